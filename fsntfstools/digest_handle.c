@@ -0,0 +1,1965 @@
+/*
+ * Digest (hash) calculation handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "digest_handle.h"
+#include "digest_hash.h"
+#include "fsntfstools_libcerror.h"
+#include "fsntfstools_libcnotify.h"
+#include "fsntfstools_libcthreads.h"
+#include "fsntfstools_libhmac.h"
+
+/* Creates a digest handle
+ * Make sure the value digest_handle is referencing, is set to NULL
+ * When multi-threading is supported a hashing thread is started for every
+ * digest type, which allows the caller to fill the next buffer while the
+ * previous one is being hashed
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_initialize(
+     digest_handle_t **digest_handle,
+     uint8_t digest_types,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_initialize";
+	int buffer_index      = 0;
+	int digest_type_index = 0;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_types == 0 )
+	 || ( ( digest_types & ~( DIGEST_HANDLE_DIGEST_TYPE_ALL ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest types.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_handle = memory_allocate_structure(
+	                  digest_handle_t );
+
+	if( *digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_handle,
+	     0,
+	     sizeof( digest_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest handle.",
+		 function );
+
+		memory_free(
+		 *digest_handle );
+
+		*digest_handle = NULL;
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < DIGEST_HANDLE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		( *digest_handle )->buffers[ buffer_index ] = (uint8_t *) memory_allocate(
+		                                                           sizeof( uint8_t ) * DIGEST_HANDLE_BUFFER_SIZE );
+
+		if( ( *digest_handle )->buffers[ buffer_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	( *digest_handle )->zero_buffer = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * DIGEST_HANDLE_BUFFER_SIZE );
+
+	if( ( *digest_handle )->zero_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create zero buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *digest_handle )->zero_buffer,
+	     0,
+	     sizeof( uint8_t ) * DIGEST_HANDLE_BUFFER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear zero buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( digest_type_index = 0;
+	     digest_type_index < DIGEST_HANDLE_NUMBER_OF_DIGEST_TYPES;
+	     digest_type_index++ )
+	{
+		if( ( digest_types & ( 1 << digest_type_index ) ) != 0 )
+		{
+			( *digest_handle )->workers[ ( *digest_handle )->number_of_workers ].digest_handle     = *digest_handle;
+			( *digest_handle )->workers[ ( *digest_handle )->number_of_workers ].digest_type_index = digest_type_index;
+
+			( *digest_handle )->number_of_workers += 1;
+		}
+	}
+	( *digest_handle )->digest_types = digest_types;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *digest_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *digest_handle )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( digest_handle_start_workers(
+	     *digest_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start workers.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( *digest_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *digest_handle )->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *digest_handle )->condition ),
+			 NULL );
+		}
+		if( ( *digest_handle )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *digest_handle )->mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *digest_handle )->zero_buffer != NULL )
+		{
+			memory_free(
+			 ( *digest_handle )->zero_buffer );
+		}
+		for( buffer_index = 0;
+		     buffer_index < DIGEST_HANDLE_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( ( *digest_handle )->buffers[ buffer_index ] != NULL )
+			{
+				memory_free(
+				 ( *digest_handle )->buffers[ buffer_index ] );
+			}
+		}
+		memory_free(
+		 *digest_handle );
+
+		*digest_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a digest handle
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_free(
+     digest_handle_t **digest_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( digest_handle_stop_workers(
+		     *digest_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to stop workers.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( ( *digest_handle )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *digest_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		if( ( *digest_handle )->md5_context != NULL )
+		{
+			if( libhmac_md5_free(
+			     &( ( *digest_handle )->md5_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free MD5 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_handle )->sha1_context != NULL )
+		{
+			if( libhmac_sha1_free(
+			     &( ( *digest_handle )->sha1_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA1 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_handle )->sha256_context != NULL )
+		{
+			if( libhmac_sha256_free(
+			     &( ( *digest_handle )->sha256_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SHA256 context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *digest_handle )->zero_buffer != NULL )
+		{
+			memory_free(
+			 ( *digest_handle )->zero_buffer );
+		}
+		for( buffer_index = 0;
+		     buffer_index < DIGEST_HANDLE_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( ( *digest_handle )->buffers[ buffer_index ] != NULL )
+			{
+				memory_free(
+				 ( *digest_handle )->buffers[ buffer_index ] );
+			}
+		}
+		memory_free(
+		 *digest_handle );
+
+		*digest_handle = NULL;
+	}
+	return( result );
+}
+
+/* Starts the calculation of a new set of digests
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_start(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_start";
+	int worker_index      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int buffer_index      = 0;
+#endif
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Make sure the workers are no longer using the digest contexts
+	 */
+	for( buffer_index = 0;
+	     buffer_index < DIGEST_HANDLE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( digest_handle_wait_for_buffer(
+		     digest_handle,
+		     buffer_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( digest_handle->md5_context != NULL )
+	{
+		if( libhmac_md5_free(
+		     &( digest_handle->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free MD5 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_handle->sha1_context != NULL )
+	{
+		if( libhmac_sha1_free(
+		     &( digest_handle->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA1 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_handle->sha256_context != NULL )
+	{
+		if( libhmac_sha256_free(
+		     &( digest_handle->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA256 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_MD5 ) != 0 )
+	{
+		if( libhmac_md5_initialize(
+		     &( digest_handle->md5_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize MD5 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA1 ) != 0 )
+	{
+		if( libhmac_sha1_initialize(
+		     &( digest_handle->sha1_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA1 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA256 ) != 0 )
+	{
+		if( libhmac_sha256_initialize(
+		     &( digest_handle->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA256 context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < digest_handle->number_of_workers;
+	     worker_index++ )
+	{
+		digest_handle->workers[ worker_index ].has_failed = 0;
+	}
+	digest_handle->is_finalized = 0;
+
+	return( 1 );
+}
+
+/* Updates a specific digest
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_update_digest(
+     digest_handle_t *digest_handle,
+     int digest_type_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_update_digest";
+	int result            = 0;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type_index )
+	{
+		case 0:
+			result = libhmac_md5_update(
+			          digest_handle->md5_context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		case 1:
+			result = libhmac_sha1_update(
+			          digest_handle->sha1_context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		case 2:
+			result = libhmac_sha256_update(
+			          digest_handle->sha256_context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type index: %d.",
+			 function,
+			 digest_type_index );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update digest: %d.",
+		 function,
+		 digest_type_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The worker callback function
+ * Every worker hashes the submitted buffers, in order, for its own digest type
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_worker_callback_function(
+     digest_handle_worker_t *digest_handle_worker )
+{
+	digest_handle_t *digest_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	uint8_t *buffer                = NULL;
+	static char *function          = "digest_handle_worker_callback_function";
+	size_t buffer_data_size        = 0;
+	int buffer_index               = 0;
+
+	if( digest_handle_worker == NULL )
+	{
+		return( -1 );
+	}
+	digest_handle = digest_handle_worker->digest_handle;
+
+	if( digest_handle == NULL )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     digest_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		while( ( digest_handle->number_of_submitted_buffers == digest_handle_worker->number_of_processed_buffers )
+		    && ( digest_handle->stop_workers == 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     digest_handle->condition,
+			     digest_handle->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 digest_handle->mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		if( digest_handle->number_of_submitted_buffers == digest_handle_worker->number_of_processed_buffers )
+		{
+			libcthreads_mutex_release(
+			 digest_handle->mutex,
+			 NULL );
+
+			break;
+		}
+		buffer_index     = (int) ( digest_handle_worker->number_of_processed_buffers % DIGEST_HANDLE_NUMBER_OF_BUFFERS );
+		buffer           = digest_handle->buffers[ buffer_index ];
+		buffer_data_size = digest_handle->buffer_data_sizes[ buffer_index ];
+
+		if( digest_handle->buffer_is_sparse[ buffer_index ] != 0 )
+		{
+			buffer = digest_handle->zero_buffer;
+		}
+
+		if( libcthreads_mutex_release(
+		     digest_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* After a failure the remaining buffers are still consumed so that the reader is not blocked
+		 */
+		if( digest_handle_worker->has_failed == 0 )
+		{
+			if( digest_handle_update_digest(
+			     digest_handle,
+			     digest_handle_worker->digest_type_index,
+			     buffer,
+			     buffer_data_size,
+			     &error ) != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+#endif
+				libcerror_error_free(
+				 &error );
+
+				digest_handle_worker->has_failed = 1;
+			}
+		}
+		if( libcthreads_mutex_grab(
+		     digest_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		digest_handle_worker->number_of_processed_buffers += 1;
+
+		digest_handle->number_of_pending_workers[ buffer_index ] -= 1;
+
+		if( digest_handle->number_of_pending_workers[ buffer_index ] == 0 )
+		{
+			if( libcthreads_condition_broadcast(
+			     digest_handle->condition,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 digest_handle->mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     digest_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Starts the workers
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_start_workers(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_start_workers";
+	int worker_index      = 0;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	digest_handle->stop_workers = 0;
+
+	for( worker_index = 0;
+	     worker_index < digest_handle->number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( digest_handle->workers[ worker_index ].thread ),
+		     NULL,
+		     (int (*)(void *)) &digest_handle_worker_callback_function,
+		     (void *) &( digest_handle->workers[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	digest_handle_stop_workers(
+	 digest_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Stops the workers
+ * The workers first process the buffers that were already submitted
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_stop_workers(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_stop_workers";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	digest_handle->stop_workers = 1;
+
+	if( libcthreads_condition_broadcast(
+	     digest_handle->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < digest_handle->number_of_workers;
+	     worker_index++ )
+	{
+		if( digest_handle->workers[ worker_index ].thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( digest_handle->workers[ worker_index ].thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join worker thread: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+	}
+	return( result );
+}
+
+/* Waits until the workers have processed a specific buffer
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_wait_for_buffer(
+     digest_handle_t *digest_handle,
+     int buffer_index,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_wait_for_buffer";
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_index < 0 )
+	 || ( buffer_index >= DIGEST_HANDLE_NUMBER_OF_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( digest_handle->number_of_pending_workers[ buffer_index ] > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     digest_handle->condition,
+		     digest_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 digest_handle->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the next buffer to fill
+ * The buffer remains owned by the digest handle and must be passed back
+ * using digest_handle_submit_buffer before the next buffer is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_get_buffer(
+     digest_handle_t *digest_handle,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_get_buffer";
+	int buffer_index      = 0;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_index = (int) ( digest_handle->number_of_submitted_buffers % DIGEST_HANDLE_NUMBER_OF_BUFFERS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( digest_handle_wait_for_buffer(
+	     digest_handle,
+	     buffer_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to wait for buffer: %d.",
+		 function,
+		 buffer_index );
+
+		return( -1 );
+	}
+#endif
+	digest_handle->buffer_is_sparse[ buffer_index ] = 0;
+
+	*buffer      = digest_handle->buffers[ buffer_index ];
+	*buffer_size = DIGEST_HANDLE_BUFFER_SIZE;
+
+	return( 1 );
+}
+
+/* Submits the buffer retrieved by digest_handle_get_buffer for hashing
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_submit_buffer(
+     digest_handle_t *digest_handle,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_submit_buffer";
+	int buffer_index      = 0;
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	uint8_t *buffer       = NULL;
+	int worker_index      = 0;
+#endif
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_handle->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest handle - digests already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) DIGEST_HANDLE_BUFFER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	buffer_index = (int) ( digest_handle->number_of_submitted_buffers % DIGEST_HANDLE_NUMBER_OF_BUFFERS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	digest_handle->buffer_data_sizes[ buffer_index ]         = data_size;
+	digest_handle->number_of_pending_workers[ buffer_index ] = digest_handle->number_of_workers;
+	digest_handle->number_of_submitted_buffers              += 1;
+
+	if( libcthreads_condition_broadcast(
+	     digest_handle->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 digest_handle->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     digest_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	buffer = digest_handle->buffers[ buffer_index ];
+
+	if( digest_handle->buffer_is_sparse[ buffer_index ] != 0 )
+	{
+		buffer = digest_handle->zero_buffer;
+	}
+	for( worker_index = 0;
+	     worker_index < digest_handle->number_of_workers;
+	     worker_index++ )
+	{
+		if( digest_handle_update_digest(
+		     digest_handle,
+		     digest_handle->workers[ worker_index ].digest_type_index,
+		     buffer,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	digest_handle->buffer_data_sizes[ buffer_index ] = data_size;
+	digest_handle->number_of_submitted_buffers      += 1;
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+}
+
+/* Updates the digests with data
+ * The data is copied into the buffers of the digest handle
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_update(
+     digest_handle_t *digest_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "digest_handle_update";
+	size_t buffer_size    = 0;
+	size_t data_offset    = 0;
+	size_t copy_size      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		if( digest_handle_get_buffer(
+		     digest_handle,
+		     &buffer,
+		     &buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve buffer.",
+			 function );
+
+			return( -1 );
+		}
+		copy_size = data_size - data_offset;
+
+		if( copy_size > buffer_size )
+		{
+			copy_size = buffer_size;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( data[ data_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_handle_submit_buffer(
+		     digest_handle,
+		     copy_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to submit buffer.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += copy_size;
+	}
+	return( 1 );
+}
+
+/* Updates the digests with sparse data, which consists of 0-byte values
+ * The data is hashed from the zero buffer of the digest handle, which
+ * removes the need for the caller to read or fill a buffer with 0-byte values
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_update_sparse(
+     digest_handle_t *digest_handle,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "digest_handle_update_sparse";
+	size_t buffer_size    = 0;
+	size_t submit_size    = 0;
+	int buffer_index      = 0;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_size > 0 )
+	{
+		if( digest_handle_get_buffer(
+		     digest_handle,
+		     &buffer,
+		     &buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve buffer.",
+			 function );
+
+			return( -1 );
+		}
+		submit_size = buffer_size;
+
+		if( (size64_t) submit_size > data_size )
+		{
+			submit_size = (size_t) data_size;
+		}
+		buffer_index = (int) ( digest_handle->number_of_submitted_buffers % DIGEST_HANDLE_NUMBER_OF_BUFFERS );
+
+		digest_handle->buffer_is_sparse[ buffer_index ] = 1;
+
+		if( digest_handle_submit_buffer(
+		     digest_handle,
+		     submit_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to submit buffer.",
+			 function );
+
+			return( -1 );
+		}
+		data_size -= submit_size;
+	}
+	return( 1 );
+}
+
+/* Finalizes the digests
+ * Waits until all submitted buffers have been hashed
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_finalize(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_finalize";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int buffer_index      = 0;
+	int worker_index      = 0;
+#endif
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_handle->is_finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest handle - digests already finalized.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( buffer_index = 0;
+	     buffer_index < DIGEST_HANDLE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( digest_handle_wait_for_buffer(
+		     digest_handle,
+		     buffer_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < digest_handle->number_of_workers;
+	     worker_index++ )
+	{
+		if( digest_handle->workers[ worker_index ].has_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest: %d.",
+			 function,
+			 digest_handle->workers[ worker_index ].digest_type_index );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( digest_handle->md5_context != NULL )
+	{
+		if( libhmac_md5_finalize(
+		     digest_handle->md5_context,
+		     digest_handle->md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_handle->sha1_context != NULL )
+	{
+		if( libhmac_sha1_finalize(
+		     digest_handle->sha1_context,
+		     digest_handle->sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( digest_handle->sha256_context != NULL )
+	{
+		if( libhmac_sha256_finalize(
+		     digest_handle->sha256_context,
+		     digest_handle->sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	digest_handle->is_finalized = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the finalized digest hashes
+ * The hashes are stored consecutively as MD5, SHA1 and SHA256, hashes of
+ * digest types that are not calculated are set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_get_hashes(
+     digest_handle_t *digest_handle,
+     uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_get_hashes";
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_handle->is_finalized == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid digest handle - digests not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes_size < DIGEST_HANDLE_HASHES_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hashes size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hashes,
+	     0,
+	     DIGEST_HANDLE_HASHES_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_MD5 ) != 0 )
+	{
+		if( memory_copy(
+		     hashes,
+		     digest_handle->md5_hash,
+		     LIBHMAC_MD5_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy MD5 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hashes += LIBHMAC_MD5_HASH_SIZE;
+
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA1 ) != 0 )
+	{
+		if( memory_copy(
+		     hashes,
+		     digest_handle->sha1_hash,
+		     LIBHMAC_SHA1_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA1 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hashes += LIBHMAC_SHA1_HASH_SIZE;
+
+	if( ( digest_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA256 ) != 0 )
+	{
+		if( memory_copy(
+		     hashes,
+		     digest_handle->sha256_hash,
+		     LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the digest hashes as if they were calculated and finalized
+ * This allows previously retrieved hashes to be reused without hashing
+ * the same data again, the hashes are stored as by digest_handle_get_hashes
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_set_hashes(
+     digest_handle_t *digest_handle,
+     const uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_set_hashes";
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes_size < DIGEST_HANDLE_HASHES_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hashes size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     digest_handle->md5_hash,
+	     hashes,
+	     LIBHMAC_MD5_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy MD5 hash.",
+		 function );
+
+		return( -1 );
+	}
+	hashes += LIBHMAC_MD5_HASH_SIZE;
+
+	if( memory_copy(
+	     digest_handle->sha1_hash,
+	     hashes,
+	     LIBHMAC_SHA1_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy SHA1 hash.",
+		 function );
+
+		return( -1 );
+	}
+	hashes += LIBHMAC_SHA1_HASH_SIZE;
+
+	if( memory_copy(
+	     digest_handle->sha256_hash,
+	     hashes,
+	     LIBHMAC_SHA256_HASH_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy SHA256 hash.",
+		 function );
+
+		return( -1 );
+	}
+	digest_handle->is_finalized = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the string of a finalized digest
+ * Returns 1 if successful or -1 on error
+ */
+int digest_handle_get_string(
+     digest_handle_t *digest_handle,
+     uint8_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *digest_hash    = NULL;
+	static char *function   = "digest_handle_get_string";
+	size_t digest_hash_size = 0;
+
+	if( digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_handle->is_finalized == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid digest handle - digests not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( digest_handle->digest_types & digest_type ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported digest type.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case DIGEST_HANDLE_DIGEST_TYPE_MD5:
+			digest_hash      = digest_handle->md5_hash;
+			digest_hash_size = LIBHMAC_MD5_HASH_SIZE;
+			break;
+
+		case DIGEST_HANDLE_DIGEST_TYPE_SHA1:
+			digest_hash      = digest_handle->sha1_hash;
+			digest_hash_size = LIBHMAC_SHA1_HASH_SIZE;
+			break;
+
+		case DIGEST_HANDLE_DIGEST_TYPE_SHA256:
+			digest_hash      = digest_handle->sha256_hash;
+			digest_hash_size = LIBHMAC_SHA256_HASH_SIZE;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type.",
+			 function );
+
+			return( -1 );
+	}
+	if( digest_hash_copy_to_string(
+	     digest_hash,
+	     digest_hash_size,
+	     string,
+	     string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set digest hash string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the digest types from a string
+ * The string contains comma separated digest type names, for example "md5,sha256"
+ * The digest types are added to the digest types that are already set
+ * Returns 1 if successful, 0 if unsupported or -1 on error
+ */
+int digest_handle_get_digest_types_from_string(
+     const system_character_t *string,
+     uint8_t *digest_types,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_handle_get_digest_types_from_string";
+	size_t segment_length = 0;
+	size_t segment_start  = 0;
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint8_t safe_types    = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest types.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != (system_character_t) ',' ) )
+		{
+			continue;
+		}
+		segment_length = string_index - segment_start;
+
+		if( ( segment_length == 3 )
+		 && ( system_string_compare_no_case(
+		       &( string[ segment_start ] ),
+		       _SYSTEM_STRING( "md5" ),
+		       3 ) == 0 ) )
+		{
+			safe_types |= DIGEST_HANDLE_DIGEST_TYPE_MD5;
+		}
+		else if( ( segment_length == 4 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "sha1" ),
+		            4 ) == 0 ) )
+		{
+			safe_types |= DIGEST_HANDLE_DIGEST_TYPE_SHA1;
+		}
+		else if( ( segment_length == 6 )
+		      && ( system_string_compare_no_case(
+		            &( string[ segment_start ] ),
+		            _SYSTEM_STRING( "sha256" ),
+		            6 ) == 0 ) )
+		{
+			safe_types |= DIGEST_HANDLE_DIGEST_TYPE_SHA256;
+		}
+		else
+		{
+			return( 0 );
+		}
+		segment_start = string_index + 1;
+	}
+	*digest_types |= safe_types;
+
+	return( 1 );
+}
+
@@ -0,0 +1,273 @@
+/*
+ * Digest (hash) calculation handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIGEST_HANDLE_H )
+#define _DIGEST_HANDLE_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "fsntfstools_libcerror.h"
+#include "fsntfstools_libcthreads.h"
+#include "fsntfstools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a single buffer of the digest handle
+ */
+#define DIGEST_HANDLE_BUFFER_SIZE		( 1024 * 1024 )
+
+/* The number of buffers of the digest handle, 2 allows the reader to fill
+ * one buffer while the other is being hashed
+ */
+#define DIGEST_HANDLE_NUMBER_OF_BUFFERS		2
+
+/* The maximum number of digest types
+ */
+#define DIGEST_HANDLE_NUMBER_OF_DIGEST_TYPES	3
+
+enum DIGEST_HANDLE_DIGEST_TYPES
+{
+	DIGEST_HANDLE_DIGEST_TYPE_MD5		= 0x01,
+	DIGEST_HANDLE_DIGEST_TYPE_SHA1		= 0x02,
+	DIGEST_HANDLE_DIGEST_TYPE_SHA256	= 0x04,
+
+	DIGEST_HANDLE_DIGEST_TYPE_ALL		= 0x07
+};
+
+#define DIGEST_HANDLE_STRING_SIZE_MD5		33
+#define DIGEST_HANDLE_STRING_SIZE_SHA1		41
+#define DIGEST_HANDLE_STRING_SIZE_SHA256	65
+
+/* The size of the digest hashes as stored by digest_handle_get_hashes
+ */
+#define DIGEST_HANDLE_HASHES_SIZE		( LIBHMAC_MD5_HASH_SIZE + LIBHMAC_SHA1_HASH_SIZE + LIBHMAC_SHA256_HASH_SIZE )
+
+typedef struct digest_handle digest_handle_t;
+
+typedef struct digest_handle_worker digest_handle_worker_t;
+
+struct digest_handle_worker
+{
+	/* The digest handle
+	 */
+	digest_handle_t *digest_handle;
+
+	/* The digest type index
+	 */
+	int digest_type_index;
+
+	/* The number of buffers processed by the worker
+	 */
+	uint64_t number_of_processed_buffers;
+
+	/* Value to indicate the worker failed to update the digest
+	 */
+	uint8_t has_failed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct digest_handle
+{
+	/* The digest types
+	 */
+	uint8_t digest_types;
+
+	/* The MD5 context
+	 */
+	libhmac_md5_context_t *md5_context;
+
+	/* The MD5 hash
+	 */
+	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
+
+	/* The SHA1 context
+	 */
+	libhmac_sha1_context_t *sha1_context;
+
+	/* The SHA1 hash
+	 */
+	uint8_t sha1_hash[ LIBHMAC_SHA1_HASH_SIZE ];
+
+	/* The SHA256 context
+	 */
+	libhmac_sha256_context_t *sha256_context;
+
+	/* The SHA256 hash
+	 */
+	uint8_t sha256_hash[ LIBHMAC_SHA256_HASH_SIZE ];
+
+	/* Value to indicate the hashes were finalized
+	 */
+	uint8_t is_finalized;
+
+	/* The buffers
+	 */
+	uint8_t *buffers[ DIGEST_HANDLE_NUMBER_OF_BUFFERS ];
+
+	/* The data sizes of the buffers
+	 */
+	size_t buffer_data_sizes[ DIGEST_HANDLE_NUMBER_OF_BUFFERS ];
+
+	/* Values to indicate the buffers represent sparse data
+	 * The data of a sparse buffer is read from the zero buffer
+	 */
+	uint8_t buffer_is_sparse[ DIGEST_HANDLE_NUMBER_OF_BUFFERS ];
+
+	/* The zero buffer, which is shared by all sparse buffers
+	 */
+	uint8_t *zero_buffer;
+
+	/* The number of workers that still need to process a buffer
+	 */
+	int number_of_pending_workers[ DIGEST_HANDLE_NUMBER_OF_BUFFERS ];
+
+	/* The number of buffers submitted
+	 */
+	uint64_t number_of_submitted_buffers;
+
+	/* The workers, one for every digest type
+	 */
+	digest_handle_worker_t workers[ DIGEST_HANDLE_NUMBER_OF_DIGEST_TYPES ];
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the buffer state
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals a change of the buffer state
+	 */
+	libcthreads_condition_t *condition;
+
+	/* Value to indicate the workers should stop
+	 */
+	uint8_t stop_workers;
+#endif
+};
+
+int digest_handle_initialize(
+     digest_handle_t **digest_handle,
+     uint8_t digest_types,
+     libcerror_error_t **error );
+
+int digest_handle_free(
+     digest_handle_t **digest_handle,
+     libcerror_error_t **error );
+
+int digest_handle_start(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error );
+
+int digest_handle_update_digest(
+     digest_handle_t *digest_handle,
+     int digest_type_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int digest_handle_worker_callback_function(
+     digest_handle_worker_t *digest_handle_worker );
+
+int digest_handle_start_workers(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error );
+
+int digest_handle_stop_workers(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error );
+
+int digest_handle_wait_for_buffer(
+     digest_handle_t *digest_handle,
+     int buffer_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int digest_handle_get_buffer(
+     digest_handle_t *digest_handle,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+int digest_handle_submit_buffer(
+     digest_handle_t *digest_handle,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int digest_handle_update(
+     digest_handle_t *digest_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int digest_handle_update_sparse(
+     digest_handle_t *digest_handle,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int digest_handle_finalize(
+     digest_handle_t *digest_handle,
+     libcerror_error_t **error );
+
+int digest_handle_get_hashes(
+     digest_handle_t *digest_handle,
+     uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error );
+
+int digest_handle_set_hashes(
+     digest_handle_t *digest_handle,
+     const uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error );
+
+int digest_handle_get_string(
+     digest_handle_t *digest_handle,
+     uint8_t digest_type,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int digest_handle_get_digest_types_from_string(
+     const system_character_t *string,
+     uint8_t *digest_types,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIGEST_HANDLE_H ) */
+
@@ -0,0 +1,792 @@
+/*
+ * Digest memo
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "digest_handle.h"
+#include "digest_memo.h"
+#include "fsntfstools_libcerror.h"
+
+/* Determines the table index of a file reference and data stream name hash
+ */
+#define digest_memo_get_table_index( file_reference, name_hash, maximum_number_of_entries ) \
+	( ( (uint32_t) ( ( file_reference ) ^ ( ( file_reference ) >> 32 ) ^ ( name_hash ) ) * (uint32_t) 2654435761UL ) & ( ( maximum_number_of_entries ) - 1 ) )
+
+/* Creates a digest memo
+ * Make sure the value digest_memo is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int digest_memo_initialize(
+     digest_memo_t **digest_memo,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_memo_initialize";
+
+	if( digest_memo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest memo.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_memo != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid digest memo value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*digest_memo = memory_allocate_structure(
+	                digest_memo_t );
+
+	if( *digest_memo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create digest memo.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *digest_memo,
+	     0,
+	     sizeof( digest_memo_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear digest memo.",
+		 function );
+
+		memory_free(
+		 *digest_memo );
+
+		*digest_memo = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *digest_memo != NULL )
+	{
+		memory_free(
+		 *digest_memo );
+
+		*digest_memo = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a digest memo
+ * Returns 1 if successful or -1 on error
+ */
+int digest_memo_free(
+     digest_memo_t **digest_memo,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_memo_free";
+	uint32_t entry_index  = 0;
+
+	if( digest_memo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest memo.",
+		 function );
+
+		return( -1 );
+	}
+	if( *digest_memo != NULL )
+	{
+		if( ( *digest_memo )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *digest_memo )->maximum_number_of_entries;
+			     entry_index++ )
+			{
+				if( ( *digest_memo )->entries[ entry_index ].data_stream_name != NULL )
+				{
+					memory_free(
+					 ( *digest_memo )->entries[ entry_index ].data_stream_name );
+				}
+			}
+			memory_free(
+			 ( *digest_memo )->entries );
+		}
+		if( ( *digest_memo )->last_entry.data_stream_name != NULL )
+		{
+			memory_free(
+			 ( *digest_memo )->last_entry.data_stream_name );
+		}
+		memory_free(
+		 *digest_memo );
+
+		*digest_memo = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of a data stream name
+ * Returns 1 if successful or -1 on error
+ */
+int digest_memo_get_name_hash(
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_memo_get_name_hash";
+	size_t name_index     = 0;
+	uint32_t safe_hash    = 0;
+
+	if( ( data_stream_name == NULL )
+	 && ( data_stream_name_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream name.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream_name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data stream name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* The default data stream has no name and a hash of 0
+	 */
+	if( data_stream_name_length > 0 )
+	{
+		safe_hash = (uint32_t) 2166136261UL;
+
+		for( name_index = 0;
+		     name_index < data_stream_name_length;
+		     name_index++ )
+		{
+			safe_hash ^= (uint32_t) data_stream_name[ name_index ];
+			safe_hash *= (uint32_t) 16777619UL;
+		}
+	}
+	*name_hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Sets a digest memo entry
+ * The entry holds its own copy of the data stream name
+ * Returns 1 if successful or -1 on error
+ */
+int digest_memo_entry_set(
+     digest_memo_entry_t *digest_memo_entry,
+     uint64_t file_reference,
+     uint32_t data_stream_name_hash,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
+     const uint8_t *hashes,
+     libcerror_error_t **error )
+{
+	system_character_t *name_copy = NULL;
+	static char *function         = "digest_memo_entry_set";
+
+	if( digest_memo_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest memo entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_stream_name == NULL )
+	 && ( data_stream_name_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream name.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream_name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data stream name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream_name_length > 0 )
+	{
+		name_copy = (system_character_t *) memory_allocate(
+		                                    sizeof( system_character_t ) * data_stream_name_length );
+
+		if( name_copy == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data stream name.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     name_copy,
+		     data_stream_name,
+		     sizeof( system_character_t ) * data_stream_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data stream name.",
+			 function );
+
+			memory_free(
+			 name_copy );
+
+			return( -1 );
+		}
+	}
+	if( memory_copy(
+	     digest_memo_entry->hashes,
+	     hashes,
+	     DIGEST_HANDLE_HASHES_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hashes.",
+		 function );
+
+		if( name_copy != NULL )
+		{
+			memory_free(
+			 name_copy );
+		}
+		return( -1 );
+	}
+	if( digest_memo_entry->data_stream_name != NULL )
+	{
+		memory_free(
+		 digest_memo_entry->data_stream_name );
+	}
+	digest_memo_entry->file_reference          = file_reference;
+	digest_memo_entry->data_stream_name_hash   = data_stream_name_hash;
+	digest_memo_entry->data_stream_name        = name_copy;
+	digest_memo_entry->data_stream_name_length = data_stream_name_length;
+	digest_memo_entry->is_set                  = 1;
+
+	return( 1 );
+}
+
+/* Compares a digest memo entry with a file reference and data stream name
+ * Returns 1 if equal or 0 if not
+ */
+int digest_memo_entry_compare(
+     digest_memo_entry_t *digest_memo_entry,
+     uint64_t file_reference,
+     uint32_t data_stream_name_hash,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length )
+{
+	if( digest_memo_entry == NULL )
+	{
+		return( 0 );
+	}
+	if( ( digest_memo_entry->is_set == 0 )
+	 || ( digest_memo_entry->file_reference != file_reference )
+	 || ( digest_memo_entry->data_stream_name_hash != data_stream_name_hash )
+	 || ( digest_memo_entry->data_stream_name_length != data_stream_name_length ) )
+	{
+		return( 0 );
+	}
+	if( data_stream_name_length == 0 )
+	{
+		return( 1 );
+	}
+	if( ( data_stream_name == NULL )
+	 || ( digest_memo_entry->data_stream_name == NULL ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     digest_memo_entry->data_stream_name,
+	     data_stream_name,
+	     sizeof( system_character_t ) * data_stream_name_length ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the hashes of a specific file reference and data stream name
+ * The data stream name is NULL for the default data stream
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int digest_memo_get_hashes(
+     digest_memo_t *digest_memo,
+     uint64_t file_reference,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
+     uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error )
+{
+	digest_memo_entry_t *entry = NULL;
+	static char *function      = "digest_memo_get_hashes";
+	uint32_t name_hash         = 0;
+	uint32_t table_index       = 0;
+
+	if( digest_memo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest memo.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes_size < DIGEST_HANDLE_HASHES_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hashes size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_memo_get_name_hash(
+	     data_stream_name,
+	     data_stream_name_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data stream name hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* The names of a file entry are printed consecutively
+	 * hence the most recently set entry is checked first
+	 */
+	if( digest_memo_entry_compare(
+	     &( digest_memo->last_entry ),
+	     file_reference,
+	     name_hash,
+	     data_stream_name,
+	     data_stream_name_length ) != 0 )
+	{
+		entry = &( digest_memo->last_entry );
+	}
+	else if( digest_memo->number_of_entries > 0 )
+	{
+		table_index = digest_memo_get_table_index(
+		               file_reference,
+		               name_hash,
+		               digest_memo->maximum_number_of_entries );
+
+		while( digest_memo->entries[ table_index ].is_set != 0 )
+		{
+			if( digest_memo_entry_compare(
+			     &( digest_memo->entries[ table_index ] ),
+			     file_reference,
+			     name_hash,
+			     data_stream_name,
+			     data_stream_name_length ) != 0 )
+			{
+				entry = &( digest_memo->entries[ table_index ] );
+
+				break;
+			}
+			table_index = ( table_index + 1 ) & ( digest_memo->maximum_number_of_entries - 1 );
+		}
+	}
+	if( entry == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     hashes,
+	     entry->hashes,
+	     DIGEST_HANDLE_HASHES_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hashes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the hashes of a specific file reference and data stream name
+ * The data stream name is NULL for the default data stream
+ * Only the hashes of shared file entries, such as those with multiple hard links,
+ * are retained in the table, other hashes only replace the most recently set entry
+ * Returns 1 if successful or -1 on error
+ */
+int digest_memo_set_hashes(
+     digest_memo_t *digest_memo,
+     uint64_t file_reference,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
+     const uint8_t *hashes,
+     size_t hashes_size,
+     uint8_t is_shared,
+     libcerror_error_t **error )
+{
+	static char *function = "digest_memo_set_hashes";
+	uint32_t name_hash    = 0;
+	uint32_t table_index  = 0;
+	uint8_t is_new_entry  = 0;
+
+	if( digest_memo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest memo.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hashes_size < DIGEST_HANDLE_HASHES_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hashes size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_memo_get_name_hash(
+	     data_stream_name,
+	     data_stream_name_length,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data stream name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_memo_entry_set(
+	     &( digest_memo->last_entry ),
+	     file_reference,
+	     name_hash,
+	     data_stream_name,
+	     data_stream_name_length,
+	     hashes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set most recently set entry.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( is_shared == 0 )
+	{
+		return( 1 );
+	}
+	/* Keep the table at most half full to keep the probe sequences short
+	 */
+	if( ( ( digest_memo->number_of_entries + 1 ) * 2 ) > digest_memo->maximum_number_of_entries )
+	{
+		if( digest_memo->maximum_number_of_entries == 0 )
+		{
+			table_index = DIGEST_MEMO_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else
+		{
+			table_index = digest_memo->maximum_number_of_entries * 2;
+		}
+		if( digest_memo_resize(
+		     digest_memo,
+		     table_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize digest memo.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	table_index = digest_memo_get_table_index(
+	               file_reference,
+	               name_hash,
+	               digest_memo->maximum_number_of_entries );
+
+	while( digest_memo->entries[ table_index ].is_set != 0 )
+	{
+		if( digest_memo_entry_compare(
+		     &( digest_memo->entries[ table_index ] ),
+		     file_reference,
+		     name_hash,
+		     data_stream_name,
+		     data_stream_name_length ) != 0 )
+		{
+			break;
+		}
+		table_index = ( table_index + 1 ) & ( digest_memo->maximum_number_of_entries - 1 );
+	}
+	is_new_entry = (uint8_t) ( digest_memo->entries[ table_index ].is_set == 0 );
+
+	if( digest_memo_entry_set(
+	     &( digest_memo->entries[ table_index ] ),
+	     file_reference,
+	     name_hash,
+	     data_stream_name,
+	     data_stream_name_length,
+	     hashes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry: %" PRIu32 ".",
+		 function,
+		 table_index );
+
+		return( -1 );
+	}
+	if( is_new_entry != 0 )
+	{
+		digest_memo->number_of_entries += 1;
+	}
+	return( 1 );
+}
+
+/* Resizes the digest memo table
+ * The maximum number of entries must be a power of 2
+ * Returns 1 if successful or -1 on error
+ */
+int digest_memo_resize(
+     digest_memo_t *digest_memo,
+     uint32_t maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	digest_memo_entry_t *entries = NULL;
+	static char *function        = "digest_memo_resize";
+	size_t entries_size          = 0;
+	uint32_t entry_index         = 0;
+	uint32_t table_index         = 0;
+
+	if( digest_memo == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest memo.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries == 0 )
+	 || ( ( maximum_number_of_entries & ( maximum_number_of_entries - 1 ) ) != 0 )
+	 || ( maximum_number_of_entries < ( digest_memo->number_of_entries * 2 ) )
+	 || ( (size_t) maximum_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( digest_memo_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries == digest_memo->maximum_number_of_entries )
+	{
+		return( 1 );
+	}
+	entries_size = sizeof( digest_memo_entry_t ) * maximum_number_of_entries;
+
+	entries = (digest_memo_entry_t *) memory_allocate(
+	                                   entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		memory_free(
+		 entries );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < digest_memo->maximum_number_of_entries;
+	     entry_index++ )
+	{
+		if( digest_memo->entries[ entry_index ].is_set == 0 )
+		{
+			continue;
+		}
+		table_index = digest_memo_get_table_index(
+		               digest_memo->entries[ entry_index ].file_reference,
+		               digest_memo->entries[ entry_index ].data_stream_name_hash,
+		               maximum_number_of_entries );
+
+		while( entries[ table_index ].is_set != 0 )
+		{
+			table_index = ( table_index + 1 ) & ( maximum_number_of_entries - 1 );
+		}
+		entries[ table_index ] = digest_memo->entries[ entry_index ];
+	}
+	if( digest_memo->entries != NULL )
+	{
+		memory_free(
+		 digest_memo->entries );
+	}
+	digest_memo->entries                   = entries;
+	digest_memo->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+}
+
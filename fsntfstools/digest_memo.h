@@ -0,0 +1,149 @@
+/*
+ * Digest memo
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIGEST_MEMO_H )
+#define _DIGEST_MEMO_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "digest_handle.h"
+#include "fsntfstools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of entries of the digest memo table, must be a power of 2
+ */
+#define DIGEST_MEMO_INITIAL_NUMBER_OF_ENTRIES	1024
+
+typedef struct digest_memo_entry digest_memo_entry_t;
+
+struct digest_memo_entry
+{
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The hash of the data stream name
+	 */
+	uint32_t data_stream_name_hash;
+
+	/* The data stream name, which is NULL for the default data stream
+	 */
+	system_character_t *data_stream_name;
+
+	/* The data stream name length
+	 */
+	size_t data_stream_name_length;
+
+	/* The hashes
+	 */
+	uint8_t hashes[ DIGEST_HANDLE_HASHES_SIZE ];
+
+	/* Value to indicate the entry is set
+	 */
+	uint8_t is_set;
+};
+
+typedef struct digest_memo digest_memo_t;
+
+struct digest_memo
+{
+	/* The most recently set entry
+	 */
+	digest_memo_entry_t last_entry;
+
+	/* The entries table
+	 */
+	digest_memo_entry_t *entries;
+
+	/* The number of entries in the table
+	 */
+	uint32_t number_of_entries;
+
+	/* The maximum number of entries in the table
+	 */
+	uint32_t maximum_number_of_entries;
+};
+
+int digest_memo_initialize(
+     digest_memo_t **digest_memo,
+     libcerror_error_t **error );
+
+int digest_memo_free(
+     digest_memo_t **digest_memo,
+     libcerror_error_t **error );
+
+int digest_memo_get_name_hash(
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int digest_memo_entry_set(
+     digest_memo_entry_t *digest_memo_entry,
+     uint64_t file_reference,
+     uint32_t data_stream_name_hash,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
+     const uint8_t *hashes,
+     libcerror_error_t **error );
+
+int digest_memo_entry_compare(
+     digest_memo_entry_t *digest_memo_entry,
+     uint64_t file_reference,
+     uint32_t data_stream_name_hash,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length );
+
+int digest_memo_get_hashes(
+     digest_memo_t *digest_memo,
+     uint64_t file_reference,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
+     uint8_t *hashes,
+     size_t hashes_size,
+     libcerror_error_t **error );
+
+int digest_memo_set_hashes(
+     digest_memo_t *digest_memo,
+     uint64_t file_reference,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
+     const uint8_t *hashes,
+     size_t hashes_size,
+     uint8_t is_shared,
+     libcerror_error_t **error );
+
+int digest_memo_resize(
+     digest_memo_t *digest_memo,
+     uint32_t maximum_number_of_entries,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIGEST_MEMO_H ) */
+
@@ -40,6 +40,7 @@
 #include <unistd.h>
 #endif
 
+#include "digest_handle.h"
 #include "fsntfstools_getopt.h"
 #include "fsntfstools_libcerror.h"
 #include "fsntfstools_libclocale.h"
@@ -56,7 +57,8 @@ enum FSNTFSINFO_MODES
 	FSNTFSINFO_MODE_FILE_SYSTEM_HIERARCHY,
 	FSNTFSINFO_MODE_MFT_ENTRY,
 	FSNTFSINFO_MODE_USN_CHANGE_JOURNAL,
-	FSNTFSINFO_MODE_VOLUME
+	FSNTFSINFO_MODE_VOLUME,
+	FSNTFSINFO_MODE_VOLUME_DIGESTS
 };
 
 info_handle_t *fsntfsinfo_info_handle = NULL;
@@ -120,11 +122,14 @@ int main( int argc, char * const argv[] )
 	fsntfstools_option_t options[ ] = {
 		{ 'B', "bodyfile", "output file system information as a bodyfile" },
 		{ 'd', NULL, "calculate a MD5 hash of a file entry to include in the bodyfile" },
+		{ 'D', "digest_types", "calculate digest (hash) types of a file entry to include in the bodyfile or of the volume, options: md5, sha1, sha256, multiple types can be separated by a comma" },
 		{ 'E', "mft_entry_index", "show information about a specific MFT entry index or \"all\"" },
 		{ 'F', "path", "show information about a specific file entry path" },
 		{ 'h', NULL, "shows this help" },
 		{ 'H', NULL, "shows the file system hierarchy" },
+		{ 'j', "number_of_jobs", "specify the number of jobs (threads) used to generate the bodyfile of all MFT entries, by default 1" },
 		{ 'o', "offset", "specify the volume offset in bytes" },
+		{ 'S', NULL, "calculate digest (hash) values of the volume data, by default MD5" },
 		{ 'U', NULL, "shows information from the USN change journal ($UsnJrnl)" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
@@ -134,15 +139,17 @@ int main( int argc, char * const argv[] )
 
 	libfsntfs_error_t *error                   = NULL;
 	system_character_t *option_bodyfile        = NULL;
+	system_character_t *option_digest_types    = NULL;
 	system_character_t *option_file_entry      = NULL;
 	system_character_t *option_mft_entry_index = NULL;
+	system_character_t *option_number_of_jobs  = NULL;
 	system_character_t *option_volume_offset   = NULL;
 	system_character_t *source                 = NULL;
 	char *program                              = "fsntfsinfo";
 	system_integer_t option                    = 0;
 	size_t string_length                       = 0;
 	uint64_t mft_entry_index                   = 0;
-	uint8_t calculate_md5                      = 0;
+	uint8_t digest_types                       = 0;
 	int option_mode                            = FSNTFSINFO_MODE_VOLUME;
 	int number_of_options                      = (int) ( sizeof( options ) / sizeof( fsntfstools_option_t ) );
 	int result                                 = 0;
@@ -224,7 +231,12 @@ int main( int argc, char * const argv[] )
 				break;
 
 			case (system_integer_t) 'd':
-				calculate_md5 = 1;
+				digest_types |= DIGEST_HANDLE_DIGEST_TYPE_MD5;
+
+				break;
+
+			case (system_integer_t) 'D':
+				option_digest_types = optarg;
 
 				break;
 
@@ -255,11 +267,21 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
 			case (system_integer_t) 'o':
 				option_volume_offset = optarg;
 
 				break;
 
+			case (system_integer_t) 'S':
+				option_mode = FSNTFSINFO_MODE_VOLUME_DIGESTS;
+
+				break;
+
 			case (system_integer_t) 'U':
 				option_mode = FSNTFSINFO_MODE_USN_CHANGE_JOURNAL;
 
@@ -302,9 +324,39 @@ int main( int argc, char * const argv[] )
 	libfsntfs_notify_set_verbose(
 	 verbose );
 
+	if( option_digest_types != NULL )
+	{
+		result = digest_handle_get_digest_types_from_string(
+		          option_digest_types,
+		          &digest_types,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine digest types.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported digest types: %" PRIs_SYSTEM ".\n",
+			 option_digest_types );
+
+			goto on_error;
+		}
+	}
+	if( ( option_mode == FSNTFSINFO_MODE_VOLUME_DIGESTS )
+	 && ( digest_types == 0 ) )
+	{
+		digest_types = DIGEST_HANDLE_DIGEST_TYPE_MD5;
+	}
 	if( info_handle_initialize(
 	     &fsntfsinfo_info_handle,
-	     calculate_md5,
+	     digest_types,
 	     &error ) != 1 )
 	{
 		fprintf(
@@ -348,6 +400,28 @@ int main( int argc, char * const argv[] )
 			 fsntfsinfo_info_handle->volume_offset );
 		}
 	}
+	if( option_number_of_jobs != NULL )
+	{
+		result = info_handle_set_number_of_jobs(
+		          fsntfsinfo_info_handle,
+		          option_number_of_jobs,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: %d.\n",
+			 fsntfsinfo_info_handle->number_of_jobs );
+		}
+	}
 /* TODO check for BDE */
 	if( info_handle_open_input(
 	     fsntfsinfo_info_handle,
@@ -496,6 +570,19 @@ int main( int argc, char * const argv[] )
 			}
 			break;
 
+		case FSNTFSINFO_MODE_VOLUME_DIGESTS:
+			if( info_handle_volume_digests_fprint(
+			     fsntfsinfo_info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print volume digests.\n" );
+
+				goto on_error;
+			}
+			break;
+
 		case FSNTFSINFO_MODE_VOLUME:
 		default:
 			if( info_handle_volume_fprint(
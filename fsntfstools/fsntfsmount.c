@@ -406,6 +406,10 @@ int main( int argc, char * const argv[] )
 	fsntfsmount_fuse_operations.readlink   = &mount_fuse_readlink;
 	fsntfsmount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+	fsntfsmount_fuse_operations.lseek      = &mount_fuse_lseek;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	fsntfsmount_fuse_handle = fuse_new(
 	                           &fsntfsmount_fuse_arguments,
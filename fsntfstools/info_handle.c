@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -27,21 +28,25 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include <stdarg.h>
+
 #include "bodyfile.h"
-#include "digest_hash.h"
+#include "digest_handle.h"
+#include "digest_memo.h"
 #include "fsntfstools_libbfio.h"
 #include "fsntfstools_libcerror.h"
 #include "fsntfstools_libclocale.h"
 #include "fsntfstools_libcnotify.h"
 #include "fsntfstools_libcpath.h"
+#include "fsntfstools_libcthreads.h"
 #include "fsntfstools_libfdatetime.h"
 #include "fsntfstools_libfguid.h"
 #include "fsntfstools_libfwnt.h"
 #include "fsntfstools_libfsntfs.h"
 #include "fsntfstools_libfusn.h"
-#include "fsntfstools_libhmac.h"
 #include "fsntfstools_libuna.h"
 #include "info_handle.h"
+#include "output_buffer.h"
 #include "path_string.h"
 
 #if !defined( LIBFSNTFS_HAVE_BFIO )
@@ -67,7 +72,6 @@ int libfsntfs_mft_metadata_file_open_file_io_handle(
 
 #endif /* !defined( LIBFSNTFS_HAVE_BFIO ) */
 
-#define DIGEST_HASH_STRING_SIZE_MD5	33
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
 /* Copies a string of a decimal value to a 64-bit value
@@ -457,7 +461,7 @@ const char *info_handle_get_attribute_type_description(
  */
 int info_handle_initialize(
      info_handle_t **info_handle,
-     uint8_t calculate_md5,
+     uint8_t digest_types,
      libcerror_error_t **error )
 {
 	static char *function = "info_handle_initialize";
@@ -530,14 +534,51 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
-	( *info_handle )->calculate_md5 = calculate_md5;
-	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	if( digest_types != 0 )
+	{
+		if( digest_handle_initialize(
+		     &( ( *info_handle )->digest_handle ),
+		     digest_types,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize digest handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( digest_memo_initialize(
+		     &( ( *info_handle )->digest_memo ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize digest memo.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *info_handle )->digest_types   = digest_types;
+	( *info_handle )->number_of_jobs = 1;
+	( *info_handle )->notify_stream  = INFO_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
 on_error:
 	if( *info_handle != NULL )
 	{
+		if( ( *info_handle )->digest_handle != NULL )
+		{
+			digest_handle_free(
+			 &( ( *info_handle )->digest_handle ),
+			 NULL );
+		}
 		if( ( *info_handle )->input_file_io_handle != NULL )
 		{
 			libbfio_handle_free(
@@ -636,6 +677,43 @@ int info_handle_free(
 
 			result = -1;
 		}
+		if( ( *info_handle )->digest_handle != NULL )
+		{
+			if( digest_handle_free(
+			     &( ( *info_handle )->digest_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->digest_memo != NULL )
+		{
+			if( digest_memo_free(
+			     &( ( *info_handle )->digest_memo ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free digest memo.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->input_filename != NULL )
+		{
+			memory_free(
+			 ( *info_handle )->input_filename );
+		}
 		memory_free(
 		 *info_handle );
 
@@ -797,6 +875,57 @@ int info_handle_set_volume_offset(
 	return( 1 );
 }
 
+/* Sets the number of jobs
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_number_of_jobs(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_number_of_jobs";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( fsntfstools_system_string_copy_decimal_to_integer_64_bit(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string of decimal to 64-bit integer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) INFO_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+	{
+		return( 0 );
+	}
+	info_handle->number_of_jobs = (int) value_64bit;
+
+	return( 1 );
+}
+
 /* Opens the input
  * Returns 1 if successful or -1 on error
  */
@@ -820,9 +949,63 @@ int info_handle_open_input(
 
 		return( -1 );
 	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->input_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - input filename value already set.",
+		 function );
+
+		return( -1 );
+	}
 	filename_length = system_string_length(
 	                   filename );
 
+	/* The input filename is retained so that the bodyfile jobs can open their own input
+	 */
+	info_handle->input_filename = system_string_allocate(
+	                               filename_length + 1 );
+
+	if( info_handle->input_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     info_handle->input_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy input filename.",
+		 function );
+
+		goto on_error;
+	}
+	info_handle->input_filename[ filename_length ] = 0;
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libbfio_file_range_set_name_wide(
 	     info_handle->input_file_io_handle,
@@ -968,6 +1151,13 @@ on_error:
 		 &( info_handle->input_volume ),
 		 NULL );
 	}
+	if( info_handle->input_filename != NULL )
+	{
+		memory_free(
+		 info_handle->input_filename );
+
+		info_handle->input_filename = NULL;
+	}
 	return( -1 );
 }
 
@@ -1026,24 +1216,35 @@ int info_handle_close_input(
 	return( 0 );
 }
 
-/* Calculates the MD5 of the contents of a file entry
+/* Calculates the digests of the contents of a file entry
+ * The contents are those of the alternate data stream if set, otherwise
+ * those of the default data stream
+ * The data is read into the buffers of the digest handle, which are hashed
+ * by the digest handle while the next buffer is being read
+ * Sparse ranges are hashed without being read
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_entry_calculate_md5(
+int info_handle_file_entry_calculate_digests(
      info_handle_t *info_handle,
      libfsntfs_file_entry_t *file_entry,
-     char *md5_string,
-     size_t md5_string_size,
+     libfsntfs_data_stream_t *alternate_data_stream,
      libcerror_error_t **error )
 {
-	uint8_t md5_hash[ LIBHMAC_MD5_HASH_SIZE ];
-	uint8_t read_buffer[ 4096 ];
-
-	libhmac_md5_context_t *md5_context = NULL;
-	static char *function              = "info_handle_file_entry_calculate_md5";
-	size64_t data_size                 = 0;
-	size_t read_size                   = 0;
-	ssize_t read_count                 = 0;
+	uint8_t *buffer         = NULL;
+	static char *function   = "info_handle_file_entry_calculate_digests";
+	size64_t data_size      = 0;
+	size64_t range_size     = 0;
+	size64_t remaining_size = 0;
+	size_t buffer_size      = 0;
+	size_t read_size        = 0;
+	ssize_t read_count      = 0;
+	off64_t current_offset  = 0;
+	off64_t range_offset    = 0;
+	off64_t seek_offset     = 0;
+	uint32_t range_flags    = 0;
+	int number_of_ranges    = 0;
+	int range_index         = 0;
+	int result              = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1056,10 +1257,32 @@ int info_handle_file_entry_calculate_md5(
 
 		return( -1 );
 	}
-	if( libfsntfs_file_entry_get_size(
-	     file_entry,
-	     &data_size,
-	     error ) != 1 )
+	if( info_handle->digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( alternate_data_stream != NULL )
+	{
+		result = libfsntfs_data_stream_get_size(
+		          alternate_data_stream,
+		          &data_size,
+		          error );
+	}
+	else
+	{
+		result = libfsntfs_file_entry_get_size(
+		          file_entry,
+		          &data_size,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1068,147 +1291,290 @@ int info_handle_file_entry_calculate_md5(
 		 "%s: unable to retrieve size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsntfs_file_entry_seek_offset(
-	     file_entry,
-	     0,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( alternate_data_stream != NULL )
+	{
+		result = libfsntfs_data_stream_get_number_of_ranges(
+		          alternate_data_stream,
+		          &number_of_ranges,
+		          error );
+	}
+	else
+	{
+		result = libfsntfs_file_entry_get_number_of_ranges(
+		          file_entry,
+		          &number_of_ranges,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset: 0 in file entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of ranges.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libhmac_md5_initialize(
-	     &md5_context,
+	if( digest_handle_start(
+	     info_handle->digest_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize MD5 context.",
+		 "%s: unable to start digest handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( data_size > 0 )
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
 	{
-		read_size = 4096;
-
-		if( (size64_t) read_size > data_size )
+		if( (size64_t) current_offset >= data_size )
 		{
-			read_size = (size_t) data_size;
+			break;
 		}
-		read_count = libfsntfs_file_entry_read_buffer(
-		              file_entry,
-		              read_buffer,
-		              read_size,
-		              error );
-
-		if( read_count != (ssize_t) read_size )
+		if( info_handle->abort != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read from file entry.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
 			 function );
 
-			goto on_error;
+			return( -1 );
+		}
+		if( alternate_data_stream != NULL )
+		{
+			result = libfsntfs_data_stream_get_range_by_index(
+			          alternate_data_stream,
+			          range_index,
+			          &range_offset,
+			          &range_size,
+			          &range_flags,
+			          error );
 		}
-		data_size -= read_size;
+		else
+		{
+			result = libfsntfs_file_entry_get_range_by_index(
+			          file_entry,
+			          range_index,
+			          &range_offset,
+			          &range_size,
+			          &range_flags,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range: %d.",
+			 function,
+			 range_index );
 
-		if( libhmac_md5_update(
-		     md5_context,
-		     read_buffer,
-		     read_size,
-		     error ) != 1 )
+			return( -1 );
+		}
+		if( range_offset != current_offset )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to update MD5 hash.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %d offset value out of bounds.",
+			 function,
+			 range_index );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	if( libhmac_md5_finalize(
-	     md5_context,
-	     md5_hash,
-	     LIBHMAC_MD5_HASH_SIZE,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to finalize MD5 hash.",
-		 function );
+		remaining_size = range_size;
 
-		goto on_error;
-	}
-	if( libhmac_md5_free(
-	     &md5_context,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free MD5 context.",
-		 function );
+		if( remaining_size > ( data_size - current_offset ) )
+		{
+			remaining_size = data_size - current_offset;
+		}
+		if( ( range_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			if( digest_handle_update_sparse(
+			     info_handle->digest_handle,
+			     remaining_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update digests with sparse data.",
+				 function );
 
-		goto on_error;
+				return( -1 );
+			}
+			current_offset += (off64_t) remaining_size;
+
+			continue;
+		}
+		if( alternate_data_stream != NULL )
+		{
+			seek_offset = libfsntfs_data_stream_seek_offset(
+			               alternate_data_stream,
+			               current_offset,
+			               SEEK_SET,
+			               error );
+		}
+		else
+		{
+			seek_offset = libfsntfs_file_entry_seek_offset(
+			               file_entry,
+			               current_offset,
+			               SEEK_SET,
+			               error );
+		}
+		if( seek_offset == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") in file entry.",
+			 function,
+			 current_offset,
+			 current_offset );
+
+			return( -1 );
+		}
+		while( remaining_size > 0 )
+		{
+			if( info_handle->abort != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
+				return( -1 );
+			}
+			if( digest_handle_get_buffer(
+			     info_handle->digest_handle,
+			     &buffer,
+			     &buffer_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve digest buffer.",
+				 function );
+
+				return( -1 );
+			}
+			read_size = buffer_size;
+
+			if( (size64_t) read_size > remaining_size )
+			{
+				read_size = (size_t) remaining_size;
+			}
+			if( alternate_data_stream != NULL )
+			{
+				read_count = libfsntfs_data_stream_read_buffer(
+				              alternate_data_stream,
+				              buffer,
+				              read_size,
+				              error );
+			}
+			else
+			{
+				read_count = libfsntfs_file_entry_read_buffer(
+				              file_entry,
+				              buffer,
+				              read_size,
+				              error );
+			}
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file entry.",
+				 function );
+
+				return( -1 );
+			}
+			if( digest_handle_submit_buffer(
+			     info_handle->digest_handle,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to submit digest buffer.",
+				 function );
+
+				return( -1 );
+			}
+			current_offset += (off64_t) read_size;
+			remaining_size -= read_size;
+		}
+	}
+	if( (size64_t) current_offset < data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing range for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 current_offset,
+		 current_offset );
+
+		return( -1 );
 	}
-	if( digest_hash_copy_to_string(
-	     md5_hash,
-	     LIBHMAC_MD5_HASH_SIZE,
-	     md5_string,
-	     md5_string_size,
+	if( digest_handle_finalize(
+	     info_handle->digest_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set MD5 hash string.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize digests.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( md5_context != NULL )
-	{
-		libhmac_md5_free(
-		 &md5_context,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Prints a file entry or data stream name
+/* Retrieves the number of hard links of a file entry
+ * The number of hard links is the number of $FILE_NAME attributes that are
+ * not in the DOS name space, since a DOS name is an alias of another name
  * Returns 1 if successful or -1 on error
  */
-int info_handle_name_value_fprint(
+int info_handle_file_entry_get_number_of_links(
      info_handle_t *info_handle,
-     const system_character_t *value_string,
-     size_t value_string_length,
+     libfsntfs_file_entry_t *file_entry,
+     int *number_of_links,
      libcerror_error_t **error )
 {
-	system_character_t *escaped_value_string = NULL;
-	static char *function                    = "info_handle_name_value_fprint";
-	size_t escaped_value_string_size         = 0;
+	libfsntfs_attribute_t *attribute = NULL;
+	static char *function            = "info_handle_file_entry_get_number_of_links";
+	uint32_t attribute_type          = 0;
+	uint8_t name_space               = 0;
+	int attribute_index              = 0;
+	int number_of_attributes         = 0;
+	int safe_number_of_links         = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1221,66 +1587,139 @@ int info_handle_name_value_fprint(
 
 		return( -1 );
 	}
-	if( path_string_copy_from_file_entry_path(
-	     &escaped_value_string,
-	     &escaped_value_string_size,
-	     value_string,
-	     value_string_length,
-	     error ) != 1 )
+	if( number_of_links == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy path from file entry path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of links.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( escaped_value_string == NULL )
+	if( libfsntfs_file_entry_get_number_of_attributes(
+	     file_entry,
+	     &number_of_attributes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing escaped value string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "%" PRIs_SYSTEM "",
-	 escaped_value_string );
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libfsntfs_file_entry_get_attribute_by_index(
+		     file_entry,
+		     attribute_index,
+		     &attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
+			 function,
+			 attribute_index );
 
-	memory_free(
-	 escaped_value_string );
+			goto on_error;
+		}
+		if( libfsntfs_attribute_get_type(
+		     attribute,
+		     &attribute_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d type.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( attribute_type == LIBFSNTFS_ATTRIBUTE_TYPE_FILE_NAME )
+		{
+			if( libfsntfs_file_name_attribute_get_name_space(
+			     attribute,
+			     &name_space,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d name space.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+			if( name_space != LIBFSNTFS_FILE_NAME_SPACE_DOS )
+			{
+				safe_number_of_links++;
+			}
+		}
+		if( libfsntfs_attribute_free(
+		     &attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free attribute: %d.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+	}
+	*number_of_links = safe_number_of_links;
 
 	return( 1 );
 
 on_error:
-	if( escaped_value_string != NULL )
+	if( attribute != NULL )
 	{
-		memory_free(
-		 escaped_value_string );
+		libfsntfs_attribute_free(
+		 &attribute,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Prints a FILETIME value
+/* Retrieves the digests of the contents of a file entry
+ * The contents are those of the alternate data stream if set, otherwise
+ * those of the default data stream. The digests are only calculated if the
+ * digest memo does not already contain the digests of the data stream,
+ * for example when it was reached before by another hard link.
+ * The digests are available from the digest handle.
  * Returns 1 if successful or -1 on error
  */
-int info_handle_filetime_value_fprint(
+int info_handle_file_entry_get_digests(
      info_handle_t *info_handle,
-     const char *value_name,
-     uint64_t value_64bit,
+     libfsntfs_file_entry_t *file_entry,
+     uint64_t file_reference,
+     libfsntfs_data_stream_t *alternate_data_stream,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
      libcerror_error_t **error )
 {
-	system_character_t date_time_string[ 48 ];
+	uint8_t hashes[ DIGEST_HANDLE_HASHES_SIZE ];
 
-	libfdatetime_filetime_t *filetime = NULL;
-	static char *function             = "info_handle_filetime_value_fprint";
-	int result                        = 0;
+	static char *function = "info_handle_file_entry_get_digests";
+	int number_of_links   = 0;
+	int result            = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1293,55 +1732,266 @@ int info_handle_filetime_value_fprint(
 
 		return( -1 );
 	}
-	if( value_name == NULL )
+	if( info_handle->digest_memo != NULL )
+	{
+		result = digest_memo_get_hashes(
+		          info_handle->digest_memo,
+		          file_reference,
+		          data_stream_name,
+		          data_stream_name_length,
+		          hashes,
+		          DIGEST_HANDLE_HASHES_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hashes from digest memo.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( digest_handle_set_hashes(
+			     info_handle->digest_handle,
+			     hashes,
+			     DIGEST_HANDLE_HASHES_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set hashes in digest handle.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	if( info_handle_file_entry_calculate_digests(
+	     info_handle,
+	     file_entry,
+	     alternate_data_stream,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate digests.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_64bit == 0 )
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "%s: Not set (0)\n",
-		 value_name );
-	}
-	else
+	if( info_handle->digest_memo != NULL )
 	{
-		if( libfdatetime_filetime_initialize(
-		     &filetime,
+		if( info_handle_file_entry_get_number_of_links(
+		     info_handle,
+		     file_entry,
+		     &number_of_links,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create FILETIME.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of links.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfdatetime_filetime_copy_from_64bit(
-		     filetime,
-		     value_64bit,
+		if( digest_handle_get_hashes(
+		     info_handle->digest_handle,
+		     hashes,
+		     DIGEST_HANDLE_HASHES_SIZE,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy 64-bit value to FILETIME.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hashes from digest handle.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_filetime_copy_to_utf16_string(
+		/* Only the digests of file entries with multiple hard links are retained
+		 * since other file entries are not reached again by another path
+		 */
+		if( digest_memo_set_hashes(
+		     info_handle->digest_memo,
+		     file_reference,
+		     data_stream_name,
+		     data_stream_name_length,
+		     hashes,
+		     DIGEST_HANDLE_HASHES_SIZE,
+		     (uint8_t) ( number_of_links > 1 ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set hashes in digest memo.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prints a file entry or data stream name
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_name_value_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *value_string,
+     size_t value_string_length,
+     libcerror_error_t **error )
+{
+	system_character_t *escaped_value_string = NULL;
+	static char *function                    = "info_handle_name_value_fprint";
+	size_t escaped_value_string_size         = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_string_copy_from_file_entry_path(
+	     &escaped_value_string,
+	     &escaped_value_string_size,
+	     value_string,
+	     value_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path from file entry path.",
+		 function );
+
+		goto on_error;
+	}
+	if( escaped_value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing escaped value string.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "%" PRIs_SYSTEM "",
+	 escaped_value_string );
+
+	memory_free(
+	 escaped_value_string );
+
+	return( 1 );
+
+on_error:
+	if( escaped_value_string != NULL )
+	{
+		memory_free(
+		 escaped_value_string );
+	}
+	return( -1 );
+}
+
+/* Prints a FILETIME value
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_filetime_value_fprint(
+     info_handle_t *info_handle,
+     const char *value_name,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	system_character_t date_time_string[ 48 ];
+
+	libfdatetime_filetime_t *filetime = NULL;
+	static char *function             = "info_handle_filetime_value_fprint";
+	int result                        = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "%s: Not set (0)\n",
+		 value_name );
+	}
+	else
+	{
+		if( libfdatetime_filetime_initialize(
+		     &filetime,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create FILETIME.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdatetime_filetime_copy_from_64bit(
+		     filetime,
+		     value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy 64-bit value to FILETIME.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfdatetime_filetime_copy_to_utf16_string(
 			  filetime,
 			  (uint16_t *) date_time_string,
 			  48,
@@ -5120,6 +5770,48 @@ on_error:
 	return( -1 );
 }
 
+/* Prints a formatted string to the bodyfile
+ * The string is appended to the bodyfile output buffer if set, otherwise it is
+ * written to the bodyfile output stream
+ * Returns the number of printed characters if successful or -1 on error
+ */
+int info_handle_bodyfile_printf(
+     info_handle_t *info_handle,
+     const char *format,
+     ... )
+{
+	va_list argument_list;
+
+	int print_count = -1;
+
+	if( info_handle == NULL )
+	{
+		return( -1 );
+	}
+	va_start(
+	 argument_list,
+	 format );
+
+	if( info_handle->bodyfile_output_buffer != NULL )
+	{
+		print_count = output_buffer_vprintf(
+		               info_handle->bodyfile_output_buffer,
+		               format,
+		               argument_list );
+	}
+	else if( info_handle->bodyfile_stream != NULL )
+	{
+		print_count = file_stream_vfprintf(
+		               info_handle->bodyfile_stream,
+		               format,
+		               argument_list );
+	}
+	va_end(
+	 argument_list );
+
+	return( print_count );
+}
+
 /* Prints a file entry or data stream name to a bodyfile
  * Returns 1 if successful or -1 on error
  */
@@ -5171,8 +5863,8 @@ int info_handle_bodyfile_name_value_fprint(
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->bodyfile_stream,
+	info_handle_bodyfile_printf(
+	 info_handle,
 	 "%" PRIs_SYSTEM "",
 	 escaped_value_string );
 
@@ -5381,8 +6073,8 @@ int info_handle_bodyfile_file_name_attribute_fprint(
 	/* Colums in a Sleuthkit 3.x and later bodyfile
 	 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
 	 */
-	fprintf(
-	 info_handle->bodyfile_stream,
+	info_handle_bodyfile_printf(
+	 info_handle,
 	 "0|" );
 
 	if( path != NULL )
@@ -5426,8 +6118,8 @@ int info_handle_bodyfile_file_name_attribute_fprint(
 	posix_inode_change_time = (int64_t) entry_modification_time - 116444736000000000L;
 	posix_modification_time = (int64_t) modification_time - 116444736000000000L;
 
-	fprintf(
-	 info_handle->bodyfile_stream,
+	info_handle_bodyfile_printf(
+	 info_handle,
 	 " ($FILE_NAME)|%" PRIu64 "-%" PRIu64 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "\n",
 	 file_reference & 0xffffffffffffUL,
 	 file_reference >> 48,
@@ -5656,8 +6348,8 @@ int info_handle_bodyfile_i30_entry_fprint(
 	/* Colums in a Sleuthkit 3.x and later bodyfile
 	 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
 	 */
-	fprintf(
-	 info_handle->bodyfile_stream,
+	info_handle_bodyfile_printf(
+	 info_handle,
 	 "0|" );
 
 	if( path != NULL )
@@ -5701,8 +6393,8 @@ int info_handle_bodyfile_i30_entry_fprint(
 	posix_inode_change_time = (int64_t) entry_modification_time - 116444736000000000L;
 	posix_modification_time = (int64_t) modification_time - 116444736000000000L;
 
-	fprintf(
-	 info_handle->bodyfile_stream,
+	info_handle_bodyfile_printf(
+	 info_handle,
 	 " ($I30)|%" PRIu64 "-%" PRIu64 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "\n",
 	 file_reference & 0xffffffffffffUL,
 	 file_reference >> 48,
@@ -5992,8 +6684,8 @@ int info_handle_bodyfile_index_root_attribute_fprint(
 	/* Colums in a Sleuthkit 3.x and later bodyfile
 	 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
 	 */
-	fprintf(
-	 info_handle->bodyfile_stream,
+	info_handle_bodyfile_printf(
+	 info_handle,
 	 "0|" );
 
 	if( path != NULL )
@@ -6039,15 +6731,15 @@ int info_handle_bodyfile_index_root_attribute_fprint(
 	       "$I30",
 	       4 ) != 0 ) ) )
 	{
-		fprintf(
-		 info_handle->bodyfile_stream,
+		info_handle_bodyfile_printf(
+		 info_handle,
 		 ":%" PRIs_SYSTEM "",
 		 attribute_name );
 	}
 	if( symbolic_link_target != NULL )
 	{
-		fprintf(
-		 info_handle->bodyfile_stream,
+		info_handle_bodyfile_printf(
+		 info_handle,
 		 " -> " );
 
 		if( info_handle_bodyfile_name_value_fprint(
@@ -6071,8 +6763,8 @@ int info_handle_bodyfile_index_root_attribute_fprint(
 	posix_inode_change_time = (int64_t) entry_modification_time - 116444736000000000L;
 	posix_modification_time = (int64_t) modification_time - 116444736000000000L;
 
-	fprintf(
-	 info_handle->bodyfile_stream,
+	info_handle_bodyfile_printf(
+	 info_handle,
 	 "|%" PRIu64 "-%" PRIu64 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "\n",
 	 file_reference & 0xffffffffffffUL,
 	 file_reference >> 48,
@@ -6121,16 +6813,20 @@ int info_handle_bodyfile_file_entry_value_fprint(
      const system_character_t *data_stream_name,
      libcerror_error_t **error )
 {
-	char md5_string[ DIGEST_HASH_STRING_SIZE_MD5 ] = {
+	char md5_string[ DIGEST_HANDLE_STRING_SIZE_MD5 ] = {
 		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
 		'0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0', '0',
 		0 };
 
+	char sha1_string[ DIGEST_HANDLE_STRING_SIZE_SHA1 ]     = { '0', 0 };
+	char sha256_string[ DIGEST_HANDLE_STRING_SIZE_SHA256 ] = { '0', 0 };
+
 	char file_mode_string[ 11 ]              = { '-', 'r', 'w', 'x', 'r', 'w', 'x', 'r', 'w', 'x', 0 };
 
 	system_character_t *symbolic_link_target = NULL;
 	static char *function                    = "info_handle_bodyfile_file_entry_value_fprint";
 	size64_t size                            = 0;
+	size_t data_stream_name_length           = 0;
 	size_t symbolic_link_target_length       = 0;
 	size_t symbolic_link_target_size         = 0;
 	uint64_t access_time                     = 0;
@@ -6146,7 +6842,7 @@ int info_handle_bodyfile_file_entry_value_fprint(
 	uint32_t file_attribute_flags            = 0;
 	uint32_t group_identifier                = 0;
 	uint32_t owner_identifier                = 0;
-	int has_default_data_stream              = 0;
+	int has_data_stream                      = 0;
 	int result                               = 0;
 
 	if( info_handle == NULL )
@@ -6336,6 +7032,7 @@ int info_handle_bodyfile_file_entry_value_fprint(
 
 			goto on_error;
 		}
+		has_data_stream = 1;
 	}
 	else
 	{
@@ -6353,23 +7050,23 @@ int info_handle_bodyfile_file_entry_value_fprint(
 
 			goto on_error;
 		}
-	}
-	result = libfsntfs_file_entry_has_default_data_stream(
-		  file_entry,
-		  error );
+		result = libfsntfs_file_entry_has_default_data_stream(
+			  file_entry,
+			  error );
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if file entry has default data stream.",
-		 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file entry has default data stream.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		has_data_stream = result;
 	}
-	has_default_data_stream = result;
 
 	result = libfsntfs_file_entry_is_symbolic_link(
 	          file_entry,
@@ -6419,23 +7116,32 @@ int info_handle_bodyfile_file_entry_value_fprint(
 		file_mode_string[ 5 ] = '-';
 		file_mode_string[ 8 ] = '-';
 	}
-	if( ( info_handle->calculate_md5 == 0 )
-	 || ( has_default_data_stream == 0 ) )
+	if( ( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_MD5 ) == 0 )
+	 || ( has_data_stream == 0 ) )
 	{
 		md5_string[ 1 ] = 0;
 	}
-	else if( result == 0 )
+	if( ( info_handle->digest_types != 0 )
+	 && ( has_data_stream != 0 )
+	 && ( result == 0 ) )
 	{
-		if( info_handle_file_entry_calculate_md5(
+		if( data_stream_name != NULL )
+		{
+			data_stream_name_length = system_string_length(
+			                           data_stream_name );
+		}
+		if( info_handle_file_entry_get_digests(
 		     info_handle,
 		     file_entry,
-		     md5_string,
-		     DIGEST_HASH_STRING_SIZE_MD5,
+		     file_reference,
+		     alternate_data_stream,
+		     data_stream_name,
+		     data_stream_name_length,
 		     error ) != 1 )
 		{
 			fprintf(
 			 info_handle->notify_stream,
-			 "Error calculating MD5 of MFT entry: %" PRIu64 "\n",
+			 "Error calculating digests of MFT entry: %" PRIu64 "\n",
 			 mft_entry_index );
 
 			if( ( error != NULL )
@@ -6451,12 +7157,74 @@ int info_handle_bodyfile_file_entry_value_fprint(
 			 info_handle->notify_stream,
 			 "\n" );
 		}
+		else
+		{
+			if( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_MD5 ) != 0 )
+			{
+				if( digest_handle_get_string(
+				     info_handle->digest_handle,
+				     DIGEST_HANDLE_DIGEST_TYPE_MD5,
+				     md5_string,
+				     DIGEST_HANDLE_STRING_SIZE_MD5,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve MD5 hash string.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA1 ) != 0 )
+			{
+				if( digest_handle_get_string(
+				     info_handle->digest_handle,
+				     DIGEST_HANDLE_DIGEST_TYPE_SHA1,
+				     sha1_string,
+				     DIGEST_HANDLE_STRING_SIZE_SHA1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve SHA1 hash string.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA256 ) != 0 )
+			{
+				if( digest_handle_get_string(
+				     info_handle->digest_handle,
+				     DIGEST_HANDLE_DIGEST_TYPE_SHA256,
+				     sha256_string,
+				     DIGEST_HANDLE_STRING_SIZE_SHA256,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve SHA256 hash string.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
 	}
 	/* Colums in a Sleuthkit 3.x and later bodyfile
 	 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
+	 *
+	 * When calculated the SHA1 and SHA256 are appended as additional columns
 	 */
-	fprintf(
-	 info_handle->bodyfile_stream,
+	info_handle_bodyfile_printf(
+	 info_handle,
 	 "%s|",
 	 md5_string );
 
@@ -6498,15 +7266,15 @@ int info_handle_bodyfile_file_entry_value_fprint(
 	}
 	if( data_stream_name != NULL )
 	{
-		fprintf(
-		 info_handle->bodyfile_stream,
+		info_handle_bodyfile_printf(
+		 info_handle,
 		 ":%" PRIs_SYSTEM "",
 		 data_stream_name );
 	}
 	if( symbolic_link_target != NULL )
 	{
-		fprintf(
-		 info_handle->bodyfile_stream,
+		info_handle_bodyfile_printf(
+		 info_handle,
 		 " -> " );
 
 		if( info_handle_bodyfile_name_value_fprint(
@@ -6530,9 +7298,9 @@ int info_handle_bodyfile_file_entry_value_fprint(
 	posix_inode_change_time = (int64_t) entry_modification_time - 116444736000000000L;
 	posix_modification_time = (int64_t) modification_time - 116444736000000000L;
 
-	fprintf(
-	 info_handle->bodyfile_stream,
-	 "|%" PRIu64 "-%" PRIu64 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "\n",
+	info_handle_bodyfile_printf(
+	 info_handle,
+	 "|%" PRIu64 "-%" PRIu64 "|%s|%" PRIu32 "|%" PRIu32 "|%" PRIu64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "|%" PRIi64 ".%07" PRIi64 "",
 	 mft_entry_index,
 	 file_reference >> 48,
 	 file_mode_string,
@@ -6548,6 +7316,24 @@ int info_handle_bodyfile_file_entry_value_fprint(
 	 posix_creation_time / 10000000,
 	 posix_creation_time - ( ( posix_creation_time / 10000000 ) * 10000000 ) );
 
+	if( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA1 ) != 0 )
+	{
+		info_handle_bodyfile_printf(
+		 info_handle,
+		 "|%s",
+		 sha1_string );
+	}
+	if( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA256 ) != 0 )
+	{
+		info_handle_bodyfile_printf(
+		 info_handle,
+		 "|%s",
+		 sha256_string );
+	}
+	info_handle_bodyfile_printf(
+	 info_handle,
+	 "\n" );
+
 	if( symbolic_link_target != NULL )
 	{
 		memory_free(
@@ -7069,7 +7855,8 @@ int info_handle_file_entry_fprint(
 					goto on_error;
 				}
 			}
-			if( info_handle->bodyfile_stream != NULL )
+			if( ( info_handle->bodyfile_stream != NULL )
+			 || ( info_handle->bodyfile_output_buffer != NULL ) )
 			{
 				if( info_handle_bodyfile_index_root_attribute_fprint(
 				     info_handle,
@@ -7175,7 +7962,8 @@ int info_handle_file_entry_fprint(
 	 && ( ( has_default_data_stream != 0 )
 	  ||  ( number_of_alternate_data_streams == 0 ) ) )
 	{
-		if( info_handle->bodyfile_stream != NULL )
+		if( ( info_handle->bodyfile_stream != NULL )
+		 || ( info_handle->bodyfile_output_buffer != NULL ) )
 		{
 			if( info_handle_bodyfile_file_entry_value_fprint(
 			     info_handle,
@@ -7323,7 +8111,8 @@ int info_handle_file_entry_fprint(
 
 				goto on_error;
 			}
-			if( info_handle->bodyfile_stream != NULL )
+			if( ( info_handle->bodyfile_stream != NULL )
+			 || ( info_handle->bodyfile_output_buffer != NULL ) )
 			{
 				if( info_handle_bodyfile_file_entry_value_fprint(
 				     info_handle,
@@ -7424,7 +8213,8 @@ int info_handle_file_entry_fprint(
 			goto on_error;
 		}
 	}
-	if( info_handle->bodyfile_stream != NULL )
+	if( ( info_handle->bodyfile_stream != NULL )
+	 || ( info_handle->bodyfile_output_buffer != NULL ) )
 	{
 		if( file_name_attribute != NULL )
 		{
@@ -7924,259 +8714,1002 @@ int info_handle_mft_entry_fprint(
 	            file_entry,
 	            error );
 
-	if( is_empty == -1 )
+	if( is_empty == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file entry is empty.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_empty != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tIs empty\n" );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	else
+	{
+		is_allocated = libfsntfs_file_entry_is_allocated(
+		                file_entry,
+		                error );
+
+		if( is_allocated == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file entry is allocated.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tIs allocated\t\t\t: " );
+
+		if( is_allocated == 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "false" );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "true" );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+		if( libfsntfs_file_entry_get_file_reference(
+		     file_entry,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file reference.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tFile reference\t\t\t: %" PRIu64 "-%" PRIu64 "\n",
+		 value_64bit & 0xffffffffffffUL,
+		 value_64bit >> 48 );
+
+		if( libfsntfs_file_entry_get_base_record_file_reference(
+		     file_entry,
+		     &base_record_file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve base record file reference.",
+			 function );
+
+			goto on_error;
+		}
+		if( base_record_file_reference == 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tBase record file reference\t: Not set (0)\n" );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tBase record file reference\t: %" PRIu64 "-%" PRIu64 "\n",
+			 base_record_file_reference & 0xffffffffffffUL,
+			 base_record_file_reference >> 48 );
+		}
+		if( libfsntfs_file_entry_get_journal_sequence_number(
+		     file_entry,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve journal sequence number.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tJournal sequence number\t\t: %" PRIu64 "\n",
+		 value_64bit );
+
+		if( libfsntfs_file_entry_get_number_of_attributes(
+		     file_entry,
+		     &number_of_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of attributes.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of attributes\t\t: %d\n",
+		 number_of_attributes );
+
+		is_corrupted = libfsntfs_file_entry_is_corrupted(
+		                file_entry,
+		                error );
+
+		if( is_corrupted == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file entry is corrupted.",
+			 function );
+
+			goto on_error;
+		}
+		else if( is_corrupted != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tIs corrupted\n" );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+		for( attribute_index = 0;
+		     attribute_index < number_of_attributes;
+		     attribute_index++ )
+		{
+			if( libfsntfs_file_entry_get_attribute_by_index(
+			     file_entry,
+			     attribute_index,
+			     &attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+			if( info_handle_attribute_fprint(
+			     info_handle,
+			     file_entry,
+			     attribute,
+			     attribute_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print attribute: %d information.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+			if( libfsntfs_attribute_free(
+			     &attribute,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free attribute: %d.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfsntfs_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( attribute != NULL )
+	{
+		libfsntfs_attribute_free(
+		 &attribute,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The bodyfile job callback function
+ * Every job formats the chunks it takes, in order, into the output buffer of the chunk
+ * using its own input so that the jobs do not share libfsntfs state
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_bodyfile_job_callback_function(
+     info_handle_bodyfile_job_t *bodyfile_job )
+{
+	info_handle_bodyfile_chunk_t *bodyfile_chunk = NULL;
+	info_handle_bodyfile_jobs_t *bodyfile_jobs   = NULL;
+	info_handle_t *info_handle                   = NULL;
+	libcerror_error_t *error                     = NULL;
+	static char *function                        = "info_handle_bodyfile_job_callback_function";
+	uint64_t chunk_index                         = 0;
+	uint64_t file_entry_index                    = 0;
+	uint64_t last_file_entry_index               = 0;
+	int result                                   = 0;
+	int stop_jobs                                = 0;
+
+	if( bodyfile_job == NULL )
+	{
+		return( -1 );
+	}
+	bodyfile_jobs = bodyfile_job->bodyfile_jobs;
+	info_handle   = bodyfile_job->info_handle;
+
+	if( ( bodyfile_jobs == NULL )
+	 || ( info_handle == NULL ) )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     bodyfile_jobs->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( bodyfile_jobs->stop_jobs != 0 )
+		 || ( bodyfile_jobs->next_chunk_index >= bodyfile_jobs->number_of_chunks ) )
+		{
+			libcthreads_mutex_release(
+			 bodyfile_jobs->mutex,
+			 NULL );
+
+			break;
+		}
+		chunk_index    = bodyfile_jobs->next_chunk_index;
+		bodyfile_chunk = &( bodyfile_jobs->chunks[ chunk_index % bodyfile_jobs->number_of_ring_chunks ] );
+
+		bodyfile_jobs->next_chunk_index += 1;
+
+		/* Wait until the output buffer of the chunk has been written
+		 */
+		while( ( bodyfile_chunk->chunk_index != chunk_index )
+		    && ( bodyfile_jobs->stop_jobs == 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     bodyfile_jobs->condition,
+			     bodyfile_jobs->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 bodyfile_jobs->mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		stop_jobs = bodyfile_jobs->stop_jobs;
+
+		if( libcthreads_mutex_release(
+		     bodyfile_jobs->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( stop_jobs != 0 )
+		{
+			break;
+		}
+		if( output_buffer_empty(
+		     bodyfile_chunk->output_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to empty output buffer of chunk: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		info_handle->bodyfile_output_buffer = bodyfile_chunk->output_buffer;
+
+		file_entry_index      = chunk_index * INFO_HANDLE_BODYFILE_CHUNK_SIZE;
+		last_file_entry_index = file_entry_index + INFO_HANDLE_BODYFILE_CHUNK_SIZE;
+
+		if( last_file_entry_index > bodyfile_jobs->number_of_file_entries )
+		{
+			last_file_entry_index = bodyfile_jobs->number_of_file_entries;
+		}
+		while( file_entry_index < last_file_entry_index )
+		{
+			if( bodyfile_jobs->info_handle->abort != 0 )
+			{
+				break;
+			}
+			result = info_handle_bodyfile_mft_entry_fprint(
+			          info_handle,
+			          file_entry_index,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print MFT entry: %" PRIu64 ".",
+				 function,
+				 file_entry_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 info_handle->notify_stream,
+				 "Unable to print MFT entry: %" PRIu64 ".\n\n",
+				 file_entry_index );
+			}
+			file_entry_index++;
+		}
+		info_handle->bodyfile_output_buffer = NULL;
+
+		if( libcthreads_mutex_grab(
+		     bodyfile_jobs->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		bodyfile_chunk->is_ready = 1;
+
+		if( libcthreads_condition_broadcast(
+		     bodyfile_jobs->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 bodyfile_jobs->mutex,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_release(
+		     bodyfile_jobs->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	info_handle->bodyfile_output_buffer = NULL;
+
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	/* Signal the other jobs and the writer that a job has failed
+	 */
+	if( libcthreads_mutex_grab(
+	     bodyfile_jobs->mutex,
+	     NULL ) == 1 )
+	{
+		bodyfile_jobs->has_failed = 1;
+		bodyfile_jobs->stop_jobs  = 1;
+
+		libcthreads_condition_broadcast(
+		 bodyfile_jobs->condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 bodyfile_jobs->mutex,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the MFT entries to a bodyfile using multiple jobs
+ * The MFT entries are divided in chunks that are formatted by the jobs into
+ * separate output buffers, which are written in order of the MFT entries so that
+ * the bodyfile is identical to the one generated by a single job
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_bodyfile_mft_entries_fprint(
+     info_handle_t *info_handle,
+     uint64_t number_of_file_entries,
+     libcerror_error_t **error )
+{
+	info_handle_bodyfile_jobs_t bodyfile_jobs;
+
+	info_handle_bodyfile_chunk_t *bodyfile_chunk = NULL;
+	info_handle_bodyfile_job_t *bodyfile_job     = NULL;
+	static char *function                        = "info_handle_bodyfile_mft_entries_fprint";
+	uint64_t chunk_index                         = 0;
+	int chunk_ring_index                         = 0;
+	int has_failed                               = 0;
+	int job_index                                = 0;
+	int result                                   = -1;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->bodyfile_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing bodyfile stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->input_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing input filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_handle->number_of_jobs <= 0 )
+	 || ( info_handle->number_of_jobs > INFO_HANDLE_MAXIMUM_NUMBER_OF_JOBS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid info handle - number of jobs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &bodyfile_jobs,
+	     0,
+	     sizeof( info_handle_bodyfile_jobs_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bodyfile jobs.",
+		 function );
+
+		return( -1 );
+	}
+	bodyfile_jobs.info_handle            = info_handle;
+	bodyfile_jobs.number_of_file_entries = number_of_file_entries;
+	bodyfile_jobs.number_of_chunks       = number_of_file_entries / INFO_HANDLE_BODYFILE_CHUNK_SIZE;
+
+	if( ( number_of_file_entries % INFO_HANDLE_BODYFILE_CHUNK_SIZE ) != 0 )
+	{
+		bodyfile_jobs.number_of_chunks += 1;
+	}
+	bodyfile_jobs.number_of_jobs = info_handle->number_of_jobs;
+
+	if( (uint64_t) bodyfile_jobs.number_of_jobs > bodyfile_jobs.number_of_chunks )
+	{
+		bodyfile_jobs.number_of_jobs = (int) bodyfile_jobs.number_of_chunks;
+	}
+	if( bodyfile_jobs.number_of_jobs == 0 )
+	{
+		return( 1 );
+	}
+	/* Every job can format a chunk while another chunk is waiting to be written
+	 */
+	bodyfile_jobs.number_of_ring_chunks = bodyfile_jobs.number_of_jobs * 2;
+
+	if( libcthreads_mutex_initialize(
+	     &( bodyfile_jobs.mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( bodyfile_jobs.condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+	bodyfile_jobs.chunks = (info_handle_bodyfile_chunk_t *) memory_allocate(
+	                                                         sizeof( info_handle_bodyfile_chunk_t ) * bodyfile_jobs.number_of_ring_chunks );
+
+	if( bodyfile_jobs.chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     bodyfile_jobs.chunks,
+	     0,
+	     sizeof( info_handle_bodyfile_chunk_t ) * bodyfile_jobs.number_of_ring_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_ring_index = 0;
+	     chunk_ring_index < bodyfile_jobs.number_of_ring_chunks;
+	     chunk_ring_index++ )
+	{
+		bodyfile_chunk = &( bodyfile_jobs.chunks[ chunk_ring_index ] );
+
+		if( output_buffer_initialize(
+		     &( bodyfile_chunk->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize output buffer: %d.",
+			 function,
+			 chunk_ring_index );
+
+			goto on_error;
+		}
+		bodyfile_chunk->chunk_index = (uint64_t) chunk_ring_index;
+	}
+	bodyfile_jobs.jobs = (info_handle_bodyfile_job_t *) memory_allocate(
+	                                                     sizeof( info_handle_bodyfile_job_t ) * bodyfile_jobs.number_of_jobs );
+
+	if( bodyfile_jobs.jobs == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if file entry is empty.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create jobs.",
 		 function );
 
 		goto on_error;
 	}
-	else if( is_empty != 0 )
+	if( memory_set(
+	     bodyfile_jobs.jobs,
+	     0,
+	     sizeof( info_handle_bodyfile_job_t ) * bodyfile_jobs.number_of_jobs ) == NULL )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tIs empty\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear jobs.",
+		 function );
 
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+		goto on_error;
 	}
-	else
+	for( job_index = 0;
+	     job_index < bodyfile_jobs.number_of_jobs;
+	     job_index++ )
 	{
-		is_allocated = libfsntfs_file_entry_is_allocated(
-		                file_entry,
-		                error );
+		bodyfile_job = &( bodyfile_jobs.jobs[ job_index ] );
 
-		if( is_allocated == -1 )
+		bodyfile_job->bodyfile_jobs = &bodyfile_jobs;
+
+		if( info_handle_initialize(
+		     &( bodyfile_job->info_handle ),
+		     info_handle->digest_types,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if file entry is allocated.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize info handle of job: %d.",
+			 function,
+			 job_index );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tIs allocated\t\t\t: " );
+		bodyfile_job->info_handle->volume_offset = info_handle->volume_offset;
+		bodyfile_job->info_handle->notify_stream = info_handle->notify_stream;
 
-		if( is_allocated == 0 )
+		if( info_handle_open_input(
+		     bodyfile_job->info_handle,
+		     info_handle->input_filename,
+		     error ) != 1 )
 		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "false" );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input of job: %d.",
+			 function,
+			 job_index );
+
+			goto on_error;
 		}
-		else
+	}
+	for( job_index = 0;
+	     job_index < bodyfile_jobs.number_of_jobs;
+	     job_index++ )
+	{
+		bodyfile_job = &( bodyfile_jobs.jobs[ job_index ] );
+
+		if( libcthreads_thread_create(
+		     &( bodyfile_job->thread ),
+		     NULL,
+		     (int (*)(void *)) &info_handle_bodyfile_job_callback_function,
+		     (void *) bodyfile_job,
+		     error ) != 1 )
 		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "true" );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of job: %d.",
+			 function,
+			 job_index );
+
+			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+	}
+	/* Write the chunks in order
+	 */
+	for( chunk_index = 0;
+	     chunk_index < bodyfile_jobs.number_of_chunks;
+	     chunk_index++ )
+	{
+		bodyfile_chunk = &( bodyfile_jobs.chunks[ chunk_index % bodyfile_jobs.number_of_ring_chunks ] );
 
-		if( libfsntfs_file_entry_get_file_reference(
-		     file_entry,
-		     &value_64bit,
+		if( libcthreads_mutex_grab(
+		     bodyfile_jobs.mutex,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file reference.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tFile reference\t\t\t: %" PRIu64 "-%" PRIu64 "\n",
-		 value_64bit & 0xffffffffffffUL,
-		 value_64bit >> 48 );
+		while( ( bodyfile_chunk->is_ready == 0 )
+		    && ( bodyfile_jobs.has_failed == 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     bodyfile_jobs.condition,
+			     bodyfile_jobs.mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
 
-		if( libfsntfs_file_entry_get_base_record_file_reference(
-		     file_entry,
-		     &base_record_file_reference,
+				libcthreads_mutex_release(
+				 bodyfile_jobs.mutex,
+				 NULL );
+
+				goto on_error;
+			}
+		}
+		has_failed = bodyfile_jobs.has_failed;
+
+		if( libcthreads_mutex_release(
+		     bodyfile_jobs.mutex,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve base record file reference.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
 			 function );
 
 			goto on_error;
 		}
-		if( base_record_file_reference == 0 )
+		if( has_failed != 0 )
 		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tBase record file reference\t: Not set (0)\n" );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print MFT entries of chunk: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
 		}
-		else
+		if( output_buffer_fprint(
+		     bodyfile_chunk->output_buffer,
+		     info_handle->bodyfile_stream,
+		     error ) != 1 )
 		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tBase record file reference\t: %" PRIu64 "-%" PRIu64 "\n",
-			 base_record_file_reference & 0xffffffffffffUL,
-			 base_record_file_reference >> 48 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print output buffer of chunk: %" PRIu64 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
 		}
-		if( libfsntfs_file_entry_get_journal_sequence_number(
-		     file_entry,
-		     &value_64bit,
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		/* Release the output buffer for the chunk that is a full ring later
+		 */
+		if( libcthreads_mutex_grab(
+		     bodyfile_jobs.mutex,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve journal sequence number.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tJournal sequence number\t\t: %" PRIu64 "\n",
-		 value_64bit );
+		bodyfile_chunk->chunk_index += bodyfile_jobs.number_of_ring_chunks;
+		bodyfile_chunk->is_ready     = 0;
 
-		if( libfsntfs_file_entry_get_number_of_attributes(
-		     file_entry,
-		     &number_of_attributes,
+		if( libcthreads_condition_broadcast(
+		     bodyfile_jobs.condition,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of attributes.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
 			 function );
 
+			libcthreads_mutex_release(
+			 bodyfile_jobs.mutex,
+			 NULL );
+
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tNumber of attributes\t\t: %d\n",
-		 number_of_attributes );
-
-		is_corrupted = libfsntfs_file_entry_is_corrupted(
-		                file_entry,
-		                error );
-
-		if( is_corrupted == -1 )
+		if( libcthreads_mutex_release(
+		     bodyfile_jobs.mutex,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if file entry is corrupted.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
 			 function );
 
 			goto on_error;
 		}
-		else if( is_corrupted != 0 )
+	}
+	result = 1;
+
+on_error:
+	/* Stop the jobs that are still running on abort or error
+	 */
+	if( bodyfile_jobs.mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     bodyfile_jobs.mutex,
+		     NULL ) == 1 )
 		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tIs corrupted\n" );
-		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+			bodyfile_jobs.stop_jobs = 1;
 
-		for( attribute_index = 0;
-		     attribute_index < number_of_attributes;
-		     attribute_index++ )
+			libcthreads_condition_broadcast(
+			 bodyfile_jobs.condition,
+			 NULL );
+
+			libcthreads_mutex_release(
+			 bodyfile_jobs.mutex,
+			 NULL );
+		}
+	}
+	if( bodyfile_jobs.jobs != NULL )
+	{
+		for( job_index = 0;
+		     job_index < bodyfile_jobs.number_of_jobs;
+		     job_index++ )
 		{
-			if( libfsntfs_file_entry_get_attribute_by_index(
-			     file_entry,
-			     attribute_index,
-			     &attribute,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve attribute: %d.",
-				 function,
-				 attribute_index );
+			bodyfile_job = &( bodyfile_jobs.jobs[ job_index ] );
 
-				goto on_error;
-			}
-			if( info_handle_attribute_fprint(
-			     info_handle,
-			     file_entry,
-			     attribute,
-			     attribute_index,
-			     error ) != 1 )
+			if( bodyfile_job->thread != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print attribute: %d information.",
-				 function,
-				 attribute_index );
+				if( ( libcthreads_thread_join(
+				       &( bodyfile_job->thread ),
+				       NULL ) != 1 )
+				 && ( result == 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread of job: %d.",
+					 function,
+					 job_index );
 
-				goto on_error;
+					result = -1;
+				}
 			}
-			if( libfsntfs_attribute_free(
-			     &attribute,
-			     error ) != 1 )
+			if( bodyfile_job->info_handle != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free attribute: %d.",
-				 function,
-				 attribute_index );
+				info_handle_close_input(
+				 bodyfile_job->info_handle,
+				 NULL );
 
-				goto on_error;
+				info_handle_free(
+				 &( bodyfile_job->info_handle ),
+				 NULL );
 			}
 		}
+		memory_free(
+		 bodyfile_jobs.jobs );
 	}
-	if( libfsntfs_file_entry_free(
-	     &file_entry,
-	     error ) != 1 )
+	if( bodyfile_jobs.chunks != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file entry.",
-		 function );
-
-		goto on_error;
+		for( chunk_ring_index = 0;
+		     chunk_ring_index < bodyfile_jobs.number_of_ring_chunks;
+		     chunk_ring_index++ )
+		{
+			output_buffer_free(
+			 &( bodyfile_jobs.chunks[ chunk_ring_index ].output_buffer ),
+			 NULL );
+		}
+		memory_free(
+		 bodyfile_jobs.chunks );
 	}
-	return( 1 );
-
-on_error:
-	if( attribute != NULL )
+	if( bodyfile_jobs.condition != NULL )
 	{
-		libfsntfs_attribute_free(
-		 &attribute,
+		libcthreads_condition_free(
+		 &( bodyfile_jobs.condition ),
 		 NULL );
 	}
-	if( file_entry != NULL )
+	if( bodyfile_jobs.mutex != NULL )
 	{
-		libfsntfs_file_entry_free(
-		 &file_entry,
+		libcthreads_mutex_free(
+		 &( bodyfile_jobs.mutex ),
 		 NULL );
 	}
-	return( -1 );
+	return( result );
 }
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 /* Prints the MFT entries information
  * Returns 1 if successful or -1 on error
  */
@@ -8225,6 +9758,27 @@ int info_handle_mft_entries_fprint(
 
 		return( -1 );
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( info_handle->bodyfile_stream != NULL )
+	 && ( info_handle->number_of_jobs > 1 ) )
+	{
+		if( info_handle_bodyfile_mft_entries_fprint(
+		     info_handle,
+		     number_of_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print MFT entries to bodyfile.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif
 	for( file_entry_index = 0;
 	     file_entry_index < number_of_file_entries;
 	     file_entry_index++ )
@@ -9054,9 +10608,10 @@ int info_handle_usn_change_journal_fprint(
 	libfusn_record_t *usn_record                       = NULL;
 	uint8_t *buffer                                    = NULL;
 	static char *function                              = "info_handle_usn_change_journal_fprint";
-	size_t journal_block_size                          = 0;
+	size_t buffer_offset                               = 0;
 	ssize_t read_count                                 = 0;
 	uint32_t usn_record_size                           = 0;
+	int number_of_usn_records                          = 0;
 	int result                                         = 0;
 
 	if( info_handle == NULL )
@@ -9098,27 +10653,26 @@ int info_handle_usn_change_journal_fprint(
 
 		return( 1 );
 	}
-/* TODO get journal block size from USN change journal */
-	journal_block_size = 0x1000;
+	fprintf(
+	 info_handle->notify_stream,
+	 "USN change journal: \\$Extend\\$UsnJrnl\n\n" );
 
-	if( ( journal_block_size == 0 )
-	 || ( journal_block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( libfsntfs_usn_change_journal_set_number_of_threads(
+	     usn_change_journal,
+	     INFO_HANDLE_USN_CHANGE_JOURNAL_NUMBER_OF_THREADS,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid journal block size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads of USN change journal.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "USN change journal: \\$Extend\\$UsnJrnl\n\n" );
-
 	buffer = (uint8_t *) memory_allocate(
-	                      sizeof( uint8_t ) * journal_block_size );
+	                      sizeof( uint8_t ) * INFO_HANDLE_USN_RECORDS_DATA_SIZE );
 
 	if( buffer == NULL )
 	{
@@ -9133,10 +10687,11 @@ int info_handle_usn_change_journal_fprint(
 	}
 	do
 	{
-		read_count = libfsntfs_usn_change_journal_read_usn_record(
+		read_count = libfsntfs_usn_change_journal_read_usn_records(
 			      usn_change_journal,
 			      buffer,
-			      journal_block_size,
+			      INFO_HANDLE_USN_RECORDS_DATA_SIZE,
+			      &number_of_usn_records,
 			      error );
 
 		if( read_count < 0 )
@@ -9145,13 +10700,33 @@ int info_handle_usn_change_journal_fprint(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read USN record data.",
+			 "%s: unable to read USN records data.",
 			 function );
 
 			goto on_error;
 		}
-		else if( read_count > 0 )
+		buffer_offset = 0;
+
+		/* The USN records are validated by libfsntfs and stored back-to-back
+		 */
+		while( ( (size_t) read_count - buffer_offset ) >= 4 )
 		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( buffer[ buffer_offset ] ),
+			 usn_record_size );
+
+			if( ( usn_record_size == 0 )
+			 || ( (size_t) usn_record_size > ( (size_t) read_count - buffer_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid USN record size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
 			if( libfusn_record_initialize(
 			     &usn_record,
 			     error ) != 1 )
@@ -9167,8 +10742,8 @@ int info_handle_usn_change_journal_fprint(
 			}
 			if( libfusn_record_copy_from_byte_stream(
 			     usn_record,
-			     buffer,
-			     read_count,
+			     &( buffer[ buffer_offset ] ),
+			     (size_t) usn_record_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -9180,20 +10755,6 @@ int info_handle_usn_change_journal_fprint(
 
 				goto on_error;
 			}
-			if( libfusn_record_get_size(
-			     usn_record,
-			     &usn_record_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve USN record size.",
-				 function );
-
-				goto on_error;
-			}
 			if( info_handle_usn_record_fprint(
 			     info_handle,
 			     usn_record,
@@ -9221,6 +10782,7 @@ int info_handle_usn_change_journal_fprint(
 
 				goto on_error;
 			}
+			buffer_offset += usn_record_size;
 		}
 	}
 	while( read_count > 0 );
@@ -9675,3 +11237,297 @@ on_error:
 	return( -1 );
 }
 
+
+/* Calculates the digests of the volume data
+ * The data is read into the buffers of the digest handle, which are hashed
+ * by the digest handle while the next buffer is being read
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_calculate_digests(
+     info_handle_t *info_handle,
+     size64_t *volume_size,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "info_handle_volume_calculate_digests";
+	size64_t data_size    = 0;
+	size_t buffer_size    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	off64_t data_offset   = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->digest_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     info_handle->input_file_io_handle,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve input size.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest_handle_start(
+	     info_handle->digest_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start digest handle.",
+		 function );
+
+		return( -1 );
+	}
+	*volume_size = data_size;
+
+	while( data_size > 0 )
+	{
+		if( info_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			return( -1 );
+		}
+		if( digest_handle_get_buffer(
+		     info_handle->digest_handle,
+		     &buffer,
+		     &buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve digest buffer.",
+			 function );
+
+			return( -1 );
+		}
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > data_size )
+		{
+			read_size = (size_t) data_size;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              info_handle->input_file_io_handle,
+		              buffer,
+		              read_size,
+		              data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			return( -1 );
+		}
+		if( digest_handle_submit_buffer(
+		     info_handle->digest_handle,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to submit digest buffer.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += read_size;
+		data_size   -= read_size;
+	}
+	if( digest_handle_finalize(
+	     info_handle->digest_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize digests.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the digests of the volume data
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_digests_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	char digest_hash_string[ DIGEST_HANDLE_STRING_SIZE_SHA256 ];
+
+	static char *function = "info_handle_volume_digests_fprint";
+	size64_t volume_size  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_volume_calculate_digests(
+	     info_handle,
+	     &volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate volume digests.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "New Technology File System information:\n\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Volume digests:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tSize\t\t\t\t: %" PRIu64 " bytes\n",
+	 volume_size );
+
+	if( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_MD5 ) != 0 )
+	{
+		if( digest_handle_get_string(
+		     info_handle->digest_handle,
+		     DIGEST_HANDLE_DIGEST_TYPE_MD5,
+		     digest_hash_string,
+		     DIGEST_HANDLE_STRING_SIZE_SHA256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MD5 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tMD5\t\t\t\t: %s\n",
+		 digest_hash_string );
+	}
+	if( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA1 ) != 0 )
+	{
+		if( digest_handle_get_string(
+		     info_handle->digest_handle,
+		     DIGEST_HANDLE_DIGEST_TYPE_SHA1,
+		     digest_hash_string,
+		     DIGEST_HANDLE_STRING_SIZE_SHA256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve SHA1 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tSHA1\t\t\t\t: %s\n",
+		 digest_hash_string );
+	}
+	if( ( info_handle->digest_types & DIGEST_HANDLE_DIGEST_TYPE_SHA256 ) != 0 )
+	{
+		if( digest_handle_get_string(
+		     info_handle->digest_handle,
+		     DIGEST_HANDLE_DIGEST_TYPE_SHA256,
+		     digest_hash_string,
+		     DIGEST_HANDLE_STRING_SIZE_SHA256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve SHA256 hash string.",
+			 function );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tSHA256\t\t\t\t: %s\n",
+		 digest_hash_string );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
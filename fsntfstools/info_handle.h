@@ -26,15 +26,35 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "digest_handle.h"
+#include "digest_memo.h"
 #include "fsntfstools_libbfio.h"
 #include "fsntfstools_libcerror.h"
+#include "fsntfstools_libcthreads.h"
 #include "fsntfstools_libfsntfs.h"
 #include "fsntfstools_libfusn.h"
+#include "output_buffer.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The number of MFT entries in a bodyfile chunk
+ */
+#define INFO_HANDLE_BODYFILE_CHUNK_SIZE		1024
+
+/* The maximum number of bodyfile jobs
+ */
+#define INFO_HANDLE_MAXIMUM_NUMBER_OF_JOBS	64
+
+/* The size of the buffer used to read the USN records of the USN change journal
+ */
+#define INFO_HANDLE_USN_RECORDS_DATA_SIZE	( 1024 * 1024 )
+
+/* The number of threads used to parse the USN change journal
+ */
+#define INFO_HANDLE_USN_CHANGE_JOURNAL_NUMBER_OF_THREADS	4
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -59,14 +79,36 @@ struct info_handle
 	 */
 	libfsntfs_mft_metadata_file_t *input_mft_metadata_file;
 
-	/* Value to indicate if the MD5 hash should be calculated
+	/* The input filename
+	 */
+	system_character_t *input_filename;
+
+	/* The digest types to calculate
+	 */
+	uint8_t digest_types;
+
+	/* The digest handle
 	 */
-	uint8_t calculate_md5;
+	digest_handle_t *digest_handle;
+
+	/* The digest memo, to prevent hashing the data of a file entry
+	 * more than once
+	 */
+	digest_memo_t *digest_memo;
 
 	/* The bodyfile output stream
 	 */
 	FILE *bodyfile_stream;
 
+	/* The bodyfile output buffer, when set the bodyfile output is buffered
+	 * instead of written to the bodyfile output stream
+	 */
+	output_buffer_t *bodyfile_output_buffer;
+
+	/* The number of jobs used to generate the bodyfile
+	 */
+	int number_of_jobs;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -76,6 +118,98 @@ struct info_handle
 	int abort;
 };
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct info_handle_bodyfile_chunk info_handle_bodyfile_chunk_t;
+
+struct info_handle_bodyfile_chunk
+{
+	/* The output buffer
+	 */
+	output_buffer_t *output_buffer;
+
+	/* The index of the chunk the output buffer is reserved for
+	 */
+	uint64_t chunk_index;
+
+	/* Value to indicate the output buffer contains the formatted chunk
+	 */
+	int is_ready;
+};
+
+typedef struct info_handle_bodyfile_jobs info_handle_bodyfile_jobs_t;
+
+typedef struct info_handle_bodyfile_job info_handle_bodyfile_job_t;
+
+struct info_handle_bodyfile_job
+{
+	/* The bodyfile jobs
+	 */
+	info_handle_bodyfile_jobs_t *bodyfile_jobs;
+
+	/* The info handle of the job, which has its own input
+	 */
+	info_handle_t *info_handle;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+};
+
+struct info_handle_bodyfile_jobs
+{
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
+
+	/* The number of file entries
+	 */
+	uint64_t number_of_file_entries;
+
+	/* The number of chunks
+	 */
+	uint64_t number_of_chunks;
+
+	/* The index of the next chunk to be formatted
+	 */
+	uint64_t next_chunk_index;
+
+	/* The chunks, used as a ring buffer of the chunks that are being
+	 * formatted or waiting to be written
+	 */
+	info_handle_bodyfile_chunk_t *chunks;
+
+	/* The number of chunks in the ring buffer
+	 */
+	int number_of_ring_chunks;
+
+	/* The jobs
+	 */
+	info_handle_bodyfile_job_t *jobs;
+
+	/* The number of jobs
+	 */
+	int number_of_jobs;
+
+	/* Value to indicate the jobs should stop
+	 */
+	int stop_jobs;
+
+	/* Value to indicate a job has failed
+	 */
+	int has_failed;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition
+	 */
+	libcthreads_condition_t *condition;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int fsntfstools_system_string_copy_decimal_to_integer_64_bit(
      const system_character_t *string,
      size_t string_size,
@@ -98,7 +232,7 @@ const char *info_handle_get_attribute_type_description(
 
 int info_handle_initialize(
      info_handle_t **info_handle,
-     uint8_t calculate_md5,
+     uint8_t digest_types,
      libcerror_error_t **error );
 
 int info_handle_free(
@@ -119,6 +253,11 @@ int info_handle_set_volume_offset(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_set_number_of_jobs(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -128,11 +267,25 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
-int info_handle_file_entry_calculate_md5(
+int info_handle_file_entry_calculate_digests(
      info_handle_t *info_handle,
      libfsntfs_file_entry_t *file_entry,
-     char *md5_string,
-     size_t md5_string_size,
+     libfsntfs_data_stream_t *alternate_data_stream,
+     libcerror_error_t **error );
+
+int info_handle_file_entry_get_number_of_links(
+     info_handle_t *info_handle,
+     libfsntfs_file_entry_t *file_entry,
+     int *number_of_links,
+     libcerror_error_t **error );
+
+int info_handle_file_entry_get_digests(
+     info_handle_t *info_handle,
+     libfsntfs_file_entry_t *file_entry,
+     uint64_t file_reference,
+     libfsntfs_data_stream_t *alternate_data_stream,
+     const system_character_t *data_stream_name,
+     size_t data_stream_name_length,
      libcerror_error_t **error );
 
 int info_handle_name_value_fprint(
@@ -215,6 +368,11 @@ int info_handle_file_entry_value_fprint(
      libfsntfs_file_entry_t *file_entry,
      libcerror_error_t **error );
 
+int info_handle_bodyfile_printf(
+     info_handle_t *info_handle,
+     const char *format,
+     ... );
+
 int info_handle_bodyfile_name_value_fprint(
      info_handle_t *info_handle,
      const system_character_t *value_string,
@@ -287,6 +445,18 @@ int info_handle_mft_entry_fprint(
      uint64_t mft_entry_index,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int info_handle_bodyfile_job_callback_function(
+     info_handle_bodyfile_job_t *bodyfile_job );
+
+int info_handle_bodyfile_mft_entries_fprint(
+     info_handle_t *info_handle,
+     uint64_t number_of_file_entries,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int info_handle_mft_entries_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
@@ -321,6 +491,15 @@ int info_handle_volume_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_volume_calculate_digests(
+     info_handle_t *info_handle,
+     size64_t *volume_size,
+     libcerror_error_t **error );
+
+int info_handle_volume_digests_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
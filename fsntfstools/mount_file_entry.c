@@ -225,6 +225,22 @@ int mount_file_entry_free(
 			memory_free(
 			 ( *file_entry )->name );
 		}
+		if( ( *file_entry )->fsntfs_directory_iterator != NULL )
+		{
+			if( libfsntfs_directory_iterator_free(
+			     &( ( *file_entry )->fsntfs_directory_iterator ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory iterator.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libfsntfs_file_entry_free(
 		     &( ( *file_entry )->fsntfs_file_entry ),
 		     error ) != 1 )
@@ -992,6 +1008,223 @@ on_error:
 	return( -1 );
 }
 
+/* Positions the directory iterator of the file entry at a cursor
+ * A cursor of 0 represents the start of the directory
+ * Returns 1 if successful, 0 if the file entry has no sub file entries or -1 on error
+ */
+int mount_file_entry_set_directory_cursor(
+     mount_file_entry_t *file_entry,
+     uint64_t cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_set_directory_cursor";
+	int result            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->fsntfs_directory_iterator == NULL )
+	{
+		result = libfsntfs_file_entry_get_directory_iterator(
+		          file_entry->fsntfs_file_entry,
+		          &( file_entry->fsntfs_directory_iterator ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory iterator.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( libfsntfs_directory_iterator_set_cursor(
+	     file_entry->fsntfs_directory_iterator,
+	     cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory cursor: 0x%08" PRIx64 ".",
+		 function,
+		 cursor );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next sub file entry from the directory iterator of the file entry
+ * The cursor is set to the cursor that positions the directory iterator after the sub file entry
+ * Returns 1 if successful, 0 if no more sub file entries or -1 on error
+ */
+int mount_file_entry_get_next_sub_file_entry(
+     mount_file_entry_t *file_entry,
+     mount_file_entry_t **sub_file_entry,
+     uint64_t *cursor,
+     libcerror_error_t **error )
+{
+	libfsntfs_file_entry_t *sub_fsntfs_file_entry = NULL;
+	system_character_t *filename                  = NULL;
+	static char *function                         = "mount_file_entry_get_next_sub_file_entry";
+	size_t filename_size                          = 0;
+	int result                                    = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->fsntfs_directory_iterator == NULL )
+	{
+		return( 0 );
+	}
+	result = libfsntfs_directory_iterator_get_next_sub_file_entry(
+	          file_entry->fsntfs_directory_iterator,
+	          &sub_fsntfs_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next sub file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_directory_iterator_get_cursor(
+	     file_entry->fsntfs_directory_iterator,
+	     cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_system_get_filename_from_file_entry(
+	     file_entry->file_system,
+	     sub_fsntfs_file_entry,
+	     &filename,
+	     &filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename of sub file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_initialize(
+	     sub_file_entry,
+	     file_entry->file_system,
+	     filename,
+	     filename_size - 1,
+	     sub_fsntfs_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sub file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( sub_fsntfs_file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &sub_fsntfs_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Reads data at a specific offset
  * Returns the number of bytes read or -1 on error
  */
@@ -1061,6 +1294,138 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Seeks the start of the next data range at or after the offset
+ * Returns 1 if successful, 0 if no such offset or -1 on error
+ */
+int mount_file_entry_seek_data(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_seek_data";
+	int result            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_file_entry_has_default_data_stream(
+	          file_entry->fsntfs_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file entry has default data stream.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* Files such as $ObjId have no default data stream and therefore no data or holes
+		 */
+		return( 0 );
+	}
+	result = libfsntfs_file_entry_seek_data(
+	          file_entry->fsntfs_file_entry,
+	          offset,
+	          data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek data at offset: %" PRIi64 " (0x%08" PRIx64 ") in file entry.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Seeks the start of the next hole (sparse range) at or after the offset
+ * Returns 1 if successful, 0 if no such offset or -1 on error
+ */
+int mount_file_entry_seek_hole(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_seek_hole";
+	int result            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_file_entry_has_default_data_stream(
+	          file_entry->fsntfs_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file entry has default data stream.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* Files such as $ObjId have no default data stream and therefore no data or holes
+		 */
+		return( 0 );
+	}
+	result = libfsntfs_file_entry_seek_hole(
+	          file_entry->fsntfs_file_entry,
+	          offset,
+	          hole_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek hole at offset: %" PRIi64 " (0x%08" PRIx64 ") in file entry.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size
  * Returns 1 if successful or -1 on error
  */
@@ -52,6 +52,10 @@ struct mount_file_entry
 	/* The file entry
 	 */
 	libfsntfs_file_entry_t *fsntfs_file_entry;
+
+	/* The directory iterator, which is created on first use
+	 */
+	libfsntfs_directory_iterator_t *fsntfs_directory_iterator;
 };
 
 int mount_file_entry_initialize(
@@ -124,6 +128,17 @@ int mount_file_entry_get_sub_file_entry_by_index(
      mount_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+int mount_file_entry_set_directory_cursor(
+     mount_file_entry_t *file_entry,
+     uint64_t cursor,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_next_sub_file_entry(
+     mount_file_entry_t *file_entry,
+     mount_file_entry_t **sub_file_entry,
+     uint64_t *cursor,
+     libcerror_error_t **error );
+
 ssize_t mount_file_entry_read_buffer_at_offset(
          mount_file_entry_t *file_entry,
          void *buffer,
@@ -131,6 +146,18 @@ ssize_t mount_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+int mount_file_entry_seek_data(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error );
+
+int mount_file_entry_seek_hole(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error );
+
 int mount_file_entry_get_size(
      mount_file_entry_t *file_entry,
      size64_t *size,
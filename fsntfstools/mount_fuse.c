@@ -149,7 +149,9 @@ int mount_fuse_set_stat_info(
 }
 
 /* Fills a directory entry
- * Returns 1 if successful or -1 on error
+ * The next offset is the offset of the directory entry that follows, where 0
+ * indicates that the directory entries are not filled using offsets
+ * Returns 1 if successful, 0 if the buffer is full or -1 on error
  */
 int mount_fuse_filldir(
      void *buffer,
@@ -157,6 +159,7 @@ int mount_fuse_filldir(
      const char *name,
      mount_fuse_stat_t *stat_info,
      mount_file_entry_t *file_entry,
+     off_t next_offset,
      libcerror_error_t **error )
 {
 	static char *function      = "mount_fuse_filldir";
@@ -287,16 +290,20 @@ int mount_fuse_filldir(
 	     buffer,
 	     name,
 	     stat_info,
-	     0,
+	     next_offset,
 	     0 ) == 1 )
 #else
 	if( filler(
 	     buffer,
 	     name,
 	     stat_info,
-	     0 ) == 1 )
+	     next_offset ) == 1 )
 #endif
 	{
+		if( next_offset != 0 )
+		{
+			return( 0 );
+		}
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
@@ -521,6 +528,119 @@ on_error:
 	return( result );
 }
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+
+/* Seeks the next data or hole (sparse range) in a file entry
+ * Only SEEK_DATA and SEEK_HOLE are supported, other seeks are handled by FUSE
+ * Returns the resulting offset if successful or a negative errno value otherwise
+ */
+off_t mount_fuse_lseek(
+     const char *path,
+     off_t offset,
+     int whence,
+     struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_lseek";
+	off64_t result_offset    = 0;
+	int result               = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( whence == SEEK_DATA )
+	{
+		result = mount_file_entry_seek_data(
+		          (mount_file_entry_t *) file_info->fh,
+		          (off64_t) offset,
+		          &result_offset,
+		          &error );
+	}
+	else if( whence == SEEK_HOLE )
+	{
+		result = mount_file_entry_seek_hole(
+		          (mount_file_entry_t *) file_info->fh,
+		          (off64_t) offset,
+		          &result_offset,
+		          &error );
+	}
+	else
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek in file entry.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( (off_t) -ENXIO );
+	}
+	return( (off_t) result_offset );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( (off_t) result );
+}
+
+#endif /* defined( MOUNT_FUSE_HAVE_LSEEK ) */
+
 /* Releases a file entry
  * Returns 0 if successful or a negative errno value otherwise
  */
@@ -696,7 +816,7 @@ int mount_fuse_readdir(
      const char *path,
      void *buffer,
      mount_fuse_fill_dir_t filler,
-     off_t offset FSNTFSTOOLS_ATTRIBUTE_UNUSED,
+     off_t offset,
      struct fuse_file_info *file_info FSNTFSTOOLS_ATTRIBUTE_UNUSED,
      enum fuse_readdir_flags flags FSNTFSTOOLS_ATTRIBUTE_UNUSED )
 #else
@@ -704,7 +824,7 @@ int mount_fuse_readdir(
      const char *path,
      void *buffer,
      mount_fuse_fill_dir_t filler,
-     off_t offset FSNTFSTOOLS_ATTRIBUTE_UNUSED,
+     off_t offset,
      struct fuse_file_info *file_info FSNTFSTOOLS_ATTRIBUTE_UNUSED )
 #endif
 {
@@ -715,11 +835,8 @@ int mount_fuse_readdir(
 	static char *function                 = "mount_fuse_readdir";
 	char *name                            = NULL;
 	size_t name_size                      = 0;
-	int number_of_sub_file_entries        = 0;
+	uint64_t cursor                       = 0;
 	int result                            = 0;
-	int sub_file_entry_index              = 0;
-
-	FSNTFSTOOLS_UNREFERENCED_PARAMETER( offset )
 
 #if defined( HAVE_LIBFUSE3 )
 	FSNTFSTOOLS_UNREFERENCED_PARAMETER( flags )
@@ -789,115 +906,147 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
-	if( mount_fuse_filldir(
-	     buffer,
-	     filler,
-	     ".",
-	     stat_info,
-	     (mount_file_entry_t *) file_info->fh,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set self directory entry.",
-		 function );
+	/* The offsets 1 and 2 refer to the entries after the self and parent directory
+	 * entries, other offsets refer to the directory cursor + 2
+	 */
+	if( offset == 0 )
+	{
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          ".",
+		          stat_info,
+		          (mount_file_entry_t *) file_info->fh,
+		          1,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set self directory entry.",
+			 function );
 
-		result = -EIO;
+			result = -EIO;
 
-		goto on_error;
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			goto on_buffer_full;
+		}
 	}
-	result = mount_file_entry_get_parent_file_entry(
-	          (mount_file_entry_t *) file_info->fh,
-	          &parent_file_entry,
-	          &error );
-
-	if( result == -1 )
+	if( offset <= 1 )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve parent file entry.",
-		 function );
+		result = mount_file_entry_get_parent_file_entry(
+		          (mount_file_entry_t *) file_info->fh,
+		          &parent_file_entry,
+		          &error );
 
-		result = -EIO;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent file entry.",
+			 function );
 
-		goto on_error;
-	}
-	if( mount_fuse_filldir(
-	     buffer,
-	     filler,
-	     "..",
-	     stat_info,
-	     parent_file_entry,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set parent directory entry.",
-		 function );
+			result = -EIO;
 
-		result = -EIO;
+			goto on_error;
+		}
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          "..",
+		          stat_info,
+		          parent_file_entry,
+		          2,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set parent directory entry.",
+			 function );
 
-		goto on_error;
-	}
-	if( mount_file_entry_free(
-	     &parent_file_entry,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free parent file entry.",
-		 function );
+			result = -EIO;
 
-		result = -EIO;
+			goto on_error;
+		}
+		if( mount_file_entry_free(
+		     &parent_file_entry,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parent file entry.",
+			 function );
 
-		goto on_error;
+			result = -EIO;
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			goto on_buffer_full;
+		}
 	}
-	if( mount_file_entry_get_number_of_sub_file_entries(
-	     (mount_file_entry_t *) file_info->fh,
-	     &number_of_sub_file_entries,
-	     &error ) != 1 )
+	if( offset > 2 )
+	{
+		cursor = (uint64_t) offset - 2;
+	}
+	result = mount_file_entry_set_directory_cursor(
+	          (mount_file_entry_t *) file_info->fh,
+	          cursor,
+	          &error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub file entries.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory cursor.",
 		 function );
 
 		result = -EIO;
 
 		goto on_error;
 	}
-	for( sub_file_entry_index = 0;
-	     sub_file_entry_index < number_of_sub_file_entries;
-	     sub_file_entry_index++ )
+	while( result != 0 )
 	{
-		if( mount_file_entry_get_sub_file_entry_by_index(
-		     (mount_file_entry_t *) file_info->fh,
-		     sub_file_entry_index,
-		     &sub_file_entry,
-		     &error ) != 1 )
+		result = mount_file_entry_get_next_sub_file_entry(
+		          (mount_file_entry_t *) file_info->fh,
+		          &sub_file_entry,
+		          &cursor,
+		          &error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			 "%s: unable to retrieve next sub file entry.",
+			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
+		else if( result == 0 )
+		{
+			break;
+		}
 		if( mount_file_entry_get_name_size(
 		     sub_file_entry,
 		     &name_size,
@@ -907,9 +1056,8 @@ int mount_fuse_readdir(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name size.",
-			 function,
-			 sub_file_entry_index );
+			 "%s: unable to retrieve sub file entry name size.",
+			 function );
 
 			result = -EIO;
 
@@ -924,7 +1072,7 @@ int mount_fuse_readdir(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
 			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sub file entry: %d name.",
+			 "%s: unable to create sub file entry name.",
 			 function );
 
 			result = -EIO;
@@ -941,21 +1089,23 @@ int mount_fuse_readdir(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name.",
-			 function,
-			 sub_file_entry_index );
+			 "%s: unable to retrieve sub file entry name.",
+			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
-		if( mount_fuse_filldir(
-		     buffer,
-		     filler,
-		     name,
-		     stat_info,
-		     sub_file_entry,
-		     &error ) != 1 )
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          name,
+		          stat_info,
+		          sub_file_entry,
+		          (off_t) ( cursor + 2 ),
+		          &error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
@@ -981,15 +1131,15 @@ int mount_fuse_readdir(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			 "%s: unable to free sub file entry.",
+			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
 	}
+on_buffer_full:
 	memory_free(
 	 stat_info );
 
@@ -47,6 +47,14 @@
 #include <osxfuse/fuse.h>
 #endif
 
+/* The lseek operation, used for SEEK_DATA and SEEK_HOLE, requires libfuse 3.8 or later
+ */
+#if defined( HAVE_LIBFUSE3 ) && defined( FUSE_MAKE_VERSION ) && defined( SEEK_DATA ) && defined( SEEK_HOLE )
+#if FUSE_VERSION >= FUSE_MAKE_VERSION( 3, 8 )
+#define MOUNT_FUSE_HAVE_LSEEK	1
+#endif
+#endif
+
 #endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
 
 #include "fsntfstools_libcerror.h"
@@ -89,6 +97,7 @@ int mount_fuse_filldir(
      const char *name,
      mount_fuse_stat_t *stat_info,
      mount_file_entry_t *file_entry,
+     off_t next_offset,
      libcerror_error_t **error );
 
 int mount_fuse_open(
@@ -102,6 +111,14 @@ int mount_fuse_read(
      off_t offset,
      struct fuse_file_info *file_info );
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+off_t mount_fuse_lseek(
+     const char *path,
+     off_t offset,
+     int whence,
+     struct fuse_file_info *file_info );
+#endif
+
 int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info );
@@ -0,0 +1,407 @@
+/*
+ * Output buffer
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <stdarg.h>
+
+#include "fsntfstools_libcerror.h"
+#include "output_buffer.h"
+
+#if !defined( va_copy ) && defined( __va_copy )
+#define va_copy( destination, source ) \
+	__va_copy( destination, source )
+
+#elif !defined( va_copy )
+#define va_copy( destination, source ) \
+	memory_copy( &( destination ), &( source ), sizeof( va_list ) )
+#endif
+
+/* Creates an output buffer
+ * Make sure the value output_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_initialize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*output_buffer = memory_allocate_structure(
+	                  output_buffer_t );
+
+	if( *output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_buffer,
+	     0,
+	     sizeof( output_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output buffer.",
+		 function );
+
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+
+		return( -1 );
+	}
+	if( output_buffer_resize(
+	     *output_buffer,
+	     OUTPUT_BUFFER_INITIAL_ALLOCATED_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_free";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		if( ( *output_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *output_buffer )->data );
+		}
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties an output buffer
+ * The allocated data is retained so that the output buffer can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_empty(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_empty";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data_size = 0;
+
+	return( 1 );
+}
+
+/* Resizes an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_resize(
+     output_buffer_t *output_buffer,
+     size_t allocated_size,
+     libcerror_error_t **error )
+{
+	char *reallocation    = NULL;
+	static char *function = "output_buffer_resize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocated_size < output_buffer->data_size )
+	 || ( allocated_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocated size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size <= output_buffer->allocated_size )
+	{
+		return( 1 );
+	}
+	reallocation = (char *) memory_reallocate(
+	                         output_buffer->data,
+	                         sizeof( char ) * allocated_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data           = reallocation;
+	output_buffer->allocated_size = allocated_size;
+
+	return( 1 );
+}
+
+/* Appends a formatted string to an output buffer
+ * The end-of-string character is not considered part of the data
+ * Returns the number of printed characters if successful or -1 on error
+ */
+int output_buffer_vprintf(
+     output_buffer_t *output_buffer,
+     const char *format,
+     va_list argument_list )
+{
+	va_list argument_list_copy;
+
+	size_t allocated_size = 0;
+	size_t remaining_size = 0;
+	int print_count       = 0;
+
+	if( output_buffer == NULL )
+	{
+		return( -1 );
+	}
+	if( format == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		remaining_size = output_buffer->allocated_size - output_buffer->data_size;
+
+		va_copy(
+		 argument_list_copy,
+		 argument_list );
+
+		print_count = narrow_string_vsnprintf(
+		               &( output_buffer->data[ output_buffer->data_size ] ),
+		               remaining_size,
+		               format,
+		               argument_list_copy );
+
+		va_end(
+		 argument_list_copy );
+
+		if( ( print_count >= 0 )
+		 && ( (size_t) print_count < remaining_size ) )
+		{
+			output_buffer->data_size += (size_t) print_count;
+
+			return( print_count );
+		}
+		/* Some implementations of vsnprintf return -1 instead of the required size
+		 * if the formatted string does not fit
+		 */
+		if( print_count < 0 )
+		{
+			allocated_size = output_buffer->allocated_size * 2;
+		}
+		else
+		{
+			allocated_size = output_buffer->data_size + (size_t) print_count + 1;
+
+			if( allocated_size < ( output_buffer->allocated_size * 2 ) )
+			{
+				allocated_size = output_buffer->allocated_size * 2;
+			}
+		}
+		if( output_buffer_resize(
+		     output_buffer,
+		     allocated_size,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	while( 1 );
+}
+
+/* Appends a formatted string to an output buffer
+ * Returns the number of printed characters if successful or -1 on error
+ */
+int output_buffer_printf(
+     output_buffer_t *output_buffer,
+     const char *format,
+     ... )
+{
+	va_list argument_list;
+
+	int print_count = 0;
+
+	va_start(
+	 argument_list,
+	 format );
+
+	print_count = output_buffer_vprintf(
+	               output_buffer,
+	               format,
+	               argument_list );
+
+	va_end(
+	 argument_list );
+
+	return( print_count );
+}
+
+/* Prints the data of an output buffer to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_fprint(
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_fprint";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( file_stream_write(
+	     stream,
+	     output_buffer->data,
+	     output_buffer->data_size ) != output_buffer->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data to stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,95 @@
+/*
+ * Output buffer
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_BUFFER_H )
+#define _OUTPUT_BUFFER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <stdarg.h>
+
+#include "fsntfstools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial allocated size of the output buffer
+ */
+#define OUTPUT_BUFFER_INITIAL_ALLOCATED_SIZE	( 64 * 1024 )
+
+typedef struct output_buffer output_buffer_t;
+
+struct output_buffer
+{
+	/* The data
+	 */
+	char *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated size of the data
+	 */
+	size_t allocated_size;
+};
+
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_empty(
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_resize(
+     output_buffer_t *output_buffer,
+     size_t allocated_size,
+     libcerror_error_t **error );
+
+int output_buffer_vprintf(
+     output_buffer_t *output_buffer,
+     const char *format,
+     va_list argument_list );
+
+int output_buffer_printf(
+     output_buffer_t *output_buffer,
+     const char *format,
+     ... );
+
+int output_buffer_fprint(
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_BUFFER_H ) */
+
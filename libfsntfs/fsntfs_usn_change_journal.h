@@ -0,0 +1,63 @@
+/*
+ * The USN change journal ($UsnJrnl) maximum ($Max) data stream definition
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSNTFS_USN_CHANGE_JOURNAL_H )
+#define _FSNTFS_USN_CHANGE_JOURNAL_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsntfs_usn_change_journal_maximum fsntfs_usn_change_journal_maximum_t;
+
+struct fsntfs_usn_change_journal_maximum
+{
+	/* The maximum size
+	 * Consists of 8 bytes
+	 */
+	uint8_t maximum_size[ 8 ];
+
+	/* The allocation delta
+	 * Consists of 8 bytes
+	 */
+	uint8_t allocation_delta[ 8 ];
+
+	/* The journal identifier
+	 * Consists of 8 bytes
+	 * Contains a FILETIME
+	 */
+	uint8_t journal_identifier[ 8 ];
+
+	/* The lowest valid update sequence number (USN)
+	 * Consists of 8 bytes
+	 */
+	uint8_t lowest_valid_update_sequence_number[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSNTFS_USN_CHANGE_JOURNAL_H ) */
+
@@ -28,7 +28,10 @@
 #include "libfsntfs_compressed_block_data_handle.h"
 #include "libfsntfs_compressed_data_handle.h"
 #include "libfsntfs_definitions.h"
+#include "libfsntfs_extent.h"
+#include "libfsntfs_extent_map.h"
 #include "libfsntfs_io_handle.h"
+#include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_mft_attribute.h"
@@ -148,19 +151,27 @@ int libfsntfs_cluster_block_stream_initialize_from_data_runs(
 {
 	libfdata_stream_t *safe_data_stream          = NULL;
 	libfsntfs_data_run_t *data_run               = NULL;
+	libfsntfs_extent_map_t *extent_map           = NULL;
 	static char *function                        = "libfsntfs_cluster_block_stream_initialize_from_data_runs";
 	size64_t attribute_data_vcn_size             = 0;
 	size64_t calculated_allocated_data_size      = 0;
 	size64_t data_segment_size                   = 0;
+	size64_t extent_size                         = 0;
 	size64_t stored_allocated_data_size          = 0;
 	size64_t valid_data_size                     = 0;
 	off64_t attribute_data_vcn_offset            = 0;
 	off64_t calculated_attribute_data_vcn_offset = 0;
 	off64_t data_segment_offset                  = 0;
+	off64_t extent_data_offset                   = 0;
+	off64_t extent_physical_offset               = 0;
+	off64_t segment_offset                       = 0;
 	uint16_t attribute_data_flags                = 0;
+	uint8_t extent_flags                         = 0;
 	int attribute_index                          = 0;
 	int data_run_index                           = 0;
+	int extent_index                             = 0;
 	int number_of_data_runs                      = 0;
+	int number_of_extents                        = 0;
 	int segment_index                            = 0;
 
 	if( cluster_block_stream == NULL )
@@ -249,23 +260,15 @@ int libfsntfs_cluster_block_stream_initialize_from_data_runs(
 
 		goto on_error;
 	}
-	if( libfdata_stream_initialize(
-	     &safe_data_stream,
-	     NULL,
-	     NULL,
-	     NULL,
-	     NULL,
-	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsntfs_cluster_block_data_read_segment_data,
-	     NULL,
-	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsntfs_cluster_block_data_seek_segment_offset,
-	     0,
+	if( libfsntfs_extent_map_initialize(
+	     &extent_map,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data stream.",
+		 "%s: unable to create extent map.",
 		 function );
 
 		goto on_error;
@@ -400,20 +403,24 @@ int libfsntfs_cluster_block_stream_initialize_from_data_runs(
 			}
 			if( (size64_t) data_segment_offset < valid_data_size )
 			{
-				if( libfdata_stream_append_segment(
-				     safe_data_stream,
-				     &segment_index,
-				     0,
+				extent_flags = 0;
+
+				if( ( data_run->range_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+				{
+					extent_flags = LIBFSNTFS_EXTENT_FLAG_IS_SPARSE;
+				}
+				if( libfsntfs_extent_map_append_extent(
+				     extent_map,
 				     data_run->start_offset,
 				     data_segment_size,
-				     data_run->range_flags,
+				     extent_flags,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append attribute: %d data run: %d data stream segment.",
+					 "%s: unable to append attribute: %d data run: %d extent.",
 					 function,
 					 attribute_index,
 					 data_run_index );
@@ -455,6 +462,126 @@ int libfsntfs_cluster_block_stream_initialize_from_data_runs(
 
 		goto on_error;
 	}
+	if( libfsntfs_extent_map_get_number_of_extents(
+	     extent_map,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		goto on_error;
+	}
+	/* The extent map maps the data offsets to the volume offsets, only sparse extents
+	 * are stored as separate segments so that these can be identified in the stream
+	 */
+	if( libfdata_stream_initialize(
+	     &safe_data_stream,
+	     (intptr_t *) extent_map,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_extent_map_free,
+	     NULL,
+	     NULL,
+	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsntfs_extent_map_read_segment_data,
+	     NULL,
+	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsntfs_extent_map_seek_segment_offset,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data stream.",
+		 function );
+
+		goto on_error;
+	}
+	data_segment_size = 0;
+
+	for( extent_index = 0;
+	     extent_index <= number_of_extents;
+	     extent_index++ )
+	{
+		if( extent_index < number_of_extents )
+		{
+			if( libfsntfs_extent_map_get_extent_by_index(
+			     extent_map,
+			     extent_index,
+			     &extent_data_offset,
+			     &extent_physical_offset,
+			     &extent_size,
+			     &extent_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			if( ( extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) == 0 )
+			{
+				if( data_segment_size == 0 )
+				{
+					segment_offset = extent_data_offset;
+				}
+				data_segment_size += extent_size;
+
+				continue;
+			}
+		}
+		if( data_segment_size > 0 )
+		{
+			if( libfdata_stream_append_segment(
+			     safe_data_stream,
+			     &segment_index,
+			     0,
+			     segment_offset,
+			     data_segment_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data stream segment.",
+				 function );
+
+				goto on_error;
+			}
+			data_segment_size = 0;
+		}
+		if( extent_index < number_of_extents )
+		{
+			if( libfdata_stream_append_segment(
+			     safe_data_stream,
+			     &segment_index,
+			     0,
+			     extent_data_offset,
+			     extent_size,
+			     LIBFDATA_RANGE_FLAG_IS_SPARSE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sparse data stream segment.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 	if( (size64_t) data_segment_offset < data_size )
 	{
 		if( libfdata_stream_append_segment(
@@ -487,6 +614,12 @@ on_error:
 		 &safe_data_stream,
 		 NULL );
 	}
+	else if( extent_map != NULL )
+	{
+		libfsntfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -977,3 +1110,650 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the data or sparse range that starts at a specific segment
+ * Adjacent segments that are both data or both sparse are combined into a single range
+ * The segment index and offset are set to the segment and offset that follow the range,
+ * so that the ranges of the stream can be walked in a single pass
+ * Returns 1 if successful, 0 if there are no more ranges or -1 on error
+ */
+int libfsntfs_cluster_block_stream_get_next_range(
+     libfdata_stream_t *cluster_block_stream,
+     int number_of_segments,
+     int *segment_index,
+     off64_t *offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsntfs_cluster_block_stream_get_next_range";
+	size64_t segment_size        = 0;
+	off64_t range_end_offset     = 0;
+	off64_t range_start_offset   = 0;
+	off64_t segment_data_offset  = 0;
+	uint32_t safe_range_flags    = 0;
+	uint32_t segment_flags       = 0;
+	uint32_t segment_range_flags = 0;
+	uint8_t range_found          = 0;
+	int safe_segment_index       = 0;
+	int segment_file_index       = 0;
+
+	if( cluster_block_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cluster block stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid segment index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range flags.",
+		 function );
+
+		return( -1 );
+	}
+	safe_segment_index = *segment_index;
+	range_end_offset   = *offset;
+
+	while( safe_segment_index < number_of_segments )
+	{
+		if( libfdata_stream_get_segment_by_index(
+		     cluster_block_stream,
+		     safe_segment_index,
+		     &segment_file_index,
+		     &segment_data_offset,
+		     &segment_size,
+		     &segment_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment: %d.",
+			 function,
+			 safe_segment_index );
+
+			return( -1 );
+		}
+		if( segment_size == 0 )
+		{
+			safe_segment_index++;
+
+			continue;
+		}
+		segment_range_flags = 0;
+
+		if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+		{
+			segment_range_flags = LIBFSNTFS_EXTENT_FLAG_IS_SPARSE;
+		}
+		if( range_found == 0 )
+		{
+			range_start_offset = range_end_offset;
+			safe_range_flags   = segment_range_flags;
+			range_found        = 1;
+		}
+		else if( segment_range_flags != safe_range_flags )
+		{
+			break;
+		}
+		if( segment_size > (size64_t) ( INT64_MAX - range_end_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment: %d size value out of bounds.",
+			 function,
+			 safe_segment_index );
+
+			return( -1 );
+		}
+		range_end_offset += (off64_t) segment_size;
+
+		safe_segment_index++;
+	}
+	*segment_index = safe_segment_index;
+	*offset        = range_end_offset;
+
+	if( range_found == 0 )
+	{
+		return( 0 );
+	}
+	*range_offset = range_start_offset;
+	*range_size   = (size64_t) ( range_end_offset - range_start_offset );
+	*range_flags  = safe_range_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the data or sparse range that contains a specific offset
+ * Adjacent segments that are both data or both sparse are combined into a single range
+ * Returns 1 if successful, 0 if the offset is beyond the end of the stream or -1 on error
+ */
+int libfsntfs_cluster_block_stream_get_range_at_offset(
+     libfdata_stream_t *cluster_block_stream,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsntfs_cluster_block_stream_get_range_at_offset";
+	size64_t safe_range_size   = 0;
+	off64_t next_offset        = 0;
+	off64_t safe_range_offset  = 0;
+	uint32_t safe_range_flags  = 0;
+	int number_of_segments     = 0;
+	int result                 = 0;
+	int segment_index          = 0;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_number_of_segments(
+	     cluster_block_stream,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfsntfs_cluster_block_stream_get_next_range(
+		          cluster_block_stream,
+		          number_of_segments,
+		          &segment_index,
+		          &next_offset,
+		          &safe_range_offset,
+		          &safe_range_size,
+		          &safe_range_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range at segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	while( offset >= next_offset );
+
+	*range_offset = safe_range_offset;
+	*range_size   = safe_range_size;
+	*range_flags  = safe_range_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the first offset, at or after a specific offset, that contains data
+ * The ranges are walked in a single pass, sparse ranges are skipped
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libfsntfs_cluster_block_stream_get_data_offset(
+     libfdata_stream_t *cluster_block_stream,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfsntfs_cluster_block_stream_get_data_offset";
+	size64_t range_size    = 0;
+	off64_t next_offset    = 0;
+	off64_t range_offset   = 0;
+	uint32_t range_flags   = 0;
+	int number_of_segments = 0;
+	int result             = 0;
+	int segment_index      = 0;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_number_of_segments(
+	     cluster_block_stream,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfsntfs_cluster_block_stream_get_next_range(
+		          cluster_block_stream,
+		          number_of_segments,
+		          &segment_index,
+		          &next_offset,
+		          &range_offset,
+		          &range_size,
+		          &range_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range at segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	while( ( offset >= next_offset )
+	    || ( ( range_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 ) );
+
+	if( offset < range_offset )
+	{
+		offset = range_offset;
+	}
+	*data_offset = offset;
+
+	return( 1 );
+}
+
+/* Retrieves the first offset, at or after a specific offset, that is part of a hole (sparse range)
+ * The end of the stream is considered an implicit hole
+ * Returns 1 if successful, 0 if the offset is beyond the end of the stream or -1 on error
+ */
+int libfsntfs_cluster_block_stream_get_hole_offset(
+     libfdata_stream_t *cluster_block_stream,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfsntfs_cluster_block_stream_get_hole_offset";
+	size64_t range_size    = 0;
+	off64_t next_offset    = 0;
+	off64_t range_offset   = 0;
+	uint32_t range_flags   = 0;
+	int number_of_segments = 0;
+	int result             = 0;
+	int segment_index      = 0;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( hole_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hole offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_number_of_segments(
+	     cluster_block_stream,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfsntfs_cluster_block_stream_get_next_range(
+		          cluster_block_stream,
+		          number_of_segments,
+		          &segment_index,
+		          &next_offset,
+		          &range_offset,
+		          &range_size,
+		          &range_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range at segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	while( offset >= next_offset );
+
+	if( ( range_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+	{
+		*hole_offset = offset;
+	}
+	else
+	{
+		*hole_offset = next_offset;
+	}
+	return( 1 );
+}
+
+/* Retrieves the data and sparse ranges array
+ * The ranges are stored as extents, where the range flags contain LIBFSNTFS_EXTENT_FLAG_IS_SPARSE if the range is sparse
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_cluster_block_stream_get_ranges_array(
+     libfdata_stream_t *cluster_block_stream,
+     libcdata_array_t **ranges_array,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *safe_ranges_array = NULL;
+	libfsntfs_extent_t *range           = NULL;
+	static char *function               = "libfsntfs_cluster_block_stream_get_ranges_array";
+	size64_t range_size                 = 0;
+	off64_t next_offset                 = 0;
+	off64_t range_offset                = 0;
+	uint32_t range_flags                = 0;
+	int entry_index                     = 0;
+	int number_of_segments              = 0;
+	int result                          = 0;
+	int segment_index                   = 0;
+
+	if( ranges_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ranges array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_number_of_segments(
+	     cluster_block_stream,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &safe_ranges_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create ranges array.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libfsntfs_cluster_block_stream_get_next_range(
+		          cluster_block_stream,
+		          number_of_segments,
+		          &segment_index,
+		          &next_offset,
+		          &range_offset,
+		          &range_size,
+		          &range_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range at segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsntfs_extent_initialize(
+		     &range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create range.",
+			 function );
+
+			goto on_error;
+		}
+		range->start_offset = range_offset;
+		range->size         = range_size;
+		range->range_flags  = range_flags;
+
+		if( libcdata_array_append_entry(
+		     safe_ranges_array,
+		     &entry_index,
+		     (intptr_t *) range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append range to array.",
+			 function );
+
+			goto on_error;
+		}
+		range = NULL;
+	}
+	while( result == 1 );
+
+	*ranges_array = safe_ranges_array;
+
+	return( 1 );
+
+on_error:
+	if( range != NULL )
+	{
+		libfsntfs_extent_free(
+		 &range,
+		 NULL );
+	}
+	if( safe_ranges_array != NULL )
+	{
+		libcdata_array_free(
+		 &safe_ranges_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_extent_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
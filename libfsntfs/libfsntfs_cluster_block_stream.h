@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libfsntfs_io_handle.h"
+#include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_mft_attribute.h"
@@ -69,6 +70,41 @@ int libfsntfs_cluster_block_stream_initialize(
      uint32_t compression_method,
      libcerror_error_t **error );
 
+int libfsntfs_cluster_block_stream_get_next_range(
+     libfdata_stream_t *cluster_block_stream,
+     int number_of_segments,
+     int *segment_index,
+     off64_t *offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
+int libfsntfs_cluster_block_stream_get_range_at_offset(
+     libfdata_stream_t *cluster_block_stream,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
+int libfsntfs_cluster_block_stream_get_data_offset(
+     libfdata_stream_t *cluster_block_stream,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error );
+
+int libfsntfs_cluster_block_stream_get_hole_offset(
+     libfdata_stream_t *cluster_block_stream,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error );
+
+int libfsntfs_cluster_block_stream_get_ranges_array(
+     libfdata_stream_t *cluster_block_stream,
+     libcdata_array_t **ranges_array,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
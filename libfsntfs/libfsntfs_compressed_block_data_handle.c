@@ -27,11 +27,14 @@
 #include "libfsntfs_compressed_block_data_handle.h"
 #include "libfsntfs_compressed_block_vector.h"
 #include "libfsntfs_compression.h"
+#include "libfsntfs_compression_unit_data_handle.h"
+#include "libfsntfs_compression_unit_descriptor.h"
 #include "libfsntfs_definitions.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libfdata.h"
 #include "libfsntfs_mft_attribute.h"
 #include "libfsntfs_unused.h"
 
@@ -113,11 +116,27 @@ int libfsntfs_compressed_block_data_handle_initialize(
 
 		return( -1 );
 	}
-	if( libfsntfs_compressed_block_vector_initialize(
-	     &( ( *data_handle )->compressed_block_vector ),
+	if( libfsntfs_compression_unit_data_handle_initialize(
+	     &( ( *data_handle )->compression_unit_data_handle ),
 	     io_handle,
 	     mft_attribute,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compression unit data handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *data_handle )->compression_unit_size = ( *data_handle )->compression_unit_data_handle->compression_unit_size;
+
+	if( libfsntfs_compressed_block_vector_initialize_from_data_handle(
+	     &( ( *data_handle )->compressed_block_vector ),
+	     ( *data_handle )->compression_unit_data_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -167,6 +186,12 @@ on_error:
 			 &( ( *data_handle )->compressed_block_vector ),
 			 NULL );
 		}
+		if( ( *data_handle )->compression_unit_data_handle != NULL )
+		{
+			libfsntfs_compression_unit_data_handle_free(
+			 &( ( *data_handle )->compression_unit_data_handle ),
+			 NULL );
+		}
 		memory_free(
 		 *data_handle );
 
@@ -224,6 +249,19 @@ int libfsntfs_compressed_block_data_handle_free(
 
 			result = -1;
 		}
+		if( libfsntfs_compression_unit_data_handle_free(
+		     &( ( *data_handle )->compression_unit_data_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compression unit data handle.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *data_handle );
 
@@ -232,6 +270,145 @@ int libfsntfs_compressed_block_data_handle_free(
 	return( result );
 }
 
+/* Reads whole compression units at the current offset directly into data
+ * Returns 1 if successful, 0 if the compression units cannot be read directly or -1 on error
+ */
+int libfsntfs_compressed_block_data_handle_read_compression_units(
+     libfsntfs_compressed_block_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     size_t *read_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_compression_unit_descriptor_t *descriptor = NULL;
+	static char *function                               = "libfsntfs_compressed_block_data_handle_read_compression_units";
+	size64_t descriptor_offset                          = 0;
+	size64_t safe_read_size                             = 0;
+	int result                                          = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->compression_unit_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data handle - compression unit size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < data_handle->compression_unit_size )
+	 || ( ( data_handle->current_offset % data_handle->compression_unit_size ) != 0 ) )
+	{
+		return( 0 );
+	}
+	result = libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+	          data_handle->compression_unit_data_handle,
+	          data_handle->current_offset,
+	          &descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression unit descriptor at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_handle->current_offset,
+		 data_handle->current_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	descriptor_offset = (size64_t) ( data_handle->current_offset - descriptor->data_offset );
+	safe_read_size    = descriptor->compression_unit_size - descriptor_offset;
+
+	/* A compressed compression unit can only be decompressed as a whole
+	 */
+	if( ( descriptor->data_range_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+	{
+		if( ( descriptor_offset != 0 )
+		 || ( safe_read_size > (size64_t) data_size ) )
+		{
+			return( 0 );
+		}
+	}
+	else if( safe_read_size > (size64_t) data_size )
+	{
+		safe_read_size = ( data_size / data_handle->compression_unit_size ) * data_handle->compression_unit_size;
+	}
+	if( libfsntfs_compressed_block_vector_read_compression_unit_data(
+	     descriptor,
+	     file_io_handle,
+	     data_handle->current_offset,
+	     data,
+	     (size_t) safe_read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compression unit data.",
+		 function );
+
+		return( -1 );
+	}
+	*read_size = (size_t) safe_read_size;
+
+	return( 1 );
+}
+
 /* Reads data from the current offset into a compressed block
  * Callback for the data stream
  * Returns the number of bytes read or -1 on error
@@ -253,6 +430,7 @@ ssize_t libfsntfs_compressed_block_data_handle_read_segment_data(
 	size_t segment_data_offset                     = 0;
 	ssize_t read_count                             = 0;
 	off64_t compressed_block_offset                = 0;
+	int result                                     = 0;
 
 	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_index )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_file_index )
@@ -329,6 +507,47 @@ ssize_t libfsntfs_compressed_block_data_handle_read_segment_data(
 		}
 		while( segment_data_size > 0 )
 		{
+			/* Read whole compression units directly into the segment data
+			 * instead of decompressing them into the compressed block cache first
+			 */
+			if( ( data_handle->compression_unit_data_handle != NULL )
+			 && ( segment_data_size >= data_handle->compression_unit_size ) )
+			{
+				result = libfsntfs_compressed_block_data_handle_read_compression_units(
+				          data_handle,
+				          file_io_handle,
+				          &( segment_data[ segment_data_offset ] ),
+				          segment_data_size,
+				          &read_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read compression units at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 data_handle->current_offset,
+					 data_handle->current_offset );
+
+					return( -1 );
+				}
+				else if( result != 0 )
+				{
+					segment_data_offset += read_size;
+					segment_data_size   -= read_size;
+
+					data_handle->current_offset += read_size;
+
+					if( (size64_t) data_handle->current_offset >= data_handle->data_size )
+					{
+						break;
+					}
+					continue;
+				}
+			}
 			if( libfdata_vector_get_element_value_at_offset(
 			     data_handle->compressed_block_vector,
 			     (intptr_t *) file_io_handle,
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsntfs_compression_unit_data_handle.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcerror.h"
@@ -48,6 +49,14 @@ struct libfsntfs_compressed_block_data_handle
 	 */
 	size64_t data_size;
 
+	/* The compression unit data handle
+	 */
+	libfsntfs_compression_unit_data_handle_t *compression_unit_data_handle;
+
+	/* The compression unit size
+	 */
+	size_t compression_unit_size;
+
 	/* The compressed block vector
 	 */
 	libfdata_vector_t *compressed_block_vector;
@@ -67,6 +76,14 @@ int libfsntfs_compressed_block_data_handle_free(
      libfsntfs_compressed_block_data_handle_t **data_handle,
      libcerror_error_t **error );
 
+int libfsntfs_compressed_block_data_handle_read_compression_units(
+     libfsntfs_compressed_block_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     size_t *read_size,
+     libcerror_error_t **error );
+
 ssize_t libfsntfs_compressed_block_data_handle_read_segment_data(
          libfsntfs_compressed_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
@@ -47,11 +47,7 @@ int libfsntfs_compressed_block_vector_initialize(
 {
 	libfdata_vector_t *safe_compressed_block_vector       = NULL;
 	libfsntfs_compression_unit_data_handle_t *data_handle = NULL;
-	libfsntfs_compression_unit_descriptor_t *descriptor   = NULL;
 	static char *function                                 = "libfsntfs_compressed_block_vector_initialize";
-	int descriptor_index                                  = 0;
-	int number_of_descriptors                             = 0;
-	int segment_index                                     = 0;
 
 	if( compressed_block_vector == NULL )
 	{
@@ -121,6 +117,150 @@ int libfsntfs_compressed_block_vector_initialize(
 
 		goto on_error;
 	}
+	if( libfsntfs_compressed_block_vector_append_segments(
+	     safe_compressed_block_vector,
+	     data_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append compression unit segments to compressed block vector.",
+		 function );
+
+		data_handle = NULL;
+
+		goto on_error;
+	}
+	*compressed_block_vector = safe_compressed_block_vector;
+
+	return( 1 );
+
+on_error:
+	if( safe_compressed_block_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &safe_compressed_block_vector,
+		 NULL );
+	}
+	if( data_handle != NULL )
+	{
+		libfsntfs_compression_unit_data_handle_free(
+		 &data_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a compressed block vector from a compression unit data handle
+ * The data handle is not managed by the compressed block vector and must remain valid while the vector is used
+ * Make sure the value compressed_block_vector is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_compressed_block_vector_initialize_from_data_handle(
+     libfdata_vector_t **compressed_block_vector,
+     libfsntfs_compression_unit_data_handle_t *data_handle,
+     libcerror_error_t **error )
+{
+	libfdata_vector_t *safe_compressed_block_vector = NULL;
+	static char *function                           = "libfsntfs_compressed_block_vector_initialize_from_data_handle";
+
+	if( compressed_block_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_block_vector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid compressed block vector value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_vector_initialize(
+	     &safe_compressed_block_vector,
+	     (size64_t) data_handle->compression_unit_size,
+	     (intptr_t *) data_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsntfs_compressed_block_vector_read_element_data,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed block vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_compressed_block_vector_append_segments(
+	     safe_compressed_block_vector,
+	     data_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append compression unit segments to compressed block vector.",
+		 function );
+
+		goto on_error;
+	}
+	*compressed_block_vector = safe_compressed_block_vector;
+
+	return( 1 );
+
+on_error:
+	if( safe_compressed_block_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &safe_compressed_block_vector,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a segment for every compression unit descriptor to the compressed block vector
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_compressed_block_vector_append_segments(
+     libfdata_vector_t *compressed_block_vector,
+     libfsntfs_compression_unit_data_handle_t *data_handle,
+     libcerror_error_t **error )
+{
+	libfsntfs_compression_unit_descriptor_t *descriptor = NULL;
+	static char *function                               = "libfsntfs_compressed_block_vector_append_segments";
+	int descriptor_index                                = 0;
+	int number_of_descriptors                           = 0;
+	int segment_index                                   = 0;
+
 	if( libfsntfs_compression_unit_data_handle_get_number_of_descriptors(
 	     data_handle,
 	     &number_of_descriptors,
@@ -133,9 +273,7 @@ int libfsntfs_compressed_block_vector_initialize(
 		 "%s: unable to retrieve number of descriptors.",
 		 function );
 
-		data_handle = NULL;
-
-		goto on_error;
+		return( -1 );
 	}
 	for( descriptor_index = 0;
 	     descriptor_index < number_of_descriptors;
@@ -155,9 +293,7 @@ int libfsntfs_compressed_block_vector_initialize(
 			 function,
 			 descriptor_index );
 
-			data_handle = NULL;
-
-			goto on_error;
+			return( -1 );
 		}
 		if( descriptor == NULL )
 		{
@@ -169,12 +305,10 @@ int libfsntfs_compressed_block_vector_initialize(
 			 function,
 			 descriptor_index );
 
-			data_handle = NULL;
-
-			goto on_error;
+			return( -1 );
 		}
 		if( libfdata_vector_append_segment(
-		     safe_compressed_block_vector,
+		     compressed_block_vector,
 		     &segment_index,
 		     descriptor_index,
 		     descriptor->data_offset,
@@ -190,129 +324,111 @@ int libfsntfs_compressed_block_vector_initialize(
 			 function,
 			 descriptor_index );
 
-			data_handle = NULL;
-
-			goto on_error;
+			return( -1 );
 		}
 	}
-	*compressed_block_vector = safe_compressed_block_vector;
-
 	return( 1 );
-
-on_error:
-	if( safe_compressed_block_vector != NULL )
-	{
-		libfdata_vector_free(
-		 &safe_compressed_block_vector,
-		 NULL );
-	}
-	if( data_handle != NULL )
-	{
-		libfsntfs_compression_unit_data_handle_free(
-		 &data_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Reads a compressed block
- * Callback function for the compressed block vector
+/* Reads the data of a compression unit
+ * A compressed compression unit is decompressed directly into data, which must be
+ * the size of the compression unit, otherwise the data is read at the data offset
  * Returns 1 if successful or -1 on error
  */
-int libfsntfs_compressed_block_vector_read_element_data(
-     libfsntfs_compression_unit_data_handle_t *data_handle,
+int libfsntfs_compressed_block_vector_read_compression_unit_data(
+     libfsntfs_compression_unit_descriptor_t *compression_unit_descriptor,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfdata_cache_t *cache,
-     int element_index,
-     int element_data_file_index,
-     off64_t element_data_offset,
-     size64_t compressed_block_size,
-     uint32_t range_flags,
-     uint8_t read_flags LIBFSNTFS_ATTRIBUTE_UNUSED,
+     off64_t data_offset,
+     uint8_t *data,
+     size_t data_size,
      libcerror_error_t **error )
 {
-	libfsntfs_compressed_block_t *compressed_block                       = NULL;
-	libfsntfs_compression_unit_descriptor_t *compression_unit_descriptor = NULL;
-	uint8_t *compressed_block_data                                       = NULL;
-	uint8_t *compressed_data                                             = NULL;
-	const char *block_type                                               = NULL;
-	static char *function                                                = "libfsntfs_compressed_block_vector_read_element_data";
-	ssize_t read_count                                                   = 0;
-	off64_t data_stream_offset                                           = 0;
-	int result                                                           = 0;
-
-	LIBFSNTFS_UNREFERENCED_PARAMETER( read_flags )
+	uint8_t *compressed_data   = NULL;
+	uint8_t *read_buffer       = NULL;
+	const char *block_type     = NULL;
+	static char *function      = "libfsntfs_compressed_block_vector_read_compression_unit_data";
+	size_t uncompressed_size   = 0;
+	ssize_t read_count         = 0;
+	off64_t data_stream_offset = 0;
+	int result                 = 0;
 
-	if( ( compressed_block_size == 0 )
-	 || ( compressed_block_size > (size64_t) SSIZE_MAX ) )
+	if( compression_unit_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid compressed block size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression unit descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsntfs_compression_unit_data_handle_get_descriptor_by_index(
-	     data_handle,
-	     element_data_file_index,
-	     &compression_unit_descriptor,
-	     error ) != 1 )
+	if( ( data_offset < compression_unit_descriptor->data_offset )
+	 || ( (size64_t) ( data_offset - compression_unit_descriptor->data_offset ) >= compression_unit_descriptor->compression_unit_size ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve compression unit descriptor: %d.",
-		 function,
-		 element_data_file_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( compression_unit_descriptor == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing compression unit descriptor: %d.",
-		 function,
-		 element_data_file_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsntfs_compressed_block_initialize(
-	     &compressed_block,
-	     compressed_block_size,
-	     error ) != 1 )
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed block.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( compressed_block == NULL )
+	data_stream_offset = data_offset - compression_unit_descriptor->data_offset;
+
+	if( (size64_t) data_size > ( compression_unit_descriptor->compression_unit_size - data_stream_offset ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing compressed block.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( range_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+	if( ( compression_unit_descriptor->data_range_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
 	{
+		/* Make sure to read from the start of the data stream
+		 * otherwise successive reads will fail
+		 */
+		if( data_stream_offset != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 		compressed_data = (uint8_t *) memory_allocate(
-		                               sizeof( uint8_t ) * (size_t) compressed_block_size );
+		                               sizeof( uint8_t ) * data_size );
 
 		if( compressed_data == NULL )
 		{
@@ -325,32 +441,24 @@ int libfsntfs_compressed_block_vector_read_element_data(
 
 			goto on_error;
 		}
-		compressed_block_data = compressed_data;
-
-		/* Make sure to read from the start of the data stream
-		 * otherwise successive reads will fail
-		 */
-		data_stream_offset = 0;
-
-		block_type = "compressed";
+		read_buffer = compressed_data;
+		block_type  = "compressed";
 	}
 	else
 	{
-		compressed_block_data = compressed_block->data;
-		data_stream_offset    = element_data_offset - compression_unit_descriptor->data_offset;
-
-		block_type = "uncompressed";
+		read_buffer = data;
+		block_type  = "uncompressed";
 	}
 	read_count = libfdata_stream_read_buffer_at_offset(
 	              compression_unit_descriptor->data_stream,
 	              (intptr_t *) file_io_handle,
-	              compressed_block_data,
-	              compressed_block_size,
+	              read_buffer,
+	              data_size,
 	              data_stream_offset,
 	              0,
 	              error );
 
-	if( read_count != (ssize_t) compressed_block_size )
+	if( read_count != (ssize_t) data_size )
 	{
 		libcerror_error_set(
 		 error,
@@ -364,14 +472,16 @@ int libfsntfs_compressed_block_vector_read_element_data(
 
 		goto on_error;
 	}
-	if( ( range_flags & LIBFDATA_RANGE_FLAG_IS_COMPRESSED ) != 0 )
+	if( compressed_data != NULL )
 	{
+		uncompressed_size = data_size;
+
 		result = libfsntfs_decompress_data(
 		          compressed_data,
-		          (size_t) compressed_block_size,
+		          data_size,
 		          LIBFSNTFS_COMPRESSION_METHOD_LZNT1,
-		          compressed_block->data,
-		          &( compressed_block->data_size ),
+		          data,
+		          &uncompressed_size,
 		          error );
 
 		if( result != 1 )
@@ -393,12 +503,12 @@ int libfsntfs_compressed_block_vector_read_element_data(
 		/* If the compressed block data size is 0 or the compressed block was truncated
 		 * fill the remainder of the compressed block with 0-byte values
 		 */
-		if( compressed_block->data_size < compressed_block_size )
+		if( uncompressed_size < data_size )
 		{
 			if( memory_set(
-			     &( compressed_block->data[ compressed_block->data_size ] ),
+			     &( data[ uncompressed_size ] ),
 			     0,
-			     compressed_block_size - compressed_block->data_size ) == NULL )
+			     data_size - uncompressed_size ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
@@ -409,9 +519,126 @@ int libfsntfs_compressed_block_vector_read_element_data(
 
 				goto on_error;
 			}
-			compressed_block->data_size = compressed_block_size;
 		}
 	}
+	return( 1 );
+
+on_error:
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+/* Reads a compressed block
+ * Callback function for the compressed block vector
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_compressed_block_vector_read_element_data(
+     libfsntfs_compression_unit_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_vector_t *vector,
+     libfdata_cache_t *cache,
+     int element_index,
+     int element_data_file_index,
+     off64_t element_data_offset,
+     size64_t compressed_block_size,
+     uint32_t range_flags,
+     uint8_t read_flags LIBFSNTFS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libfsntfs_compressed_block_t *compressed_block                       = NULL;
+	libfsntfs_compression_unit_descriptor_t *compression_unit_descriptor = NULL;
+	static char *function                                                = "libfsntfs_compressed_block_vector_read_element_data";
+
+	LIBFSNTFS_UNREFERENCED_PARAMETER( range_flags )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( read_flags )
+
+	if( ( compressed_block_size == 0 )
+	 || ( compressed_block_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_compression_unit_data_handle_get_descriptor_by_index(
+	     data_handle,
+	     element_data_file_index,
+	     &compression_unit_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compression unit descriptor: %d.",
+		 function,
+		 element_data_file_index );
+
+		goto on_error;
+	}
+	if( compression_unit_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing compression unit descriptor: %d.",
+		 function,
+		 element_data_file_index );
+
+		goto on_error;
+	}
+	if( libfsntfs_compressed_block_initialize(
+	     &compressed_block,
+	     compressed_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed block.",
+		 function );
+
+		goto on_error;
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing compressed block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_compressed_block_vector_read_compression_unit_data(
+	     compression_unit_descriptor,
+	     file_io_handle,
+	     element_data_offset,
+	     compressed_block->data,
+	     compressed_block->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compression unit: %d data.",
+		 function,
+		 element_data_file_index );
+
+		goto on_error;
+	}
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
@@ -434,11 +661,6 @@ int libfsntfs_compressed_block_vector_read_element_data(
 	return( 1 );
 
 on_error:
-	if( compressed_data != NULL )
-	{
-		memory_free(
-		 compressed_data );
-	}
 	if( compressed_block != NULL )
 	{
 		libfsntfs_compressed_block_free(
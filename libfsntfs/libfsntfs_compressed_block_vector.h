@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libfsntfs_compression_unit_data_handle.h"
+#include "libfsntfs_compression_unit_descriptor.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcerror.h"
@@ -42,6 +43,24 @@ int libfsntfs_compressed_block_vector_initialize(
      libfsntfs_mft_attribute_t *mft_attribute,
      libcerror_error_t **error );
 
+int libfsntfs_compressed_block_vector_initialize_from_data_handle(
+     libfdata_vector_t **compressed_block_vector,
+     libfsntfs_compression_unit_data_handle_t *data_handle,
+     libcerror_error_t **error );
+
+int libfsntfs_compressed_block_vector_append_segments(
+     libfdata_vector_t *compressed_block_vector,
+     libfsntfs_compression_unit_data_handle_t *data_handle,
+     libcerror_error_t **error );
+
+int libfsntfs_compressed_block_vector_read_compression_unit_data(
+     libfsntfs_compression_unit_descriptor_t *compression_unit_descriptor,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsntfs_compressed_block_vector_read_element_data(
      libfsntfs_compression_unit_data_handle_t *data_handle,
      libbfio_handle_t *file_io_handle,
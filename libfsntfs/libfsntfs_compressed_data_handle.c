@@ -46,6 +46,8 @@ int libfsntfs_compressed_data_handle_initialize(
 {
 	static char *function        = "libfsntfs_compressed_data_handle_initialize";
 	size_t compression_unit_size = 0;
+	int number_of_cache_values   = 0;
+	int value_index              = 0;
 
 	if( data_handle == NULL )
 	{
@@ -146,54 +148,71 @@ int libfsntfs_compressed_data_handle_initialize(
 
 		return( -1 );
 	}
-	( *data_handle )->compressed_segment_data = (uint8_t *) memory_allocate(
-	                                                         sizeof( uint8_t ) * compression_unit_size );
+	number_of_cache_values = (int) ( LIBFSNTFS_COMPRESSED_DATA_HANDLE_MAXIMUM_CACHE_SIZE / compression_unit_size );
 
-	if( ( *data_handle )->compressed_segment_data == NULL )
+	( *data_handle )->cache_values = (libfsntfs_compressed_data_handle_cache_value_t *) memory_allocate(
+	                                                                                    sizeof( libfsntfs_compressed_data_handle_cache_value_t ) * number_of_cache_values );
+
+	if( ( *data_handle )->cache_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed segment data.",
+		 "%s: unable to create cache values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *data_handle )->cache_values,
+	     0,
+	     sizeof( libfsntfs_compressed_data_handle_cache_value_t ) * number_of_cache_values ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache values.",
 		 function );
 
 		goto on_error;
 	}
-	( *data_handle )->segment_data = (uint8_t *) memory_allocate(
-	                                              sizeof( uint8_t ) * compression_unit_size );
+	for( value_index = 0;
+	     value_index < number_of_cache_values;
+	     value_index++ )
+	{
+		( *data_handle )->cache_values[ value_index ].compressed_block_index = (uint64_t) -1;
+	}
+	( *data_handle )->pending_cache_values = (libfsntfs_compressed_data_handle_cache_value_t **) memory_allocate(
+	                                                                                             sizeof( libfsntfs_compressed_data_handle_cache_value_t * ) * number_of_cache_values );
 
-	if( ( *data_handle )->segment_data == NULL )
+	if( ( *data_handle )->pending_cache_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create segment data.",
+		 "%s: unable to create pending cache values.",
 		 function );
 
 		goto on_error;
 	}
-	( *data_handle )->compressed_data_stream         = compressed_data_stream;
-	( *data_handle )->current_compressed_block_index = (uint32_t) -1;
-	( *data_handle )->uncompressed_data_size         = uncompressed_data_size;
-	( *data_handle )->compression_method             = (int) compression_method;
-	( *data_handle )->compression_unit_size          = compression_unit_size;
+	( *data_handle )->compressed_data_stream = compressed_data_stream;
+	( *data_handle )->uncompressed_data_size = uncompressed_data_size;
+	( *data_handle )->compression_method     = (int) compression_method;
+	( *data_handle )->compression_unit_size  = compression_unit_size;
+	( *data_handle )->number_of_cache_values = number_of_cache_values;
 
 	return( 1 );
 
 on_error:
 	if( *data_handle != NULL )
 	{
-		if( ( *data_handle )->segment_data != NULL )
-		{
-			memory_free(
-			 ( *data_handle )->segment_data );
-		}
-		if( ( *data_handle )->compressed_segment_data != NULL )
+		if( ( *data_handle )->cache_values != NULL )
 		{
 			memory_free(
-			 ( *data_handle )->compressed_segment_data );
+			 ( *data_handle )->cache_values );
 		}
 		memory_free(
 		 *data_handle );
@@ -211,6 +230,7 @@ int libfsntfs_compressed_data_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfsntfs_compressed_data_handle_free";
+	int value_index       = 0;
 
 	if( data_handle == NULL )
 	{
@@ -225,15 +245,30 @@ int libfsntfs_compressed_data_handle_free(
 	}
 	if( *data_handle != NULL )
 	{
-		if( ( *data_handle )->segment_data != NULL )
+		if( ( *data_handle )->cache_values != NULL )
 		{
+			for( value_index = 0;
+			     value_index < ( *data_handle )->number_of_cache_values;
+			     value_index++ )
+			{
+				if( ( *data_handle )->cache_values[ value_index ].data != NULL )
+				{
+					memory_free(
+					 ( *data_handle )->cache_values[ value_index ].data );
+				}
+				if( ( *data_handle )->cache_values[ value_index ].compressed_data != NULL )
+				{
+					memory_free(
+					 ( *data_handle )->cache_values[ value_index ].compressed_data );
+				}
+			}
 			memory_free(
-			 ( *data_handle )->segment_data );
+			 ( *data_handle )->cache_values );
 		}
-		if( ( *data_handle )->compressed_segment_data != NULL )
+		if( ( *data_handle )->pending_cache_values != NULL )
 		{
 			memory_free(
-			 ( *data_handle )->compressed_segment_data );
+			 ( *data_handle )->pending_cache_values );
 		}
 		if( ( *data_handle )->compressed_block_offsets != NULL )
 		{
@@ -547,6 +582,707 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the cache value of a specific compressed block
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_compressed_data_handle_get_cache_value(
+     libfsntfs_compressed_data_handle_t *data_handle,
+     uint64_t compressed_block_index,
+     libfsntfs_compressed_data_handle_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_compressed_data_handle_get_cache_value";
+	int value_index       = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->cache_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing cache values.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < data_handle->number_of_cache_values;
+	     value_index++ )
+	{
+		if( data_handle->cache_values[ value_index ].compressed_block_index == compressed_block_index )
+		{
+			*cache_value = &( data_handle->cache_values[ value_index ] );
+
+			( *cache_value )->last_used = data_handle->cache_access_counter;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Decompresses the data of a cache value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_compressed_data_handle_decompress_cache_value(
+     libfsntfs_compressed_data_handle_t *data_handle,
+     libfsntfs_compressed_data_handle_cache_value_t *cache_value,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfsntfs_compressed_data_handle_decompress_cache_value";
+	size64_t uncompressed_block_offset = 0;
+	size_t data_size                   = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = cache_value->data_size;
+
+	if( libfsntfs_decompress_data(
+	     cache_value->compressed_data,
+	     cache_value->compressed_data_size,
+	     data_handle->compression_method,
+	     cache_value->output_data,
+	     &( cache_value->data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_block_offset = ( cache_value->compressed_block_index + 1 ) * data_handle->compression_unit_size;
+
+	/* When decompressing into the buffer of the caller the entire block must be filled
+	 */
+	if( cache_value->output_data != cache_value->data )
+	{
+		if( cache_value->data_size != data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( uncompressed_block_offset < data_handle->uncompressed_data_size )
+	      && ( cache_value->data_size != data_handle->compression_unit_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cache_value->compressed_data_size = 0;
+
+	return( 1 );
+}
+
+/* Callback function to decompress cache values in a thread
+ * Decompresses every number of threads pending cache value starting with the first value index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_compressed_data_handle_thread_callback_function(
+     libfsntfs_compressed_data_handle_thread_t *data_handle_thread )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libfsntfs_compressed_data_handle_thread_callback_function";
+	int value_index          = 0;
+
+	if( data_handle_thread == NULL )
+	{
+		return( -1 );
+	}
+	if( ( data_handle_thread->data_handle == NULL )
+	 || ( data_handle_thread->number_of_threads <= 0 ) )
+	{
+		return( -1 );
+	}
+	for( value_index = data_handle_thread->first_value_index;
+	     value_index < data_handle_thread->data_handle->number_of_pending_cache_values;
+	     value_index += data_handle_thread->number_of_threads )
+	{
+		if( libfsntfs_compressed_data_handle_decompress_cache_value(
+		     data_handle_thread->data_handle,
+		     data_handle_thread->data_handle->pending_cache_values[ value_index ],
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to decompress pending cache value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Decompresses the pending cache values
+ * The cache values are decompressed by multiple threads if multi-threading is supported
+ * and the pending cache values contain at least LIBFSNTFS_COMPRESSED_DATA_HANDLE_MINIMUM_PARALLEL_DECOMPRESSION_SIZE
+ * bytes of uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_compressed_data_handle_decompress_pending_cache_values(
+     libfsntfs_compressed_data_handle_t *data_handle,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	libfsntfs_compressed_data_handle_thread_t data_handle_threads[ LIBFSNTFS_COMPRESSED_DATA_HANDLE_MAXIMUM_NUMBER_OF_THREADS ];
+
+	int number_of_threads = 0;
+	int thread_index      = 0;
+#endif
+
+	static char *function = "libfsntfs_compressed_data_handle_decompress_pending_cache_values";
+	int result            = 1;
+	int value_index       = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( ( data_handle->number_of_pending_cache_values > 1 )
+	 && ( ( (size_t) data_handle->number_of_pending_cache_values * data_handle->compression_unit_size ) >= LIBFSNTFS_COMPRESSED_DATA_HANDLE_MINIMUM_PARALLEL_DECOMPRESSION_SIZE ) )
+	{
+		number_of_threads = data_handle->number_of_pending_cache_values;
+
+		if( number_of_threads > LIBFSNTFS_COMPRESSED_DATA_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			number_of_threads = LIBFSNTFS_COMPRESSED_DATA_HANDLE_MAXIMUM_NUMBER_OF_THREADS;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			data_handle_threads[ thread_index ].data_handle       = data_handle;
+			data_handle_threads[ thread_index ].first_value_index = thread_index;
+			data_handle_threads[ thread_index ].number_of_threads = number_of_threads;
+			data_handle_threads[ thread_index ].thread            = NULL;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcthreads_thread_create(
+			     &( data_handle_threads[ thread_index ].thread ),
+			     NULL,
+			     (int (*)(void *)) &libfsntfs_compressed_data_handle_thread_callback_function,
+			     (void *) &( data_handle_threads[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 thread_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		/* A thread can fail to decompress so the pending cache values are validated after all threads finished
+		 */
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( data_handle_threads[ thread_index ].thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( data_handle_threads[ thread_index ].thread ),
+				     NULL ) != 1 )
+				{
+					data_handle_threads[ thread_index ].thread = NULL;
+				}
+			}
+		}
+		if( result == 1 )
+		{
+			for( value_index = 0;
+			     value_index < data_handle->number_of_pending_cache_values;
+			     value_index++ )
+			{
+				if( data_handle->pending_cache_values[ value_index ]->compressed_data_size != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+					 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+					 "%s: unable to decompress compressed block: %" PRIu64 ".",
+					 function,
+					 data_handle->pending_cache_values[ value_index ]->compressed_block_index );
+
+					result = -1;
+
+					break;
+				}
+			}
+		}
+		data_handle->number_of_pending_cache_values = 0;
+
+		return( result );
+	}
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+
+	for( value_index = 0;
+	     value_index < data_handle->number_of_pending_cache_values;
+	     value_index++ )
+	{
+		if( libfsntfs_compressed_data_handle_decompress_cache_value(
+		     data_handle,
+		     data_handle->pending_cache_values[ value_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decompress compressed block: %" PRIu64 ".",
+			 function,
+			 data_handle->pending_cache_values[ value_index ]->compressed_block_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	data_handle->number_of_pending_cache_values = 0;
+
+	return( result );
+}
+
+/* Reads and decompresses a range of compressed blocks
+ * The compressed data is read sequentially after which the blocks are decompressed in parallel
+ * If data is set the blocks are decompressed directly into data, which must be large enough
+ * to contain all the blocks, otherwise the blocks are decompressed into the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_compressed_data_handle_read_blocks(
+     libfsntfs_compressed_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t first_compressed_block_index,
+     uint64_t number_of_compressed_blocks,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_compressed_data_handle_cache_value_t *cache_value = NULL;
+	uint8_t *read_buffer                                        = NULL;
+	uint8_t *output_data                                        = NULL;
+	static char *function                                       = "libfsntfs_compressed_data_handle_read_blocks";
+	size_t block_data_size                                      = 0;
+	size_t data_offset                                          = 0;
+	size_t read_size                                            = 0;
+	ssize_t read_count                                          = 0;
+	off64_t data_stream_offset                                  = 0;
+	uint64_t compressed_block_index                             = 0;
+	int result                                                  = 0;
+	int value_index                                             = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->compressed_block_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing compressed block offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_compressed_block_index >= data_handle->number_of_compressed_blocks )
+	 || ( number_of_compressed_blocks > ( data_handle->number_of_compressed_blocks - first_compressed_block_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Limit the number of blocks to the number of cache values so that
+	 * the blocks read do not replace each other
+	 */
+	if( number_of_compressed_blocks > (uint64_t) data_handle->number_of_cache_values )
+	{
+		number_of_compressed_blocks = (uint64_t) data_handle->number_of_cache_values;
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->cache_access_counter          += 1;
+	data_handle->number_of_pending_cache_values = 0;
+
+	for( compressed_block_index = first_compressed_block_index;
+	     compressed_block_index < ( first_compressed_block_index + number_of_compressed_blocks );
+	     compressed_block_index++ )
+	{
+		result = libfsntfs_compressed_data_handle_get_cache_value(
+		          data_handle,
+		          compressed_block_index,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value of compressed block: %" PRIu64 ".",
+			 function,
+			 compressed_block_index );
+
+			goto on_error;
+		}
+		block_data_size = data_handle->compression_unit_size;
+
+		if( (size64_t) block_data_size > ( data_handle->uncompressed_data_size - ( compressed_block_index * data_handle->compression_unit_size ) ) )
+		{
+			block_data_size = (size_t) ( data_handle->uncompressed_data_size - ( compressed_block_index * data_handle->compression_unit_size ) );
+		}
+		if( data != NULL )
+		{
+			if( block_data_size > ( data_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			output_data  = &( data[ data_offset ] );
+			data_offset += block_data_size;
+		}
+		if( result != 0 )
+		{
+			if( data != NULL )
+			{
+				if( memory_copy(
+				     output_data,
+				     cache_value->data,
+				     cache_value->data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy cached data of compressed block: %" PRIu64 ".",
+					 function,
+					 compressed_block_index );
+
+					goto on_error;
+				}
+			}
+			continue;
+		}
+		/* Use an unused cache value or the least recently used one that is not part of this read
+		 */
+		cache_value = NULL;
+
+		for( value_index = 0;
+		     value_index < data_handle->number_of_cache_values;
+		     value_index++ )
+		{
+			if( data_handle->cache_values[ value_index ].last_used == data_handle->cache_access_counter )
+			{
+				continue;
+			}
+			if( data_handle->cache_values[ value_index ].compressed_block_index == (uint64_t) -1 )
+			{
+				cache_value = &( data_handle->cache_values[ value_index ] );
+
+				break;
+			}
+			if( ( cache_value == NULL )
+			 || ( data_handle->cache_values[ value_index ].last_used < cache_value->last_used ) )
+			{
+				cache_value = &( data_handle->cache_values[ value_index ] );
+			}
+		}
+		if( cache_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing cache value.",
+			 function );
+
+			goto on_error;
+		}
+		cache_value->compressed_block_index = (uint64_t) -1;
+
+		data_stream_offset = data_handle->compressed_block_offsets[ compressed_block_index ];
+		read_size          = (size_t) ( data_handle->compressed_block_offsets[ compressed_block_index + 1 ] - data_stream_offset );
+
+		if( read_size > block_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( data == NULL )
+		{
+			output_data = cache_value->data;
+		}
+		if( output_data == NULL )
+		{
+			cache_value->data = (uint8_t *) memory_allocate(
+			                                 sizeof( uint8_t ) * data_handle->compression_unit_size );
+
+			if( cache_value->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create cache value data.",
+				 function );
+
+				goto on_error;
+			}
+			output_data = cache_value->data;
+		}
+		if( read_size < block_data_size )
+		{
+			if( cache_value->compressed_data == NULL )
+			{
+				cache_value->compressed_data = (uint8_t *) memory_allocate(
+				                                            sizeof( uint8_t ) * data_handle->compression_unit_size );
+
+				if( cache_value->compressed_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create cache value compressed data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			read_buffer = cache_value->compressed_data;
+		}
+		else
+		{
+			read_buffer = output_data;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compressed block: % 2" PRIu64 " offset\t: %" PRIu64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 compressed_block_index,
+			 data_stream_offset,
+			 data_stream_offset );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              data_handle->compressed_data_stream,
+		              (intptr_t *) file_io_handle,
+		              read_buffer,
+		              read_size,
+		              data_stream_offset,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from data stream.",
+			 function,
+			 data_stream_offset,
+			 data_stream_offset );
+
+			goto on_error;
+		}
+		/* The cache value is only used as scratch buffer for the compressed data
+		 * when decompressing directly into the buffer of the caller
+		 */
+		if( data == NULL )
+		{
+			cache_value->compressed_block_index = compressed_block_index;
+		}
+		cache_value->last_used   = data_handle->cache_access_counter;
+		cache_value->data_size   = block_data_size;
+		cache_value->output_data = output_data;
+
+		if( read_buffer == cache_value->compressed_data )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: compressed block data:\n",
+				 function );
+				libcnotify_print_data(
+				 cache_value->compressed_data,
+				 read_size,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			}
+#endif
+			cache_value->compressed_data_size = read_size;
+
+			data_handle->pending_cache_values[ data_handle->number_of_pending_cache_values++ ] = cache_value;
+		}
+		else
+		{
+			cache_value->compressed_data_size = 0;
+		}
+	}
+	if( libfsntfs_compressed_data_handle_decompress_pending_cache_values(
+	     data_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decompress compressed blocks.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* Make sure cache values that were not decompressed are not used
+	 */
+	for( value_index = 0;
+	     value_index < data_handle->number_of_cache_values;
+	     value_index++ )
+	{
+		if( data_handle->cache_values[ value_index ].compressed_data_size != 0 )
+		{
+			data_handle->cache_values[ value_index ].compressed_block_index = (uint64_t) -1;
+			data_handle->cache_values[ value_index ].compressed_data_size   = 0;
+		}
+	}
+	data_handle->number_of_pending_cache_values = 0;
+
+	return( -1 );
+}
+
 /* Reads data from the current offset into a compressed
  * Callback for the data stream
  * Returns the number of bytes read or -1 on error
@@ -562,15 +1298,15 @@ ssize_t libfsntfs_compressed_data_handle_read_segment_data(
          uint8_t read_flags LIBFSNTFS_ATTRIBUTE_UNUSED,
          libcerror_error_t **error )
 {
-	uint8_t *read_buffer              = NULL;
-	static char *function             = "libfsntfs_compressed_data_handle_read_segment_data";
-	size_t data_offset                = 0;
-	size_t read_size                  = 0;
-	size_t segment_data_offset        = 0;
-	ssize_t read_count                = 0;
-	off64_t data_stream_offset        = 0;
-	off64_t uncompressed_block_offset = 0;
-	uint64_t compressed_block_index   = 0;
+	libfsntfs_compressed_data_handle_cache_value_t *cache_value = NULL;
+	static char *function                                       = "libfsntfs_compressed_data_handle_read_segment_data";
+	size_t data_offset                                          = 0;
+	size_t read_size                                            = 0;
+	size_t segment_data_offset                                  = 0;
+	size64_t remaining_data_size                                = 0;
+	uint64_t compressed_block_index                             = 0;
+	uint64_t number_of_compressed_blocks                        = 0;
+	int result                                                  = 0;
 
 	LIBFSNTFS_UNREFERENCED_PARAMETER( file_io_handle )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_file_index )
@@ -645,6 +1381,8 @@ ssize_t libfsntfs_compressed_data_handle_read_segment_data(
 	compressed_block_index = (uint64_t) ( data_handle->current_offset / data_handle->compression_unit_size );
 	data_offset            = (size_t) ( data_handle->current_offset % data_handle->compression_unit_size );
 
+	data_handle->cache_access_counter += 1;
+
 	while( segment_data_size > 0 )
 	{
 		if( compressed_block_index >= data_handle->number_of_compressed_blocks )
@@ -658,133 +1396,148 @@ ssize_t libfsntfs_compressed_data_handle_read_segment_data(
 
 			return( -1 );
 		}
-		if( data_handle->current_compressed_block_index != compressed_block_index )
+		result = libfsntfs_compressed_data_handle_get_cache_value(
+		          data_handle,
+		          compressed_block_index,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
 		{
-			data_stream_offset = data_handle->compressed_block_offsets[ compressed_block_index ];
-			read_size          = (size_t) ( data_handle->compressed_block_offsets[ compressed_block_index + 1 ] - data_stream_offset );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value of compressed block: %" PRIu64 ".",
+			 function,
+			 compressed_block_index );
 
-			data_handle->segment_data_size = data_handle->compression_unit_size;
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* When whole blocks are requested decompress them directly into the segment data
+			 */
+			number_of_compressed_blocks = 0;
 
-			if( data_handle->segment_data_size > ( data_handle->uncompressed_data_size - data_handle->current_offset ) )
-			{
-				data_handle->segment_data_size = data_handle->uncompressed_data_size - data_handle->current_offset;
-			}
-			if( read_size > data_handle->segment_data_size )
+			if( data_offset == 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid segment data size value out of bounds.",
-				 function );
+				remaining_data_size = data_handle->uncompressed_data_size - data_handle->current_offset;
 
-				return( -1 );
+				if( (size64_t) segment_data_size >= remaining_data_size )
+				{
+					number_of_compressed_blocks = data_handle->number_of_compressed_blocks - compressed_block_index;
+					read_size                   = (size_t) remaining_data_size;
+				}
+				else
+				{
+					number_of_compressed_blocks = (uint64_t) ( segment_data_size / data_handle->compression_unit_size );
+					read_size                   = (size_t) number_of_compressed_blocks * data_handle->compression_unit_size;
+				}
+				if( number_of_compressed_blocks > (uint64_t) data_handle->number_of_cache_values )
+				{
+					number_of_compressed_blocks = (uint64_t) data_handle->number_of_cache_values;
+					read_size                   = (size_t) number_of_compressed_blocks * data_handle->compression_unit_size;
+				}
 			}
-			if( read_size < data_handle->segment_data_size )
+			if( number_of_compressed_blocks > 0 )
 			{
-				read_buffer = data_handle->compressed_segment_data;
+				if( libfsntfs_compressed_data_handle_read_blocks(
+				     data_handle,
+				     (libbfio_handle_t *) file_io_handle,
+				     compressed_block_index,
+				     number_of_compressed_blocks,
+				     &( segment_data[ segment_data_offset ] ),
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read compressed block: %" PRIu64 ".",
+					 function,
+					 compressed_block_index );
+
+					return( -1 );
+				}
+				segment_data_size   -= read_size;
+				segment_data_offset += read_size;
+
+				compressed_block_index += number_of_compressed_blocks;
+
+				data_handle->current_offset += read_size;
+
+				if( (size64_t) data_handle->current_offset >= data_handle->uncompressed_data_size )
+				{
+					break;
+				}
+				continue;
 			}
-			else
+			/* Read all the blocks that cover the remainder of the segment data at once
+			 * so that they can be decompressed in parallel
+			 */
+			number_of_compressed_blocks = (uint64_t) ( ( data_offset + segment_data_size ) / data_handle->compression_unit_size );
+
+			if( ( ( data_offset + segment_data_size ) % data_handle->compression_unit_size ) != 0 )
 			{
-				read_buffer = data_handle->segment_data;
+				number_of_compressed_blocks++;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( number_of_compressed_blocks > ( data_handle->number_of_compressed_blocks - compressed_block_index ) )
 			{
-				libcnotify_printf(
-				 "%s: compressed block: % 2" PRIu64 " offset\t: %" PRIu64 " (0x%08" PRIx64 ")\n",
-				 function,
-				 compressed_block_index,
-				 data_stream_offset,
-				 data_stream_offset );
-
-				libcnotify_printf(
-				 "\n" );
+				number_of_compressed_blocks = data_handle->number_of_compressed_blocks - compressed_block_index;
 			}
-#endif
-			read_count = libfdata_stream_read_buffer_at_offset(
-			              data_handle->compressed_data_stream,
-			              (intptr_t *) file_io_handle,
-			              read_buffer,
-			              read_size,
-			              data_stream_offset,
-			              0,
-			              error );
-
-			if( read_count != (ssize_t) read_size )
+			if( libfsntfs_compressed_data_handle_read_blocks(
+			     data_handle,
+			     (libbfio_handle_t *) file_io_handle,
+			     compressed_block_index,
+			     number_of_compressed_blocks,
+			     NULL,
+			     0,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_IO,
 				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from data stream.",
+				 "%s: unable to read compressed block: %" PRIu64 ".",
 				 function,
-				 data_stream_offset,
-				 data_stream_offset );
+				 compressed_block_index );
 
 				return( -1 );
 			}
-			if( read_buffer == data_handle->compressed_segment_data )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: compressed block data:\n",
-					 function );
-					libcnotify_print_data(
-					 data_handle->compressed_segment_data,
-					 read_size,
-					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-				}
-#endif
-				if( libfsntfs_decompress_data(
-				     data_handle->compressed_segment_data,
-				     (size_t) read_count,
-				     data_handle->compression_method,
-				     data_handle->segment_data,
-				     &( data_handle->segment_data_size ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-					 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-					 "%s: unable to decompress data.",
-					 function );
+			result = libfsntfs_compressed_data_handle_get_cache_value(
+			          data_handle,
+			          compressed_block_index,
+			          &cache_value,
+			          error );
 
-					return( -1 );
-				}
-				uncompressed_block_offset = ( compressed_block_index + 1 ) * data_handle->compression_unit_size;
-
-				if( ( (size64_t) uncompressed_block_offset < data_handle->uncompressed_data_size )
-				 && ( data_handle->segment_data_size != data_handle->compression_unit_size ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid uncompressed segment data size value out of bounds.",
-					 function );
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cache value of compressed block: %" PRIu64 ".",
+				 function,
+				 compressed_block_index );
 
-					return( -1 );
-				}
+				return( -1 );
 			}
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: uncompressed block data:\n",
-				 function );
-				libcnotify_print_data(
-				 data_handle->segment_data,
-				 data_handle->segment_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-			}
-#endif
-			data_handle->current_compressed_block_index = compressed_block_index;
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: uncompressed block data:\n",
+			 function );
+			libcnotify_print_data(
+			 cache_value->data,
+			 cache_value->data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
-		if( data_offset >= data_handle->segment_data_size )
+#endif
+		if( data_offset >= cache_value->data_size )
 		{
 			libcerror_error_set(
 			 error,
@@ -795,7 +1548,7 @@ ssize_t libfsntfs_compressed_data_handle_read_segment_data(
 
 			return( -1 );
 		}
-		read_size = data_handle->segment_data_size - data_offset;
+		read_size = cache_value->data_size - data_offset;
 
 		if( read_size > segment_data_size )
 		{
@@ -803,7 +1556,7 @@ ssize_t libfsntfs_compressed_data_handle_read_segment_data(
 		}
 		if( memory_copy(
 		     &( segment_data[ segment_data_offset ] ),
-		     &( data_handle->segment_data[ data_offset ] ),
+		     &( cache_value->data[ data_offset ] ),
 		     read_size ) == NULL )
 		{
 			libcerror_error_set(
@@ -27,14 +27,85 @@
 
 #include "libfsntfs_libbfio.h"
 #include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
 #include "libfsntfs_libfdata.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum size of the decompressed blocks kept in the cache
+ */
+#define LIBFSNTFS_COMPRESSED_DATA_HANDLE_MAXIMUM_CACHE_SIZE		( 256 * 1024 )
+
+/* The maximum number of threads used to decompress blocks
+ */
+#define LIBFSNTFS_COMPRESSED_DATA_HANDLE_MAXIMUM_NUMBER_OF_THREADS	4
+
+/* The minimum size of the pending compression units that are decompressed by multiple threads,
+ * smaller sizes are decompressed serially since creating and joining the threads costs more
+ * than it saves
+ */
+#define LIBFSNTFS_COMPRESSED_DATA_HANDLE_MINIMUM_PARALLEL_DECOMPRESSION_SIZE	( 128 * 1024 )
+
+typedef struct libfsntfs_compressed_data_handle_cache_value libfsntfs_compressed_data_handle_cache_value_t;
+
+struct libfsntfs_compressed_data_handle_cache_value
+{
+	/* The compressed block index, which is -1 if not set
+	 */
+	uint64_t compressed_block_index;
+
+	/* The value to indicate when the cache value was last used
+	 */
+	uint64_t last_used;
+
+	/* The compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size, which is 0 if the data is not compressed
+	 */
+	size_t compressed_data_size;
+
+	/* The (uncompressed) data
+	 */
+	uint8_t *data;
+
+	/* The (uncompressed) data size
+	 */
+	size_t data_size;
+
+	/* The buffer to decompress into, which is either the data or the buffer of the caller
+	 */
+	uint8_t *output_data;
+};
+
 typedef struct libfsntfs_compressed_data_handle libfsntfs_compressed_data_handle_t;
 
+typedef struct libfsntfs_compressed_data_handle_thread libfsntfs_compressed_data_handle_thread_t;
+
+struct libfsntfs_compressed_data_handle_thread
+{
+	/* The data handle
+	 */
+	libfsntfs_compressed_data_handle_t *data_handle;
+
+	/* The index of the first cache value to decompress
+	 */
+	int first_value_index;
+
+	/* The number of threads, which is the step between the cache values to decompress
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
 struct libfsntfs_compressed_data_handle
 {
 	/* The current offset
@@ -53,21 +124,25 @@ struct libfsntfs_compressed_data_handle
 	 */
 	int compression_method;
 
-	/* The current compressed block index
+	/* The cache values of the decompressed blocks
+	 */
+	libfsntfs_compressed_data_handle_cache_value_t *cache_values;
+
+	/* The number of cache values
 	 */
-	uint32_t current_compressed_block_index;
+	int number_of_cache_values;
 
-	/* The compressed segment data
+	/* The cache values that are pending decompression
 	 */
-	uint8_t *compressed_segment_data;
+	libfsntfs_compressed_data_handle_cache_value_t **pending_cache_values;
 
-	/* The (uncompressed) segment data
+	/* The number of cache values that are pending decompression
 	 */
-	uint8_t *segment_data;
+	int number_of_pending_cache_values;
 
-	/* The (uncompressed) segment data size
+	/* The cache access counter
 	 */
-	size_t segment_data_size;
+	uint64_t cache_access_counter;
 
 	/* The number of compressed blocks
 	 */
@@ -98,6 +173,33 @@ int libfsntfs_compressed_data_handle_get_compressed_block_offsets(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfsntfs_compressed_data_handle_get_cache_value(
+     libfsntfs_compressed_data_handle_t *data_handle,
+     uint64_t compressed_block_index,
+     libfsntfs_compressed_data_handle_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
+int libfsntfs_compressed_data_handle_decompress_cache_value(
+     libfsntfs_compressed_data_handle_t *data_handle,
+     libfsntfs_compressed_data_handle_cache_value_t *cache_value,
+     libcerror_error_t **error );
+
+int libfsntfs_compressed_data_handle_thread_callback_function(
+     libfsntfs_compressed_data_handle_thread_t *data_handle_thread );
+
+int libfsntfs_compressed_data_handle_decompress_pending_cache_values(
+     libfsntfs_compressed_data_handle_t *data_handle,
+     libcerror_error_t **error );
+
+int libfsntfs_compressed_data_handle_read_blocks(
+     libfsntfs_compressed_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t first_compressed_block_index,
+     uint64_t number_of_compressed_blocks,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 ssize_t libfsntfs_compressed_data_handle_read_segment_data(
          libfsntfs_compressed_data_handle_t *data_handle,
          intptr_t *file_io_handle,
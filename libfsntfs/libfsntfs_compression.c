@@ -31,6 +31,8 @@
 #include "libfsntfs_definitions.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libfwnt.h"
+#include "libfsntfs_lznt1.h"
+#include "libfsntfs_lzxpress_huffman.h"
 
 /* Decompresses data using the compression method
  * Returns 1 on success, 0 on failure or -1 on error
@@ -92,7 +94,7 @@ int libfsntfs_decompress_data(
 	switch( compression_method )
 	{
 		case LIBFSNTFS_COMPRESSION_METHOD_LZNT1:
-			if( libfwnt_lznt1_decompress(
+			if( libfsntfs_lznt1_decompress(
 			     compressed_data,
 			     compressed_data_size,
 			     uncompressed_data,
@@ -130,7 +132,7 @@ int libfsntfs_decompress_data(
 			break;
 
 		case LIBFSNTFS_COMPRESSION_METHOD_LZXPRESS_HUFFMAN:
-			if( libfwnt_lzxpress_huffman_decompress(
+			if( libfsntfs_lzxpress_huffman_decompress(
 			     compressed_data,
 			     compressed_data_size,
 			     uncompressed_data,
@@ -161,3 +163,128 @@ int libfsntfs_decompress_data(
 	return( 1 );
 }
 
+/* Copies a match of previously uncompressed data to the current offset
+ * The match offset is relative to the current offset and the match can overlap the current offset
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_compression_copy_match(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     size_t match_offset,
+     size_t match_size,
+     libcerror_error_t **error )
+{
+	uint8_t *match_data   = NULL;
+	uint8_t *output_data  = NULL;
+	static char *function = "libfsntfs_compression_copy_match";
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size > (size_t) SSIZE_MAX )
+	 || ( uncompressed_data_offset > uncompressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( match_offset == 0 )
+	 || ( match_offset > uncompressed_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_size > ( uncompressed_data_size - uncompressed_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	output_data = &( uncompressed_data[ uncompressed_data_offset ] );
+	match_data  = &( uncompressed_data[ uncompressed_data_offset - match_offset ] );
+
+	if( match_offset == 1 )
+	{
+		/* A match with offset 1 repeats a single byte value
+		 */
+		if( memory_set(
+		     output_data,
+		     match_data[ 0 ],
+		     match_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set match data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* Copy the match in blocks of 16 or 8 bytes where the source of a block
+	 * does not overlap the destination of the same block
+	 */
+	if( match_offset >= 16 )
+	{
+		while( match_size >= 16 )
+		{
+			memory_copy(
+			 output_data,
+			 match_data,
+			 16 );
+
+			output_data += 16;
+			match_data  += 16;
+			match_size  -= 16;
+		}
+	}
+	if( match_offset >= 8 )
+	{
+		while( match_size >= 8 )
+		{
+			memory_copy(
+			 output_data,
+			 match_data,
+			 8 );
+
+			output_data += 8;
+			match_data  += 8;
+			match_size  -= 8;
+		}
+	}
+	while( match_size > 0 )
+	{
+		*output_data++ = *match_data++;
+
+		match_size--;
+	}
+	return( 1 );
+}
+
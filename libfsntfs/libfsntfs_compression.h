@@ -39,6 +39,14 @@ int libfsntfs_decompress_data(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int libfsntfs_compression_copy_match(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     size_t match_offset,
+     size_t match_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -786,3 +786,112 @@ int libfsntfs_compression_unit_data_handle_get_descriptor_by_index(
 	return( 1 );
 }
 
+/* Retrieves the descriptor that contains a specific offset
+ * The descriptors are stored consecutively in ascending data offset order
+ * Returns 1 if successful, 0 if no such descriptor or -1 on error
+ */
+int libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+     libfsntfs_compression_unit_data_handle_t *data_handle,
+     off64_t offset,
+     libfsntfs_compression_unit_descriptor_t **descriptor,
+     libcerror_error_t **error )
+{
+	libfsntfs_compression_unit_descriptor_t *safe_descriptor = NULL;
+	static char *function                                    = "libfsntfs_compression_unit_data_handle_get_descriptor_at_offset";
+	int descriptor_index                                     = 0;
+	int first_descriptor_index                               = 0;
+	int last_descriptor_index                                = 0;
+	int number_of_descriptors                                = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     data_handle->descriptors_array,
+	     &number_of_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		return( 0 );
+	}
+	last_descriptor_index = number_of_descriptors - 1;
+
+	while( first_descriptor_index <= last_descriptor_index )
+	{
+		descriptor_index = first_descriptor_index + ( ( last_descriptor_index - first_descriptor_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     data_handle->descriptors_array,
+		     descriptor_index,
+		     (intptr_t **) &safe_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from descriptors array.",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		if( safe_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing descriptor: %d.",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		if( offset < safe_descriptor->data_offset )
+		{
+			last_descriptor_index = descriptor_index - 1;
+		}
+		else if( (size64_t) ( offset - safe_descriptor->data_offset ) >= safe_descriptor->compression_unit_size )
+		{
+			first_descriptor_index = descriptor_index + 1;
+		}
+		else
+		{
+			*descriptor = safe_descriptor;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
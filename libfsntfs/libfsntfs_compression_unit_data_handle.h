@@ -68,6 +68,12 @@ int libfsntfs_compression_unit_data_handle_get_descriptor_by_index(
      libfsntfs_compression_unit_descriptor_t **descriptor,
      libcerror_error_t **error );
 
+int libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+     libfsntfs_compression_unit_data_handle_t *data_handle,
+     off64_t offset,
+     libfsntfs_compression_unit_descriptor_t **descriptor,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -29,6 +30,22 @@
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
 
+/* The masks of the value sizes, value sizes of 8 or more bytes are not masked
+ */
+const uint64_t libfsntfs_data_run_value_masks[ 16 ] = {
+	0x0000000000000000ULL, 0x00000000000000ffULL, 0x000000000000ffffULL, 0x0000000000ffffffULL,
+	0x00000000ffffffffULL, 0x000000ffffffffffULL, 0x0000ffffffffffffULL, 0x00ffffffffffffffULL,
+	0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+	0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL };
+
+/* The sign bit masks of the value sizes, value sizes of 8 or more bytes are not sign extended
+ */
+const uint64_t libfsntfs_data_run_sign_bit_masks[ 16 ] = {
+	0x0000000000000000ULL, 0x0000000000000080ULL, 0x0000000000008000ULL, 0x0000000000800000ULL,
+	0x0000000080000000ULL, 0x0000008000000000ULL, 0x0000800000000000ULL, 0x0080000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+	0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL };
+
 /* Creates a data run
  * Make sure the value data_run is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -417,3 +434,320 @@ ssize_t libfsntfs_data_run_read_data(
 	return( (ssize_t) data_offset );
 }
 
+/* Reads a list of data runs into a flat array in a single pass
+ * The data runs are decoded with fixed size little-endian loads that are masked to the
+ * value sizes, which avoids a loop and a branch per value byte. The end of the data runs
+ * is padded with zero bytes so the same loads can be used for the last data runs
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libfsntfs_data_run_read_list_data(
+         libfsntfs_data_run_t **data_runs,
+         int *number_of_data_runs,
+         libfsntfs_io_handle_t *io_handle,
+         const uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	uint8_t padded_data[ LIBFSNTFS_DATA_RUN_PADDED_DATA_SIZE ];
+
+	libfsntfs_data_run_t *data_run       = NULL;
+	libfsntfs_data_run_t *reallocation   = NULL;
+	libfsntfs_data_run_t *safe_data_runs = NULL;
+	const uint8_t *data_run_data         = NULL;
+	static char *function                = "libfsntfs_data_run_read_list_data";
+	size_t data_offset                   = 0;
+	size_t data_run_data_size            = 0;
+	size_t maximum_number_of_data_runs   = 0;
+	size_t remaining_data_size           = 0;
+	uint64_t cluster_block_number        = 0;
+	uint64_t is_negative                 = 0;
+	uint64_t is_sparse                   = 0;
+	uint64_t last_cluster_block_number   = 0;
+	uint64_t number_of_cluster_blocks    = 0;
+	uint8_t cluster_block_value_size     = 0;
+	uint8_t number_of_blocks_value_size  = 0;
+	int safe_number_of_data_runs         = 0;
+
+	if( data_runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data runs.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_runs != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data runs value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of data runs.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 1 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every data run consists of at least 2 bytes
+	 */
+	maximum_number_of_data_runs = data_size / 2;
+
+	if( maximum_number_of_data_runs > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsntfs_data_run_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of data runs value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_data_runs > (size_t) INT_MAX )
+	{
+		maximum_number_of_data_runs = (size_t) INT_MAX;
+	}
+	if( maximum_number_of_data_runs > 0 )
+	{
+		safe_data_runs = (libfsntfs_data_run_t *) memory_allocate(
+		                                           sizeof( libfsntfs_data_run_t ) * maximum_number_of_data_runs );
+
+		if( safe_data_runs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data runs.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( data_offset < data_size )
+	{
+		data_run_data       = &( data[ data_offset ] );
+		remaining_data_size = data_size - data_offset;
+
+		if( remaining_data_size < LIBFSNTFS_DATA_RUN_PADDED_DATA_SIZE )
+		{
+			if( memory_set(
+			     padded_data,
+			     0,
+			     LIBFSNTFS_DATA_RUN_PADDED_DATA_SIZE ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear padded data.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     padded_data,
+			     data_run_data,
+			     remaining_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy padded data.",
+				 function );
+
+				goto on_error;
+			}
+			data_run_data = padded_data;
+		}
+		number_of_blocks_value_size = data_run_data[ 0 ] & 0x0f;
+		cluster_block_value_size    = data_run_data[ 0 ] >> 4;
+
+		data_run_data_size = 1 + number_of_blocks_value_size + cluster_block_value_size;
+
+		if( data_run_data_size > remaining_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		/* A number of cluster blocks value size of zero indicates the end of the data runs.
+		 */
+		if( number_of_blocks_value_size == 0 )
+		{
+			data_offset += 1;
+
+			break;
+		}
+		if( (size_t) safe_number_of_data_runs >= maximum_number_of_data_runs )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of data runs value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		/* Value sizes of 8 or more bytes use the first 8 bytes
+		 */
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data_run_data[ 1 ] ),
+		 number_of_cluster_blocks );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data_run_data[ 1 + number_of_blocks_value_size ] ),
+		 cluster_block_number );
+
+		number_of_cluster_blocks &= libfsntfs_data_run_value_masks[ number_of_blocks_value_size ];
+		cluster_block_number     &= libfsntfs_data_run_value_masks[ cluster_block_value_size ];
+
+		/* The cluster block number is a signed relative value, except for the first data run
+		 */
+		is_negative = (uint64_t) ( ( cluster_block_number & libfsntfs_data_run_sign_bit_masks[ cluster_block_value_size ] ) != 0 )
+		            & (uint64_t) ( last_cluster_block_number != 0 );
+
+		cluster_block_number |= ( (uint64_t) 0 - is_negative ) & ~( libfsntfs_data_run_value_masks[ cluster_block_value_size ] );
+
+		/* A cluster block number value size of zero indicates a sparse data run
+		 */
+		is_sparse = (uint64_t) ( cluster_block_value_size == 0 );
+
+		cluster_block_number = ( last_cluster_block_number + cluster_block_number ) & ( is_sparse - 1 );
+
+		data_run = &( safe_data_runs[ safe_number_of_data_runs ] );
+
+		data_run->cluster_block_number = cluster_block_number;
+		data_run->start_offset         = (off64_t) ( cluster_block_number * io_handle->cluster_block_size );
+		data_run->size                 = (size64_t) ( number_of_cluster_blocks * io_handle->cluster_block_size );
+		data_run->range_flags          = (uint32_t) is_sparse * LIBFDATA_RANGE_FLAG_IS_SPARSE;
+
+		last_cluster_block_number = cluster_block_number | ( last_cluster_block_number & ( (uint64_t) 0 - is_sparse ) );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data run: %d number of cluster blocks\t: %" PRIu64 " (size: %" PRIu64 ")\n",
+			 function,
+			 safe_number_of_data_runs,
+			 number_of_cluster_blocks,
+			 data_run->size );
+
+			libcnotify_printf(
+			 "%s: data run: %d cluster block number\t: %" PRIu64 " (offset: 0x%08" PRIx64 ")%s\n",
+			 function,
+			 safe_number_of_data_runs,
+			 data_run->cluster_block_number,
+			 data_run->start_offset,
+			 ( is_sparse != 0 ) ? " (is sparse)" : "" );
+		}
+#endif
+		safe_number_of_data_runs++;
+
+		data_offset += data_run_data_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( safe_number_of_data_runs == 0 )
+	{
+		if( safe_data_runs != NULL )
+		{
+			memory_free(
+			 safe_data_runs );
+
+			safe_data_runs = NULL;
+		}
+	}
+	else if( (size_t) safe_number_of_data_runs < maximum_number_of_data_runs )
+	{
+		reallocation = (libfsntfs_data_run_t *) memory_reallocate(
+		                                         safe_data_runs,
+		                                         sizeof( libfsntfs_data_run_t ) * safe_number_of_data_runs );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data runs.",
+			 function );
+
+			goto on_error;
+		}
+		safe_data_runs = reallocation;
+	}
+	*data_runs           = safe_data_runs;
+	*number_of_data_runs = safe_number_of_data_runs;
+
+	return( (ssize_t) data_offset );
+
+on_error:
+	if( safe_data_runs != NULL )
+	{
+		memory_free(
+		 safe_data_runs );
+	}
+	return( -1 );
+}
+
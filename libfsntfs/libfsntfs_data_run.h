@@ -32,6 +32,11 @@
 extern "C" {
 #endif
 
+/* The size of the zero padded data used to decode the last data runs,
+ * a data run consists of at most 31 bytes and the values are read with 8 byte loads
+ */
+#define LIBFSNTFS_DATA_RUN_PADDED_DATA_SIZE	32
+
 typedef struct libfsntfs_data_run libfsntfs_data_run_t;
 
 struct libfsntfs_data_run
@@ -74,6 +79,14 @@ ssize_t libfsntfs_data_run_read_data(
          uint64_t last_cluster_block_number,
          libcerror_error_t **error );
 
+ssize_t libfsntfs_data_run_read_list_data(
+         libfsntfs_data_run_t **data_runs,
+         int *number_of_data_runs,
+         libfsntfs_io_handle_t *io_handle,
+         const uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
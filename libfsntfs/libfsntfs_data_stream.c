@@ -261,6 +261,23 @@ int libfsntfs_data_stream_free(
 
 			result = -1;
 		}
+		if( internal_data_stream->ranges_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( internal_data_stream->ranges_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_extent_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free ranges array.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_data_stream );
 	}
@@ -1110,3 +1127,549 @@ int libfsntfs_data_stream_get_extent_by_index(
 	return( result );
 }
 
+/* Retrieves the data and sparse ranges array
+ * The array is created on first use, the caller must hold the read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_data_stream_get_ranges_array(
+     libfsntfs_internal_data_stream_t *internal_data_stream,
+     libcdata_array_t **ranges_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_data_stream_get_ranges_array";
+
+	if( internal_data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ranges_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ranges array.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_data_stream->ranges_array == NULL )
+	{
+		if( libfsntfs_cluster_block_stream_get_ranges_array(
+		     internal_data_stream->data_cluster_block_stream,
+		     &( internal_data_stream->ranges_array ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve ranges array from data cluster block stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*ranges_array = internal_data_stream->ranges_array;
+
+	return( 1 );
+}
+
+/* Retrieves the number of data and sparse ranges
+ * Adjacent extents that are both data or both sparse are combined into a single range
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_data_stream_get_number_of_ranges(
+     libfsntfs_data_stream_t *data_stream,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *ranges_array                         = NULL;
+	libfsntfs_internal_data_stream_t *internal_data_stream = NULL;
+	static char *function                                  = "libfsntfs_data_stream_get_number_of_ranges";
+	int result                                             = 0;
+	int safe_number_of_ranges                              = 0;
+
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_stream = (libfsntfs_internal_data_stream_t *) data_stream;
+
+	if( number_of_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_data_stream_get_ranges_array(
+	          internal_data_stream,
+	          &ranges_array,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ranges array.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     ranges_array,
+		     &safe_number_of_ranges,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of ranges.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	*number_of_ranges = safe_number_of_ranges;
+
+	return( 1 );
+}
+
+/* Retrieves a specific data or sparse range
+ * The range flags contain LIBFSNTFS_EXTENT_FLAG_IS_SPARSE if the range is sparse
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_data_stream_get_range_by_index(
+     libfsntfs_data_stream_t *data_stream,
+     int range_index,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *ranges_array                         = NULL;
+	libfsntfs_extent_t *range                              = NULL;
+	libfsntfs_internal_data_stream_t *internal_data_stream = NULL;
+	static char *function                                  = "libfsntfs_data_stream_get_range_by_index";
+	int result                                             = 0;
+
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_stream = (libfsntfs_internal_data_stream_t *) data_stream;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_data_stream_get_ranges_array(
+	          internal_data_stream,
+	          &ranges_array,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ranges array.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_entry_by_index(
+	          ranges_array,
+	          range_index,
+	          (intptr_t **) &range,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range: %d.",
+		 function,
+		 range_index );
+
+		result = -1;
+	}
+	else if( libfsntfs_extent_get_values(
+	          range,
+	          range_offset,
+	          range_size,
+	          range_flags,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range: %d values.",
+		 function,
+		 range_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data or sparse range that contains a specific offset
+ * The range flags contain LIBFSNTFS_EXTENT_FLAG_IS_SPARSE if the range is sparse
+ * Returns 1 if successful, 0 if the offset is beyond the end of the data or -1 on error
+ */
+int libfsntfs_data_stream_get_range_at_offset(
+     libfsntfs_data_stream_t *data_stream,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_data_stream_t *internal_data_stream = NULL;
+	static char *function                                  = "libfsntfs_data_stream_get_range_at_offset";
+	int result                                             = 0;
+
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_stream = (libfsntfs_internal_data_stream_t *) data_stream;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_cluster_block_stream_get_range_at_offset(
+	          internal_data_stream->data_cluster_block_stream,
+	          offset,
+	          range_offset,
+	          range_size,
+	          range_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range at offset: %" PRIi64 " (0x%08" PRIx64 ") from data cluster block stream.",
+		 function,
+		 offset,
+		 offset );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Seeks the first offset, at or after a specific offset, that contains data
+ * This is the equivalent of lseek with SEEK_DATA, sparse ranges are skipped
+ * On success the current offset is set to the data offset
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libfsntfs_data_stream_seek_data(
+     libfsntfs_data_stream_t *data_stream,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_data_stream_t *internal_data_stream = NULL;
+	static char *function                                  = "libfsntfs_data_stream_seek_data";
+	int result                                             = 0;
+
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_stream = (libfsntfs_internal_data_stream_t *) data_stream;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_cluster_block_stream_get_data_offset(
+	          internal_data_stream->data_cluster_block_stream,
+	          offset,
+	          data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data offset from data cluster block stream.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libfdata_stream_seek_offset(
+		     internal_data_stream->data_cluster_block_stream,
+		     *data_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in data cluster block stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Seeks the first offset, at or after a specific offset, that is part of a hole (sparse range)
+ * This is the equivalent of lseek with SEEK_HOLE, the end of the data is considered an implicit hole
+ * On success the current offset is set to the hole offset
+ * Returns 1 if successful, 0 if the offset is beyond the end of the data or -1 on error
+ */
+int libfsntfs_data_stream_seek_hole(
+     libfsntfs_data_stream_t *data_stream,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_data_stream_t *internal_data_stream = NULL;
+	static char *function                                  = "libfsntfs_data_stream_seek_hole";
+	int result                                             = 0;
+
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_stream = (libfsntfs_internal_data_stream_t *) data_stream;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_cluster_block_stream_get_hole_offset(
+	          internal_data_stream->data_cluster_block_stream,
+	          offset,
+	          hole_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hole offset from data cluster block stream.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libfdata_stream_seek_offset(
+		     internal_data_stream->data_cluster_block_stream,
+		     *hole_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in data cluster block stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_data_stream->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -55,6 +55,10 @@ struct libfsntfs_internal_data_stream
 	 */
 	libcdata_array_t *extents_array;
 
+	/* The data and sparse ranges array
+	 */
+	libcdata_array_t *ranges_array;
+
 	/* The $DATA attribute cluster block stream
 	 */
 	libfdata_stream_t *data_cluster_block_stream;
@@ -153,6 +157,49 @@ int libfsntfs_data_stream_get_extent_by_index(
      uint32_t *extent_flags,
      libcerror_error_t **error );
 
+int libfsntfs_internal_data_stream_get_ranges_array(
+     libfsntfs_internal_data_stream_t *internal_data_stream,
+     libcdata_array_t **ranges_array,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_data_stream_get_number_of_ranges(
+     libfsntfs_data_stream_t *data_stream,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_data_stream_get_range_by_index(
+     libfsntfs_data_stream_t *data_stream,
+     int range_index,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_data_stream_get_range_at_offset(
+     libfsntfs_data_stream_t *data_stream,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_data_stream_seek_data(
+     libfsntfs_data_stream_t *data_stream,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_data_stream_seek_hole(
+     libfsntfs_data_stream_t *data_stream,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
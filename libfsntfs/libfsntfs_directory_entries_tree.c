@@ -28,16 +28,18 @@
 #include "libfsntfs_directory_entry.h"
 #include "libfsntfs_file_name_values.h"
 #include "libfsntfs_index.h"
+#include "libfsntfs_index_prefetch.h"
 #include "libfsntfs_index_value.h"
 #include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libcthreads.h"
 #include "libfsntfs_libfcache.h"
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_mft_attribute.h"
 #include "libfsntfs_mft_entry.h"
 #include "libfsntfs_name.h"
-#include "libfsntfs_standard_information_values.h"
+#include "libfsntfs_name_hash_table.h"
 #include "libfsntfs_unused.h"
 
 /* Creates a directory entries tree
@@ -100,6 +102,21 @@ int libfsntfs_directory_entries_tree_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *directory_entries_tree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -201,6 +218,37 @@ int libfsntfs_directory_entries_tree_free(
 				result = -1;
 			}
 		}
+		if( ( *directory_entries_tree )->name_hash_table != NULL )
+		{
+			if( libfsntfs_name_hash_table_free(
+			     &( ( *directory_entries_tree )->name_hash_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *directory_entries_tree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *directory_entries_tree );
 
@@ -776,12 +824,10 @@ int libfsntfs_directory_entries_tree_read_from_i30_index(
      uint8_t flags,
      libcerror_error_t **error )
 {
-	libfsntfs_mft_attribute_t *mft_attribute                             = NULL;
-	libfsntfs_standard_information_values_t *standard_information_values = NULL;
-	static char *function                                                = "libfsntfs_directory_entries_tree_read_from_i30_index";
-	uint32_t attribute_type                                              = 0;
-	uint32_t collation_type                                              = 0;
-	int result                                                           = 0;
+	static char *function   = "libfsntfs_directory_entries_tree_read_from_i30_index";
+	uint32_t attribute_type = 0;
+	uint32_t collation_type = 0;
+	int result              = 0;
 
 	if( directory_entries_tree == NULL )
 	{
@@ -818,6 +864,8 @@ int libfsntfs_directory_entries_tree_read_from_i30_index(
 	}
 	if( ( flags & LIBFSNTFS_FILE_ENTRY_FLAGS_MFT_ONLY ) != 0 )
 	{
+		directory_entries_tree->is_read = 1;
+
 		return( 1 );
 	}
 	if( libfsntfs_index_initialize(
@@ -953,6 +1001,23 @@ int libfsntfs_directory_entries_tree_read_from_i30_index(
 
 			goto on_error;
 		}
+		/* All the index nodes are read, hence read the allocated index entries
+		 * in physical order first
+		 */
+		if( libfsntfs_index_prefetch_sub_nodes(
+		     directory_entries_tree->i30_index,
+		     file_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to prefetch sub nodes of $I30 index.",
+			 function );
+
+			goto on_error;
+		}
 		if( libfsntfs_directory_entries_tree_read_from_index_node(
 		     directory_entries_tree,
 		     file_io_handle,
@@ -969,81 +1034,26 @@ int libfsntfs_directory_entries_tree_read_from_i30_index(
 
 			goto on_error;
 		}
-		directory_entries_tree->use_case_folding = 0;
-
-		result = libfsntfs_mft_entry_get_standard_information_attribute(
-		          mft_entry,
-		          &mft_attribute,
-		          error );
-
-		if( result == -1 )
+		if( libfsntfs_mft_entry_get_use_case_folding(
+		     mft_entry,
+		     &( directory_entries_tree->use_case_folding ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve $STANDARD_INFORMATION attribute from MFT entry.",
+			 "%s: unable to determine if case folding should be used.",
 			 function );
 
 			goto on_error;
 		}
-		else if( result != 0 )
-		{
-			if( libfsntfs_standard_information_values_initialize(
-			     &standard_information_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create standard information values.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsntfs_standard_information_values_read_from_mft_attribute(
-			     standard_information_values,
-			     mft_attribute,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read standard information values from MFT attribute.",
-				 function );
-
-				goto on_error;
-			}
-			if( standard_information_values->is_case_sensitive == 0 )
-			{
-				directory_entries_tree->use_case_folding = 1;
-			}
-			if( libfsntfs_standard_information_values_free(
-			     &standard_information_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free standard information values.",
-				 function );
-
-				goto on_error;
-			}
-		}
 	}
+	directory_entries_tree->is_read = 1;
+
 	return( 1 );
 
 on_error:
-	if( standard_information_values != NULL )
-	{
-		libfsntfs_standard_information_values_free(
-		 &standard_information_values,
-		 NULL );
-	}
 	if( directory_entries_tree->short_names_tree != NULL )
 	{
 		libcdata_btree_free(
@@ -1072,6 +1082,126 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the directory entries tree from the $I30 index if it was not read before
+ * The read/write lock is only grabbed for writing when the directory entries tree was not read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_entries_tree_read_from_i30_index_on_demand(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_directory_entries_tree_read_from_i30_index_on_demand";
+	uint8_t is_read       = 0;
+	int result            = 1;
+
+	if( directory_entries_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     directory_entries_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	is_read = directory_entries_tree->is_read;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     directory_entries_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( is_read != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     directory_entries_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have read the directory entries tree in the meantime
+	 */
+	if( directory_entries_tree->is_read == 0 )
+	{
+		result = libfsntfs_directory_entries_tree_read_from_i30_index(
+		          directory_entries_tree,
+		          io_handle,
+		          file_io_handle,
+		          mft_entry,
+		          flags,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entries tree from $I30 index.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     directory_entries_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the number of entries
  * Returns 1 if successful or -1 on error
  */
@@ -1189,33 +1319,26 @@ int libfsntfs_directory_entries_tree_get_entry_by_index(
 	return( 1 );
 }
 
-/* Retrieves the directory entry from an index node for an UTF-8 encoded name
- * This function creates a new directory entry
- * Returns 1 if successful, 0 if no such directory entry or -1 on error
+/* Builds the name hash table
+ * The name hash table is only built for directory entries trees with at least
+ * LIBFSNTFS_DIRECTORY_ENTRIES_TREE_NAME_HASH_TABLE_MINIMUM_NUMBER_OF_ENTRIES entries
+ * The values of the name hash table are the entry index for names in the entries list
+ * and the number of entries + the short name index for names in the short names tree
+ * Returns 1 if successful, 0 if the name hash table was not built or -1 on error
  */
-int libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf8_name(
+int libfsntfs_directory_entries_tree_build_name_hash_table(
      libfsntfs_directory_entries_tree_t *directory_entries_tree,
      libbfio_handle_t *file_io_handle,
-     libfsntfs_index_node_t *index_node,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsntfs_directory_entry_t **directory_entry,
-     int recursion_depth,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node                      = NULL;
-	libfsntfs_directory_entry_t *existing_directory_entry = NULL;
-	libfsntfs_directory_entry_t *safe_directory_entry     = NULL;
-	libfsntfs_file_name_values_t *file_name_values        = NULL;
-	libfsntfs_index_node_t *sub_node                      = NULL;
-	libfsntfs_index_value_t *index_value                  = NULL;
-	static char *function                                 = "libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf8_name";
-	off64_t index_entry_offset                            = 0;
-	int compare_result                                    = 0;
-	int index_value_entry                                 = 0;
-	int is_allocated                                      = 0;
-	int number_of_index_values                            = 0;
-	int result                                            = 0;
+	libfsntfs_directory_entry_t *directory_entry  = NULL;
+	libfsntfs_name_hash_table_t *name_hash_table  = NULL;
+	static char *function                         = "libfsntfs_directory_entries_tree_build_name_hash_table";
+	uint32_t name_hash                            = 0;
+	int entry_index                               = 0;
+	int number_of_entries                         = 0;
+	int number_of_short_names                     = 0;
+	int short_name_index                          = 0;
 
 	if( directory_entries_tree == NULL )
 	{
@@ -1228,73 +1351,857 @@ int libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf8_name(
 
 		return( -1 );
 	}
-	if( directory_entries_tree->i30_index == NULL )
+	if( directory_entries_tree->name_hash_table != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entries tree - missing $I30 index.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entries tree - name hash table value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_entries_tree->i30_index->io_handle == NULL )
+	if( libfsntfs_directory_entries_tree_get_number_of_entries(
+	     directory_entries_tree,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entries tree - invalid $I30 index - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( directory_entry == NULL )
+	if( number_of_entries < LIBFSNTFS_DIRECTORY_ENTRIES_TREE_NAME_HASH_TABLE_MINIMUM_NUMBER_OF_ENTRIES )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory entry.",
-		 function );
+		return( 0 );
+	}
+	if( directory_entries_tree->short_names_tree != NULL )
+	{
+		if( libcdata_btree_get_number_of_values(
+		     directory_entries_tree->short_names_tree,
+		     &number_of_short_names,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of short names.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBFSNTFS_MAXIMUM_RECURSION_DEPTH ) )
+	if( number_of_short_names > ( INT_MAX - number_of_entries ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 "%s: invalid number of short names value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfsntfs_index_node_get_number_of_values(
-	     index_node,
-	     &number_of_index_values,
+	if( libfsntfs_name_hash_table_initialize(
+	     &name_hash_table,
+	     number_of_entries + number_of_short_names,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values from index node.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name hash table.",
 		 function );
 
 		goto on_error;
 	}
-	for( index_value_entry = 0;
-	     index_value_entry < number_of_index_values;
-	     index_value_entry++ )
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
 	{
-		if( libfsntfs_index_node_get_value_by_index(
-		     index_node,
-		     index_value_entry,
-		     &index_value,
+		if( libfdata_list_get_element_value_by_index(
+		     directory_entries_tree->entries_list,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) directory_entries_tree->entries_cache,
+		     entry_index,
+		     (intptr_t **) &directory_entry,
+		     LIBFDATA_READ_FLAG_IGNORE_CACHE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d from entries list.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( directory_entry == NULL )
+		 || ( directory_entry->file_name_values == NULL )
+		 || ( directory_entry->file_name_values->name == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid entry: %d - missing name.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_name_get_hash(
+		     directory_entry->file_name_values->name,
+		     directory_entry->file_name_values->name_size,
+		     directory_entries_tree->use_case_folding,
+		     &name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of name of entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_name_hash_table_insert_value(
+		     name_hash_table,
+		     name_hash,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert entry: %d into name hash table.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	for( short_name_index = 0;
+	     short_name_index < number_of_short_names;
+	     short_name_index++ )
+	{
+		if( libcdata_btree_get_value_by_index(
+		     directory_entries_tree->short_names_tree,
+		     short_name_index,
+		     (intptr_t **) &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve short name: %d from tree.",
+			 function,
+			 short_name_index );
+
+			goto on_error;
+		}
+		if( ( directory_entry == NULL )
+		 || ( directory_entry->short_file_name_values == NULL )
+		 || ( directory_entry->short_file_name_values->name == NULL ) )
+		{
+			continue;
+		}
+		if( libfsntfs_name_get_hash(
+		     directory_entry->short_file_name_values->name,
+		     directory_entry->short_file_name_values->name_size,
+		     directory_entries_tree->use_case_folding,
+		     &name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash of short name: %d.",
+			 function,
+			 short_name_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_name_hash_table_insert_value(
+		     name_hash_table,
+		     name_hash,
+		     number_of_entries + short_name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert short name: %d into name hash table.",
+			 function,
+			 short_name_index );
+
+			goto on_error;
+		}
+	}
+	directory_entries_tree->name_hash_table = name_hash_table;
+
+	return( 1 );
+
+on_error:
+	if( name_hash_table != NULL )
+	{
+		libfsntfs_name_hash_table_free(
+		 &name_hash_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Builds the name hash table if this was not checked before
+ * The read/write lock is only grabbed for writing when the name hash table was not checked
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_entries_tree_build_name_hash_table_on_demand(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfsntfs_directory_entries_tree_build_name_hash_table_on_demand";
+	uint8_t name_hash_table_is_checked = 0;
+	int result                         = 1;
+
+	if( directory_entries_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     directory_entries_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	name_hash_table_is_checked = directory_entries_tree->name_hash_table_is_checked;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     directory_entries_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( name_hash_table_is_checked != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     directory_entries_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have built the name hash table in the meantime
+	 */
+	if( directory_entries_tree->name_hash_table_is_checked == 0 )
+	{
+		result = libfsntfs_directory_entries_tree_build_name_hash_table(
+		          directory_entries_tree,
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build name hash table.",
+			 function );
+		}
+		else
+		{
+			directory_entries_tree->name_hash_table_is_checked = 1;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     directory_entries_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the directory entry and name of a specific name hash table value
+ * The directory entry and file name values are managed by the directory entries tree
+ * and are only valid until the next entry is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_entries_tree_get_name_hash_table_value(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     int number_of_entries,
+     int value,
+     libfsntfs_directory_entry_t **directory_entry,
+     libfsntfs_file_name_values_t **file_name_values,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                             = "libfsntfs_directory_entries_tree_get_name_hash_table_value";
+
+	if( directory_entries_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_name_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file name values.",
+		 function );
+
+		return( -1 );
+	}
+	if( value < number_of_entries )
+	{
+		if( libfdata_list_get_element_value_by_index(
+		     directory_entries_tree->entries_list,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) directory_entries_tree->entries_cache,
+		     value,
+		     (intptr_t **) &safe_directory_entry,
+		     LIBFDATA_READ_FLAG_IGNORE_CACHE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d from entries list.",
+			 function,
+			 value );
+
+			return( -1 );
+		}
+		if( safe_directory_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing directory entry: %d.",
+			 function,
+			 value );
+
+			return( -1 );
+		}
+		*file_name_values = safe_directory_entry->file_name_values;
+	}
+	else
+	{
+		if( libcdata_btree_get_value_by_index(
+		     directory_entries_tree->short_names_tree,
+		     value - number_of_entries,
+		     (intptr_t **) &safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve short name: %d from tree.",
+			 function,
+			 value - number_of_entries );
+
+			return( -1 );
+		}
+		if( safe_directory_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing directory entry for short name: %d.",
+			 function,
+			 value - number_of_entries );
+
+			return( -1 );
+		}
+		*file_name_values = safe_directory_entry->short_file_name_values;
+	}
+	if( ( *file_name_values == NULL )
+	 || ( ( *file_name_values )->name == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory entry - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	*directory_entry = safe_directory_entry;
+
+	return( 1 );
+}
+
+/* Retrieves the directory entry of a name hash table value that matched a name
+ * A match on a short name returns a directory entry with the short name as its name,
+ * the same as when the short name was found in the $I30 index
+ * This function creates a new directory entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_value(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libfsntfs_directory_entry_t *existing_directory_entry,
+     int number_of_entries,
+     int value,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                             = "libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_value";
+
+	if( directory_entries_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( existing_directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid existing directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( value < number_of_entries )
+	{
+		if( libfsntfs_directory_entry_clone(
+		     &safe_directory_entry,
+		     existing_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libfsntfs_directory_entry_initialize(
+		     &safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		safe_directory_entry->file_reference = existing_directory_entry->file_reference;
+
+		if( libfsntfs_file_name_values_clone(
+		     &( safe_directory_entry->file_name_values ),
+		     existing_directory_entry->short_file_name_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone short file name values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*directory_entry = safe_directory_entry;
+
+	return( 1 );
+
+on_error:
+	if( safe_directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &safe_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the directory entry for an UTF-8 encoded name from the name hash table
+ * This function creates a new directory entry
+ * Returns 1 if successful, 0 if no such directory entry or -1 on error
+ */
+int libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_by_utf8_name(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *existing_directory_entry = NULL;
+	libfsntfs_file_name_values_t *file_name_values        = NULL;
+	static char *function                                 = "libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_by_utf8_name";
+	uint32_t name_hash                                    = 0;
+	uint32_t probe_index                                  = 0;
+	int compare_result                                    = 0;
+	int number_of_entries                                 = 0;
+	int result                                            = 0;
+	int value                                             = 0;
+
+	if( directory_entries_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_tree->name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree - missing name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_name_get_hash_from_utf8_string(
+	     utf8_string,
+	     utf8_string_length,
+	     directory_entries_tree->use_case_folding,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_directory_entries_tree_get_number_of_entries(
+	     directory_entries_tree,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfsntfs_name_hash_table_get_next_value_by_hash(
+		          directory_entries_tree->name_hash_table,
+		          name_hash,
+		          &probe_index,
+		          &value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsntfs_directory_entries_tree_get_name_hash_table_value(
+		     directory_entries_tree,
+		     file_io_handle,
+		     number_of_entries,
+		     value,
+		     &existing_directory_entry,
+		     &file_name_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name hash table value: %d.",
+			 function,
+			 value );
+
+			return( -1 );
+		}
+		compare_result = libfsntfs_name_compare_with_utf8_string(
+		                  file_name_values->name,
+		                  file_name_values->name_size,
+		                  utf8_string,
+		                  utf8_string_length,
+		                  directory_entries_tree->use_case_folding,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare file name values with UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( compare_result != LIBUNA_COMPARE_EQUAL );
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_value(
+	     directory_entries_tree,
+	     existing_directory_entry,
+	     number_of_entries,
+	     value,
+	     directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry of name hash table value: %d.",
+		 function,
+		 value );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the directory entry from an index node for an UTF-8 encoded name
+ * This function creates a new directory entry
+ * Returns 1 if successful, 0 if no such directory entry or -1 on error
+ */
+int libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf8_name(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_node_t *index_node,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsntfs_directory_entry_t **directory_entry,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *upper_node                      = NULL;
+	libfsntfs_directory_entry_t *existing_directory_entry = NULL;
+	libfsntfs_directory_entry_t *safe_directory_entry     = NULL;
+	libfsntfs_file_name_values_t *file_name_values        = NULL;
+	libfsntfs_index_node_t *sub_node                      = NULL;
+	libfsntfs_index_value_t *index_value                  = NULL;
+	static char *function                                 = "libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf8_name";
+	off64_t index_entry_offset                            = 0;
+	int compare_result                                    = 0;
+	int index_value_entry                                 = 0;
+	int is_allocated                                      = 0;
+	int number_of_index_values                            = 0;
+	int result                                            = 0;
+
+	if( directory_entries_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_tree->i30_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree - missing $I30 index.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_tree->i30_index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree - invalid $I30 index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSNTFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_node_get_number_of_values(
+	     index_node,
+	     &number_of_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values from index node.",
+		 function );
+
+		goto on_error;
+	}
+	for( index_value_entry = 0;
+	     index_value_entry < number_of_index_values;
+	     index_value_entry++ )
+	{
+		if( libfsntfs_index_node_get_value_by_index(
+		     index_node,
+		     index_value_entry,
+		     &index_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1639,15 +2546,44 @@ int libfsntfs_directory_entries_tree_get_entry_by_utf8_name(
 
 		return( -1 );
 	}
-	result = libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf8_name(
-	          directory_entries_tree,
-	          file_io_handle,
-	          directory_entries_tree->i30_index->root_node,
-	          utf8_string,
-	          utf8_string_length,
-	          directory_entry,
-	          0,
-	          error );
+	/* The name hash table is built on the first lookup by name of a large directory
+	 */
+	if( libfsntfs_directory_entries_tree_build_name_hash_table_on_demand(
+	     directory_entries_tree,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build name hash table on demand.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_tree->name_hash_table != NULL )
+	{
+		result = libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_by_utf8_name(
+		          directory_entries_tree,
+		          file_io_handle,
+		          utf8_string,
+		          utf8_string_length,
+		          directory_entry,
+		          error );
+	}
+	else
+	{
+		result = libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf8_name(
+		          directory_entries_tree,
+		          file_io_handle,
+		          directory_entries_tree->i30_index->root_node,
+		          utf8_string,
+		          utf8_string_length,
+		          directory_entry,
+		          0,
+		          error );
+	}
 
 	if( result == -1 )
 	{
@@ -1663,6 +2599,170 @@ int libfsntfs_directory_entries_tree_get_entry_by_utf8_name(
 	return( result );
 }
 
+/* Retrieves the directory entry for an UTF-16 encoded name from the name hash table
+ * This function creates a new directory entry
+ * Returns 1 if successful, 0 if no such directory entry or -1 on error
+ */
+int libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_by_utf16_name(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *existing_directory_entry = NULL;
+	libfsntfs_file_name_values_t *file_name_values        = NULL;
+	static char *function                                 = "libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_by_utf16_name";
+	uint32_t name_hash                                    = 0;
+	uint32_t probe_index                                  = 0;
+	int compare_result                                    = 0;
+	int number_of_entries                                 = 0;
+	int result                                            = 0;
+	int value                                             = 0;
+
+	if( directory_entries_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_tree->name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entries tree - missing name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_name_get_hash_from_utf16_string(
+	     utf16_string,
+	     utf16_string_length,
+	     directory_entries_tree->use_case_folding,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash of UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_directory_entries_tree_get_number_of_entries(
+	     directory_entries_tree,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfsntfs_name_hash_table_get_next_value_by_hash(
+		          directory_entries_tree->name_hash_table,
+		          name_hash,
+		          &probe_index,
+		          &value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from name hash table.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsntfs_directory_entries_tree_get_name_hash_table_value(
+		     directory_entries_tree,
+		     file_io_handle,
+		     number_of_entries,
+		     value,
+		     &existing_directory_entry,
+		     &file_name_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name hash table value: %d.",
+			 function,
+			 value );
+
+			return( -1 );
+		}
+		compare_result = libfsntfs_name_compare_with_utf16_string(
+		                  file_name_values->name,
+		                  file_name_values->name_size,
+		                  utf16_string,
+		                  utf16_string_length,
+		                  directory_entries_tree->use_case_folding,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare file name values with UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( compare_result != LIBUNA_COMPARE_EQUAL );
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_value(
+	     directory_entries_tree,
+	     existing_directory_entry,
+	     number_of_entries,
+	     value,
+	     directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry of name hash table value: %d.",
+		 function,
+		 value );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the directory entry from an index node for an UTF-16 encoded name
  * This function creates a new directory entry
  * Returns 1 if successful, 0 if no such directory entry or -1 on error
@@ -2113,15 +3213,44 @@ int libfsntfs_directory_entries_tree_get_entry_by_utf16_name(
 
 		return( -1 );
 	}
-	result = libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf16_name(
-	          directory_entries_tree,
-	          file_io_handle,
-	          directory_entries_tree->i30_index->root_node,
-	          utf16_string,
-	          utf16_string_length,
-	          directory_entry,
-	          0,
-	          error );
+	/* The name hash table is built on the first lookup by name of a large directory
+	 */
+	if( libfsntfs_directory_entries_tree_build_name_hash_table_on_demand(
+	     directory_entries_tree,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build name hash table on demand.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entries_tree->name_hash_table != NULL )
+	{
+		result = libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_by_utf16_name(
+		          directory_entries_tree,
+		          file_io_handle,
+		          utf16_string,
+		          utf16_string_length,
+		          directory_entry,
+		          error );
+	}
+	else
+	{
+		result = libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf16_name(
+		          directory_entries_tree,
+		          file_io_handle,
+		          directory_entries_tree->i30_index->root_node,
+		          utf16_string,
+		          utf16_string_length,
+		          directory_entry,
+		          0,
+		          error );
+	}
 
 	if( result == -1 )
 	{
@@ -32,14 +32,20 @@
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
 #include "libfsntfs_libfcache.h"
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_mft_entry.h"
+#include "libfsntfs_name_hash_table.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The minimum number of entries for which the name hash table is used for lookups by name
+ */
+#define LIBFSNTFS_DIRECTORY_ENTRIES_TREE_NAME_HASH_TABLE_MINIMUM_NUMBER_OF_ENTRIES	1024
+
 typedef struct libfsntfs_directory_entries_tree libfsntfs_directory_entries_tree_t;
 
 struct libfsntfs_directory_entries_tree
@@ -60,9 +66,29 @@ struct libfsntfs_directory_entries_tree
 	 */
 	libfcache_cache_t *entries_cache;
 
+	/* Value to indicate the directory entries tree was read from the $I30 index,
+	 * which includes a directory entries tree without $I30 index
+	 */
+	uint8_t is_read;
+
+	/* The name hash table
+	 */
+	libfsntfs_name_hash_table_t *name_hash_table;
+
+	/* Value to indicate the name hash table was built or the directory entries tree
+	 * has too few entries to use one
+	 */
+	uint8_t name_hash_table_is_checked;
+
 	/* Value to indicate case folding should be used
 	 */
 	uint8_t use_case_folding;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsntfs_directory_entries_tree_initialize(
@@ -95,6 +121,14 @@ int libfsntfs_directory_entries_tree_read_from_i30_index(
      uint8_t flags,
      libcerror_error_t **error );
 
+int libfsntfs_directory_entries_tree_read_from_i30_index_on_demand(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_mft_entry_t *mft_entry,
+     uint8_t flags,
+     libcerror_error_t **error );
+
 int libfsntfs_directory_entries_tree_get_number_of_entries(
      libfsntfs_directory_entries_tree_t *directory_entries_tree,
      int *number_of_entries,
@@ -107,6 +141,41 @@ int libfsntfs_directory_entries_tree_get_entry_by_index(
      libfsntfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfsntfs_directory_entries_tree_build_name_hash_table(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsntfs_directory_entries_tree_build_name_hash_table_on_demand(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsntfs_directory_entries_tree_get_name_hash_table_value(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     int number_of_entries,
+     int value,
+     libfsntfs_directory_entry_t **directory_entry,
+     libfsntfs_file_name_values_t **file_name_values,
+     libcerror_error_t **error );
+
+int libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_value(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libfsntfs_directory_entry_t *existing_directory_entry,
+     int number_of_entries,
+     int value,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_by_utf8_name(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 int libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf8_name(
      libfsntfs_directory_entries_tree_t *directory_entries_tree,
      libbfio_handle_t *file_io_handle,
@@ -125,6 +194,14 @@ int libfsntfs_directory_entries_tree_get_entry_by_utf8_name(
      libfsntfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfsntfs_directory_entries_tree_get_entry_from_name_hash_table_by_utf16_name(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree,
+     libbfio_handle_t *file_io_handle,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 int libfsntfs_directory_entries_tree_get_entry_from_index_node_by_utf16_name(
      libfsntfs_directory_entries_tree_t *directory_entries_tree,
      libbfio_handle_t *file_io_handle,
@@ -601,6 +601,44 @@ int libfsntfs_directory_entry_get_entry_modification_time(
 	return( 1 );
 }
 
+/* Retrieves the allocated size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_entry_get_allocated_size(
+     libfsntfs_directory_entry_t *directory_entry,
+     uint64_t *allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_directory_entry_get_allocated_size";
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_name_values_get_allocated_size(
+	     directory_entry->file_name_values,
+	     allocated_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve allocated size from file name values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size
  * Returns 1 if successful or -1 on error
  */
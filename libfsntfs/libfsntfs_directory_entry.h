@@ -102,6 +102,11 @@ int libfsntfs_directory_entry_get_entry_modification_time(
      uint64_t *filetime,
      libcerror_error_t **error );
 
+int libfsntfs_directory_entry_get_allocated_size(
+     libfsntfs_directory_entry_t *directory_entry,
+     uint64_t *allocated_size,
+     libcerror_error_t **error );
+
 int libfsntfs_directory_entry_get_size(
      libfsntfs_directory_entry_t *directory_entry,
      uint64_t *size,
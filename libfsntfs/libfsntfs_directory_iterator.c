@@ -0,0 +1,3221 @@
+/*
+ * Directory iterator functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_directory_entry.h"
+#include "libfsntfs_directory_iterator.h"
+#include "libfsntfs_file_entry.h"
+#include "libfsntfs_file_name_values.h"
+#include "libfsntfs_file_system.h"
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_value.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+#include "libfsntfs_libfcache.h"
+#include "libfsntfs_libuna.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_name.h"
+#include "libfsntfs_types.h"
+
+/* Creates a directory iterator
+ * Make sure the value directory_iterator is referencing, is set to NULL
+ * Only the $INDEX_ROOT and $BITMAP of the $I30 index are read, the index nodes
+ * stored in $INDEX_ALLOCATION are read when the iterator reaches them
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_initialize(
+     libfsntfs_directory_iterator_t **directory_iterator,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_file_system_t *file_system,
+     libfsntfs_mft_entry_t *mft_entry,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_initialize";
+	uint32_t attribute_type                                              = 0;
+	uint32_t collation_type                                              = 0;
+	int result                                                           = 0;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory iterator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = memory_allocate_structure(
+	                               libfsntfs_internal_directory_iterator_t );
+
+	if( internal_directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_directory_iterator,
+	     0,
+	     sizeof( libfsntfs_internal_directory_iterator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory iterator.",
+		 function );
+
+		memory_free(
+		 internal_directory_iterator );
+
+		return( -1 );
+	}
+	internal_directory_iterator->depth = -1;
+
+	if( libfsntfs_index_initialize(
+	     &( internal_directory_iterator->i30_index ),
+	     io_handle,
+	     (uint8_t *) "$I30",
+	     5,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create $I30 index.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_index_read(
+	          internal_directory_iterator->i30_index,
+	          file_io_handle,
+	          mft_entry,
+	          flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read $I30 index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_index_get_attribute_type(
+		     internal_directory_iterator->i30_index,
+		     &attribute_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute type from index.",
+			 function );
+
+			goto on_error;
+		}
+		if( attribute_type != LIBFSNTFS_ATTRIBUTE_TYPE_FILE_NAME )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported index attribute type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_index_get_collation_type(
+		     internal_directory_iterator->i30_index,
+		     &collation_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve collation type from index.",
+			 function );
+
+			goto on_error;
+		}
+		if( collation_type != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported index collation type.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsntfs_mft_entry_get_use_case_folding(
+	     mft_entry,
+	     &( internal_directory_iterator->use_case_folding ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if case folding should be used.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory_iterator->io_handle      = io_handle;
+	internal_directory_iterator->file_io_handle = file_io_handle;
+	internal_directory_iterator->file_system    = file_system;
+	internal_directory_iterator->flags          = flags;
+
+	if( libfsntfs_internal_directory_iterator_reset(
+	     internal_directory_iterator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset directory iterator.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_directory_iterator->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*directory_iterator = (libfsntfs_directory_iterator_t *) internal_directory_iterator;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory_iterator != NULL )
+	{
+		if( internal_directory_iterator->i30_index != NULL )
+		{
+			libfsntfs_index_free(
+			 &( internal_directory_iterator->i30_index ),
+			 NULL );
+		}
+		memory_free(
+		 internal_directory_iterator );
+	}
+	return( -1 );
+}
+
+/* Frees a directory iterator
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_free(
+     libfsntfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_free";
+	int level_index                                                      = 0;
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_iterator != NULL )
+	{
+		internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) *directory_iterator;
+		*directory_iterator         = NULL;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_directory_iterator->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The index nodes are managed by the sub node caches and the $I30 index
+		 */
+		for( level_index = 0;
+		     level_index <= LIBFSNTFS_MAXIMUM_RECURSION_DEPTH;
+		     level_index++ )
+		{
+			if( internal_directory_iterator->levels[ level_index ].sub_node_cache == NULL )
+			{
+				break;
+			}
+			if( libfcache_cache_free(
+			     &( internal_directory_iterator->levels[ level_index ].sub_node_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free level: %d sub node cache.",
+				 function,
+				 level_index );
+
+				result = -1;
+			}
+		}
+		if( internal_directory_iterator->directory_entry != NULL )
+		{
+			if( libfsntfs_directory_entry_free(
+			     &( internal_directory_iterator->directory_entry ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libfsntfs_index_free(
+		     &( internal_directory_iterator->i30_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free $I30 index.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_directory_iterator );
+	}
+	return( result );
+}
+
+/* Resets the directory iterator to the start of the $I30 index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_directory_iterator_reset(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_iterator_level_t *level = NULL;
+	static char *function                       = "libfsntfs_internal_directory_iterator_reset";
+
+	if( internal_directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_iterator->i30_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing $I30 index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator->depth         = -1;
+	internal_directory_iterator->cursor        = 0;
+	internal_directory_iterator->cursor_is_set = 1;
+
+	/* An $I30 index without a root node has no entries
+	 */
+	if( internal_directory_iterator->i30_index->root_node == NULL )
+	{
+		return( 1 );
+	}
+	level = &( internal_directory_iterator->levels[ 0 ] );
+
+	if( libfsntfs_index_node_get_number_of_values(
+	     internal_directory_iterator->i30_index->root_node,
+	     &( level->number_of_index_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values from root node.",
+		 function );
+
+		return( -1 );
+	}
+	level->index_node        = internal_directory_iterator->i30_index->root_node;
+	level->index_node_vcn    = -1;
+	level->index_value_entry = 0;
+	level->sub_node_visited  = 0;
+
+	internal_directory_iterator->depth = 0;
+
+	return( 1 );
+}
+
+/* Reads the sub node of a branch index value and makes it the current level
+ * Returns 1 if successful, 0 if the sub node is not allocated or -1 on error
+ */
+int libfsntfs_internal_directory_iterator_push_sub_node(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     libfsntfs_index_value_t *index_value,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_iterator_level_t *level     = NULL;
+	libfsntfs_directory_iterator_level_t *sub_level = NULL;
+	libfsntfs_index_node_t *sub_node                = NULL;
+	static char *function                           = "libfsntfs_internal_directory_iterator_push_sub_node";
+	off64_t index_entry_offset                      = 0;
+	int is_allocated                                = 0;
+	int number_of_index_values                      = 0;
+
+	if( internal_directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_iterator->i30_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing $I30 index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_iterator->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_directory_iterator->depth < 0 )
+	 || ( internal_directory_iterator->depth >= LIBFSNTFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory iterator - depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index value.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_value->sub_node_vcn > (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index value - sub node VCN value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	is_allocated = libfsntfs_index_sub_node_is_allocated(
+	                internal_directory_iterator->i30_index,
+	                (int) index_value->sub_node_vcn,
+	                error );
+
+	if( is_allocated == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if sub node with VCN: %d is allocated.",
+		 function,
+		 (int) index_value->sub_node_vcn );
+
+		return( -1 );
+	}
+	else if( is_allocated == 0 )
+	{
+		return( 0 );
+	}
+	level = &( internal_directory_iterator->levels[ internal_directory_iterator->depth ] );
+
+	/* Every level uses its own cache to prevent cache invalidation of the index nodes
+	 * of the upper levels when reading sub nodes.
+	 */
+	if( level->sub_node_cache == NULL )
+	{
+		if( libfcache_cache_initialize(
+		     &( level->sub_node_cache ),
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub node cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	index_entry_offset = (off64_t) ( index_value->sub_node_vcn * internal_directory_iterator->io_handle->cluster_block_size );
+
+	if( libfsntfs_index_get_sub_node(
+	     internal_directory_iterator->i30_index,
+	     internal_directory_iterator->file_io_handle,
+	     level->sub_node_cache,
+	     index_entry_offset,
+	     (int) index_value->sub_node_vcn,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node with VCN: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 (int) index_value->sub_node_vcn,
+		 index_entry_offset,
+		 index_entry_offset );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_node_get_number_of_values(
+	     sub_node,
+	     &number_of_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values from sub node with VCN: %d.",
+		 function,
+		 (int) index_value->sub_node_vcn );
+
+		return( -1 );
+	}
+	internal_directory_iterator->depth += 1;
+
+	sub_level = &( internal_directory_iterator->levels[ internal_directory_iterator->depth ] );
+
+	sub_level->index_node             = sub_node;
+	sub_level->index_node_vcn         = (int) index_value->sub_node_vcn;
+	sub_level->number_of_index_values = number_of_index_values;
+	sub_level->index_value_entry      = 0;
+	sub_level->sub_node_visited       = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the next directory entry in collation order
+ * The index nodes are read when the iterator reaches them, only the index nodes
+ * on the path from the root node to the current index node are retained
+ * This function creates a new directory entry
+ * Returns 1 if successful, 0 if no more directory entries or -1 on error
+ */
+int libfsntfs_internal_directory_iterator_get_next_directory_entry(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *safe_directory_entry = NULL;
+	libfsntfs_directory_iterator_level_t *level       = NULL;
+	libfsntfs_file_name_values_t *file_name_values    = NULL;
+	libfsntfs_index_value_t *index_value              = NULL;
+	static char *function                             = "libfsntfs_internal_directory_iterator_get_next_directory_entry";
+	int result                                        = 0;
+
+	if( internal_directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_directory_iterator->depth >= 0 )
+	{
+		level = &( internal_directory_iterator->levels[ internal_directory_iterator->depth ] );
+
+		if( level->index_value_entry >= level->number_of_index_values )
+		{
+			/* Continue with the index value of the upper level
+			 * that refers to this index node
+			 */
+			internal_directory_iterator->depth -= 1;
+
+			continue;
+		}
+		if( libfsntfs_index_node_get_value_by_index(
+		     level->index_node,
+		     level->index_value_entry,
+		     &index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d from index node.",
+			 function,
+			 level->index_value_entry );
+
+			goto on_error;
+		}
+		if( index_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid index node - missing index value: %d.",
+			 function,
+			 level->index_value_entry );
+
+			goto on_error;
+		}
+		/* The entries of the sub node sort before the entry of the index value
+		 */
+		if( ( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_BRANCH_NODE ) != 0 )
+		 && ( level->sub_node_visited == 0 ) )
+		{
+			level->sub_node_visited = 1;
+
+			result = libfsntfs_internal_directory_iterator_push_sub_node(
+			          internal_directory_iterator,
+			          index_value,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read sub node of index value: %d.",
+				 function,
+				 level->index_value_entry );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				/* Index values with an unallocated sub node are ignored
+				 * as in libfsntfs_directory_entries_tree_read_from_index_node
+				 */
+				level->index_value_entry += 1;
+				level->sub_node_visited   = 0;
+			}
+			continue;
+		}
+		level->index_value_entry += 1;
+		level->sub_node_visited   = 0;
+
+		if( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 )
+		{
+			level->index_value_entry = level->number_of_index_values;
+
+			continue;
+		}
+		if( libfsntfs_file_name_values_initialize(
+		     &file_name_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file name values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_file_name_values_read_data(
+		     file_name_values,
+		     index_value->key_data,
+		     (size_t) index_value->key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file name values.",
+			 function );
+
+			goto on_error;
+		}
+		if( file_name_values->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid file name values - missing name.",
+			 function );
+
+			goto on_error;
+		}
+		/* Ignore the file name with the . as its name and the short names
+		 * the latter are represented by the directory entry of the long name
+		 */
+		if( ( file_name_values->name_space == LIBFSNTFS_FILE_NAME_SPACE_DOS )
+		 || ( ( file_name_values->name_size == 2 )
+		  &&  ( file_name_values->name[ 0 ] == 0x2e )
+		  &&  ( file_name_values->name[ 1 ] == 0x00 ) ) )
+		{
+			if( libfsntfs_file_name_values_free(
+			     &file_name_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file name values.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( libfsntfs_directory_entry_initialize(
+		     &safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		safe_directory_entry->file_reference   = index_value->file_reference;
+		safe_directory_entry->file_name_values = file_name_values;
+
+		/* The cursor contains the VCN of the index node + 1 in bits 16 to 47
+		 * and the index value entry + 1 in bits 0 to 15
+		 */
+		if( level->index_value_entry <= 0xffff )
+		{
+			internal_directory_iterator->cursor        = ( (uint64_t) ( level->index_node_vcn + 1 ) << 16 )
+			                                           | (uint64_t) level->index_value_entry;
+			internal_directory_iterator->cursor_is_set = 1;
+		}
+		else
+		{
+			internal_directory_iterator->cursor_is_set = 0;
+		}
+		*directory_entry = safe_directory_entry;
+
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+	if( file_name_values != NULL )
+	{
+		libfsntfs_file_name_values_free(
+		 &file_name_values,
+		 NULL );
+	}
+	/* Prevent the iterator from continuing with an inconsistent path
+	 */
+	internal_directory_iterator->depth         = -1;
+	internal_directory_iterator->cursor_is_set = 0;
+
+	return( -1 );
+}
+
+/* Positions the directory iterator after a specific name
+ * The next directory entry returned by the iterator is the first entry that sorts after the name,
+ * the name does not need to be present in the $I30 index
+ * Either the UTF-8 or the UTF-16 string is used, the other must be NULL
+ * Only the index nodes on the path from the root node to the resulting position are read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_directory_iterator_seek_after_name(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_iterator_level_t *level    = NULL;
+	libfsntfs_file_name_values_t *file_name_values = NULL;
+	libfsntfs_index_value_t *index_value           = NULL;
+	static char *function                          = "libfsntfs_internal_directory_iterator_seek_after_name";
+	int compare_result                             = 0;
+	int result                                     = 0;
+
+	if( internal_directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( utf8_string == NULL )
+	  &&  ( utf16_string == NULL ) )
+	 || ( ( utf8_string != NULL )
+	  &&  ( utf16_string != NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 and UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_internal_directory_iterator_reset(
+	     internal_directory_iterator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset directory iterator.",
+		 function );
+
+		goto on_error;
+	}
+	while( internal_directory_iterator->depth >= 0 )
+	{
+		level = &( internal_directory_iterator->levels[ internal_directory_iterator->depth ] );
+
+		/* Skip the index values that sort before or equal to the name
+		 */
+		for( level->index_value_entry = 0;
+		     level->index_value_entry < level->number_of_index_values;
+		     level->index_value_entry++ )
+		{
+			if( libfsntfs_index_node_get_value_by_index(
+			     level->index_node,
+			     level->index_value_entry,
+			     &index_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d from index node.",
+				 function,
+				 level->index_value_entry );
+
+				goto on_error;
+			}
+			if( index_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid index node - missing index value: %d.",
+				 function,
+				 level->index_value_entry );
+
+				goto on_error;
+			}
+			if( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 )
+			{
+				break;
+			}
+			if( libfsntfs_file_name_values_initialize(
+			     &file_name_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file name values.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_file_name_values_read_data(
+			     file_name_values,
+			     index_value->key_data,
+			     (size_t) index_value->key_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file name values.",
+				 function );
+
+				goto on_error;
+			}
+			if( utf8_string != NULL )
+			{
+				compare_result = libfsntfs_name_compare_with_utf8_string(
+				                  file_name_values->name,
+				                  file_name_values->name_size,
+				                  utf8_string,
+				                  utf8_string_length,
+				                  internal_directory_iterator->use_case_folding,
+				                  error );
+			}
+			else
+			{
+				compare_result = libfsntfs_name_compare_with_utf16_string(
+				                  file_name_values->name,
+				                  file_name_values->name_size,
+				                  utf16_string,
+				                  utf16_string_length,
+				                  internal_directory_iterator->use_case_folding,
+				                  error );
+			}
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare file name values with name.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_file_name_values_free(
+			     &file_name_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file name values.",
+				 function );
+
+				goto on_error;
+			}
+			if( compare_result == LIBUNA_COMPARE_LESS )
+			{
+				break;
+			}
+		}
+		if( ( index_value == NULL )
+		 || ( level->index_value_entry >= level->number_of_index_values )
+		 || ( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_BRANCH_NODE ) == 0 ) )
+		{
+			break;
+		}
+		/* The sub node can contain entries that sort after the name
+		 */
+		level->sub_node_visited = 1;
+
+		result = libfsntfs_internal_directory_iterator_push_sub_node(
+		          internal_directory_iterator,
+		          index_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read sub node of index value: %d.",
+			 function,
+			 level->index_value_entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			level->sub_node_visited = 0;
+
+			break;
+		}
+		index_value = NULL;
+	}
+	/* The position after a name has no cursor
+	 */
+	internal_directory_iterator->cursor_is_set = 0;
+
+	return( 1 );
+
+on_error:
+	if( file_name_values != NULL )
+	{
+		libfsntfs_file_name_values_free(
+		 &file_name_values,
+		 NULL );
+	}
+	internal_directory_iterator->depth         = -1;
+	internal_directory_iterator->cursor_is_set = 0;
+
+	return( -1 );
+}
+
+/* Positions the directory iterator at a cursor
+ * The directory iterator is positioned after the directory entry the cursor was retrieved for,
+ * only the index node referenced by the cursor and the index nodes on the path from the root
+ * node to the resulting position are read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_directory_iterator_set_cursor(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     uint64_t cursor,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_iterator_level_t *level    = NULL;
+	libfsntfs_file_name_values_t *file_name_values = NULL;
+	libfsntfs_index_node_t *index_node             = NULL;
+	libfsntfs_index_value_t *index_value           = NULL;
+	uint16_t *utf16_string                         = NULL;
+	static char *function                          = "libfsntfs_internal_directory_iterator_set_cursor";
+	size_t name_offset                             = 0;
+	size_t utf16_string_length                     = 0;
+	size_t utf16_string_index                      = 0;
+	off64_t index_entry_offset                     = 0;
+	uint64_t index_node_vcn                        = 0;
+	int index_value_entry                          = 0;
+	int number_of_index_values                     = 0;
+
+	if( internal_directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_iterator->i30_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing $I30 index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_iterator->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cursor >> 48 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cursor value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( cursor == 0 )
+	{
+		if( libfsntfs_internal_directory_iterator_reset(
+		     internal_directory_iterator,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset directory iterator.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* Consecutive listings continue at the position of the previous listing
+	 */
+	if( ( internal_directory_iterator->cursor_is_set != 0 )
+	 && ( internal_directory_iterator->cursor == cursor ) )
+	{
+		return( 1 );
+	}
+	index_node_vcn    = cursor >> 16;
+	index_value_entry = (int) ( cursor & 0xffff );
+
+	if( index_value_entry == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cursor - index value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	index_value_entry -= 1;
+
+	if( index_node_vcn == 0 )
+	{
+		index_node = internal_directory_iterator->i30_index->root_node;
+	}
+	else
+	{
+		index_node_vcn -= 1;
+
+		if( index_node_vcn > (uint64_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid cursor - index node VCN value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The sub node cache of the root level is used, the index node is read again
+		 * from this cache when the path from the root node leads to it
+		 */
+		level = &( internal_directory_iterator->levels[ 0 ] );
+
+		if( level->sub_node_cache == NULL )
+		{
+			if( libfcache_cache_initialize(
+			     &( level->sub_node_cache ),
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub node cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		index_entry_offset = (off64_t) ( index_node_vcn * internal_directory_iterator->io_handle->cluster_block_size );
+
+		if( libfsntfs_index_get_sub_node(
+		     internal_directory_iterator->i30_index,
+		     internal_directory_iterator->file_io_handle,
+		     level->sub_node_cache,
+		     index_entry_offset,
+		     (int) index_node_vcn,
+		     &index_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node with VCN: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 (int) index_node_vcn,
+			 index_entry_offset,
+			 index_entry_offset );
+
+			goto on_error;
+		}
+	}
+	if( index_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cursor - missing index node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_index_node_get_number_of_values(
+	     index_node,
+	     &number_of_index_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values from index node.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_value_entry >= number_of_index_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cursor - index value entry value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_index_node_get_value_by_index(
+	     index_node,
+	     index_value_entry,
+	     &index_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from index node.",
+		 function,
+		 index_value_entry );
+
+		goto on_error;
+	}
+	if( ( index_value == NULL )
+	 || ( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cursor - unsupported index value: %d.",
+		 function,
+		 index_value_entry );
+
+		goto on_error;
+	}
+	if( libfsntfs_file_name_values_initialize(
+	     &file_name_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file name values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_file_name_values_read_data(
+	     file_name_values,
+	     index_value->key_data,
+	     (size_t) index_value->key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file name values.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_name_values->name == NULL )
+	 || ( file_name_values->name_size < 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file name values - missing name.",
+		 function );
+
+		goto on_error;
+	}
+	/* The name is stored as an UTF-16 little-endian stream
+	 */
+	utf16_string_length = file_name_values->name_size / 2;
+
+	utf16_string = (uint16_t *) memory_allocate(
+	                             sizeof( uint16_t ) * utf16_string_length );
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( file_name_values->name[ name_offset ] ),
+		 utf16_string[ utf16_string_index ] );
+
+		name_offset += 2;
+	}
+	if( libfsntfs_file_name_values_free(
+	     &file_name_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file name values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_internal_directory_iterator_seek_after_name(
+	     internal_directory_iterator,
+	     NULL,
+	     0,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to seek after name of cursor.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf16_string );
+
+	internal_directory_iterator->cursor        = cursor;
+	internal_directory_iterator->cursor_is_set = 1;
+
+	return( 1 );
+
+on_error:
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
+	}
+	if( file_name_values != NULL )
+	{
+		libfsntfs_file_name_values_free(
+		 &file_name_values,
+		 NULL );
+	}
+	internal_directory_iterator->depth         = -1;
+	internal_directory_iterator->cursor_is_set = 0;
+
+	return( -1 );
+}
+
+/* Resets the directory iterator to the start of the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_reset(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_reset";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_internal_directory_iterator_reset(
+	     internal_directory_iterator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset directory iterator.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the next sub file entry in collation order
+ * Returns 1 if successful, 0 if no more sub file entries or -1 on error
+ */
+int libfsntfs_directory_iterator_get_next_sub_file_entry(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     libfsntfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *sub_directory_entry                     = NULL;
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_next_sub_file_entry";
+	uint64_t mft_entry_index                                             = 0;
+	int result                                                           = 0;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_directory_iterator_get_next_directory_entry(
+	          internal_directory_iterator,
+	          &sub_directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next directory entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_directory_entry_get_mft_entry_index(
+		     sub_directory_entry,
+		     &mft_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MFT entry index.",
+			 function );
+
+			result = -1;
+		}
+		/* sub_file_entry takes over management of sub_directory_entry
+		 */
+		else if( libfsntfs_file_entry_initialize(
+		          sub_file_entry,
+		          internal_directory_iterator->io_handle,
+		          internal_directory_iterator->file_io_handle,
+		          internal_directory_iterator->file_system,
+		          mft_entry_index,
+		          sub_directory_entry,
+		          internal_directory_iterator->flags,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub file entry with MFT entry: %" PRIu64 ".",
+			 function,
+			 mft_entry_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result == -1 )
+	{
+		if( sub_directory_entry != NULL )
+		{
+			libfsntfs_directory_entry_free(
+			 &sub_directory_entry,
+			 NULL );
+		}
+	}
+	return( result );
+}
+
+/* Positions the directory iterator after an UTF-8 encoded name
+ * The name is used as a resumable cursor, it does not need to be present in the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_seek_after_utf8_name(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_seek_after_utf8_name";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_internal_directory_iterator_seek_after_name(
+	     internal_directory_iterator,
+	     utf8_string,
+	     utf8_string_length,
+	     NULL,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to seek after UTF-8 name.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Positions the directory iterator after an UTF-16 encoded name
+ * The name is used as a resumable cursor, it does not need to be present in the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_seek_after_utf16_name(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_seek_after_utf16_name";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_internal_directory_iterator_seek_after_name(
+	     internal_directory_iterator,
+	     NULL,
+	     0,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to seek after UTF-16 name.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the cursor of the current position
+ * The cursor is an opaque value that can be used to position a directory iterator
+ * of the same directory after the directory entry that was last retrieved,
+ * a cursor of 0 represents the start of the directory
+ * Returns 1 if successful, 0 if the current position has no cursor or -1 on error
+ */
+int libfsntfs_directory_iterator_get_cursor(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *cursor,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_cursor";
+	int result                                                           = 0;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->cursor_is_set != 0 )
+	{
+		*cursor = internal_directory_iterator->cursor;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Positions the directory iterator at a cursor
+ * The cursor must have been retrieved from a directory iterator of the same directory
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_set_cursor(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t cursor,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_set_cursor";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_internal_directory_iterator_set_cursor(
+	     internal_directory_iterator,
+	     cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cursor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the next index entry in collation order
+ * The values of the index entry are stored in the $I30 index of the directory,
+ * hence reading them does not require the MFT entry of the sub file entry
+ * The index entry remains available until the next index entry is read
+ * Returns 1 if successful, 0 if no more index entries or -1 on error
+ */
+int libfsntfs_directory_iterator_read_next_index_entry(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_read_next_index_entry";
+	int result                                                           = 0;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry != NULL )
+	{
+		if( libfsntfs_directory_entry_free(
+		     &( internal_directory_iterator->directory_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		result = libfsntfs_internal_directory_iterator_get_next_directory_entry(
+		          internal_directory_iterator,
+		          &( internal_directory_iterator->directory_entry ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next directory entry.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file reference of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_file_reference(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_file_reference";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_file_reference(
+	          internal_directory_iterator->directory_entry,
+	          file_reference,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file reference.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the parent file reference of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_parent_file_reference(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *parent_file_reference,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_parent_file_reference";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_parent_file_reference(
+	          internal_directory_iterator->directory_entry,
+	          parent_file_reference,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file reference.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the creation date and time of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_creation_time(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_creation_time";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_creation_time(
+	          internal_directory_iterator->directory_entry,
+	          filetime,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the (file) modification (last written) date and time of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_modification_time(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_modification_time";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_modification_time(
+	          internal_directory_iterator->directory_entry,
+	          filetime,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the access date and time of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_access_time(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_access_time";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_access_time(
+	          internal_directory_iterator->directory_entry,
+	          filetime,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the (file system entry) modification date and time of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_entry_modification_time(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_entry_modification_time";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_entry_modification_time(
+	          internal_directory_iterator->directory_entry,
+	          filetime,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry modification time.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the allocated size of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_allocated_size(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *allocated_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_allocated_size";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_allocated_size(
+	          internal_directory_iterator->directory_entry,
+	          allocated_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve allocated size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_size(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *size,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_size";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_size(
+	          internal_directory_iterator->directory_entry,
+	          size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file attribute flags of the current index entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_file_attribute_flags(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint32_t *file_attribute_flags,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_file_attribute_flags";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_file_attribute_flags(
+	          internal_directory_iterator->directory_entry,
+	          file_attribute_flags,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of the current index entry
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_utf8_name_size(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_utf8_name_size";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_utf8_name_size(
+	          internal_directory_iterator->directory_entry,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name of the current index entry
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_utf8_name(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_utf8_name";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_utf8_name(
+	          internal_directory_iterator->directory_entry,
+	          utf8_string,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 name.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded name of the current index entry
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_utf16_name_size(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_utf16_name_size";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_utf16_name_size(
+	          internal_directory_iterator->directory_entry,
+	          utf16_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 name size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded name of the current index entry
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_directory_iterator_get_utf16_name(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                                = "libfsntfs_directory_iterator_get_utf16_name";
+	int result                                                           = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsntfs_internal_directory_iterator_t *) directory_iterator;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_directory_iterator->directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory iterator - missing index entry.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsntfs_directory_entry_get_utf16_name(
+	          internal_directory_iterator->directory_entry,
+	          utf16_string,
+	          utf16_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 name.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
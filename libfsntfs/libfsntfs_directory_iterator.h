@@ -0,0 +1,300 @@
+/*
+ * Directory iterator functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_DIRECTORY_ITERATOR_H )
+#define _LIBFSNTFS_DIRECTORY_ITERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_directory_entry.h"
+#include "libfsntfs_extern.h"
+#include "libfsntfs_file_system.h"
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_value.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+#include "libfsntfs_libfcache.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_directory_iterator_level libfsntfs_directory_iterator_level_t;
+
+struct libfsntfs_directory_iterator_level
+{
+	/* The index node
+	 */
+	libfsntfs_index_node_t *index_node;
+
+	/* The VCN of the index node, which is -1 for the root node
+	 */
+	int index_node_vcn;
+
+	/* The sub node cache
+	 * The cache holds the index node of the next level
+	 */
+	libfcache_cache_t *sub_node_cache;
+
+	/* The number of index values
+	 */
+	int number_of_index_values;
+
+	/* The current index value entry
+	 */
+	int index_value_entry;
+
+	/* Value to indicate the sub node of the current index value was visited
+	 */
+	uint8_t sub_node_visited;
+};
+
+typedef struct libfsntfs_internal_directory_iterator libfsntfs_internal_directory_iterator_t;
+
+struct libfsntfs_internal_directory_iterator
+{
+	/* The IO handle
+	 */
+	libfsntfs_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file system
+	 */
+	libfsntfs_file_system_t *file_system;
+
+	/* The $I30 index
+	 */
+	libfsntfs_index_t *i30_index;
+
+	/* The levels of the path from the root node to the current index node
+	 */
+	libfsntfs_directory_iterator_level_t levels[ LIBFSNTFS_MAXIMUM_RECURSION_DEPTH + 1 ];
+
+	/* The current depth, which is -1 if there are no more entries
+	 */
+	int depth;
+
+	/* The cursor of the current position
+	 */
+	uint64_t cursor;
+
+	/* Value to indicate the cursor is set
+	 */
+	uint8_t cursor_is_set;
+
+	/* The directory entry of the current index entry
+	 */
+	libfsntfs_directory_entry_t *directory_entry;
+
+	/* Value to indicate case folding should be used
+	 */
+	uint8_t use_case_folding;
+
+	/* The file entry flags
+	 */
+	uint8_t flags;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsntfs_directory_iterator_initialize(
+     libfsntfs_directory_iterator_t **directory_iterator,
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_file_system_t *file_system,
+     libfsntfs_mft_entry_t *mft_entry,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_free(
+     libfsntfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_directory_iterator_reset(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_directory_iterator_push_sub_node(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     libfsntfs_index_value_t *index_value,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_directory_iterator_get_next_directory_entry(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_directory_iterator_seek_after_name(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_directory_iterator_set_cursor(
+     libfsntfs_internal_directory_iterator_t *internal_directory_iterator,
+     uint64_t cursor,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_reset(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_next_sub_file_entry(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     libfsntfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_seek_after_utf8_name(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_seek_after_utf16_name(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_cursor(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *cursor,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_set_cursor(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t cursor,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_read_next_index_entry(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_file_reference(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_parent_file_reference(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *parent_file_reference,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_creation_time(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_modification_time(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_access_time(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_entry_modification_time(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_allocated_size(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *allocated_size,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_size(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint64_t *size,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_file_attribute_flags(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint32_t *file_attribute_flags,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_utf8_name_size(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_utf8_name(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_utf16_name_size(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_directory_iterator_get_utf16_name(
+     libfsntfs_directory_iterator_t *directory_iterator,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_DIRECTORY_ITERATOR_H ) */
+
@@ -0,0 +1,751 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_extent_map.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libfdata.h"
+#include "libfsntfs_unused.h"
+
+/* Creates an extent map
+ * Make sure the value extent_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_map_initialize(
+     libfsntfs_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_map_initialize";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_map = memory_allocate_structure(
+	               libfsntfs_extent_map_t );
+
+	if( *extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_map,
+	     0,
+	     sizeof( libfsntfs_extent_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent map.",
+		 function );
+
+		goto on_error;
+	}
+	( *extent_map )->current_extent_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *extent_map != NULL )
+	{
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent map
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_map_free(
+     libfsntfs_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_map_free";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_map != NULL )
+	{
+		if( ( *extent_map )->extent_flags != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->extent_flags );
+		}
+		if( ( *extent_map )->physical_offsets != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->physical_offsets );
+		}
+		if( ( *extent_map )->data_offsets != NULL )
+		{
+			memory_free(
+			 ( *extent_map )->data_offsets );
+		}
+		memory_free(
+		 *extent_map );
+
+		*extent_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an extent to the extent map
+ * The extent is merged with the last extent if both are sparse or physically adjacent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_map_append_extent(
+     libfsntfs_extent_map_t *extent_map,
+     off64_t physical_offset,
+     size64_t size,
+     uint8_t extent_flags,
+     libcerror_error_t **error )
+{
+	void *reallocation              = NULL;
+	static char *function           = "libfsntfs_extent_map_append_extent";
+	size64_t last_extent_size       = 0;
+	int last_extent_index           = 0;
+	int number_of_allocated_extents = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid physical offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - extent_map->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( extent_map->number_of_extents > 0 )
+	{
+		last_extent_index = extent_map->number_of_extents - 1;
+		last_extent_size  = extent_map->data_size - (size64_t) extent_map->data_offsets[ last_extent_index ];
+
+		if( extent_map->extent_flags[ last_extent_index ] == extent_flags )
+		{
+			if( ( ( extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+			 || ( ( extent_map->physical_offsets[ last_extent_index ] + (off64_t) last_extent_size ) == physical_offset ) )
+			{
+				extent_map->data_size += size;
+
+				return( 1 );
+			}
+		}
+	}
+	if( extent_map->number_of_extents >= extent_map->number_of_allocated_extents )
+	{
+		if( extent_map->number_of_allocated_extents > ( ( INT_MAX / 2 ) / (int) sizeof( off64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated extents value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		/* Grow the arrays exponentially to keep appending large numbers of extents linear
+		 */
+		if( extent_map->number_of_allocated_extents < LIBFSNTFS_EXTENT_MAP_ALLOCATION_INCREMENT )
+		{
+			number_of_allocated_extents = LIBFSNTFS_EXTENT_MAP_ALLOCATION_INCREMENT;
+		}
+		else
+		{
+			number_of_allocated_extents = extent_map->number_of_allocated_extents * 2;
+		}
+		reallocation = memory_reallocate(
+		                extent_map->data_offsets,
+		                sizeof( off64_t ) * number_of_allocated_extents );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data offsets.",
+			 function );
+
+			return( -1 );
+		}
+		extent_map->data_offsets = (off64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                extent_map->physical_offsets,
+		                sizeof( off64_t ) * number_of_allocated_extents );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize physical offsets.",
+			 function );
+
+			return( -1 );
+		}
+		extent_map->physical_offsets = (off64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                extent_map->extent_flags,
+		                sizeof( uint8_t ) * number_of_allocated_extents );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extent flags.",
+			 function );
+
+			return( -1 );
+		}
+		extent_map->extent_flags = (uint8_t *) reallocation;
+
+		extent_map->number_of_allocated_extents = number_of_allocated_extents;
+	}
+	extent_map->data_offsets[ extent_map->number_of_extents ]     = (off64_t) extent_map->data_size;
+	extent_map->physical_offsets[ extent_map->number_of_extents ] = physical_offset;
+	extent_map->extent_flags[ extent_map->number_of_extents ]     = extent_flags;
+
+	extent_map->number_of_extents += 1;
+	extent_map->data_size         += size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_map_get_number_of_extents(
+     libfsntfs_extent_map_t *extent_map,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_map_get_number_of_extents";
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extents = extent_map->number_of_extents;
+
+	return( 1 );
+}
+
+/* Retrieves a specific extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_extent_map_get_extent_by_index(
+     libfsntfs_extent_map_t *extent_map,
+     int extent_index,
+     off64_t *data_offset,
+     off64_t *physical_offset,
+     size64_t *size,
+     uint8_t *extent_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_map_get_extent_by_index";
+	off64_t end_offset    = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= extent_map->number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index + 1 ) < extent_map->number_of_extents )
+	{
+		end_offset = extent_map->data_offsets[ extent_index + 1 ];
+	}
+	else
+	{
+		end_offset = (off64_t) extent_map->data_size;
+	}
+	*data_offset     = extent_map->data_offsets[ extent_index ];
+	*physical_offset = extent_map->physical_offsets[ extent_index ];
+	*size            = (size64_t) ( end_offset - extent_map->data_offsets[ extent_index ] );
+	*extent_flags    = extent_map->extent_flags[ extent_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the index of the extent that contains a specific data offset
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libfsntfs_extent_map_get_extent_index_at_offset(
+     libfsntfs_extent_map_t *extent_map,
+     off64_t data_offset,
+     int *extent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_map_get_extent_index_at_offset";
+	int first_index       = 0;
+	int last_index        = 0;
+	int middle_index      = 0;
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_map->number_of_extents == 0 )
+	 || ( data_offset < 0 )
+	 || ( (size64_t) data_offset >= extent_map->data_size ) )
+	{
+		return( 0 );
+	}
+	/* Find the last extent that starts at or before the data offset
+	 */
+	last_index = extent_map->number_of_extents - 1;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index + 1 ) / 2 );
+
+		if( extent_map->data_offsets[ middle_index ] <= data_offset )
+		{
+			first_index = middle_index;
+		}
+		else
+		{
+			last_index = middle_index - 1;
+		}
+	}
+	*extent_index = first_index;
+
+	return( 1 );
+}
+
+/* Reads data from the current offset into a buffer
+ * Callback for the cluster block stream
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsntfs_extent_map_read_segment_data(
+         libfsntfs_extent_map_t *extent_map,
+         libbfio_handle_t *file_io_handle,
+         int segment_index LIBFSNTFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSNTFS_ATTRIBUTE_UNUSED,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags LIBFSNTFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function      = "libfsntfs_extent_map_read_segment_data";
+	size_t read_size           = 0;
+	size_t segment_data_offset = 0;
+	ssize_t read_count         = 0;
+	off64_t extent_data_offset = 0;
+	off64_t extent_end_offset  = 0;
+	int extent_index           = 0;
+
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_file_index )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( read_flags )
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+	{
+		if( memory_set(
+		     segment_data,
+		     0,
+		     segment_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear segment data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) segment_data_size );
+	}
+	extent_index = extent_map->current_extent_index;
+
+	while( segment_data_size > 0 )
+	{
+		if( (size64_t) extent_map->current_offset >= extent_map->data_size )
+		{
+			break;
+		}
+		/* Sequential reads continue in the current or next extent, otherwise the extent is searched for
+		 */
+		if( ( extent_index < 0 )
+		 || ( extent_index >= extent_map->number_of_extents )
+		 || ( extent_map->current_offset < extent_map->data_offsets[ extent_index ] ) )
+		{
+			extent_index = -1;
+		}
+		else if( ( ( extent_index + 1 ) < extent_map->number_of_extents )
+		      && ( extent_map->current_offset >= extent_map->data_offsets[ extent_index + 1 ] ) )
+		{
+			if( ( ( extent_index + 2 ) < extent_map->number_of_extents )
+			 && ( extent_map->current_offset >= extent_map->data_offsets[ extent_index + 2 ] ) )
+			{
+				extent_index = -1;
+			}
+			else
+			{
+				extent_index++;
+			}
+		}
+		if( extent_index == -1 )
+		{
+			if( libfsntfs_extent_map_get_extent_index_at_offset(
+			     extent_map,
+			     extent_map->current_offset,
+			     &extent_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 extent_map->current_offset,
+				 extent_map->current_offset );
+
+				return( -1 );
+			}
+		}
+		if( ( extent_index + 1 ) < extent_map->number_of_extents )
+		{
+			extent_end_offset = extent_map->data_offsets[ extent_index + 1 ];
+		}
+		else
+		{
+			extent_end_offset = (off64_t) extent_map->data_size;
+		}
+		extent_data_offset = extent_map->current_offset - extent_map->data_offsets[ extent_index ];
+
+		read_size = segment_data_size;
+
+		if( (size64_t) read_size > (size64_t) ( extent_end_offset - extent_map->current_offset ) )
+		{
+			read_size = (size_t) ( extent_end_offset - extent_map->current_offset );
+		}
+		if( ( extent_map->extent_flags[ extent_index ] & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			if( memory_set(
+			     &( segment_data[ segment_data_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear segment data.",
+				 function );
+
+				return( -1 );
+			}
+			read_count = (ssize_t) read_size;
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( segment_data[ segment_data_offset ] ),
+			              read_size,
+			              extent_map->physical_offsets[ extent_index ] + extent_data_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extent: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 extent_index,
+				 extent_map->physical_offsets[ extent_index ] + extent_data_offset,
+				 extent_map->physical_offsets[ extent_index ] + extent_data_offset );
+
+				return( -1 );
+			}
+		}
+		segment_data_offset += (size_t) read_count;
+		segment_data_size   -= (size_t) read_count;
+
+		extent_map->current_offset      += (off64_t) read_count;
+		extent_map->current_extent_index = extent_index;
+
+		if( (size_t) read_count != read_size )
+		{
+			break;
+		}
+	}
+	return( (ssize_t) segment_data_offset );
+}
+
+/* Seeks a certain offset of the data
+ * Callback for the cluster block stream
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfsntfs_extent_map_seek_segment_offset(
+         libfsntfs_extent_map_t *extent_map,
+         libbfio_handle_t *file_io_handle LIBFSNTFS_ATTRIBUTE_UNUSED,
+         int segment_index LIBFSNTFS_ATTRIBUTE_UNUSED,
+         int segment_file_index LIBFSNTFS_ATTRIBUTE_UNUSED,
+         off64_t segment_offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_extent_map_seek_segment_offset";
+
+	LIBFSNTFS_UNREFERENCED_PARAMETER( file_io_handle )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_index )
+	LIBFSNTFS_UNREFERENCED_PARAMETER( segment_file_index )
+
+	if( extent_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent map.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	extent_map->current_offset = segment_offset;
+
+	return( segment_offset );
+}
+
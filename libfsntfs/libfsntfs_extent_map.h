@@ -0,0 +1,135 @@
+/*
+ * Extent map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_EXTENT_MAP_H )
+#define _LIBFSNTFS_EXTENT_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of extents the extent map arrays are grown by
+ */
+#define LIBFSNTFS_EXTENT_MAP_ALLOCATION_INCREMENT	256
+
+typedef struct libfsntfs_extent_map libfsntfs_extent_map_t;
+
+struct libfsntfs_extent_map
+{
+	/* The data offsets of the extents, sorted in ascending order
+	 */
+	off64_t *data_offsets;
+
+	/* The physical offsets of the extents
+	 */
+	off64_t *physical_offsets;
+
+	/* The flags of the extents
+	 */
+	uint8_t *extent_flags;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The number of allocated extents
+	 */
+	int number_of_allocated_extents;
+
+	/* The data size, which is the end offset of the last extent
+	 */
+	size64_t data_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The index of the extent that contains the current offset or -1 if not determined
+	 */
+	int current_extent_index;
+};
+
+int libfsntfs_extent_map_initialize(
+     libfsntfs_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_map_free(
+     libfsntfs_extent_map_t **extent_map,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_map_append_extent(
+     libfsntfs_extent_map_t *extent_map,
+     off64_t physical_offset,
+     size64_t size,
+     uint8_t extent_flags,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_map_get_number_of_extents(
+     libfsntfs_extent_map_t *extent_map,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_map_get_extent_by_index(
+     libfsntfs_extent_map_t *extent_map,
+     int extent_index,
+     off64_t *data_offset,
+     off64_t *physical_offset,
+     size64_t *size,
+     uint8_t *extent_flags,
+     libcerror_error_t **error );
+
+int libfsntfs_extent_map_get_extent_index_at_offset(
+     libfsntfs_extent_map_t *extent_map,
+     off64_t data_offset,
+     int *extent_index,
+     libcerror_error_t **error );
+
+ssize_t libfsntfs_extent_map_read_segment_data(
+         libfsntfs_extent_map_t *extent_map,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         uint32_t segment_flags,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+off64_t libfsntfs_extent_map_seek_segment_offset(
+         libfsntfs_extent_map_t *extent_map,
+         libbfio_handle_t *file_io_handle,
+         int segment_index,
+         int segment_file_index,
+         off64_t segment_offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_EXTENT_MAP_H ) */
+
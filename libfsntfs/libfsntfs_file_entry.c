@@ -29,6 +29,7 @@
 #include "libfsntfs_definitions.h"
 #include "libfsntfs_directory_entries_tree.h"
 #include "libfsntfs_directory_entry.h"
+#include "libfsntfs_directory_iterator.h"
 #include "libfsntfs_extent.h"
 #include "libfsntfs_file_entry.h"
 #include "libfsntfs_file_name_attribute.h"
@@ -210,24 +211,8 @@ int libfsntfs_file_entry_initialize(
 
 					goto on_error;
 				}
-				if( libfsntfs_directory_entries_tree_read_from_i30_index(
-				     internal_file_entry->directory_entries_tree,
-				     io_handle,
-				     file_io_handle,
-				     mft_entry,
-				     flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read MFT entry: %" PRIu32 " directory entries tree.",
-					 function,
-					 mft_entry->index );
-
-					goto on_error;
-				}
+				/* The directory entries tree is read from the $I30 index on demand
+				 */
 			}
 			if( mft_entry->data_attribute != NULL )
 			{
@@ -466,6 +451,23 @@ int libfsntfs_file_entry_free(
 
 			result = -1;
 		}
+		if( internal_file_entry->ranges_array != NULL )
+		{
+			if( libcdata_array_free(
+			     &( internal_file_entry->ranges_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_extent_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free ranges array.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( internal_file_entry->security_descriptor_values != NULL )
 		{
 			if( libfsntfs_security_descriptor_values_free(
@@ -6010,6 +6012,62 @@ int libfsntfs_file_entry_get_alternate_data_stream_by_utf16_name(
 	return( result );
 }
 
+/* Reads the directory entries tree if not read before
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_file_entry_read_directory_entries_tree(
+     libfsntfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_file_entry_read_directory_entries_tree";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->directory_entries_tree == NULL )
+	{
+		return( 1 );
+	}
+	if( internal_file_entry->mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_directory_entries_tree_read_from_i30_index_on_demand(
+	     internal_file_entry->directory_entries_tree,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->mft_entry,
+	     internal_file_entry->flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read MFT entry: %" PRIu32 " directory entries tree.",
+		 function,
+		 internal_file_entry->mft_entry->index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of sub file entries
  * Returns 1 if successful or -1 on error
  */
@@ -6047,6 +6105,19 @@ int libfsntfs_file_entry_get_number_of_sub_file_entries(
 
 		return( -1 );
 	}
+	if( libfsntfs_internal_file_entry_read_directory_entries_tree(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -6151,6 +6222,19 @@ int libfsntfs_file_entry_get_sub_file_entry_by_index(
 
 		return( -1 );
 	}
+	if( libfsntfs_internal_file_entry_read_directory_entries_tree(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -6301,6 +6385,19 @@ int libfsntfs_file_entry_get_sub_file_entry_by_utf8_name(
 
 		return( -1 );
 	}
+	if( libfsntfs_internal_file_entry_read_directory_entries_tree(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -6452,6 +6549,19 @@ int libfsntfs_file_entry_get_sub_file_entry_by_utf16_name(
 
 		return( -1 );
 	}
+	if( libfsntfs_internal_file_entry_read_directory_entries_tree(
+	     internal_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries tree.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
@@ -6552,6 +6662,117 @@ int libfsntfs_file_entry_get_sub_file_entry_by_utf16_name(
 	return( result );
 }
 
+/* Retrieves a directory iterator
+ * The directory iterator retrieves the sub file entries in collation order
+ * without reading all the index nodes of the directory entries ($I30) index
+ * Returns 1 if successful, 0 if the file entry has no directory entries index or -1 on error
+ */
+int libfsntfs_file_entry_get_directory_iterator(
+     libfsntfs_file_entry_t *file_entry,
+     libfsntfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_get_directory_iterator";
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory iterator value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_entries_tree != NULL )
+	{
+		if( libfsntfs_directory_iterator_initialize(
+		     directory_iterator,
+		     internal_file_entry->io_handle,
+		     internal_file_entry->file_io_handle,
+		     internal_file_entry->file_system,
+		     internal_file_entry->mft_entry,
+		     internal_file_entry->flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory iterator.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libfsntfs_directory_iterator_free(
+		 directory_iterator,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Reads data at the current offset from the default data stream (nameless $DATA attribute)
  * Returns the number of bytes read or -1 on error
  */
@@ -7181,3 +7402,586 @@ int libfsntfs_file_entry_get_extent_by_index(
 	return( result );
 }
 
+/* Retrieves the data and sparse ranges array of the default data stream (nameless $DATA attribute)
+ * The array is created on first use, the caller must hold the read/write lock for writing
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_internal_file_entry_get_ranges_array(
+     libfsntfs_internal_file_entry_t *internal_file_entry,
+     libcdata_array_t **ranges_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_file_entry_get_ranges_array";
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ranges_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ranges array.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->data_cluster_block_stream == NULL )
+	{
+		return( 0 );
+	}
+	if( internal_file_entry->ranges_array == NULL )
+	{
+		if( libfsntfs_cluster_block_stream_get_ranges_array(
+		     internal_file_entry->data_cluster_block_stream,
+		     &( internal_file_entry->ranges_array ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve ranges array from data cluster block stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*ranges_array = internal_file_entry->ranges_array;
+
+	return( 1 );
+}
+
+/* Retrieves the number of data and sparse ranges of the default data stream (nameless $DATA attribute)
+ * Adjacent extents that are both data or both sparse are combined into a single range
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_file_entry_get_number_of_ranges(
+     libfsntfs_file_entry_t *file_entry,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *ranges_array                       = NULL;
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_get_number_of_ranges";
+	int result                                           = 0;
+	int safe_number_of_ranges                            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+	if( number_of_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_file_entry_get_ranges_array(
+	          internal_file_entry,
+	          &ranges_array,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ranges array.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     ranges_array,
+		     &safe_number_of_ranges,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of ranges.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	*number_of_ranges = safe_number_of_ranges;
+
+	return( 1 );
+}
+
+/* Retrieves a specific data or sparse range of the default data stream (nameless $DATA attribute)
+ * The range flags contain LIBFSNTFS_EXTENT_FLAG_IS_SPARSE if the range is sparse
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_file_entry_get_range_by_index(
+     libfsntfs_file_entry_t *file_entry,
+     int range_index,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *ranges_array                       = NULL;
+	libfsntfs_extent_t *range                            = NULL;
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_get_range_by_index";
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_file_entry_get_ranges_array(
+	          internal_file_entry,
+	          &ranges_array,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ranges array.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_entry_by_index(
+	          ranges_array,
+	          range_index,
+	          (intptr_t **) &range,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range: %d.",
+		 function,
+		 range_index );
+
+		result = -1;
+	}
+	else if( libfsntfs_extent_get_values(
+	          range,
+	          range_offset,
+	          range_size,
+	          range_flags,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range: %d values.",
+		 function,
+		 range_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data or sparse range that contains a specific offset in the default data stream (nameless $DATA attribute)
+ * The range flags contain LIBFSNTFS_EXTENT_FLAG_IS_SPARSE if the range is sparse
+ * Returns 1 if successful, 0 if the offset is beyond the end of the data or -1 on error
+ */
+int libfsntfs_file_entry_get_range_at_offset(
+     libfsntfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_get_range_at_offset";
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->data_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing data attribute.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_cluster_block_stream_get_range_at_offset(
+	          internal_file_entry->data_cluster_block_stream,
+	          offset,
+	          range_offset,
+	          range_size,
+	          range_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range at offset: %" PRIi64 " (0x%08" PRIx64 ") from data cluster block stream.",
+		 function,
+		 offset,
+		 offset );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Seeks the first offset, at or after a specific offset, that contains data in the default data stream (nameless $DATA attribute)
+ * This is the equivalent of lseek with SEEK_DATA, sparse ranges are skipped
+ * On success the current offset is set to the data offset
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libfsntfs_file_entry_seek_data(
+     libfsntfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_seek_data";
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->data_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing data attribute.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_cluster_block_stream_get_data_offset(
+	          internal_file_entry->data_cluster_block_stream,
+	          offset,
+	          data_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data offset from data cluster block stream.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libfdata_stream_seek_offset(
+		     internal_file_entry->data_cluster_block_stream,
+		     *data_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in data cluster block stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Seeks the first offset, at or after a specific offset, that is part of a hole (sparse range) in the default data stream (nameless $DATA attribute)
+ * This is the equivalent of lseek with SEEK_HOLE, the end of the data is considered an implicit hole
+ * On success the current offset is set to the hole offset
+ * Returns 1 if successful, 0 if the offset is beyond the end of the data or -1 on error
+ */
+int libfsntfs_file_entry_seek_hole(
+     libfsntfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsntfs_file_entry_seek_hole";
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsntfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->data_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing data attribute.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_cluster_block_stream_get_hole_offset(
+	          internal_file_entry->data_cluster_block_stream,
+	          offset,
+	          hole_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hole offset from data cluster block stream.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libfdata_stream_seek_offset(
+		     internal_file_entry->data_cluster_block_stream,
+		     *hole_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset in data cluster block stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -86,6 +86,10 @@ struct libfsntfs_internal_file_entry
 	 */
 	libcdata_array_t *extents_array;
 
+	/* The data and sparse ranges array
+	 */
+	libcdata_array_t *ranges_array;
+
 	/* The attributes array
 	 */
 	libcdata_array_t *attributes_array;
@@ -335,6 +339,10 @@ int libfsntfs_file_entry_get_utf16_name_by_attribute_index(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libfsntfs_internal_file_entry_read_directory_entries_tree(
+     libfsntfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error );
+
 int libfsntfs_internal_file_entry_get_path_hint(
      libfsntfs_internal_file_entry_t *internal_file_entry,
      int attribute_index,
@@ -515,6 +523,12 @@ int libfsntfs_file_entry_get_sub_file_entry_by_utf16_name(
      libfsntfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+int libfsntfs_file_entry_get_directory_iterator(
+     libfsntfs_file_entry_t *file_entry,
+     libfsntfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 ssize_t libfsntfs_file_entry_read_buffer(
          libfsntfs_file_entry_t *file_entry,
@@ -564,6 +578,49 @@ int libfsntfs_file_entry_get_extent_by_index(
      uint32_t *extent_flags,
      libcerror_error_t **error );
 
+int libfsntfs_internal_file_entry_get_ranges_array(
+     libfsntfs_internal_file_entry_t *internal_file_entry,
+     libcdata_array_t **ranges_array,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_file_entry_get_number_of_ranges(
+     libfsntfs_file_entry_t *file_entry,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_file_entry_get_range_by_index(
+     libfsntfs_file_entry_t *file_entry,
+     int range_index,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_file_entry_get_range_at_offset(
+     libfsntfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_file_entry_seek_data(
+     libfsntfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *data_offset,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_file_entry_seek_hole(
+     libfsntfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *hole_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -361,7 +361,6 @@ int libfsntfs_file_name_values_read_data(
 	uint16_t name_size    = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit  = 0;
 	uint32_t value_32bit  = 0;
 #endif
 
@@ -452,6 +451,10 @@ int libfsntfs_file_name_values_read_data(
 	 ( (fsntfs_file_name_t *) data )->entry_modification_time,
 	 file_name_values->entry_modification_time );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsntfs_file_name_t *) data )->allocated_data_size,
+	 file_name_values->allocated_size );
+
 	byte_stream_copy_to_uint64_little_endian(
 	 ( (fsntfs_file_name_t *) data )->data_size,
 	 file_name_values->size );
@@ -545,13 +548,10 @@ int libfsntfs_file_name_values_read_data(
 
 			goto on_error;
 		}
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsntfs_file_name_t *) data )->allocated_data_size,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: allocated data size\t\t: %" PRIu64 "\n",
 		 function,
-		 value_64bit );
+		 file_name_values->allocated_size );
 
 		libcnotify_printf(
 		 "%s: data size\t\t\t\t: %" PRIu64 "\n",
@@ -974,6 +974,43 @@ int libfsntfs_file_name_values_get_entry_modification_time(
 	return( 1 );
 }
 
+/* Retrieves the allocated size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_file_name_values_get_allocated_size(
+     libfsntfs_file_name_values_t *file_name_values,
+     uint64_t *allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_file_name_values_get_allocated_size";
+
+	if( file_name_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file name values.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	*allocated_size = file_name_values->allocated_size;
+
+	return( 1 );
+}
+
 /* Retrieves the size
  * Returns 1 if successful or -1 on error
  */
@@ -56,6 +56,10 @@ struct libfsntfs_file_name_values
 	 */
 	uint64_t entry_modification_time;
 
+	/* The allocated size
+	 */
+	uint64_t allocated_size;
+
 	/* The size
 	 */
 	uint64_t size;
@@ -132,6 +136,11 @@ int libfsntfs_file_name_values_get_entry_modification_time(
      uint64_t *filetime,
      libcerror_error_t **error );
 
+int libfsntfs_file_name_values_get_allocated_size(
+     libfsntfs_file_name_values_t *file_name_values,
+     uint64_t *allocated_size,
+     libcerror_error_t **error );
+
 int libfsntfs_file_name_values_get_size(
      libfsntfs_file_name_values_t *file_name_values,
      uint64_t *size,
@@ -38,6 +38,7 @@
 #include "libfsntfs_mft_attribute_list.h"
 #include "libfsntfs_mft_entry.h"
 #include "libfsntfs_name.h"
+#include "libfsntfs_path_cache.h"
 #include "libfsntfs_path_hint.h"
 #include "libfsntfs_security_descriptor_index.h"
 #include "libfsntfs_security_descriptor_values.h"
@@ -122,11 +123,33 @@ int libfsntfs_file_system_initialize(
 		goto on_error;
 	}
 #endif
+	if( libfsntfs_path_cache_initialize(
+	     &( ( *file_system )->path_cache ),
+	     LIBFSNTFS_PATH_CACHE_MAXIMUM_NUMBER_OF_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *file_system != NULL )
 	{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( ( *file_system )->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( ( *file_system )->read_write_lock ),
+			 NULL );
+		}
+#endif
 		memory_free(
 		 *file_system );
 
@@ -173,6 +196,19 @@ int libfsntfs_file_system_free(
 			result = -1;
 		}
 #endif
+		if( libfsntfs_path_cache_free(
+		     &( ( *file_system )->path_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free path cache.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *file_system )->path_hints_tree != NULL )
 		{
 			if( libcdata_btree_free(
@@ -1441,6 +1477,8 @@ int libfsntfs_file_system_get_mft_entry_by_index_no_cache(
 
 /* Retrieves the security descriptor for a specific identifier
  * This function creates new security descriptor values
+ * The read/write lock is only grabbed for writing to cache security descriptor
+ * values that were read from the $SII index and $SDS data stream
  * Returns 1 if successful, 0 if not available or -1 on error
  */
 int libfsntfs_file_system_get_security_descriptor_values_by_identifier(
@@ -1450,8 +1488,9 @@ int libfsntfs_file_system_get_security_descriptor_values_by_identifier(
      libfsntfs_security_descriptor_values_t **security_descriptor_values,
      libcerror_error_t **error )
 {
-	static char *function = "libfsntfs_file_system_get_security_descriptor_values_by_identifier";
-	int result            = 0;
+	libfsntfs_security_descriptor_values_t *read_security_descriptor_values = NULL;
+	static char *function                                                   = "libfsntfs_file_system_get_security_descriptor_values_by_identifier";
+	int result                                                              = 0;
 
 	if( file_system == NULL )
 	{
@@ -1464,29 +1503,179 @@ int libfsntfs_file_system_get_security_descriptor_values_by_identifier(
 
 		return( -1 );
 	}
-	if( file_system->security_descriptor_index != NULL )
+	if( security_descriptor_values == NULL )
 	{
-		result = libfsntfs_security_descriptor_index_get_entry_by_identifier(
-		          file_system->security_descriptor_index,
-		          file_io_handle,
-		          security_descriptor_identifier,
-		          security_descriptor_values,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor values.",
+		 function );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve security descriptor from index for identifier: %" PRIu32 ".",
-			 function,
-			 security_descriptor_identifier );
+		return( -1 );
+	}
+	if( *security_descriptor_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor values value already set.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	return( result );
+	if( file_system->security_descriptor_index == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_security_descriptor_index_get_cached_entry_by_identifier(
+	          file_system->security_descriptor_index,
+	          security_descriptor_identifier,
+	          security_descriptor_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached security descriptor for identifier: %" PRIu32 ".",
+		 function,
+		 security_descriptor_identifier );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 0 )
+	{
+		return( result );
+	}
+	/* The $SII index and $SDS data stream are read without holding the read/write lock
+	 * the security descriptor index serializes these reads itself
+	 */
+	result = libfsntfs_security_descriptor_index_read_entry_by_identifier(
+	          file_system->security_descriptor_index,
+	          file_io_handle,
+	          security_descriptor_identifier,
+	          &read_security_descriptor_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read security descriptor from index for identifier: %" PRIu32 ".",
+		 function,
+		 security_descriptor_identifier );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Another thread could have cached the security descriptor in the meantime
+	 * in which case the cached values are used
+	 */
+	result = libfsntfs_security_descriptor_index_insert_entry(
+	          file_system->security_descriptor_index,
+	          &read_security_descriptor_values,
+	          security_descriptor_values,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to cache security descriptor for identifier: %" PRIu32 ".",
+		 function,
+		 security_descriptor_identifier );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 security_descriptor_values,
+		 NULL );
+	}
+	if( read_security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 &read_security_descriptor_values,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the path hint of a specific file reference
@@ -31,6 +31,7 @@
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcthreads.h"
 #include "libfsntfs_mft.h"
+#include "libfsntfs_path_cache.h"
 #include "libfsntfs_path_hint.h"
 #include "libfsntfs_security_descriptor_index.h"
 #include "libfsntfs_security_descriptor_values.h"
@@ -59,6 +60,10 @@ struct libfsntfs_file_system
 	 */
 	libcdata_btree_t *path_hints_tree;
 
+	/* The path component cache
+	 */
+	libfsntfs_path_cache_t *path_cache;
+
 #if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -50,6 +50,13 @@ int libfsntfs_index_entry_free(
      libfsntfs_index_entry_t **index_entry,
      libcerror_error_t **error );
 
+int libfsntfs_index_entry_read_data(
+     libfsntfs_index_entry_t *index_entry,
+     uint8_t *data,
+     size_t data_size,
+     uint32_t index_entry_index,
+     libcerror_error_t **error );
+
 int libfsntfs_index_entry_read_file_io_handle(
      libfsntfs_index_entry_t *index_entry,
      libbfio_handle_t *file_io_handle,
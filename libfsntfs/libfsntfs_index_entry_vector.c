@@ -26,6 +26,8 @@
 #include "libfsntfs_definitions.h"
 #include "libfsntfs_index_entry.h"
 #include "libfsntfs_index_entry_vector.h"
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_node_cache.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
@@ -155,7 +157,7 @@ int libfsntfs_index_entry_vector_initialize(
 	if( libfdata_vector_initialize(
 	     &safe_index_entry_vector,
 	     (size64_t) index_entry_size,
-	     NULL,
+	     (intptr_t *) io_handle,
 	     NULL,
 	     NULL,
 	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsntfs_index_entry_vector_read_element_data,
@@ -364,7 +366,7 @@ on_error:
  * Returns 1 if successful or -1 on error
  */
 int libfsntfs_index_entry_vector_read_element_data(
-     intptr_t *data_handle LIBFSNTFS_ATTRIBUTE_UNUSED,
+     libfsntfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfdata_vector_t *vector,
      libfdata_cache_t *cache,
@@ -377,9 +379,10 @@ int libfsntfs_index_entry_vector_read_element_data(
      libcerror_error_t **error )
 {
 	libfsntfs_index_entry_t *index_entry = NULL;
+	libfsntfs_index_node_t *index_node   = NULL;
 	static char *function                = "libfsntfs_index_entry_vector_read_element_data";
+	int result                           = 0;
 
-	LIBFSNTFS_UNREFERENCED_PARAMETER( data_handle )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( element_data_file_index )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( element_flags )
 	LIBFSNTFS_UNREFERENCED_PARAMETER( read_flags )
@@ -406,6 +409,55 @@ int libfsntfs_index_entry_vector_read_element_data(
 
 		return( -1 );
 	}
+	/* The index node cache of the IO handle is shared by all the indexes of
+	 * the volume and can contain the index node from a previous read
+	 */
+	if( ( io_handle != NULL )
+	 && ( io_handle->index_node_cache != NULL ) )
+	{
+		result = libfsntfs_index_node_cache_get_index_node(
+		          io_handle->index_node_cache,
+		          index_entry_offset,
+		          element_index,
+		          &index_node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index node: %d from cache.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libfdata_vector_set_element_value_by_index(
+		     vector,
+		     (intptr_t *) file_io_handle,
+		     cache,
+		     element_index,
+		     (intptr_t *) index_node,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_index_node_free,
+		     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index node as element value.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
 	if( libfsntfs_index_entry_initialize(
 	     &index_entry,
 	     error ) != 1 )
@@ -439,6 +491,27 @@ int libfsntfs_index_entry_vector_read_element_data(
 
 		goto on_error;
 	}
+	if( ( io_handle != NULL )
+	 && ( io_handle->index_node_cache != NULL ) )
+	{
+		if( libfsntfs_index_node_cache_set_index_node(
+		     io_handle->index_node_cache,
+		     index_entry_offset,
+		     element_index,
+		     index_entry->node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index node: %d in cache.",
+			 function,
+			 element_index );
+
+			goto on_error;
+		}
+	}
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
@@ -476,6 +549,12 @@ int libfsntfs_index_entry_vector_read_element_data(
 	return( 1 );
 
 on_error:
+	if( index_node != NULL )
+	{
+		libfsntfs_index_node_free(
+		 &index_node,
+		 NULL );
+	}
 	if( index_entry != NULL )
 	{
 		libfsntfs_index_entry_free(
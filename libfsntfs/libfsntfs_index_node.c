@@ -27,9 +27,9 @@
 #include "libfsntfs_index_node.h"
 #include "libfsntfs_index_node_header.h"
 #include "libfsntfs_index_value.h"
-#include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libcthreads.h"
 
 #include "fsntfs_index.h"
 
@@ -98,20 +98,8 @@ int libfsntfs_index_node_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( ( *index_node )->values_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create values array.",
-		 function );
+	( *index_node )->number_of_references = 1;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
@@ -126,14 +114,18 @@ on_error:
 }
 
 /* Frees an index node
+ * The index node is only freed when its last reference is released
  * Returns 1 if successful or -1 on error
  */
 int libfsntfs_index_node_free(
      libfsntfs_index_node_t **index_node,
      libcerror_error_t **error )
 {
-	static char *function = "libfsntfs_index_node_free";
-	int result            = 1;
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_t *read_write_lock = NULL;
+#endif
+	static char *function                          = "libfsntfs_index_node_free";
+	int result                                     = 1;
 
 	if( index_node == NULL )
 	{
@@ -148,44 +140,206 @@ int libfsntfs_index_node_free(
 	}
 	if( *index_node != NULL )
 	{
-		if( ( *index_node )->header != NULL )
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		/* The number of references of a cached index node is guarded by the read/write lock
+		 * of the index node cache, the index node itself has no lock
+		 */
+		read_write_lock = ( *index_node )->cache_read_write_lock;
+
+		if( read_write_lock != NULL )
 		{
-			if( libfsntfs_index_node_header_free(
-			     &( ( *index_node )->header ),
+			if( libcthreads_read_write_lock_grab_for_write(
+			     read_write_lock,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free index node header.",
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
 				 function );
 
-				result = -1;
+				return( -1 );
 			}
 		}
-		if( libcdata_array_free(
-		     &( ( *index_node )->values_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_index_value_free,
+#endif
+		if( libfsntfs_index_node_remove_reference(
+		     index_node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free values array.",
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove reference from index node.",
 			 function );
 
 			result = -1;
 		}
-		memory_free(
-		 *index_node );
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_release_for_write(
+			     read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
 
-		*index_node = NULL;
+				return( -1 );
+			}
+		}
+#endif
+	}
+	return( result );
+}
+
+/* Adds a reference to an index node
+ * Every reference must be released with libfsntfs_index_node_free
+ * The read/write lock of the index node cache must be held for writing when the index node is cached
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_node_add_reference(
+     libfsntfs_index_node_t *index_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_index_node_add_reference";
+
+	if( index_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node.",
+		 function );
+
+		return( -1 );
+	}
+	index_node->number_of_references += 1;
+
+	return( 1 );
+}
+
+/* Removes a reference from an index node
+ * The index node is freed when its last reference is removed
+ * The read/write lock of the index node cache must be held for writing when the index node is cached
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_node_remove_reference(
+     libfsntfs_index_node_t **index_node,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_node_t *safe_index_node = NULL;
+	static char *function                   = "libfsntfs_index_node_remove_reference";
+	int result                              = 1;
+
+	if( index_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_node != NULL )
+	{
+		safe_index_node = *index_node;
+		*index_node     = NULL;
+
+		safe_index_node->number_of_references -= 1;
+
+		if( safe_index_node->number_of_references > 0 )
+		{
+			return( 1 );
+		}
+		if( safe_index_node->header != NULL )
+		{
+			if( libfsntfs_index_node_header_free(
+			     &( safe_index_node->header ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index node header.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The values reference the data hence they do not need to be freed individually
+		 */
+		if( safe_index_node->values != NULL )
+		{
+			memory_free(
+			 safe_index_node->values );
+		}
+		if( safe_index_node->data != NULL )
+		{
+			memory_free(
+			 safe_index_node->data );
+		}
+		memory_free(
+		 safe_index_node );
 	}
 	return( result );
 }
 
+/* Retrieves the size of the memory used by the index node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_node_get_size(
+     libfsntfs_index_node_t *index_node,
+     size_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_index_node_get_size";
+	size_t safe_size      = 0;
+
+	if( index_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_size = sizeof( libfsntfs_index_node_t )
+	          + index_node->data_size
+	          + ( sizeof( libfsntfs_index_value_t ) * (size_t) index_node->number_of_allocated_values );
+
+	if( index_node->header != NULL )
+	{
+		safe_size += sizeof( libfsntfs_index_node_header_t );
+	}
+	*size = safe_size;
+
+	return( 1 );
+}
+
 /* Reads the index node header
  * Returns 1 if successful or -1 on error
  */
@@ -284,6 +438,68 @@ on_error:
 	return( -1 );
 }
 
+/* Resizes the index node values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_node_resize_values(
+     libfsntfs_index_node_t *index_node,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_value_t *reallocation = NULL;
+	static char *function                 = "libfsntfs_index_node_resize_values";
+	size_t values_size                    = 0;
+
+	if( index_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values < index_node->number_of_values )
+	 || ( (size_t) number_of_values > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsntfs_index_value_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values <= index_node->number_of_allocated_values )
+	{
+		return( 1 );
+	}
+	values_size = sizeof( libfsntfs_index_value_t ) * number_of_values;
+
+	reallocation = (libfsntfs_index_value_t *) memory_reallocate(
+	                                            index_node->values,
+	                                            values_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize values.",
+		 function );
+
+		return( -1 );
+	}
+	index_node->values                     = reallocation;
+	index_node->number_of_allocated_values = number_of_values;
+
+	return( 1 );
+}
+
 /* Reads the index node values
  * Returns 1 if successful or -1 on error
  */
@@ -301,9 +517,8 @@ int libfsntfs_index_node_read_values(
 	size_t index_values_offset           = 0;
 	size_t unknown_data_size             = 0;
 	ssize_t read_count                   = 0;
-	uint32_t index_value_flags           = 0;
-	int entry_index                      = 0;
 	int index_value_entry                = 0;
+	int number_of_allocated_values       = 0;
 
 	if( index_node == NULL )
 	{
@@ -360,6 +575,17 @@ int libfsntfs_index_node_read_values(
 
 		return( -1 );
 	}
+	if( index_node->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index node - data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	index_values_offset = (size_t) index_node->header->index_values_offset;
 
 	if( index_values_offset > ( data_size - index_node->header_data_offset ) )
@@ -426,27 +652,101 @@ int libfsntfs_index_node_read_values(
 		}
 		index_node_size -= (uint32_t) unknown_data_size;
 	}
+	/* The values reference a single copy of the data instead of each
+	 * value having its own copy of the key and value data
+	 */
+	index_node->data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * data_size );
+
+	if( index_node->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     index_node->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	index_node->data_size = data_size;
+
 	while( index_node_size > 0 )
 	{
-		if( libfsntfs_index_value_initialize(
-		     &index_value,
-		     error ) != 1 )
+		if( index_node->number_of_values >= index_node->number_of_allocated_values )
+		{
+			if( index_node->number_of_allocated_values == 0 )
+			{
+				number_of_allocated_values = LIBFSNTFS_INDEX_NODE_INITIAL_NUMBER_OF_VALUES;
+			}
+			else if( index_node->number_of_allocated_values < ( INT_MAX / 2 ) )
+			{
+				number_of_allocated_values = index_node->number_of_allocated_values * 2;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid index node - number of values value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_index_node_resize_values(
+			     index_node,
+			     number_of_allocated_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize values.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		index_value = &( index_node->values[ index_node->number_of_values ] );
+
+		if( memory_set(
+		     index_value,
+		     0,
+		     sizeof( libfsntfs_index_value_t ) ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create index value.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear index value.",
 			 function );
 
 			goto on_error;
 		}
+		index_value->references_data = 1;
+
 		read_count = libfsntfs_index_value_read(
 		              index_value,
 		              index_value_vcn_offset + data_offset,
 		              &index_value_entry,
-		              data,
-		              data_size,
+		              index_node->data,
+		              index_node->data_size,
 		              data_offset,
 		              error );
 
@@ -464,26 +764,9 @@ int libfsntfs_index_node_read_values(
 		data_offset     += read_count;
 		index_node_size -= (uint32_t) read_count;
 
-		index_value_flags = index_value->flags;
-
-		if( libcdata_array_append_entry(
-		     index_node->values_array,
-		     &entry_index,
-		     (intptr_t *) index_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append index value to values array.",
-			 function );
-
-			goto on_error;
-		}
-		index_value = NULL;
+		index_node->number_of_values += 1;
 
-		if( ( index_value_flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 )
+		if( ( index_value->flags & LIBFSNTFS_INDEX_VALUE_FLAG_IS_LAST ) != 0 )
 		{
 			break;
 		}
@@ -507,12 +790,25 @@ int libfsntfs_index_node_read_values(
 	return( 1 );
 
 on_error:
-	if( index_value != NULL )
+	if( index_node->values != NULL )
 	{
-		libfsntfs_index_value_free(
-		 &index_value,
-		 NULL );
+		memory_free(
+		 index_node->values );
+
+		index_node->values = NULL;
 	}
+	index_node->number_of_values           = 0;
+	index_node->number_of_allocated_values = 0;
+
+	if( index_node->data != NULL )
+	{
+		memory_free(
+		 index_node->data );
+
+		index_node->data = NULL;
+	}
+	index_node->data_size = 0;
+
 	return( -1 );
 }
 
@@ -537,20 +833,19 @@ int libfsntfs_index_node_get_number_of_values(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     index_node->values_array,
-	     number_of_values,
-	     error ) != 1 )
+	if( number_of_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from values array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_values = index_node->number_of_values;
+
 	return( 1 );
 }
 
@@ -576,22 +871,31 @@ int libfsntfs_index_node_get_value_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     index_node->values_array,
-	     value_entry,
-	     (intptr_t **) value,
-	     error ) != 1 )
+	if( ( value_entry < 0 )
+	 || ( value_entry >= index_node->number_of_values ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d from values array.",
-		 function,
-		 value_entry );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
 
 		return( -1 );
 	}
+	*value = &( index_node->values[ value_entry ] );
+
 	return( 1 );
 }
 
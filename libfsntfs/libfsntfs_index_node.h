@@ -27,13 +27,17 @@
 
 #include "libfsntfs_index_node_header.h"
 #include "libfsntfs_index_value.h"
-#include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The initial number of allocated values of an index node
+ */
+#define LIBFSNTFS_INDEX_NODE_INITIAL_NUMBER_OF_VALUES	16
+
 typedef struct libfsntfs_index_node libfsntfs_index_node_t;
 
 struct libfsntfs_index_node
@@ -46,9 +50,37 @@ struct libfsntfs_index_node
 	 */
 	libfsntfs_index_node_header_t *header;
 
-	/* The values array
+	/* The data, a copy of the (fixed-up) index node data the values reference
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The values
+	 */
+	libfsntfs_index_value_t *values;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The number of allocated values
+	 */
+	int number_of_allocated_values;
+
+	/* The number of references, the index node is shared between
+	 * the index node cache and the index entry vector
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock of the index node cache, that guards the number of references
+	 * when the index node is cached
 	 */
-	libcdata_array_t *values_array;
+	libcthreads_read_write_lock_t *cache_read_write_lock;
+#endif
 };
 
 int libfsntfs_index_node_initialize(
@@ -59,6 +91,19 @@ int libfsntfs_index_node_free(
      libfsntfs_index_node_t **index_node,
      libcerror_error_t **error );
 
+int libfsntfs_index_node_add_reference(
+     libfsntfs_index_node_t *index_node,
+     libcerror_error_t **error );
+
+int libfsntfs_index_node_remove_reference(
+     libfsntfs_index_node_t **index_node,
+     libcerror_error_t **error );
+
+int libfsntfs_index_node_get_size(
+     libfsntfs_index_node_t *index_node,
+     size_t *size,
+     libcerror_error_t **error );
+
 int libfsntfs_index_node_read_header(
      libfsntfs_index_node_t *index_node,
      const uint8_t *data,
@@ -66,6 +111,11 @@ int libfsntfs_index_node_read_header(
      size_t data_offset,
      libcerror_error_t **error );
 
+int libfsntfs_index_node_resize_values(
+     libfsntfs_index_node_t *index_node,
+     int number_of_values,
+     libcerror_error_t **error );
+
 int libfsntfs_index_node_read_values(
      libfsntfs_index_node_t *index_node,
      off64_t index_value_vcn_offset,
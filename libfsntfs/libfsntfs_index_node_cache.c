@@ -0,0 +1,696 @@
+/*
+ * Index node cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_index_node_cache.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+
+/* Creates an index node cache
+ * Make sure the value index_node_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_node_cache_initialize(
+     libfsntfs_index_node_cache_t **index_node_cache,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_index_node_cache_initialize";
+
+	if( index_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_node_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index node cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index_node_cache = memory_allocate_structure(
+	                     libfsntfs_index_node_cache_t );
+
+	if( *index_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index node cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_node_cache,
+	     0,
+	     sizeof( libfsntfs_index_node_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index node cache.",
+		 function );
+
+		memory_free(
+		 *index_node_cache );
+
+		*index_node_cache = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *index_node_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *index_node_cache )->maximum_size = maximum_size;
+
+	return( 1 );
+
+on_error:
+	if( *index_node_cache != NULL )
+	{
+		memory_free(
+		 *index_node_cache );
+
+		*index_node_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index node cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_node_cache_free(
+     libfsntfs_index_node_cache_t **index_node_cache,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_node_cache_value_t *cache_value = NULL;
+	static char *function                           = "libfsntfs_index_node_cache_free";
+	int result                                      = 1;
+
+	if( index_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_node_cache != NULL )
+	{
+		while( ( *index_node_cache )->first_value != NULL )
+		{
+			cache_value = ( *index_node_cache )->first_value;
+
+			( *index_node_cache )->first_value = cache_value->next_value;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+			/* The index node can be referenced after the read/write lock is freed
+			 */
+			cache_value->index_node->cache_read_write_lock = NULL;
+#endif
+			if( libfsntfs_index_node_remove_reference(
+			     &( cache_value->index_node ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove reference from index node.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 cache_value );
+		}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *index_node_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *index_node_cache );
+
+		*index_node_cache = NULL;
+	}
+	return( result );
+}
+
+/* Removes the least recently used value from the index node cache
+ * The read/write lock must be held for writing by the caller
+ * Returns 1 if successful, 0 if the cache is empty or -1 on error
+ */
+int libfsntfs_index_node_cache_remove_last_value(
+     libfsntfs_index_node_cache_t *index_node_cache,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_node_cache_value_t *bucket_value = NULL;
+	libfsntfs_index_node_cache_value_t *cache_value  = NULL;
+	static char *function                            = "libfsntfs_index_node_cache_remove_last_value";
+	uint32_t bucket_index                            = 0;
+
+	if( index_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node cache.",
+		 function );
+
+		return( -1 );
+	}
+	cache_value = index_node_cache->last_value;
+
+	if( cache_value == NULL )
+	{
+		return( 0 );
+	}
+	bucket_index = (uint32_t) ( ( (uint64_t) cache_value->index_entry_offset * 0x9e3779b97f4a7c15ULL ) >> 32 ) % LIBFSNTFS_INDEX_NODE_CACHE_NUMBER_OF_BUCKETS;
+
+	bucket_value = index_node_cache->buckets[ bucket_index ];
+
+	if( bucket_value == cache_value )
+	{
+		index_node_cache->buckets[ bucket_index ] = cache_value->next_in_bucket;
+	}
+	else
+	{
+		while( ( bucket_value != NULL )
+		    && ( bucket_value->next_in_bucket != cache_value ) )
+		{
+			bucket_value = bucket_value->next_in_bucket;
+		}
+		if( bucket_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid index node cache - missing value in bucket: %" PRIu32 ".",
+			 function,
+			 bucket_index );
+
+			return( -1 );
+		}
+		bucket_value->next_in_bucket = cache_value->next_in_bucket;
+	}
+	index_node_cache->last_value = cache_value->previous_value;
+
+	if( index_node_cache->last_value != NULL )
+	{
+		index_node_cache->last_value->next_value = NULL;
+	}
+	else
+	{
+		index_node_cache->first_value = NULL;
+	}
+	index_node_cache->number_of_values -= 1;
+	index_node_cache->size             -= cache_value->size;
+
+	/* The read/write lock is held by the caller, hence the reference is removed
+	 * without libfsntfs_index_node_free
+	 */
+	if( libfsntfs_index_node_remove_reference(
+	     &( cache_value->index_node ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove reference from index node.",
+		 function );
+
+		memory_free(
+		 cache_value );
+
+		return( -1 );
+	}
+	memory_free(
+	 cache_value );
+
+	return( 1 );
+}
+
+/* Empties an index node cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_node_cache_empty(
+     libfsntfs_index_node_cache_t *index_node_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_index_node_cache_empty";
+	int result            = 1;
+
+	if( index_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     index_node_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( index_node_cache->last_value != NULL )
+	{
+		if( libfsntfs_index_node_cache_remove_last_value(
+		     index_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last value.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     index_node_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the index node of a specific index entry
+ * The cached index node is shared, index nodes are not modified after they are read,
+ * the reference must be released with libfsntfs_index_node_free
+ * The cached index node is marked as most recently used
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_index_node_cache_get_index_node(
+     libfsntfs_index_node_cache_t *index_node_cache,
+     off64_t index_entry_offset,
+     int index_entry_index,
+     libfsntfs_index_node_t **index_node,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_node_cache_value_t *cache_value = NULL;
+	static char *function                           = "libfsntfs_index_node_cache_get_index_node";
+	uint32_t bucket_index                           = 0;
+	int result                                      = 0;
+
+	if( index_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (uint32_t) ( ( (uint64_t) index_entry_offset * 0x9e3779b97f4a7c15ULL ) >> 32 ) % LIBFSNTFS_INDEX_NODE_CACHE_NUMBER_OF_BUCKETS;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     index_node_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_value = index_node_cache->buckets[ bucket_index ];
+
+	while( cache_value != NULL )
+	{
+		if( ( cache_value->index_entry_offset == index_entry_offset )
+		 && ( cache_value->index_entry_index == index_entry_index ) )
+		{
+			break;
+		}
+		cache_value = cache_value->next_in_bucket;
+	}
+	if( cache_value != NULL )
+	{
+		if( cache_value != index_node_cache->first_value )
+		{
+			cache_value->previous_value->next_value = cache_value->next_value;
+
+			if( cache_value->next_value != NULL )
+			{
+				cache_value->next_value->previous_value = cache_value->previous_value;
+			}
+			else
+			{
+				index_node_cache->last_value = cache_value->previous_value;
+			}
+			cache_value->previous_value = NULL;
+			cache_value->next_value     = index_node_cache->first_value;
+
+			index_node_cache->first_value->previous_value = cache_value;
+			index_node_cache->first_value                 = cache_value;
+		}
+		result = libfsntfs_index_node_add_reference(
+		          cache_value->index_node,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to index node.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*index_node = cache_value->index_node;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     index_node_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( *index_node != NULL )
+		{
+			libfsntfs_index_node_free(
+			 index_node,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Stores the index node of a specific index entry
+ * The cache adds its own reference to the index node
+ * The least recently used index nodes are removed when the maximum size is exceeded
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_node_cache_set_index_node(
+     libfsntfs_index_node_cache_t *index_node_cache,
+     off64_t index_entry_offset,
+     int index_entry_index,
+     libfsntfs_index_node_t *index_node,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_node_cache_value_t *cache_value = NULL;
+	static char *function                           = "libfsntfs_index_node_cache_set_index_node";
+	size_t index_node_size                          = 0;
+	uint32_t bucket_index                           = 0;
+	int result                                      = 1;
+
+	if( index_node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_index_node_get_size(
+	     index_node,
+	     &index_node_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index node size.",
+		 function );
+
+		return( -1 );
+	}
+	index_node_size += sizeof( libfsntfs_index_node_cache_value_t );
+
+	if( index_node_size > index_node_cache->maximum_size )
+	{
+		return( 1 );
+	}
+	bucket_index = (uint32_t) ( ( (uint64_t) index_entry_offset * 0x9e3779b97f4a7c15ULL ) >> 32 ) % LIBFSNTFS_INDEX_NODE_CACHE_NUMBER_OF_BUCKETS;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     index_node_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_value = index_node_cache->buckets[ bucket_index ];
+
+	while( cache_value != NULL )
+	{
+		if( ( cache_value->index_entry_offset == index_entry_offset )
+		 && ( cache_value->index_entry_index == index_entry_index ) )
+		{
+			break;
+		}
+		cache_value = cache_value->next_in_bucket;
+	}
+	/* Another thread could have stored the same index node in the meantime
+	 */
+	if( cache_value == NULL )
+	{
+		cache_value = memory_allocate_structure(
+		               libfsntfs_index_node_cache_value_t );
+
+		if( cache_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache value.",
+			 function );
+
+			result = -1;
+		}
+		else if( memory_set(
+		          cache_value,
+		          0,
+		          sizeof( libfsntfs_index_node_cache_value_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear cache value.",
+			 function );
+
+			memory_free(
+			 cache_value );
+
+			result = -1;
+		}
+		else if( libfsntfs_index_node_add_reference(
+		          index_node,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to index node.",
+			 function );
+
+			memory_free(
+			 cache_value );
+
+			result = -1;
+		}
+		else
+		{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+			/* From now on the number of references of the index node is guarded
+			 * by the read/write lock of the index node cache
+			 */
+			index_node->cache_read_write_lock = index_node_cache->read_write_lock;
+#endif
+			cache_value->index_node         = index_node;
+			cache_value->index_entry_offset = index_entry_offset;
+			cache_value->index_entry_index  = index_entry_index;
+			cache_value->size               = index_node_size;
+			cache_value->next_in_bucket     = index_node_cache->buckets[ bucket_index ];
+			cache_value->next_value         = index_node_cache->first_value;
+
+			index_node_cache->buckets[ bucket_index ] = cache_value;
+
+			if( index_node_cache->first_value != NULL )
+			{
+				index_node_cache->first_value->previous_value = cache_value;
+			}
+			else
+			{
+				index_node_cache->last_value = cache_value;
+			}
+			index_node_cache->first_value       = cache_value;
+			index_node_cache->number_of_values += 1;
+			index_node_cache->size             += index_node_size;
+
+			while( index_node_cache->size > index_node_cache->maximum_size )
+			{
+				if( libfsntfs_index_node_cache_remove_last_value(
+				     index_node_cache,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove last value.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+			}
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     index_node_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
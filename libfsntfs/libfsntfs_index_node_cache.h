@@ -0,0 +1,140 @@
+/*
+ * Index node cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_INDEX_NODE_CACHE_H )
+#define _LIBFSNTFS_INDEX_NODE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_index_node.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of buckets of the index node cache, must be a power of 2
+ */
+#define LIBFSNTFS_INDEX_NODE_CACHE_NUMBER_OF_BUCKETS	1024
+
+typedef struct libfsntfs_index_node_cache_value libfsntfs_index_node_cache_value_t;
+
+struct libfsntfs_index_node_cache_value
+{
+	/* The (physical) offset of the index entry
+	 */
+	off64_t index_entry_offset;
+
+	/* The index of the index entry within the index allocation
+	 */
+	int index_entry_index;
+
+	/* The index node
+	 */
+	libfsntfs_index_node_t *index_node;
+
+	/* The size of the memory used by the index node
+	 */
+	size_t size;
+
+	/* The next value in the same bucket
+	 */
+	libfsntfs_index_node_cache_value_t *next_in_bucket;
+
+	/* The previous (more recently used) value
+	 */
+	libfsntfs_index_node_cache_value_t *previous_value;
+
+	/* The next (less recently used) value
+	 */
+	libfsntfs_index_node_cache_value_t *next_value;
+};
+
+typedef struct libfsntfs_index_node_cache libfsntfs_index_node_cache_t;
+
+struct libfsntfs_index_node_cache
+{
+	/* The buckets
+	 */
+	libfsntfs_index_node_cache_value_t *buckets[ LIBFSNTFS_INDEX_NODE_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The most recently used value
+	 */
+	libfsntfs_index_node_cache_value_t *first_value;
+
+	/* The least recently used value
+	 */
+	libfsntfs_index_node_cache_value_t *last_value;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The size of the memory used by the cached index nodes
+	 */
+	size_t size;
+
+	/* The maximum size of the memory used by the cached index nodes
+	 */
+	size_t maximum_size;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsntfs_index_node_cache_initialize(
+     libfsntfs_index_node_cache_t **index_node_cache,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+int libfsntfs_index_node_cache_free(
+     libfsntfs_index_node_cache_t **index_node_cache,
+     libcerror_error_t **error );
+
+int libfsntfs_index_node_cache_empty(
+     libfsntfs_index_node_cache_t *index_node_cache,
+     libcerror_error_t **error );
+
+int libfsntfs_index_node_cache_get_index_node(
+     libfsntfs_index_node_cache_t *index_node_cache,
+     off64_t index_entry_offset,
+     int index_entry_index,
+     libfsntfs_index_node_t **index_node,
+     libcerror_error_t **error );
+
+int libfsntfs_index_node_cache_set_index_node(
+     libfsntfs_index_node_cache_t *index_node_cache,
+     off64_t index_entry_offset,
+     int index_entry_index,
+     libfsntfs_index_node_t *index_node,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_INDEX_NODE_CACHE_H ) */
+
@@ -0,0 +1,787 @@
+/*
+ * Index prefetch functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsntfs_index.h"
+#include "libfsntfs_index_entry.h"
+#include "libfsntfs_index_node_cache.h"
+#include "libfsntfs_index_prefetch.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcdata.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libfdata.h"
+
+/* Compares two prefetch extents
+ * The extents are ordered by their physical offset
+ * Returns -1 if the first extent is less than the second, 0 if equal or 1 if greater
+ */
+int libfsntfs_index_prefetch_extent_compare(
+     const void *first_extent,
+     const void *second_extent )
+{
+	const libfsntfs_index_prefetch_extent_t *first_prefetch_extent  = NULL;
+	const libfsntfs_index_prefetch_extent_t *second_prefetch_extent = NULL;
+
+	first_prefetch_extent  = (const libfsntfs_index_prefetch_extent_t *) first_extent;
+	second_prefetch_extent = (const libfsntfs_index_prefetch_extent_t *) second_extent;
+
+	if( first_prefetch_extent->physical_offset < second_prefetch_extent->physical_offset )
+	{
+		return( -1 );
+	}
+	else if( first_prefetch_extent->physical_offset > second_prefetch_extent->physical_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the extents of the allocated index entries
+ * The extents are determined by intersecting the index entry vector segments,
+ * which are the data runs of the $INDEX_ALLOCATION attribute, with the allocated
+ * ranges of the $BITMAP attribute. Index entries that are stored in more than
+ * one segment are not included.
+ * The extents are limited to a total size of maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_index_prefetch_get_extents(
+     libfsntfs_index_t *index,
+     uint32_t index_entry_size,
+     size64_t maximum_size,
+     libfsntfs_index_prefetch_extent_t **extents,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_prefetch_extent_t *new_extents  = NULL;
+	libfsntfs_index_prefetch_extent_t *safe_extents = NULL;
+	intptr_t *range_value                           = NULL;
+	static char *function                           = "libfsntfs_index_prefetch_get_extents";
+	size64_t extent_size                            = 0;
+	size64_t segment_size                           = 0;
+	size64_t total_size                             = 0;
+	size_t extents_size                             = 0;
+	uint64_t range_offset                           = 0;
+	uint64_t range_size                             = 0;
+	uint32_t segment_flags                          = 0;
+	off64_t extent_end_offset                       = 0;
+	off64_t extent_start_offset                     = 0;
+	off64_t logical_offset                          = 0;
+	off64_t segment_offset                          = 0;
+	int first_range_index                           = 0;
+	int maximum_number_of_extents                   = 0;
+	int number_of_ranges                            = 0;
+	int number_of_segments                          = 0;
+	int range_index                                 = 0;
+	int safe_number_of_extents                      = 0;
+	int segment_file_index                          = 0;
+	int segment_index                               = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->bitmap_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index - missing bitmap values.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_entry_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid index entry size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extents != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extents value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_vector_get_number_of_segments(
+	     index->index_entry_vector,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of index entry vector segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     index->bitmap_values->allocated_block_list,
+	     &number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocated ranges.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		if( total_size >= maximum_size )
+		{
+			break;
+		}
+		if( libfdata_vector_get_segment_by_index(
+		     index->index_entry_vector,
+		     segment_index,
+		     &segment_file_index,
+		     &segment_offset,
+		     &segment_size,
+		     &segment_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve index entry vector segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( ( segment_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
+		{
+			logical_offset += (off64_t) segment_size;
+
+			continue;
+		}
+		/* The allocated ranges are sorted and do not overlap, hence ranges that end
+		 * before the start of the segment are not needed for the next segments
+		 */
+		for( range_index = first_range_index;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libcdata_range_list_get_range_by_index(
+			     index->bitmap_values->allocated_block_list,
+			     range_index,
+			     &range_offset,
+			     &range_size,
+			     &range_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve allocated range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			if( ( range_offset + range_size ) <= (uint64_t) logical_offset )
+			{
+				first_range_index = range_index + 1;
+
+				continue;
+			}
+			if( range_offset >= (uint64_t) ( logical_offset + segment_size ) )
+			{
+				break;
+			}
+			extent_start_offset = (off64_t) range_offset;
+
+			if( extent_start_offset < logical_offset )
+			{
+				extent_start_offset = logical_offset;
+			}
+			extent_end_offset = (off64_t) ( range_offset + range_size );
+
+			if( extent_end_offset > (off64_t) ( logical_offset + segment_size ) )
+			{
+				extent_end_offset = (off64_t) ( logical_offset + segment_size );
+			}
+			/* Only include index entries that are fully stored in the segment
+			 */
+			extent_start_offset = ( ( extent_start_offset + index_entry_size - 1 ) / index_entry_size ) * index_entry_size;
+			extent_end_offset   = ( extent_end_offset / index_entry_size ) * index_entry_size;
+
+			if( extent_start_offset >= extent_end_offset )
+			{
+				continue;
+			}
+			extent_size = (size64_t) ( extent_end_offset - extent_start_offset );
+
+			if( extent_size > ( maximum_size - total_size ) )
+			{
+				extent_size = ( ( maximum_size - total_size ) / index_entry_size ) * index_entry_size;
+
+				if( extent_size == 0 )
+				{
+					break;
+				}
+			}
+			if( safe_number_of_extents >= maximum_number_of_extents )
+			{
+				if( maximum_number_of_extents == 0 )
+				{
+					maximum_number_of_extents = 16;
+				}
+				else
+				{
+					maximum_number_of_extents *= 2;
+				}
+				extents_size = sizeof( libfsntfs_index_prefetch_extent_t ) * maximum_number_of_extents;
+
+				if( ( maximum_number_of_extents > ( INT_MAX / 2 ) )
+				 || ( extents_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid extents size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				new_extents = (libfsntfs_index_prefetch_extent_t *) memory_reallocate(
+				                                                     safe_extents,
+				                                                     extents_size );
+
+				if( new_extents == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize extents.",
+					 function );
+
+					goto on_error;
+				}
+				safe_extents = new_extents;
+			}
+			safe_extents[ safe_number_of_extents ].physical_offset = segment_offset + ( extent_start_offset - logical_offset );
+			safe_extents[ safe_number_of_extents ].logical_offset  = extent_start_offset;
+			safe_extents[ safe_number_of_extents ].size            = extent_size;
+
+			safe_number_of_extents++;
+
+			total_size += extent_size;
+
+			if( total_size >= maximum_size )
+			{
+				break;
+			}
+		}
+		logical_offset += (off64_t) segment_size;
+	}
+	*extents           = safe_extents;
+	*number_of_extents = safe_number_of_extents;
+
+	return( 1 );
+
+on_error:
+	if( safe_extents != NULL )
+	{
+		memory_free(
+		 safe_extents );
+	}
+	return( -1 );
+}
+
+/* Reads the index entries of a prefetch extent and stores their index nodes
+ * in the index node cache of the IO handle
+ * Index entries that cannot be read are not stored, they will be read again,
+ * and their error reported, when the corresponding sub node is retrieved
+ * Returns 1 if successful, 0 if the extent could not be read or -1 on error
+ */
+int libfsntfs_index_prefetch_read_extent(
+     libfsntfs_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_prefetch_extent_t *extent,
+     uint32_t index_entry_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error        = NULL;
+	libfsntfs_index_entry_t *index_entry = NULL;
+	static char *function                = "libfsntfs_index_prefetch_read_extent";
+	size64_t remaining_size              = 0;
+	size_t buffer_offset                 = 0;
+	size_t read_size                     = 0;
+	ssize_t read_count                   = 0;
+	off64_t logical_offset               = 0;
+	off64_t physical_offset              = 0;
+	int index_entry_index                = 0;
+	int result                           = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_entry_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid index entry size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size < (size_t) index_entry_size )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buffer_size = ( buffer_size / index_entry_size ) * index_entry_size;
+
+	logical_offset  = extent->logical_offset;
+	physical_offset = extent->physical_offset;
+	remaining_size  = extent->size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: prefetching %" PRIzd " bytes of index entries at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 read_size,
+			 physical_offset,
+			 physical_offset );
+		}
+#endif
+		/* A failed or short read is not considered an error, the index entries
+		 * are read again, and the error reported, when the corresponding sub node
+		 * is retrieved
+		 */
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              read_size,
+		              physical_offset,
+		              &read_error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read index entries data at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 physical_offset,
+				 physical_offset );
+
+				if( read_error != NULL )
+				{
+					libcnotify_print_error_backtrace(
+					 read_error );
+				}
+			}
+#endif
+			if( read_error != NULL )
+			{
+				libcerror_error_free(
+				 &read_error );
+			}
+			return( 0 );
+		}
+		for( buffer_offset = 0;
+		     buffer_offset < read_size;
+		     buffer_offset += index_entry_size )
+		{
+			index_entry_index = (int) ( ( logical_offset + buffer_offset ) / index_entry_size );
+
+			if( libfsntfs_index_entry_initialize(
+			     &index_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create index entry.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfsntfs_index_entry_read_data(
+			          index_entry,
+			          &( buffer[ buffer_offset ] ),
+			          (size_t) index_entry_size,
+			          (uint32_t) index_entry_index,
+			          &read_error );
+
+			if( result != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( read_error != NULL )
+					{
+						libcnotify_print_error_backtrace(
+						 read_error );
+					}
+				}
+#endif
+				if( read_error != NULL )
+				{
+					libcerror_error_free(
+					 &read_error );
+				}
+			}
+			else if( libfsntfs_index_node_cache_set_index_node(
+			          index->io_handle->index_node_cache,
+			          physical_offset + buffer_offset,
+			          index_entry_index,
+			          index_entry->node,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set index node: %d in cache.",
+				 function,
+				 index_entry_index );
+
+				goto on_error;
+			}
+			if( libfsntfs_index_entry_free(
+			     &index_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		logical_offset  += (off64_t) read_size;
+		physical_offset += (off64_t) read_size;
+		remaining_size  -= read_size;
+	}
+	return( 1 );
+
+on_error:
+	if( index_entry != NULL )
+	{
+		libfsntfs_index_entry_free(
+		 &index_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prefetches the sub nodes of an index
+ * The allocated index entries, according to the $BITMAP attribute, are read
+ * in physical order with large sequential reads, and their index nodes are
+ * stored in the index node cache of the IO handle. A subsequent traversal
+ * of the index then no longer needs to read the index entries one by one.
+ * The amount of prefetched data is limited to half of the maximum size of
+ * the index node cache, so that prefetched index nodes are not evicted by
+ * the prefetch itself
+ * Returns 1 if successful, 0 if there are no sub nodes to prefetch or -1 on error
+ */
+int libfsntfs_index_prefetch_sub_nodes(
+     libfsntfs_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsntfs_index_prefetch_extent_t *extents = NULL;
+	uint8_t *buffer                            = NULL;
+	static char *function                      = "libfsntfs_index_prefetch_sub_nodes";
+	size64_t maximum_size                      = 0;
+	size_t buffer_size                         = 0;
+	uint32_t index_entry_size                  = 0;
+	int extent_index                           = 0;
+	int number_of_extents                      = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index->index_entry_vector == NULL )
+	 || ( index->bitmap_values == NULL )
+	 || ( index->io_handle->index_node_cache == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_index_get_index_entry_size(
+	     index,
+	     &index_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index entry size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( index_entry_size == 0 )
+	 || ( index_entry_size > LIBFSNTFS_INDEX_PREFETCH_MAXIMUM_READ_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index entry size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_size = (size64_t) index->io_handle->index_node_cache->maximum_size / 2;
+
+	if( libfsntfs_index_prefetch_get_extents(
+	     index,
+	     index_entry_size,
+	     maximum_size,
+	     &extents,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch extents.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_extents == 0 )
+	{
+		return( 0 );
+	}
+	qsort(
+	 extents,
+	 (size_t) number_of_extents,
+	 sizeof( libfsntfs_index_prefetch_extent_t ),
+	 &libfsntfs_index_prefetch_extent_compare );
+
+	buffer_size = ( LIBFSNTFS_INDEX_PREFETCH_MAXIMUM_READ_SIZE / index_entry_size ) * index_entry_size;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* Extents that cannot be read are skipped, their index entries are read
+	 * when the corresponding sub nodes are retrieved
+	 */
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libfsntfs_index_prefetch_read_extent(
+		     index,
+		     file_io_handle,
+		     &( extents[ extent_index ] ),
+		     index_entry_size,
+		     buffer,
+		     buffer_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read prefetch extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	memory_free(
+	 extents );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( extents != NULL )
+	{
+		memory_free(
+		 extents );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,89 @@
+/*
+ * Index prefetch functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBFSNTFS_INDEX_PREFETCH_H )
+#define _LIBFSNTFS_INDEX_PREFETCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_index.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a single prefetch read
+ */
+#define LIBFSNTFS_INDEX_PREFETCH_MAXIMUM_READ_SIZE	( 1024 * 1024 )
+
+typedef struct libfsntfs_index_prefetch_extent libfsntfs_index_prefetch_extent_t;
+
+struct libfsntfs_index_prefetch_extent
+{
+	/* The (physical) offset of the first index entry
+	 */
+	off64_t physical_offset;
+
+	/* The offset of the first index entry relative to the start of the index allocation
+	 */
+	off64_t logical_offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+int libfsntfs_index_prefetch_extent_compare(
+     const void *first_extent,
+     const void *second_extent );
+
+int libfsntfs_index_prefetch_get_extents(
+     libfsntfs_index_t *index,
+     uint32_t index_entry_size,
+     size64_t maximum_size,
+     libfsntfs_index_prefetch_extent_t **extents,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+int libfsntfs_index_prefetch_read_extent(
+     libfsntfs_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_index_prefetch_extent_t *extent,
+     uint32_t index_entry_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libfsntfs_index_prefetch_sub_nodes(
+     libfsntfs_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_INDEX_PREFETCH_H ) */
+
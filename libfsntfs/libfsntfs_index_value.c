@@ -132,15 +132,18 @@ int libfsntfs_index_value_free(
 	}
 	if( *index_value != NULL )
 	{
-		if( ( *index_value )->key_data != NULL )
+		if( ( *index_value )->references_data == 0 )
 		{
-			memory_free(
-			 ( *index_value )->key_data );
-		}
-		if( ( *index_value )->value_data != NULL )
-		{
-			memory_free(
-			 ( *index_value )->value_data );
+			if( ( *index_value )->key_data != NULL )
+			{
+				memory_free(
+				 ( *index_value )->key_data );
+			}
+			if( ( *index_value )->value_data != NULL )
+			{
+				memory_free(
+				 ( *index_value )->value_data );
+			}
 		}
 		memory_free(
 		 *index_value );
@@ -151,6 +154,8 @@ int libfsntfs_index_value_free(
 }
 
 /* Reads the index value
+ * If references_data is set the key and value data reference data directly,
+ * in which case data must remain available for as long as the index value is used
  * Returns the number of bytes read if successful or -1 on error
  */
 ssize_t libfsntfs_index_value_read(
@@ -346,21 +351,6 @@ ssize_t libfsntfs_index_value_read(
 
 			goto on_error;
 		}
-		index_value->key_data = (uint8_t *) memory_allocate(
-		                                     sizeof( uint8_t ) * index_value->key_data_size );
-
-		if( index_value->key_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create index value: %03d key data.",
-			 function,
-			 *index_value_entry );
-
-			goto on_error;
-		}
 		if( data_offset > ( data_size - index_value->key_data_size ) )
 		{
 			libcerror_error_set(
@@ -372,20 +362,42 @@ ssize_t libfsntfs_index_value_read(
 
 			goto on_error;
 		}
-		if( memory_copy(
-		     index_value->key_data,
-		     &( data[ data_offset ] ),
-		     (size_t) index_value->key_data_size ) == NULL )
+		if( index_value->references_data != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy index value: %03d data.",
-			 function,
-			 *index_value_entry );
-
-			goto on_error;
+			index_value->key_data = (uint8_t *) &( data[ data_offset ] );
+		}
+		else
+		{
+			index_value->key_data = (uint8_t *) memory_allocate(
+			                                     sizeof( uint8_t ) * index_value->key_data_size );
+
+			if( index_value->key_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create index value: %03d key data.",
+				 function,
+				 *index_value_entry );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     index_value->key_data,
+			     &( data[ data_offset ] ),
+			     (size_t) index_value->key_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy index value: %03d data.",
+				 function,
+				 *index_value_entry );
+
+				goto on_error;
+			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -421,24 +433,7 @@ ssize_t libfsntfs_index_value_read(
 	}
 	if( remaining_size > 0 )
 	{
-		index_value->value_data = (uint8_t *) memory_allocate(
-		                                       sizeof( uint8_t ) * remaining_size );
-
-		if( index_value->value_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create index value: %03d value data.",
-			 function,
-			 *index_value_entry );
-
-			goto on_error;
-		}
-		index_value->value_data_size = remaining_size;
-
-		if( data_offset > ( data_size - index_value->value_data_size ) )
+		if( data_offset > ( data_size - remaining_size ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -449,21 +444,44 @@ ssize_t libfsntfs_index_value_read(
 
 			goto on_error;
 		}
-		if( memory_copy(
-		     index_value->value_data,
-		     &( data[ data_offset ] ),
-		     (size_t) index_value->value_data_size ) == NULL )
+		if( index_value->references_data != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy index value: %03d data.",
-			 function,
-			 *index_value_entry );
-
-			goto on_error;
+			index_value->value_data = (uint8_t *) &( data[ data_offset ] );
 		}
+		else
+		{
+			index_value->value_data = (uint8_t *) memory_allocate(
+			                                       sizeof( uint8_t ) * remaining_size );
+
+			if( index_value->value_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create index value: %03d value data.",
+				 function,
+				 *index_value_entry );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     index_value->value_data,
+			     &( data[ data_offset ] ),
+			     (size_t) remaining_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy index value: %03d data.",
+				 function,
+				 *index_value_entry );
+
+				goto on_error;
+			}
+		}
+		index_value->value_data_size = remaining_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -528,22 +546,22 @@ ssize_t libfsntfs_index_value_read(
 	return( (ssize_t) index_value->size );
 
 on_error:
-	if( index_value->value_data != NULL )
+	if( ( index_value->references_data == 0 )
+	 && ( index_value->value_data != NULL ) )
 	{
 		memory_free(
 		 index_value->value_data );
-
-		index_value->value_data = NULL;
 	}
+	index_value->value_data      = NULL;
 	index_value->value_data_size = 0;
 
-	if( index_value->key_data != NULL )
+	if( ( index_value->references_data == 0 )
+	 && ( index_value->key_data != NULL ) )
 	{
 		memory_free(
 		 index_value->key_data );
-
-		index_value->key_data = NULL;
 	}
+	index_value->key_data      = NULL;
 	index_value->key_data_size = 0;
 
 	return( -1 );
@@ -70,6 +70,11 @@ struct libfsntfs_index_value
 	/* The sub node virtual cluster number (VCN)
 	 */
 	uint64_t sub_node_vcn;
+
+	/* Value to indicate the key and value data reference the data
+	 * the index value was read from instead of being copies
+	 */
+	uint8_t references_data;
 };
 
 int libfsntfs_index_value_initialize(
@@ -23,6 +23,8 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_index_node_cache.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libcerror.h"
 
@@ -93,6 +95,20 @@ int libfsntfs_io_handle_initialize(
 
 		return( -1 );
 	}
+	if( libfsntfs_index_node_cache_initialize(
+	     &( ( *io_handle )->index_node_cache ),
+	     LIBFSNTFS_MAXIMUM_CACHE_SIZE_INDEX_NODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index node cache.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_PROFILER )
 	if( libfsntfs_profiler_initialize(
 	     &( ( *io_handle )->profiler ),
@@ -136,6 +152,12 @@ on_error:
 			 NULL );
 		}
 #endif
+		if( ( *io_handle )->index_node_cache != NULL )
+		{
+			libfsntfs_index_node_cache_free(
+			 &( ( *io_handle )->index_node_cache ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -196,6 +218,19 @@ int libfsntfs_io_handle_free(
 		}
 #endif /* defined( HAVE_PROFILER ) */
 
+		if( libfsntfs_index_node_cache_free(
+		     &( ( *io_handle )->index_node_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index node cache.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
@@ -211,10 +246,11 @@ int libfsntfs_io_handle_clear(
      libfsntfs_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function          = "libfsntfs_io_handle_clear";
+	libfsntfs_index_node_cache_t *index_node_cache = NULL;
+	static char *function                          = "libfsntfs_io_handle_clear";
 
 #if defined( HAVE_PROFILER )
-	libfsntfs_profiler_t *profiler = NULL;
+	libfsntfs_profiler_t *profiler                 = NULL;
 #endif
 
 	if( io_handle == NULL )
@@ -228,6 +264,26 @@ int libfsntfs_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The cached index nodes are only valid for the file system they were read from
+	 */
+	if( io_handle->index_node_cache != NULL )
+	{
+		if( libfsntfs_index_node_cache_empty(
+		     io_handle->index_node_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty index node cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	index_node_cache = io_handle->index_node_cache;
+
 #if defined( HAVE_PROFILER )
 	profiler = io_handle->profiler;
 #endif
@@ -245,6 +301,8 @@ int libfsntfs_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->index_node_cache = index_node_cache;
+
 #if defined( HAVE_PROFILER )
 	io_handle->profiler = profiler;
 #endif
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsntfs_index_node_cache.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_profiler.h"
 
@@ -54,6 +55,10 @@ struct libfsntfs_io_handle
 	 */
 	uint16_t bytes_per_sector;
 
+	/* The index node cache, that is shared by all indexes of the volume
+	 */
+	libfsntfs_index_node_cache_t *index_node_cache;
+
 #if defined( HAVE_PROFILER )
 	/* The profiler
 	 */
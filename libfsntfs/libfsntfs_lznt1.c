@@ -0,0 +1,475 @@
+/*
+ * LZNT1 (LZ77 + DIRECT2) decompression functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_compression.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcnotify.h"
+#include "libfsntfs_lznt1.h"
+
+/* Decompresses the data of a LZNT1 compressed chunk
+ * Returns 1 on success or -1 on error
+ */
+int libfsntfs_lznt1_decompress_chunk(
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libfsntfs_lznt1_decompress_chunk";
+	size_t chunk_data_offset                = 0;
+	size_t chunk_uncompressed_data_end      = 0;
+	size_t chunk_uncompressed_data_start    = 0;
+	size_t compression_offset               = 0;
+	size_t compression_size                 = 0;
+	size_t safe_uncompressed_data_offset    = 0;
+	uint16_t compression_tuple              = 0;
+	uint16_t compression_tuple_size_mask    = 0;
+	uint8_t compression_tuple_offset_shift  = 0;
+	uint8_t compression_flag_byte           = 0;
+	uint8_t compression_flag_bit_index      = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_uncompressed_data_start = safe_uncompressed_data_offset;
+	chunk_uncompressed_data_end   = uncompressed_data_size;
+
+	if( ( uncompressed_data_size - safe_uncompressed_data_offset ) > LIBFSNTFS_LZNT1_CHUNK_SIZE )
+	{
+		chunk_uncompressed_data_end = safe_uncompressed_data_offset + LIBFSNTFS_LZNT1_CHUNK_SIZE;
+	}
+	while( chunk_data_offset < chunk_data_size )
+	{
+		compression_flag_byte = chunk_data[ chunk_data_offset++ ];
+
+		/* A flag byte of 0 indicates 8 literals, which are copied at once if available
+		 */
+		if( ( compression_flag_byte == 0 )
+		 && ( ( chunk_data_size - chunk_data_offset ) >= 8 )
+		 && ( ( chunk_uncompressed_data_end - safe_uncompressed_data_offset ) >= 8 ) )
+		{
+			memory_copy(
+			 &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+			 &( chunk_data[ chunk_data_offset ] ),
+			 8 );
+
+			chunk_data_offset             += 8;
+			safe_uncompressed_data_offset += 8;
+
+			continue;
+		}
+		for( compression_flag_bit_index = 0;
+		     compression_flag_bit_index < 8;
+		     compression_flag_bit_index++ )
+		{
+			if( chunk_data_offset >= chunk_data_size )
+			{
+				break;
+			}
+			if( ( compression_flag_byte & 0x01 ) == 0 )
+			{
+				if( safe_uncompressed_data_offset >= chunk_uncompressed_data_end )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				uncompressed_data[ safe_uncompressed_data_offset++ ] = chunk_data[ chunk_data_offset++ ];
+			}
+			else
+			{
+				if( ( chunk_data_size - chunk_data_offset ) < 2 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: chunk data too small.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( chunk_data[ chunk_data_offset ] ),
+				 compression_tuple );
+
+				chunk_data_offset += 2;
+
+				if( safe_uncompressed_data_offset == chunk_uncompressed_data_start )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid compression tuple at start of chunk.",
+					 function );
+
+					return( -1 );
+				}
+				/* The number of bits used for the offset depends on the position in the chunk
+				 */
+				compression_tuple_size_mask    = 0x0fff;
+				compression_tuple_offset_shift = 12;
+
+				for( compression_offset = safe_uncompressed_data_offset - chunk_uncompressed_data_start - 1;
+				     compression_offset >= 0x10;
+				     compression_offset >>= 1 )
+				{
+					compression_tuple_size_mask    >>= 1;
+					compression_tuple_offset_shift  -= 1;
+				}
+				compression_offset = (size_t) ( compression_tuple >> compression_tuple_offset_shift ) + 1;
+				compression_size   = (size_t) ( compression_tuple & compression_tuple_size_mask ) + 3;
+
+				if( compression_offset > ( safe_uncompressed_data_offset - chunk_uncompressed_data_start ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compression offset value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( compression_size > ( chunk_uncompressed_data_end - safe_uncompressed_data_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compression size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( libfsntfs_compression_copy_match(
+				     uncompressed_data,
+				     uncompressed_data_size,
+				     safe_uncompressed_data_offset,
+				     compression_offset,
+				     compression_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy match.",
+					 function );
+
+					return( -1 );
+				}
+				safe_uncompressed_data_offset += compression_size;
+			}
+			compression_flag_byte >>= 1;
+		}
+	}
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses LZNT1 compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libfsntfs_lznt1_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfsntfs_lznt1_decompress";
+	size_t compressed_data_offset      = 0;
+	size_t compression_chunk_size      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint16_t compression_chunk_header  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_offset < compressed_data_size )
+	{
+		if( uncompressed_data_offset >= safe_uncompressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_size - compressed_data_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_chunk_header );
+
+		compressed_data_offset += 2;
+
+		/* A chunk header of 0 indicates the end of the compressed data
+		 */
+		if( compression_chunk_header == 0 )
+		{
+			break;
+		}
+		/* The chunk size is stored in the lower 12 bits as size - 1
+		 */
+		compression_chunk_size = (size_t) ( compression_chunk_header & 0x0fff ) + 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
+			 function,
+			 compressed_data_offset - 2,
+			 compressed_data_offset - 2 );
+
+			libcnotify_printf(
+			 "%s: compression chunk header\t\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 compression_chunk_header );
+
+			libcnotify_printf(
+			 "%s: compressed chunk size\t\t\t: %" PRIzd "\n",
+			 function,
+			 compression_chunk_size );
+
+			libcnotify_printf(
+			 "%s: signature value\t\t\t\t: %" PRIu16 "\n",
+			 function,
+			 ( compression_chunk_header >> 12 ) & 0x0007 );
+
+			libcnotify_printf(
+			 "%s: is compressed flag\t\t\t: %" PRIu16 "\n",
+			 function,
+			 compression_chunk_header >> 15 );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( compression_chunk_size > ( compressed_data_size - compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compression chunk size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( compression_chunk_header & 0x8000 ) != 0 )
+		{
+			if( libfsntfs_lznt1_decompress_chunk(
+			     &( compressed_data[ compressed_data_offset ] ),
+			     compression_chunk_size,
+			     uncompressed_data,
+			     safe_uncompressed_data_size,
+			     &uncompressed_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress chunk.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( compression_chunk_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: uncompressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( compressed_data[ compressed_data_offset ] ),
+			     compression_chunk_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chunk data.",
+				 function );
+
+				return( -1 );
+			}
+			uncompressed_data_offset += compression_chunk_size;
+		}
+		compressed_data_offset += compression_chunk_size;
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
@@ -0,0 +1,779 @@
+/*
+ * LZXPRESS Huffman decompression functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_compression.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_lzxpress_huffman.h"
+
+/* The layout of a lookup table entry
+ * bits 0 - 8   the (first) symbol
+ * bits 9 - 12  the code size of the (first) symbol, 0 if the code is larger than the lookup table bits
+ * bits 13 - 20 the second literal
+ * bits 21 - 25 the combined code size of both literals
+ * bit 26       flag to indicate the entry contains 2 literals
+ */
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_SYMBOL( entry ) \
+	( ( entry ) & 0x000001ffUL )
+
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_CODE_SIZE( entry ) \
+	( ( ( entry ) >> 9 ) & 0x0000000fUL )
+
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_SECOND_LITERAL( entry ) \
+	( ( ( entry ) >> 13 ) & 0x000000ffUL )
+
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_COMBINED_CODE_SIZE( entry ) \
+	( ( ( entry ) >> 21 ) & 0x0000001fUL )
+
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_FLAG_TWO_LITERALS	0x04000000UL
+
+/* Consumes bits of the bit stream and refills it with the next 16-bit value,
+ * when the end of the compressed data is reached 0-byte values are used as padding
+ */
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_CONSUME_BITS( number_of_bits ) \
+	next_bits           <<= ( number_of_bits ); \
+	number_of_extra_bits -= (int) ( number_of_bits ); \
+	if( number_of_extra_bits < 0 ) \
+	{ \
+		if( ( compressed_data_size - safe_compressed_data_offset ) >= 2 ) \
+		{ \
+			byte_stream_copy_to_uint16_little_endian( \
+			 &( compressed_data[ safe_compressed_data_offset ] ), \
+			 value_16bit ); \
+			safe_compressed_data_offset += 2; \
+		} \
+		else \
+		{ \
+			value_16bit = 0; \
+			number_of_padding_bits += 16; \
+		} \
+		next_bits            |= (uint32_t) value_16bit << ( 0 - number_of_extra_bits ); \
+		number_of_extra_bits += 16; \
+	}
+
+/* Builds the decoder from the code size table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_lzxpress_huffman_decoder_build(
+     libfsntfs_lzxpress_huffman_decoder_t *decoder,
+     const uint8_t *code_size_table,
+     size_t code_size_table_size,
+     libcerror_error_t **error )
+{
+	uint16_t next_symbol_index[ LIBFSNTFS_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ];
+	uint8_t code_sizes[ LIBFSNTFS_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS ];
+
+	static char *function     = "libfsntfs_lzxpress_huffman_decoder_build";
+	uint32_t code             = 0;
+	uint32_t code_index       = 0;
+	uint32_t entry            = 0;
+	uint32_t first_entry      = 0;
+	uint32_t last_entry       = 0;
+	uint32_t second_entry     = 0;
+	uint32_t symbol_index     = 0;
+	uint8_t code_size         = 0;
+	uint8_t second_code_size  = 0;
+	uint16_t symbol           = 0;
+	uint16_t table_index      = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_size_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code size table.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_size_table_size != LIBFSNTFS_LZXPRESS_HUFFMAN_CODE_SIZE_TABLE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid code size table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     decoder,
+	     0,
+	     sizeof( libfsntfs_lzxpress_huffman_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder.",
+		 function );
+
+		return( -1 );
+	}
+	/* The code sizes are stored as 4-bit values, the lower nibble contains the code size of the even symbol
+	 */
+	for( symbol = 0;
+	     symbol < LIBFSNTFS_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS;
+	     symbol += 2 )
+	{
+		code_sizes[ symbol ]     = code_size_table[ symbol / 2 ] & 0x0f;
+		code_sizes[ symbol + 1 ] = code_size_table[ symbol / 2 ] >> 4;
+
+		decoder->number_of_codes[ code_sizes[ symbol ] ] += 1;
+		decoder->number_of_codes[ code_sizes[ symbol + 1 ] ] += 1;
+	}
+	decoder->number_of_codes[ 0 ] = 0;
+
+	/* Determine the canonical code ranges, where shorter codes precede longer codes
+	 */
+	for( code_size = 1;
+	     code_size <= LIBFSNTFS_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		decoder->first_code[ code_size ]         = code;
+		decoder->first_symbol_index[ code_size ] = (uint16_t) symbol_index;
+		next_symbol_index[ code_size ]           = (uint16_t) symbol_index;
+
+		code         += decoder->number_of_codes[ code_size ];
+		symbol_index += decoder->number_of_codes[ code_size ];
+
+		if( code > ( (uint32_t) 1UL << code_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code sizes - codes are over-subscribed.",
+			 function );
+
+			return( -1 );
+		}
+		code <<= 1;
+	}
+	for( symbol = 0;
+	     symbol < LIBFSNTFS_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size != 0 )
+		{
+			decoder->symbols[ next_symbol_index[ code_size ]++ ] = symbol;
+		}
+	}
+	/* Fill the lookup table with the codes that fit in the lookup table bits
+	 */
+	for( code_size = 1;
+	     code_size <= LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS;
+	     code_size++ )
+	{
+		for( code_index = 0;
+		     code_index < decoder->number_of_codes[ code_size ];
+		     code_index++ )
+		{
+			code   = decoder->first_code[ code_size ] + code_index;
+			symbol = decoder->symbols[ decoder->first_symbol_index[ code_size ] + code_index ];
+			entry  = (uint32_t) symbol | ( (uint32_t) code_size << 9 );
+
+			first_entry = code << ( LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS - code_size );
+			last_entry  = ( code + 1 ) << ( LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS - code_size );
+
+			while( first_entry < last_entry )
+			{
+				decoder->lookup_table[ first_entry++ ] = entry;
+			}
+		}
+	}
+	/* Combine 2 literals into a single entry when the index contains both codes
+	 */
+	for( table_index = 0;
+	     table_index < ( 1 << LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS );
+	     table_index++ )
+	{
+		entry     = decoder->lookup_table[ table_index ];
+		code_size = (uint8_t) LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_CODE_SIZE( entry );
+
+		if( ( code_size == 0 )
+		 || ( code_size >= LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS )
+		 || ( LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_SYMBOL( entry ) >= 256 ) )
+		{
+			continue;
+		}
+		second_entry     = decoder->lookup_table[ ( table_index << code_size ) & ( ( 1 << LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ) - 1 ) ];
+		second_code_size = (uint8_t) LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_CODE_SIZE( second_entry );
+
+		if( ( second_code_size == 0 )
+		 || ( ( code_size + second_code_size ) > LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS )
+		 || ( LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_SYMBOL( second_entry ) >= 256 ) )
+		{
+			continue;
+		}
+		decoder->lookup_table[ table_index ] = entry
+		                                     | ( LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_SYMBOL( second_entry ) << 13 )
+		                                     | ( (uint32_t) ( code_size + second_code_size ) << 21 )
+		                                     | LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_FLAG_TWO_LITERALS;
+	}
+	return( 1 );
+}
+
+/* Decompresses a LZXPRESS Huffman compressed block
+ * The bit stream consists of 16-bit little-endian values of which the most significant bits are read first
+ * Returns 1 on success or -1 on error
+ */
+int libfsntfs_lzxpress_huffman_decompress_block(
+     libfsntfs_lzxpress_huffman_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t *end_of_stream,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libfsntfs_lzxpress_huffman_decompress_block";
+	size_t block_end_offset               = 0;
+	size_t compression_offset             = 0;
+	size_t compression_size               = 0;
+	size_t safe_compressed_data_offset    = 0;
+	size_t safe_uncompressed_data_offset  = 0;
+	uint32_t code                         = 0;
+	uint32_t entry                        = 0;
+	uint32_t next_bits                    = 0;
+	uint16_t symbol                       = 0;
+	uint16_t value_16bit                  = 0;
+	uint8_t code_size                     = 0;
+	uint8_t compression_offset_size       = 0;
+	int number_of_extra_bits              = 0;
+	int number_of_padding_bits            = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end of stream.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset   = *compressed_data_offset;
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( ( safe_compressed_data_offset > compressed_data_size )
+	 || ( ( compressed_data_size - safe_compressed_data_offset ) < ( LIBFSNTFS_LZXPRESS_HUFFMAN_CODE_SIZE_TABLE_SIZE + 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_lzxpress_huffman_decoder_build(
+	     decoder,
+	     &( compressed_data[ safe_compressed_data_offset ] ),
+	     LIBFSNTFS_LZXPRESS_HUFFMAN_CODE_SIZE_TABLE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build Huffman decoder.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset += LIBFSNTFS_LZXPRESS_HUFFMAN_CODE_SIZE_TABLE_SIZE;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( compressed_data[ safe_compressed_data_offset ] ),
+	 value_16bit );
+
+	next_bits = (uint32_t) value_16bit << 16;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( compressed_data[ safe_compressed_data_offset + 2 ] ),
+	 value_16bit );
+
+	next_bits |= value_16bit;
+
+	safe_compressed_data_offset += 4;
+	number_of_extra_bits         = 16;
+
+	block_end_offset = uncompressed_data_size;
+
+	if( ( uncompressed_data_size - safe_uncompressed_data_offset ) > LIBFSNTFS_LZXPRESS_HUFFMAN_BLOCK_SIZE )
+	{
+		block_end_offset = safe_uncompressed_data_offset + LIBFSNTFS_LZXPRESS_HUFFMAN_BLOCK_SIZE;
+	}
+	*end_of_stream = 0;
+
+	while( safe_uncompressed_data_offset < block_end_offset )
+	{
+		/* Stop when all the bits of the compressed data have been consumed
+		 */
+		if( ( 16 + number_of_extra_bits - number_of_padding_bits ) <= 0 )
+		{
+			*end_of_stream = 1;
+
+			break;
+		}
+		entry = decoder->lookup_table[ next_bits >> ( 32 - LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ) ];
+
+		if( ( ( entry & LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_FLAG_TWO_LITERALS ) != 0 )
+		 && ( ( block_end_offset - safe_uncompressed_data_offset ) >= 2 ) )
+		{
+			uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_SYMBOL( entry );
+			uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_SECOND_LITERAL( entry );
+
+			code_size = (uint8_t) LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_COMBINED_CODE_SIZE( entry );
+
+			LIBFSNTFS_LZXPRESS_HUFFMAN_CONSUME_BITS( code_size );
+
+			if( number_of_padding_bits > ( 16 + number_of_extra_bits ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		code_size = (uint8_t) LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_CODE_SIZE( entry );
+
+		if( code_size != 0 )
+		{
+			symbol = (uint16_t) LIBFSNTFS_LZXPRESS_HUFFMAN_ENTRY_SYMBOL( entry );
+		}
+		else
+		{
+			/* The code is larger than the lookup table bits
+			 */
+			for( code_size = LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS + 1;
+			     code_size <= LIBFSNTFS_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE;
+			     code_size++ )
+			{
+				code = ( next_bits >> ( 32 - code_size ) ) - decoder->first_code[ code_size ];
+
+				if( code < decoder->number_of_codes[ code_size ] )
+				{
+					break;
+				}
+			}
+			if( code_size > LIBFSNTFS_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid Huffman code.",
+				 function );
+
+				return( -1 );
+			}
+			symbol = decoder->symbols[ decoder->first_symbol_index[ code_size ] + code ];
+		}
+		LIBFSNTFS_LZXPRESS_HUFFMAN_CONSUME_BITS( code_size );
+
+		if( number_of_padding_bits > ( 16 + number_of_extra_bits ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( symbol < 256 )
+		{
+			uncompressed_data[ safe_uncompressed_data_offset++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		symbol                 -= 256;
+		compression_size        = symbol & 0x000f;
+		compression_offset_size = (uint8_t) ( symbol >> 4 );
+
+		if( compression_size == 15 )
+		{
+			if( safe_compressed_data_offset >= compressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			compression_size = compressed_data[ safe_compressed_data_offset++ ];
+
+			if( compression_size == 255 )
+			{
+				if( ( compressed_data_size - safe_compressed_data_offset ) < 2 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ safe_compressed_data_offset ] ),
+				 compression_size );
+
+				safe_compressed_data_offset += 2;
+
+				if( compression_size == 0 )
+				{
+					if( ( compressed_data_size - safe_compressed_data_offset ) < 4 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data size value too small.",
+						 function );
+
+						return( -1 );
+					}
+					byte_stream_copy_to_uint32_little_endian(
+					 &( compressed_data[ safe_compressed_data_offset ] ),
+					 compression_size );
+
+					safe_compressed_data_offset += 4;
+				}
+				if( compression_size < 15 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid compression size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				compression_size -= 15;
+			}
+			compression_size += 15;
+		}
+		compression_size += 3;
+
+		compression_offset = (size_t) 1 << compression_offset_size;
+
+		if( compression_offset_size > 0 )
+		{
+			compression_offset |= next_bits >> ( 32 - compression_offset_size );
+
+			LIBFSNTFS_LZXPRESS_HUFFMAN_CONSUME_BITS( compression_offset_size );
+
+			if( number_of_padding_bits > ( 16 + number_of_extra_bits ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( compression_offset > safe_uncompressed_data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compression offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( compression_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compression size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsntfs_compression_copy_match(
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     safe_uncompressed_data_offset,
+		     compression_offset,
+		     compression_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy match.",
+			 function );
+
+			return( -1 );
+		}
+		safe_uncompressed_data_offset += compression_size;
+	}
+
+	*compressed_data_offset   = safe_compressed_data_offset;
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses LZXPRESS Huffman compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libfsntfs_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libfsntfs_lzxpress_huffman_decoder_t decoder;
+
+	static char *function              = "libfsntfs_lzxpress_huffman_decompress";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint8_t end_of_stream              = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( safe_uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_offset < compressed_data_size )
+	{
+		if( uncompressed_data_offset >= safe_uncompressed_data_size )
+		{
+			break;
+		}
+		if( libfsntfs_lzxpress_huffman_decompress_block(
+		     &decoder,
+		     compressed_data,
+		     compressed_data_size,
+		     &compressed_data_offset,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     &end_of_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress block.",
+			 function );
+
+			return( -1 );
+		}
+		if( end_of_stream != 0 )
+		{
+			break;
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
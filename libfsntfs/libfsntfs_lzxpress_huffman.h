@@ -0,0 +1,111 @@
+/*
+ * LZXPRESS Huffman decompression functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_LZXPRESS_HUFFMAN_H )
+#define _LIBFSNTFS_LZXPRESS_HUFFMAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The (maximum) size of the uncompressed data of a LZXPRESS Huffman block
+ */
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_BLOCK_SIZE			65536
+
+/* The number of Huffman symbols, 256 literals and 256 match symbols
+ */
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS		512
+
+/* The size of the code size table that precedes the bit stream of a block
+ */
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_CODE_SIZE_TABLE_SIZE		256
+
+/* The maximum number of bits of a Huffman code
+ */
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE		15
+
+/* The number of bits used to index the lookup table
+ * codes that are larger are decoded using the canonical code ranges
+ */
+#define LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS		11
+
+typedef struct libfsntfs_lzxpress_huffman_decoder libfsntfs_lzxpress_huffman_decoder_t;
+
+struct libfsntfs_lzxpress_huffman_decoder
+{
+	/* The lookup table
+	 * Every entry contains the symbol and its code size and, if the bits
+	 * of the index contain 2 complete literal codes, also the second literal
+	 */
+	uint32_t lookup_table[ 1 << LIBFSNTFS_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ];
+
+	/* The first code per code size
+	 */
+	uint32_t first_code[ LIBFSNTFS_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ];
+
+	/* The number of codes per code size
+	 */
+	uint16_t number_of_codes[ LIBFSNTFS_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ];
+
+	/* The index of the first symbol per code size
+	 */
+	uint16_t first_symbol_index[ LIBFSNTFS_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ];
+
+	/* The symbols sorted by code size and symbol value
+	 */
+	uint16_t symbols[ LIBFSNTFS_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS ];
+};
+
+int libfsntfs_lzxpress_huffman_decoder_build(
+     libfsntfs_lzxpress_huffman_decoder_t *decoder,
+     const uint8_t *code_size_table,
+     size_t code_size_table_size,
+     libcerror_error_t **error );
+
+int libfsntfs_lzxpress_huffman_decompress_block(
+     libfsntfs_lzxpress_huffman_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     uint8_t *end_of_stream,
+     libcerror_error_t **error );
+
+int libfsntfs_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_LZXPRESS_HUFFMAN_H ) */
+
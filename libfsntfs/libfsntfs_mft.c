@@ -169,6 +169,12 @@ int libfsntfs_mft_initialize(
 on_error:
 	if( *mft != NULL )
 	{
+		if( ( *mft )->single_mft_entry_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *mft )->single_mft_entry_cache ),
+			 NULL );
+		}
 		if( ( *mft )->mft_entry_cache != NULL )
 		{
 			libfcache_cache_free(
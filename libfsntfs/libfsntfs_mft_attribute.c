@@ -143,22 +143,10 @@ int libfsntfs_mft_attribute_free(
 			memory_free(
 			 ( *mft_attribute )->data );
 		}
-		if( ( *mft_attribute )->data_runs_array != NULL )
+		if( ( *mft_attribute )->data_runs != NULL )
 		{
-			if( libcdata_array_free(
-			     &( ( *mft_attribute )->data_runs_array ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_run_free,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data runs array.",
-				 function );
-
-				result = -1;
-			}
+			memory_free(
+			 ( *mft_attribute )->data_runs );
 		}
 		memory_free(
 		 *mft_attribute );
@@ -234,10 +222,10 @@ int libfsntfs_mft_attribute_clone(
 
 		goto on_error;
 	}
-	( *destination_mft_attribute )->name            = NULL;
-	( *destination_mft_attribute )->data            = NULL;
-	( *destination_mft_attribute )->data_runs_array = NULL;
-	( *destination_mft_attribute )->next_attribute  = NULL;
+	( *destination_mft_attribute )->name           = NULL;
+	( *destination_mft_attribute )->data           = NULL;
+	( *destination_mft_attribute )->data_runs      = NULL;
+	( *destination_mft_attribute )->next_attribute = NULL;
 
 	if( source_mft_attribute->name != NULL )
 	{
@@ -303,27 +291,47 @@ int libfsntfs_mft_attribute_clone(
 		}
 		( *destination_mft_attribute )->data_size = source_mft_attribute->data_size;
 	}
-	if( libcdata_array_clone(
-	     &( ( *destination_mft_attribute )->data_runs_array ),
-	     source_mft_attribute->data_runs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_run_free,
-	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfsntfs_data_run_clone,
-	     error ) != 1 )
+	if( source_mft_attribute->data_runs != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to clone data runs array.",
-		 function );
+		( *destination_mft_attribute )->data_runs = (libfsntfs_data_run_t *) memory_allocate(
+		                                                                   sizeof( libfsntfs_data_run_t ) * source_mft_attribute->number_of_data_runs );
 
-		goto on_error;
+		if( ( *destination_mft_attribute )->data_runs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination data runs.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_mft_attribute )->data_runs,
+		     source_mft_attribute->data_runs,
+		     sizeof( libfsntfs_data_run_t ) * source_mft_attribute->number_of_data_runs ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source data runs to destination.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
 
 on_error:
 	if( *destination_mft_attribute != NULL )
 	{
+		if( ( *destination_mft_attribute )->data_runs != NULL )
+		{
+			memory_free(
+			 ( *destination_mft_attribute )->data_runs );
+		}
 		if( ( *destination_mft_attribute )->data != NULL )
 		{
 			memory_free(
@@ -352,23 +360,20 @@ int libfsntfs_mft_attribute_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	libfsntfs_data_run_t *data_run     = NULL;
-	const uint8_t *non_resident_data   = NULL;
-	const uint8_t *resident_data       = NULL;
-	static char *function              = "libfsntfs_mft_attribute_read_data";
-	size_t data_offset                 = 0;
-	size_t non_resident_data_size      = 0;
-	ssize_t read_count                 = 0;
-	uint64_t last_cluster_block_number = 0;
-	uint16_t compression_unit_size     = 0;
-	uint16_t data_runs_offset          = 0;
-	uint16_t name_offset               = 0;
-	int data_run_index                 = 0;
-	int entry_index                    = 0;
+	const uint8_t *non_resident_data = NULL;
+	const uint8_t *resident_data     = NULL;
+	static char *function            = "libfsntfs_mft_attribute_read_data";
+	size_t data_offset               = 0;
+	size_t non_resident_data_size    = 0;
+	ssize_t read_count               = 0;
+	uint16_t compression_unit_size   = 0;
+	uint16_t data_runs_offset        = 0;
+	uint16_t name_offset             = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit               = 0;
-	uint32_t value_32bit               = 0;
+	uint64_t value_64bit             = 0;
+	uint32_t value_32bit             = 0;
+	int data_run_index               = 0;
 #endif
 
 	if( mft_attribute == NULL )
@@ -404,13 +409,13 @@ int libfsntfs_mft_attribute_read_data(
 
 		return( -1 );
 	}
-	if( mft_attribute->data_runs_array != NULL )
+	if( mft_attribute->data_runs != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid MFT attribute - data runs array value already set.",
+		 "%s: invalid MFT attribute - data runs value already set.",
 		 function );
 
 		return( -1 );
@@ -1067,123 +1072,46 @@ int libfsntfs_mft_attribute_read_data(
 #endif
 		data_offset = (size_t) data_runs_offset;
 
-		if( libcdata_array_initialize(
-		     &( mft_attribute->data_runs_array ),
-		     0,
-		     error ) != 1 )
+		read_count = libfsntfs_data_run_read_list_data(
+		              &( mft_attribute->data_runs ),
+		              &( mft_attribute->number_of_data_runs ),
+		              io_handle,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              error );
+
+		if( read_count <= -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data runs array.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data runs.",
 			 function );
 
 			goto on_error;
 		}
-		while( data_offset < data_size )
-		{
-			if( libfsntfs_data_run_initialize(
-			     &data_run,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create data run: %d.",
-				 function,
-				 data_run_index );
-
-				goto on_error;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: reading data run: %d.\n",
-				 function,
-				 data_run_index );
-			}
-#endif
-			read_count = libfsntfs_data_run_read_data(
-			              data_run,
-			              io_handle,
-			              &( data[ data_offset ] ),
-			              data_size - data_offset,
-			              last_cluster_block_number,
-			              error );
-
-			if( read_count <= -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read data run: %d.",
-				 function,
-				 data_run_index );
-
-				goto on_error;
-			}
-			else if( read_count == 1 )
-			{
-				if( libfsntfs_data_run_free(
-				     &data_run,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free data run: %d.",
-					 function,
-					 data_run_index );
-
-					goto on_error;
-				}
-				break;
-			}
-			data_offset += read_count;
+		data_offset += (size_t) read_count;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+		if( libcnotify_verbose != 0 )
+		{
+			for( data_run_index = 0;
+			     data_run_index < mft_attribute->number_of_data_runs;
+			     data_run_index++ )
 			{
-				if( ( data_run->start_offset == 0 )
+				if( ( ( mft_attribute->data_runs[ data_run_index ].range_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) != 0 )
 				 && ( ( mft_attribute->data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_COMPRESSION_MASK ) == 0 )
 				 && ( ( mft_attribute->data_flags & LIBFSNTFS_ATTRIBUTE_FLAG_SPARSE ) == 0 ) )
 				{
 					libcnotify_printf(
-					 "%s: data run is sparse but no attribute data flags set.\n\n",
-					 function );
+					 "%s: data run: %d is sparse but no attribute data flags set.\n\n",
+					 function,
+					 data_run_index );
 				}
 			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-			if( ( data_run->range_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) == 0 )
-			{
-				last_cluster_block_number = data_run->cluster_block_number;
-			}
-			if( libcdata_array_append_entry(
-			     mft_attribute->data_runs_array,
-			     &entry_index,
-			     (intptr_t *) data_run,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append data run: %d to array.",
-				 function,
-				 data_run_index );
-
-				goto on_error;
-			}
-			data_run = NULL;
-
-			data_run_index++;
 		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1203,19 +1131,15 @@ int libfsntfs_mft_attribute_read_data(
 	return( 1 );
 
 on_error:
-	if( data_run != NULL )
+	if( mft_attribute->data_runs != NULL )
 	{
-		libfsntfs_data_run_free(
-		 &data_run,
-		 NULL );
-	}
-	if( mft_attribute->data_runs_array != NULL )
-	{
-		libcdata_array_free(
-		 &( mft_attribute->data_runs_array ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_data_run_free,
-		 NULL );
+		memory_free(
+		 mft_attribute->data_runs );
+
+		mft_attribute->data_runs = NULL;
 	}
+	mft_attribute->number_of_data_runs = 0;
+
 	if( mft_attribute->data != NULL )
 	{
 		memory_free(
@@ -1965,38 +1889,19 @@ int libfsntfs_mft_attribute_get_number_of_data_runs(
 
 		return( -1 );
 	}
-	if( mft_attribute->data_runs_array == NULL )
+	if( number_of_data_runs == NULL )
 	{
-		if( number_of_data_runs == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid number of data runs.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of data runs.",
+		 function );
 
-			return( -1 );
-		}
-		*number_of_data_runs = 0;
+		return( -1 );
 	}
-	else
-	{
-		if( libcdata_array_get_number_of_entries(
-		     mft_attribute->data_runs_array,
-		     number_of_data_runs,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of data runs.",
-			 function );
+	*number_of_data_runs = mft_attribute->number_of_data_runs;
 
-			return( -1 );
-		}
-	}
 	return( 1 );
 }
 
@@ -2022,22 +1927,31 @@ int libfsntfs_mft_attribute_get_data_run_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     mft_attribute->data_runs_array,
-	     data_run_index,
-	     (intptr_t **) data_run,
-	     error ) != 1 )
+	if( ( data_run_index < 0 )
+	 || ( data_run_index >= mft_attribute->number_of_data_runs ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data run: %d.",
-		 function,
-		 data_run_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data run.",
+		 function );
 
 		return( -1 );
 	}
+	*data_run = &( mft_attribute->data_runs[ data_run_index ] );
+
 	return( 1 );
 }
 
@@ -2062,7 +1976,6 @@ int libfsntfs_mft_attribute_get_data_extents_array(
 	int attribute_index                          = 0;
 	int data_run_index                           = 0;
 	int entry_index                              = 0;
-	int number_of_data_runs                      = 0;
 
 	if( mft_attribute == NULL )
 	{
@@ -2138,7 +2051,7 @@ int libfsntfs_mft_attribute_get_data_extents_array(
 	}
 	while( mft_attribute != NULL )
 	{
-		if( mft_attribute->data_runs_array != NULL )
+		if( ( mft_attribute->non_resident_flag & 0x01 ) != 0 )
 		{
 			attribute_data_vcn_offset = mft_attribute->data_first_vcn;
 			attribute_data_vcn_size   = mft_attribute->data_last_vcn;
@@ -2197,55 +2110,12 @@ int libfsntfs_mft_attribute_get_data_extents_array(
 				}
 				calculated_attribute_data_vcn_offset = attribute_data_vcn_offset + (off64_t) attribute_data_vcn_size;
 			}
-			if( libcdata_array_get_number_of_entries(
-			     mft_attribute->data_runs_array,
-			     &number_of_data_runs,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve attribute: %d number of data runs.",
-				 function,
-				 attribute_index );
-
-				goto on_error;
-			}
 			for( data_run_index = 0;
-			     data_run_index < number_of_data_runs;
+			     data_run_index < mft_attribute->number_of_data_runs;
 			     data_run_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     mft_attribute->data_runs_array,
-				     data_run_index,
-				     (intptr_t **) &data_run,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve attribute: %d data run: %d.",
-					 function,
-					 attribute_index,
-					 data_run_index );
+				data_run = &( mft_attribute->data_runs[ data_run_index ] );
 
-					goto on_error;
-				}
-				if( data_run == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing attribute: %d data run: %d.",
-					 function,
-					 attribute_index,
-					 data_run_index );
-
-					goto on_error;
-				}
 				if( libfsntfs_extent_initialize(
 				     &data_extent,
 				     error ) != 1 )
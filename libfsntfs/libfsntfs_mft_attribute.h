@@ -98,9 +98,13 @@ struct libfsntfs_mft_attribute
 	 */
 	uint8_t *data;
 
-	/* The data runs array
+	/* The data runs
 	 */
-	libcdata_array_t *data_runs_array;
+	libfsntfs_data_run_t *data_runs;
+
+	/* The number of data runs
+	 */
+	int number_of_data_runs;
 
 	/* The next attribute in an attribute chain
 	 */
@@ -3102,6 +3102,120 @@ int libfsntfs_mft_entry_has_directory_entries_index(
 	return( (int) mft_entry->has_i30_index );
 }
 
+/* Determines if names in the directory entries ($I30) index should be compared using case folding
+ * Case folding is used unless the $STANDARD_INFORMATION attribute marks the directory as case sensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_mft_entry_get_use_case_folding(
+     libfsntfs_mft_entry_t *mft_entry,
+     uint8_t *use_case_folding,
+     libcerror_error_t **error )
+{
+	libfsntfs_mft_attribute_t *mft_attribute                             = NULL;
+	libfsntfs_standard_information_values_t *standard_information_values = NULL;
+	static char *function                                                = "libfsntfs_mft_entry_get_use_case_folding";
+	uint8_t safe_use_case_folding                                        = 0;
+	int result                                                           = 0;
+
+	if( mft_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( use_case_folding == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid use case folding.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_mft_entry_get_standard_information_attribute(
+	          mft_entry,
+	          &mft_attribute,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $STANDARD_INFORMATION attribute from MFT entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsntfs_standard_information_values_initialize(
+		     &standard_information_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create standard information values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsntfs_standard_information_values_read_from_mft_attribute(
+		     standard_information_values,
+		     mft_attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read standard information values from MFT attribute.",
+			 function );
+
+			goto on_error;
+		}
+		if( standard_information_values->is_case_sensitive == 0 )
+		{
+			safe_use_case_folding = 1;
+		}
+		if( libfsntfs_standard_information_values_free(
+		     &standard_information_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free standard information values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*use_case_folding = safe_use_case_folding;
+
+	return( 1 );
+
+on_error:
+	if( standard_information_values != NULL )
+	{
+		libfsntfs_standard_information_values_free(
+		 &standard_information_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Reads the MFT entry
  * Callback function for the MFT entry vector
  * Returns 1 if successful or -1 on error
@@ -303,6 +303,11 @@ int libfsntfs_mft_entry_has_directory_entries_index(
      libfsntfs_mft_entry_t *mft_entry,
      libcerror_error_t **error );
 
+int libfsntfs_mft_entry_get_use_case_folding(
+     libfsntfs_mft_entry_t *mft_entry,
+     uint8_t *use_case_folding,
+     libcerror_error_t **error );
+
 int libfsntfs_mft_entry_read_element_data(
      intptr_t *data_handle,
      libbfio_handle_t *file_io_handle,
@@ -904,3 +904,265 @@ int libfsntfs_name_compare_with_utf16_string(
 	return( LIBUNA_COMPARE_EQUAL );
 }
 
+/* Calculates the hash of an UTF-16 encoded name
+ * The hash is calculated over the Unicode characters of the name, so that
+ * names that are equal according to libfsntfs_name_compare_with_utf8_string
+ * or libfsntfs_name_compare_with_utf16_string have the same hash
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_get_hash(
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libfsntfs_name_get_hash";
+	libuna_unicode_character_t name_character = 0;
+	size_t name_index                         = 0;
+	uint32_t safe_hash                        = LIBFSNTFS_NAME_HASH_INITIAL_VALUE;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 encoded name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 encoded name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check if the UTF-16 stream is terminated with zero bytes
+	 */
+	if( ( name_size >= 2 )
+	 && ( name[ name_size - 2 ] == 0 )
+	 && ( name[ name_size - 1 ] == 0 ) )
+	{
+		name_size -= 2;
+	}
+	while( name_index < name_size )
+	{
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &name_character,
+		     name,
+		     name_size,
+		     &name_index,
+		     LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 encoded name to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( use_case_folding != 0 )
+		{
+			name_character = (libuna_unicode_character_t) towupper( (wint_t) name_character );
+		}
+		safe_hash ^= (uint32_t) name_character;
+		safe_hash *= LIBFSNTFS_NAME_HASH_MULTIPLIER;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-8 encoded string
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_get_hash_from_utf8_string(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libfsntfs_name_get_hash_from_utf8_string";
+	libuna_unicode_character_t string_character = 0;
+	size_t utf8_string_index                    = 0;
+	uint32_t safe_hash                          = LIBFSNTFS_NAME_HASH_INITIAL_VALUE;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length >= 1 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length -= 1;
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		/* Using RFC 2279 UTF-8 to support unpaired UTF-16 surrogates
+		 */
+		if( libuna_unicode_character_copy_from_utf8_rfc2279(
+		     &string_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 RFC 2279 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( use_case_folding != 0 )
+		{
+			string_character = (libuna_unicode_character_t) towupper( (wint_t) string_character );
+		}
+		safe_hash ^= (uint32_t) string_character;
+		safe_hash *= LIBFSNTFS_NAME_HASH_MULTIPLIER;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-16 encoded string
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_get_hash_from_utf16_string(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libfsntfs_name_get_hash_from_utf16_string";
+	libuna_unicode_character_t string_character = 0;
+	size_t utf16_string_index                   = 0;
+	uint32_t safe_hash                          = LIBFSNTFS_NAME_HASH_INITIAL_VALUE;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length >= 1 )
+	 && ( utf16_string[ utf16_string_length - 1 ] == 0 ) )
+	{
+		utf16_string_length -= 1;
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		/* Using UCS-2 to support unpaired UTF-16 surrogates
+		 */
+		if( libuna_unicode_character_copy_from_ucs2(
+		     &string_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UCS-2 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( use_case_folding != 0 )
+		{
+			string_character = (libuna_unicode_character_t) towupper( (wint_t) string_character );
+		}
+		safe_hash ^= (uint32_t) string_character;
+		safe_hash *= LIBFSNTFS_NAME_HASH_MULTIPLIER;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
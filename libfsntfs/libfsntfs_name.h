@@ -32,6 +32,11 @@
 extern "C" {
 #endif
 
+/* The FNV-1a initial value and multiplier used to calculate name hashes
+ */
+#define LIBFSNTFS_NAME_HASH_INITIAL_VALUE	0x811c9dc5UL
+#define LIBFSNTFS_NAME_HASH_MULTIPLIER		0x01000193UL
+
 int libfsntfs_name_compare(
      const uint8_t *name,
      size_t name_size,
@@ -63,6 +68,27 @@ int libfsntfs_name_compare_with_utf16_string(
      uint8_t use_case_folding,
      libcerror_error_t **error );
 
+int libfsntfs_name_get_hash(
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libfsntfs_name_get_hash_from_utf8_string(
+     const libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libfsntfs_name_get_hash_from_utf16_string(
+     const libuna_utf16_character_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t use_case_folding,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
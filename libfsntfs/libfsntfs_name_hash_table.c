@@ -0,0 +1,373 @@
+/*
+ * Name hash table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_name_hash_table.h"
+
+/* Creates a name hash table
+ * Make sure the value name_hash_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_hash_table_initialize(
+     libfsntfs_name_hash_table_t **name_hash_table,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsntfs_name_hash_table_initialize";
+	uint32_t number_of_slots = LIBFSNTFS_NAME_HASH_TABLE_MINIMUM_NUMBER_OF_SLOTS;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_values < 0 )
+	 || ( maximum_number_of_values > (int) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load factor of the table at most 0.5 to keep the probe sequences short
+	 */
+	while( number_of_slots < ( (uint32_t) maximum_number_of_values * 2 ) )
+	{
+		number_of_slots *= 2;
+	}
+	if( ( (size_t) number_of_slots * sizeof( uint32_t ) ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*name_hash_table = memory_allocate_structure(
+	                    libfsntfs_name_hash_table_t );
+
+	if( *name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_hash_table,
+	     0,
+	     sizeof( libfsntfs_name_hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name hash table.",
+		 function );
+
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+
+		return( -1 );
+	}
+	( *name_hash_table )->hashes = (uint32_t *) memory_allocate(
+	                                             sizeof( uint32_t ) * number_of_slots );
+
+	if( ( *name_hash_table )->hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hashes.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_hash_table )->values = (int *) memory_allocate(
+	                                        sizeof( int ) * number_of_slots );
+
+	if( ( *name_hash_table )->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		goto on_error;
+	}
+	/* Setting all bytes to 0xff marks every slot as unused (-1)
+	 */
+	if( memory_set(
+	     ( *name_hash_table )->values,
+	     0xff,
+	     sizeof( int ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values.",
+		 function );
+
+		goto on_error;
+	}
+	( *name_hash_table )->number_of_slots          = number_of_slots;
+	( *name_hash_table )->maximum_number_of_values = maximum_number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( *name_hash_table != NULL )
+	{
+		if( ( *name_hash_table )->values != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->values );
+		}
+		if( ( *name_hash_table )->hashes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->hashes );
+		}
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a name hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_hash_table_free(
+     libfsntfs_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_name_hash_table_free";
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_hash_table != NULL )
+	{
+		if( ( *name_hash_table )->values != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->values );
+		}
+		if( ( *name_hash_table )->hashes != NULL )
+		{
+			memory_free(
+			 ( *name_hash_table )->hashes );
+		}
+		memory_free(
+		 *name_hash_table );
+
+		*name_hash_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Inserts a value into the name hash table
+ * Values with the same name hash are retained in order of insertion
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_name_hash_table_insert_value(
+     libfsntfs_name_hash_table_t *name_hash_table,
+     uint32_t name_hash,
+     int value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_name_hash_table_insert_value";
+	uint32_t slot_index   = 0;
+	uint32_t slot_mask    = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( value < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash_table->number_of_values >= name_hash_table->maximum_number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name hash table - maximum number of values reached.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask  = name_hash_table->number_of_slots - 1;
+	slot_index = name_hash & slot_mask;
+
+	while( name_hash_table->values[ slot_index ] != -1 )
+	{
+		slot_index = ( slot_index + 1 ) & slot_mask;
+	}
+	name_hash_table->hashes[ slot_index ] = name_hash;
+	name_hash_table->values[ slot_index ] = value;
+
+	name_hash_table->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next value with a specific name hash
+ * The probe index should be set to 0 to retrieve the first value and is
+ * updated so that subsequent calls retrieve the next value with the same name hash
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsntfs_name_hash_table_get_next_value_by_hash(
+     libfsntfs_name_hash_table_t *name_hash_table,
+     uint32_t name_hash,
+     uint32_t *probe_index,
+     int *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_name_hash_table_get_next_value_by_hash";
+	uint32_t safe_index   = 0;
+	uint32_t slot_index   = 0;
+	uint32_t slot_mask    = 0;
+
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( probe_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid probe index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	slot_mask = name_hash_table->number_of_slots - 1;
+
+	for( safe_index = *probe_index;
+	     safe_index < name_hash_table->number_of_slots;
+	     safe_index++ )
+	{
+		slot_index = ( name_hash + safe_index ) & slot_mask;
+
+		/* An unused slot terminates the probe sequence
+		 */
+		if( name_hash_table->values[ slot_index ] == -1 )
+		{
+			break;
+		}
+		if( name_hash_table->hashes[ slot_index ] == name_hash )
+		{
+			*probe_index = safe_index + 1;
+			*value       = name_hash_table->values[ slot_index ];
+
+			return( 1 );
+		}
+	}
+	*probe_index = safe_index;
+
+	return( 0 );
+}
+
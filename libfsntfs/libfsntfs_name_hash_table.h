@@ -0,0 +1,90 @@
+/*
+ * Name hash table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_NAME_HASH_TABLE_H )
+#define _LIBFSNTFS_NAME_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of slots of the name hash table, must be a power of 2
+ */
+#define LIBFSNTFS_NAME_HASH_TABLE_MINIMUM_NUMBER_OF_SLOTS	16
+
+typedef struct libfsntfs_name_hash_table libfsntfs_name_hash_table_t;
+
+struct libfsntfs_name_hash_table
+{
+	/* The name hashes
+	 */
+	uint32_t *hashes;
+
+	/* The values, where -1 represents an unused slot
+	 */
+	int *values;
+
+	/* The number of slots
+	 */
+	uint32_t number_of_slots;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The maximum number of values
+	 */
+	int maximum_number_of_values;
+};
+
+int libfsntfs_name_hash_table_initialize(
+     libfsntfs_name_hash_table_t **name_hash_table,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libfsntfs_name_hash_table_free(
+     libfsntfs_name_hash_table_t **name_hash_table,
+     libcerror_error_t **error );
+
+int libfsntfs_name_hash_table_insert_value(
+     libfsntfs_name_hash_table_t *name_hash_table,
+     uint32_t name_hash,
+     int value,
+     libcerror_error_t **error );
+
+int libfsntfs_name_hash_table_get_next_value_by_hash(
+     libfsntfs_name_hash_table_t *name_hash_table,
+     uint32_t name_hash,
+     uint32_t *probe_index,
+     int *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_NAME_HASH_TABLE_H ) */
+
@@ -0,0 +1,963 @@
+/*
+ * Path component cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#endif
+
+#include "libfsntfs_directory_entry.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+#include "libfsntfs_libuna.h"
+#include "libfsntfs_name.h"
+#include "libfsntfs_path_cache.h"
+
+/* Sets the path cache key from a parent file reference and an UTF-8 encoded name
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * The name is case folded, hence the key should only be used for directories that use case folding
+ * Returns 1 if successful, 0 if the name is too long to be cached or -1 on error
+ */
+int libfsntfs_path_cache_key_set_utf8_name(
+     libfsntfs_path_cache_key_t *path_cache_key,
+     uint64_t parent_file_reference,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfsntfs_path_cache_key_set_utf8_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	size_t name_length                           = 0;
+	uint32_t name_hash                           = LIBFSNTFS_NAME_HASH_INITIAL_VALUE;
+
+	if( path_cache_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache key.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length >= 1 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length -= 1;
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( name_length >= LIBFSNTFS_PATH_CACHE_MAXIMUM_NAME_LENGTH )
+		{
+			return( 0 );
+		}
+		/* Using RFC 2279 UTF-8 to support unpaired UTF-16 surrogates
+		 */
+		if( libuna_unicode_character_copy_from_utf8_rfc2279(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 RFC 2279 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		unicode_character = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+
+		name_hash ^= (uint32_t) unicode_character;
+		name_hash *= LIBFSNTFS_NAME_HASH_MULTIPLIER;
+
+		path_cache_key->name[ name_length++ ] = unicode_character;
+	}
+	path_cache_key->parent_file_reference = parent_file_reference;
+	path_cache_key->name_hash             = name_hash;
+	path_cache_key->name_length           = name_length;
+
+	return( 1 );
+}
+
+/* Sets the path cache key from a parent file reference and an UTF-16 encoded name
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
+ * The name is case folded, hence the key should only be used for directories that use case folding
+ * Returns 1 if successful, 0 if the name is too long to be cached or -1 on error
+ */
+int libfsntfs_path_cache_key_set_utf16_name(
+     libfsntfs_path_cache_key_t *path_cache_key,
+     uint64_t parent_file_reference,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfsntfs_path_cache_key_set_utf16_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	size_t name_length                           = 0;
+	uint32_t name_hash                           = LIBFSNTFS_NAME_HASH_INITIAL_VALUE;
+
+	if( path_cache_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache key.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_string_length >= 1 )
+	 && ( utf16_string[ utf16_string_length - 1 ] == 0 ) )
+	{
+		utf16_string_length -= 1;
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( name_length >= LIBFSNTFS_PATH_CACHE_MAXIMUM_NAME_LENGTH )
+		{
+			return( 0 );
+		}
+		/* Using UCS-2 to support unpaired UTF-16 surrogates
+		 */
+		if( libuna_unicode_character_copy_from_ucs2(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UCS-2 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		unicode_character = (libuna_unicode_character_t) towupper( (wint_t) unicode_character );
+
+		name_hash ^= (uint32_t) unicode_character;
+		name_hash *= LIBFSNTFS_NAME_HASH_MULTIPLIER;
+
+		path_cache_key->name[ name_length++ ] = unicode_character;
+	}
+	path_cache_key->parent_file_reference = parent_file_reference;
+	path_cache_key->name_hash             = name_hash;
+	path_cache_key->name_length           = name_length;
+
+	return( 1 );
+}
+
+/* Creates a path cache
+ * Make sure the value path_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_path_cache_initialize(
+     libfsntfs_path_cache_t **path_cache,
+     int maximum_number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_path_cache_initialize";
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_values <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of values value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*path_cache = memory_allocate_structure(
+	               libfsntfs_path_cache_t );
+
+	if( *path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_cache,
+	     0,
+	     sizeof( libfsntfs_path_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path cache.",
+		 function );
+
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *path_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *path_cache )->maximum_number_of_values = maximum_number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( *path_cache != NULL )
+	{
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_path_cache_free(
+     libfsntfs_path_cache_t **path_cache,
+     libcerror_error_t **error )
+{
+	libfsntfs_path_cache_value_t *cache_value = NULL;
+	static char *function                     = "libfsntfs_path_cache_free";
+	int result                                = 1;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		while( ( *path_cache )->first_value != NULL )
+		{
+			cache_value = ( *path_cache )->first_value;
+
+			( *path_cache )->first_value = cache_value->next_value;
+
+			if( cache_value->directory_entry != NULL )
+			{
+				if( libfsntfs_directory_entry_free(
+				     &( cache_value->directory_entry ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory entry.",
+					 function );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 cache_value->name );
+
+			memory_free(
+			 cache_value );
+		}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *path_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( result );
+}
+
+/* Removes the least recently used value from the path cache
+ * Returns 1 if successful, 0 if the cache is empty or -1 on error
+ */
+int libfsntfs_path_cache_remove_last_value(
+     libfsntfs_path_cache_t *path_cache,
+     libcerror_error_t **error )
+{
+	libfsntfs_path_cache_value_t *bucket_value = NULL;
+	libfsntfs_path_cache_value_t *cache_value  = NULL;
+	static char *function                      = "libfsntfs_path_cache_remove_last_value";
+	uint32_t bucket_index                      = 0;
+	int result                                 = 1;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	cache_value = path_cache->last_value;
+
+	if( cache_value == NULL )
+	{
+		return( 0 );
+	}
+	bucket_index = ( cache_value->name_hash ^ (uint32_t) ( ( cache_value->parent_file_reference * 0x9e3779b97f4a7c15ULL ) >> 32 ) ) % LIBFSNTFS_PATH_CACHE_NUMBER_OF_BUCKETS;
+
+	bucket_value = path_cache->buckets[ bucket_index ];
+
+	if( bucket_value == cache_value )
+	{
+		path_cache->buckets[ bucket_index ] = cache_value->next_in_bucket;
+	}
+	else
+	{
+		while( ( bucket_value != NULL )
+		    && ( bucket_value->next_in_bucket != cache_value ) )
+		{
+			bucket_value = bucket_value->next_in_bucket;
+		}
+		if( bucket_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid path cache - missing value in bucket: %" PRIu32 ".",
+			 function,
+			 bucket_index );
+
+			return( -1 );
+		}
+		bucket_value->next_in_bucket = cache_value->next_in_bucket;
+	}
+	path_cache->last_value = cache_value->previous_value;
+
+	if( path_cache->last_value != NULL )
+	{
+		path_cache->last_value->next_value = NULL;
+	}
+	else
+	{
+		path_cache->first_value = NULL;
+	}
+	path_cache->number_of_values -= 1;
+
+	if( cache_value->directory_entry != NULL )
+	{
+		if( libfsntfs_directory_entry_free(
+		     &( cache_value->directory_entry ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 cache_value->name );
+
+	memory_free(
+	 cache_value );
+
+	return( result );
+}
+
+/* Empties a path cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_path_cache_empty(
+     libfsntfs_path_cache_t *path_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_path_cache_empty";
+	int result            = 1;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( path_cache->last_value != NULL )
+	{
+		if( libfsntfs_path_cache_remove_last_value(
+		     path_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last value.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a copy of the directory entry of a specific path cache key
+ * The cached value is marked as most recently used
+ * If the name was cached as not existing directory_entry is not set
+ * Returns 1 if the name was cached, 0 if not or -1 on error
+ */
+int libfsntfs_path_cache_get_directory_entry(
+     libfsntfs_path_cache_t *path_cache,
+     libfsntfs_path_cache_key_t *path_cache_key,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_path_cache_value_t *cache_value = NULL;
+	static char *function                     = "libfsntfs_path_cache_get_directory_entry";
+	uint32_t bucket_index                     = 0;
+	int result                                = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_cache_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache key.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = ( path_cache_key->name_hash ^ (uint32_t) ( ( path_cache_key->parent_file_reference * 0x9e3779b97f4a7c15ULL ) >> 32 ) ) % LIBFSNTFS_PATH_CACHE_NUMBER_OF_BUCKETS;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_value = path_cache->buckets[ bucket_index ];
+
+	while( cache_value != NULL )
+	{
+		if( ( cache_value->parent_file_reference == path_cache_key->parent_file_reference )
+		 && ( cache_value->name_hash == path_cache_key->name_hash )
+		 && ( cache_value->name_length == path_cache_key->name_length )
+		 && ( memory_compare(
+		       cache_value->name,
+		       path_cache_key->name,
+		       sizeof( libuna_unicode_character_t ) * cache_value->name_length ) == 0 ) )
+		{
+			break;
+		}
+		cache_value = cache_value->next_in_bucket;
+	}
+	if( cache_value != NULL )
+	{
+		if( cache_value != path_cache->first_value )
+		{
+			cache_value->previous_value->next_value = cache_value->next_value;
+
+			if( cache_value->next_value != NULL )
+			{
+				cache_value->next_value->previous_value = cache_value->previous_value;
+			}
+			else
+			{
+				path_cache->last_value = cache_value->previous_value;
+			}
+			cache_value->previous_value = NULL;
+			cache_value->next_value     = path_cache->first_value;
+
+			path_cache->first_value->previous_value = cache_value;
+			path_cache->first_value                 = cache_value;
+		}
+		result = 1;
+
+		if( cache_value->directory_entry != NULL )
+		{
+			if( libfsntfs_directory_entry_clone(
+			     directory_entry,
+			     cache_value->directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( *directory_entry != NULL )
+		{
+			libfsntfs_directory_entry_free(
+			 directory_entry,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Stores a copy of the directory entry of a specific path cache key
+ * A directory entry of NULL indicates that the name does not exist
+ * The least recently used values are removed when the maximum number of values is exceeded
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_path_cache_set_directory_entry(
+     libfsntfs_path_cache_t *path_cache,
+     libfsntfs_path_cache_key_t *path_cache_key,
+     libfsntfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_path_cache_value_t *cache_value = NULL;
+	static char *function                     = "libfsntfs_path_cache_set_directory_entry";
+	uint32_t bucket_index                     = 0;
+	int result                                = 1;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_cache_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_cache_key->name_length == 0 )
+	 || ( path_cache_key->name_length > LIBFSNTFS_PATH_CACHE_MAXIMUM_NAME_LENGTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path cache key - name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = ( path_cache_key->name_hash ^ (uint32_t) ( ( path_cache_key->parent_file_reference * 0x9e3779b97f4a7c15ULL ) >> 32 ) ) % LIBFSNTFS_PATH_CACHE_NUMBER_OF_BUCKETS;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_value = path_cache->buckets[ bucket_index ];
+
+	while( cache_value != NULL )
+	{
+		if( ( cache_value->parent_file_reference == path_cache_key->parent_file_reference )
+		 && ( cache_value->name_hash == path_cache_key->name_hash )
+		 && ( cache_value->name_length == path_cache_key->name_length )
+		 && ( memory_compare(
+		       cache_value->name,
+		       path_cache_key->name,
+		       sizeof( libuna_unicode_character_t ) * cache_value->name_length ) == 0 ) )
+		{
+			break;
+		}
+		cache_value = cache_value->next_in_bucket;
+	}
+	/* Another thread could have stored the same name in the meantime
+	 */
+	if( cache_value == NULL )
+	{
+		cache_value = memory_allocate_structure(
+		               libfsntfs_path_cache_value_t );
+
+		if( cache_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create cache value.",
+			 function );
+
+			result = -1;
+		}
+		else if( memory_set(
+		          cache_value,
+		          0,
+		          sizeof( libfsntfs_path_cache_value_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear cache value.",
+			 function );
+
+			memory_free(
+			 cache_value );
+
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			cache_value->name = (libuna_unicode_character_t *) memory_allocate(
+			                                                    sizeof( libuna_unicode_character_t ) * path_cache_key->name_length );
+
+			if( cache_value->name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create cache value name.",
+				 function );
+
+				result = -1;
+			}
+			else if( memory_copy(
+			          cache_value->name,
+			          path_cache_key->name,
+			          sizeof( libuna_unicode_character_t ) * path_cache_key->name_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy cache value name.",
+				 function );
+
+				result = -1;
+			}
+			else if( libfsntfs_directory_entry_clone(
+			          &( cache_value->directory_entry ),
+			          directory_entry,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entry.",
+				 function );
+
+				result = -1;
+			}
+			if( result != 1 )
+			{
+				if( cache_value->name != NULL )
+				{
+					memory_free(
+					 cache_value->name );
+				}
+				memory_free(
+				 cache_value );
+			}
+		}
+		if( result == 1 )
+		{
+			cache_value->parent_file_reference = path_cache_key->parent_file_reference;
+			cache_value->name_hash             = path_cache_key->name_hash;
+			cache_value->name_length           = path_cache_key->name_length;
+			cache_value->next_in_bucket        = path_cache->buckets[ bucket_index ];
+			cache_value->next_value            = path_cache->first_value;
+
+			path_cache->buckets[ bucket_index ] = cache_value;
+
+			if( path_cache->first_value != NULL )
+			{
+				path_cache->first_value->previous_value = cache_value;
+			}
+			else
+			{
+				path_cache->last_value = cache_value;
+			}
+			path_cache->first_value       = cache_value;
+			path_cache->number_of_values += 1;
+
+			while( path_cache->number_of_values > path_cache->maximum_number_of_values )
+			{
+				if( libfsntfs_path_cache_remove_last_value(
+				     path_cache,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove last value.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+			}
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     path_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
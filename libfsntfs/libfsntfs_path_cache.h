@@ -0,0 +1,187 @@
+/*
+ * Path component cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_PATH_CACHE_H )
+#define _LIBFSNTFS_PATH_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_directory_entry.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
+#include "libfsntfs_libuna.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of buckets of the path cache, must be a power of 2
+ */
+#define LIBFSNTFS_PATH_CACHE_NUMBER_OF_BUCKETS			4096
+
+/* The maximum number of values of the path cache
+ */
+#define LIBFSNTFS_PATH_CACHE_MAXIMUM_NUMBER_OF_VALUES		16384
+
+/* The maximum number of characters of a path component name,
+ * a NTFS file name consists of at most 255 UTF-16 characters
+ */
+#define LIBFSNTFS_PATH_CACHE_MAXIMUM_NAME_LENGTH		255
+
+typedef struct libfsntfs_path_cache_key libfsntfs_path_cache_key_t;
+
+struct libfsntfs_path_cache_key
+{
+	/* The file reference of the parent directory
+	 */
+	uint64_t parent_file_reference;
+
+	/* The hash of the case folded name
+	 */
+	uint32_t name_hash;
+
+	/* The case folded name
+	 */
+	libuna_unicode_character_t name[ LIBFSNTFS_PATH_CACHE_MAXIMUM_NAME_LENGTH ];
+
+	/* The name length
+	 */
+	size_t name_length;
+};
+
+typedef struct libfsntfs_path_cache_value libfsntfs_path_cache_value_t;
+
+struct libfsntfs_path_cache_value
+{
+	/* The file reference of the parent directory
+	 */
+	uint64_t parent_file_reference;
+
+	/* The hash of the case folded name
+	 */
+	uint32_t name_hash;
+
+	/* The case folded name
+	 */
+	libuna_unicode_character_t *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The directory entry, which is NULL if the name does not exist
+	 */
+	libfsntfs_directory_entry_t *directory_entry;
+
+	/* The next value in the same bucket
+	 */
+	libfsntfs_path_cache_value_t *next_in_bucket;
+
+	/* The previous (more recently used) value
+	 */
+	libfsntfs_path_cache_value_t *previous_value;
+
+	/* The next (less recently used) value
+	 */
+	libfsntfs_path_cache_value_t *next_value;
+};
+
+typedef struct libfsntfs_path_cache libfsntfs_path_cache_t;
+
+struct libfsntfs_path_cache
+{
+	/* The buckets
+	 */
+	libfsntfs_path_cache_value_t *buckets[ LIBFSNTFS_PATH_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The most recently used value
+	 */
+	libfsntfs_path_cache_value_t *first_value;
+
+	/* The least recently used value
+	 */
+	libfsntfs_path_cache_value_t *last_value;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The maximum number of values
+	 */
+	int maximum_number_of_values;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsntfs_path_cache_key_set_utf8_name(
+     libfsntfs_path_cache_key_t *path_cache_key,
+     uint64_t parent_file_reference,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libfsntfs_path_cache_key_set_utf16_name(
+     libfsntfs_path_cache_key_t *path_cache_key,
+     uint64_t parent_file_reference,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libfsntfs_path_cache_initialize(
+     libfsntfs_path_cache_t **path_cache,
+     int maximum_number_of_values,
+     libcerror_error_t **error );
+
+int libfsntfs_path_cache_free(
+     libfsntfs_path_cache_t **path_cache,
+     libcerror_error_t **error );
+
+int libfsntfs_path_cache_remove_last_value(
+     libfsntfs_path_cache_t *path_cache,
+     libcerror_error_t **error );
+
+int libfsntfs_path_cache_empty(
+     libfsntfs_path_cache_t *path_cache,
+     libcerror_error_t **error );
+
+int libfsntfs_path_cache_get_directory_entry(
+     libfsntfs_path_cache_t *path_cache,
+     libfsntfs_path_cache_key_t *path_cache_key,
+     libfsntfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsntfs_path_cache_set_directory_entry(
+     libfsntfs_path_cache_t *path_cache,
+     libfsntfs_path_cache_key_t *path_cache_key,
+     libfsntfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_PATH_CACHE_H ) */
+
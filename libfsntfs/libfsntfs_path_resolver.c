@@ -0,0 +1,744 @@
+/*
+ * Batched path resolution functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsntfs_definitions.h"
+#include "libfsntfs_directory_entries_tree.h"
+#include "libfsntfs_directory_entry.h"
+#include "libfsntfs_file_system.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_mft_entry.h"
+#include "libfsntfs_path_resolver.h"
+
+/* Compares two paths
+ * The paths are ordered by their UTF-8 string, so that paths that share
+ * a parent directory are adjacent, and otherwise by their index in the input
+ * Returns -1 if the first path is less than the second, 0 if equal or 1 if greater
+ */
+int libfsntfs_path_resolver_path_compare(
+     const void *first_path,
+     const void *second_path )
+{
+	const libfsntfs_path_resolver_path_t *first_resolver_path  = NULL;
+	const libfsntfs_path_resolver_path_t *second_resolver_path = NULL;
+	size_t compare_length                                      = 0;
+	int result                                                 = 0;
+
+	first_resolver_path  = (const libfsntfs_path_resolver_path_t *) first_path;
+	second_resolver_path = (const libfsntfs_path_resolver_path_t *) second_path;
+
+	compare_length = first_resolver_path->utf8_string_length;
+
+	if( compare_length > second_resolver_path->utf8_string_length )
+	{
+		compare_length = second_resolver_path->utf8_string_length;
+	}
+	if( compare_length > 0 )
+	{
+		result = memory_compare(
+		          first_resolver_path->utf8_string,
+		          second_resolver_path->utf8_string,
+		          compare_length );
+
+		if( result < 0 )
+		{
+			return( -1 );
+		}
+		else if( result > 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( first_resolver_path->utf8_string_length < second_resolver_path->utf8_string_length )
+	{
+		return( -1 );
+	}
+	else if( first_resolver_path->utf8_string_length > second_resolver_path->utf8_string_length )
+	{
+		return( 1 );
+	}
+	if( first_resolver_path->path_index < second_resolver_path->path_index )
+	{
+		return( -1 );
+	}
+	else if( first_resolver_path->path_index > second_resolver_path->path_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the length of the path segment that starts at a specific index in an UTF-8 encoded path
+ * The path segment is terminated by a separator or the end of the string
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_path_resolver_get_utf8_path_segment(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     size_t utf8_string_index,
+     size_t *utf8_segment_length,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsntfs_path_resolver_get_utf8_path_segment";
+	size_t safe_string_index = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index > utf8_string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_segment_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 segment length.",
+		 function );
+
+		return( -1 );
+	}
+	/* The separator cannot be part of a multi-byte UTF-8 sequence
+	 * hence the string can be scanned byte by byte
+	 */
+	for( safe_string_index = utf8_string_index;
+	     safe_string_index < utf8_string_length;
+	     safe_string_index++ )
+	{
+		if( utf8_string[ safe_string_index ] == (uint8_t) LIBFSNTFS_SEPARATOR )
+		{
+			break;
+		}
+	}
+	*utf8_segment_length = safe_string_index - utf8_string_index;
+
+	return( 1 );
+}
+
+/* Resolves multiple UTF-8 encoded paths to file references
+ * The paths are sorted so that the $I30 index of a directory shared by several paths is read only once
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * results[ path_index ] is set to 1 if the corresponding path was found or 0 if not
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_path_resolver_resolve_utf8_paths(
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_file_system_t *file_system,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     uint64_t *file_references,
+     int *results,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_mft_entry_t *mft_entry             = NULL;
+	libfsntfs_path_resolver_level_t *levels      = NULL;
+	libfsntfs_path_resolver_level_t *level       = NULL;
+	libfsntfs_path_resolver_path_t *paths        = NULL;
+	const uint8_t *utf8_string                   = NULL;
+	void *reallocation                           = NULL;
+	static char *function                        = "libfsntfs_path_resolver_resolve_utf8_paths";
+	size_t segment_length                        = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf8_string_length                    = 0;
+	uint64_t file_reference                      = 0;
+	uint64_t mft_entry_index                     = 0;
+	int depth                                    = 0;
+	int level_index                              = 0;
+	int maximum_number_of_levels                 = 0;
+	int path_index                               = 0;
+	int result                                   = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsntfs_path_resolver_path_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file references.",
+		 function );
+
+		return( -1 );
+	}
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths == 0 )
+	{
+		return( 1 );
+	}
+	paths = (libfsntfs_path_resolver_path_t *) memory_allocate(
+	                                            sizeof( libfsntfs_path_resolver_path_t ) * number_of_paths );
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create paths.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		utf8_string        = utf8_strings[ path_index ];
+		utf8_string_length = utf8_string_lengths[ path_index ];
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string: %d.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		if( utf8_string_length > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string: %d length value exceeds maximum.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		/* The path ends at the first end-of-string character
+		 */
+		for( utf8_string_index = 0;
+		     utf8_string_index < utf8_string_length;
+		     utf8_string_index++ )
+		{
+			if( utf8_string[ utf8_string_index ] == 0 )
+			{
+				break;
+			}
+		}
+		paths[ path_index ].utf8_string        = utf8_string;
+		paths[ path_index ].utf8_string_length = utf8_string_index;
+		paths[ path_index ].path_index         = path_index;
+	}
+	qsort(
+	 paths,
+	 (size_t) number_of_paths,
+	 sizeof( libfsntfs_path_resolver_path_t ),
+	 &libfsntfs_path_resolver_path_compare );
+
+	levels = (libfsntfs_path_resolver_level_t *) memory_allocate(
+	                                              sizeof( libfsntfs_path_resolver_level_t ) * LIBFSNTFS_PATH_RESOLVER_INITIAL_NUMBER_OF_LEVELS );
+
+	if( levels == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create levels.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_number_of_levels = LIBFSNTFS_PATH_RESOLVER_INITIAL_NUMBER_OF_LEVELS;
+
+	if( memory_set(
+	     levels,
+	     0,
+	     sizeof( libfsntfs_path_resolver_level_t ) * maximum_number_of_levels ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear levels.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_file_system_get_mft_entry_by_index(
+	     file_system,
+	     file_io_handle,
+	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
+	     &mft_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MFT entry: 5.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsntfs_mft_entry_get_file_reference(
+	     mft_entry,
+	     &file_reference,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory file reference.",
+		 function );
+
+		goto on_error;
+	}
+	levels[ 0 ].mft_entry_index = LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY;
+	levels[ 0 ].file_reference  = file_reference;
+
+	/* Walk the sorted paths as a prefix tree, where levels contains
+	 * the directories of the path segments shared with the previous path
+	 */
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		utf8_string        = paths[ path_index ].utf8_string;
+		utf8_string_length = paths[ path_index ].utf8_string_length;
+		utf8_string_index  = 0;
+		level_index        = 0;
+		result             = 1;
+
+		/* Ignore a leading separator
+		 */
+		if( ( utf8_string_length > 0 )
+		 && ( utf8_string[ 0 ] == (uint8_t) LIBFSNTFS_SEPARATOR ) )
+		{
+			utf8_string_index++;
+		}
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( libfsntfs_path_resolver_get_utf8_path_segment(
+			     utf8_string,
+			     utf8_string_length,
+			     utf8_string_index,
+			     &segment_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve path segment.",
+				 function );
+
+				goto on_error;
+			}
+			if( segment_length == 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			level_index++;
+
+			if( level_index <= depth )
+			{
+				level = &( levels[ level_index ] );
+
+				if( ( level->segment_length == segment_length )
+				 && ( memory_compare(
+				       level->segment,
+				       &( utf8_string[ utf8_string_index ] ),
+				       segment_length ) == 0 ) )
+				{
+					utf8_string_index += segment_length + 1;
+
+					continue;
+				}
+				/* The path diverges from the previous path at this level
+				 */
+				while( depth >= level_index )
+				{
+					if( levels[ depth ].directory_entries_tree != NULL )
+					{
+						if( libfsntfs_directory_entries_tree_free(
+						     &( levels[ depth ].directory_entries_tree ),
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+							 "%s: unable to free directory entries tree: %d.",
+							 function,
+							 depth );
+
+							goto on_error;
+						}
+					}
+					depth--;
+				}
+			}
+			level = &( levels[ depth ] );
+
+			if( level->directory_entries_tree == NULL )
+			{
+				if( libfsntfs_file_system_get_mft_entry_by_index(
+				     file_system,
+				     file_io_handle,
+				     level->mft_entry_index,
+				     &mft_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve MFT entry: %" PRIu64 ".",
+					 function,
+					 level->mft_entry_index );
+
+					goto on_error;
+				}
+				/* Only directories can contain the next path segment
+				 */
+				if( mft_entry->has_i30_index == 0 )
+				{
+					result = 0;
+
+					break;
+				}
+				if( libfsntfs_directory_entries_tree_initialize(
+				     &( level->directory_entries_tree ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create directory entries tree.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfsntfs_directory_entries_tree_read_from_i30_index(
+				     level->directory_entries_tree,
+				     io_handle,
+				     file_io_handle,
+				     mft_entry,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
+					 function,
+					 level->mft_entry_index );
+
+					goto on_error;
+				}
+			}
+			result = libfsntfs_directory_entries_tree_get_entry_by_utf8_name(
+			          level->directory_entries_tree,
+			          file_io_handle,
+			          &( utf8_string[ utf8_string_index ] ),
+			          segment_length,
+			          &directory_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry by UTF-8 name.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libfsntfs_directory_entry_get_mft_entry_index(
+			     directory_entry,
+			     &mft_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve MFT entry index.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_directory_entry_get_file_reference(
+			     directory_entry,
+			     &file_reference,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file reference.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_directory_entry_free(
+			     &directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( depth + 1 ) >= maximum_number_of_levels )
+			{
+				if( maximum_number_of_levels > ( INT_MAX / 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid maximum number of levels value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				reallocation = memory_reallocate(
+				                levels,
+				                sizeof( libfsntfs_path_resolver_level_t ) * maximum_number_of_levels * 2 );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize levels.",
+					 function );
+
+					goto on_error;
+				}
+				levels = (libfsntfs_path_resolver_level_t *) reallocation;
+
+				if( memory_set(
+				     &( levels[ maximum_number_of_levels ] ),
+				     0,
+				     sizeof( libfsntfs_path_resolver_level_t ) * maximum_number_of_levels ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear levels.",
+					 function );
+
+					goto on_error;
+				}
+				maximum_number_of_levels *= 2;
+			}
+			depth++;
+
+			level = &( levels[ depth ] );
+
+			level->segment                = &( utf8_string[ utf8_string_index ] );
+			level->segment_length         = segment_length;
+			level->mft_entry_index        = mft_entry_index;
+			level->file_reference         = file_reference;
+			level->directory_entries_tree = NULL;
+
+			utf8_string_index += segment_length + 1;
+		}
+		if( result != 0 )
+		{
+			file_references[ paths[ path_index ].path_index ] = levels[ level_index ].file_reference;
+		}
+		else
+		{
+			file_references[ paths[ path_index ].path_index ] = 0;
+		}
+		results[ paths[ path_index ].path_index ] = result;
+	}
+	while( depth >= 0 )
+	{
+		if( levels[ depth ].directory_entries_tree != NULL )
+		{
+			if( libfsntfs_directory_entries_tree_free(
+			     &( levels[ depth ].directory_entries_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entries tree: %d.",
+				 function,
+				 depth );
+
+				goto on_error;
+			}
+		}
+		depth--;
+	}
+	memory_free(
+	 levels );
+
+	memory_free(
+	 paths );
+
+	return( 1 );
+
+on_error:
+	if( directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( levels != NULL )
+	{
+		while( depth >= 0 )
+		{
+			if( levels[ depth ].directory_entries_tree != NULL )
+			{
+				libfsntfs_directory_entries_tree_free(
+				 &( levels[ depth ].directory_entries_tree ),
+				 NULL );
+			}
+			depth--;
+		}
+		memory_free(
+		 levels );
+	}
+	if( paths != NULL )
+	{
+		memory_free(
+		 paths );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,111 @@
+/*
+ * Batched path resolution functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_PATH_RESOLVER_H )
+#define _LIBFSNTFS_PATH_RESOLVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_directory_entries_tree.h"
+#include "libfsntfs_file_system.h"
+#include "libfsntfs_io_handle.h"
+#include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of directory levels of the path resolver
+ */
+#define LIBFSNTFS_PATH_RESOLVER_INITIAL_NUMBER_OF_LEVELS	16
+
+typedef struct libfsntfs_path_resolver_path libfsntfs_path_resolver_path_t;
+
+struct libfsntfs_path_resolver_path
+{
+	/* The UTF-8 string
+	 */
+	const uint8_t *utf8_string;
+
+	/* The UTF-8 string length
+	 */
+	size_t utf8_string_length;
+
+	/* The index of the path in the input
+	 */
+	int path_index;
+};
+
+typedef struct libfsntfs_path_resolver_level libfsntfs_path_resolver_level_t;
+
+struct libfsntfs_path_resolver_level
+{
+	/* The name segment
+	 */
+	const uint8_t *segment;
+
+	/* The name segment length
+	 */
+	size_t segment_length;
+
+	/* The MFT entry index
+	 */
+	uint64_t mft_entry_index;
+
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The directory entries tree, which is read on first use
+	 */
+	libfsntfs_directory_entries_tree_t *directory_entries_tree;
+};
+
+int libfsntfs_path_resolver_path_compare(
+     const void *first_path,
+     const void *second_path );
+
+int libfsntfs_path_resolver_get_utf8_path_segment(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     size_t utf8_string_index,
+     size_t *utf8_segment_length,
+     libcerror_error_t **error );
+
+int libfsntfs_path_resolver_resolve_utf8_paths(
+     libfsntfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsntfs_file_system_t *file_system,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     uint64_t *file_references,
+     int *results,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_PATH_RESOLVER_H ) */
+
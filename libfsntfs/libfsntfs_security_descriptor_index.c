@@ -33,6 +33,7 @@
 #include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
+#include "libfsntfs_libcthreads.h"
 #include "libfsntfs_mft_attribute.h"
 #include "libfsntfs_mft_entry.h"
 #include "libfsntfs_security_descriptor_index.h"
@@ -139,11 +140,53 @@ int libfsntfs_security_descriptor_index_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_btree_initialize(
+	     &( ( *security_descriptor_index )->security_descriptor_values_tree ),
+	     LIBFSNTFS_INDEX_TREE_MAXIMUM_NUMBER_OF_SUB_NODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security descriptor values B-tree.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *security_descriptor_index )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *security_descriptor_index != NULL )
 	{
+		if( ( *security_descriptor_index )->security_descriptor_values_tree != NULL )
+		{
+			libcdata_btree_free(
+			 &( ( *security_descriptor_index )->security_descriptor_values_tree ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_security_descriptor_values_free,
+			 NULL );
+		}
+		if( ( *security_descriptor_index )->data_stream != NULL )
+		{
+			libfsntfs_data_stream_free(
+			 &( ( *security_descriptor_index )->data_stream ),
+			 NULL );
+		}
 		memory_free(
 		 *security_descriptor_index );
 
@@ -175,6 +218,21 @@ int libfsntfs_security_descriptor_index_free(
 	}
 	if( *security_descriptor_index != NULL )
 	{
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *security_descriptor_index )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		if( ( *security_descriptor_index )->sii_index != NULL )
 		{
 			if( libfsntfs_index_free(
@@ -204,6 +262,20 @@ int libfsntfs_security_descriptor_index_free(
 
 			result = -1;
 		}
+		if( libcdata_btree_free(
+		     &( ( *security_descriptor_index )->security_descriptor_values_tree ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsntfs_security_descriptor_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free security descriptor values B-tree.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *security_descriptor_index );
 
@@ -662,6 +734,20 @@ int libfsntfs_security_descriptor_index_get_entry_from_index_node_by_identifier(
 		}
 /* TODO check index values against secure_index_value */
 
+		if( libfsntfs_sds_index_value_free(
+		     &sds_index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free $SDS index value.",
+			 function );
+
+			goto on_error;
+		}
+
 		if( libfsntfs_security_descriptor_values_initialize(
 		     &safe_security_descriptor_values,
 		     error ) != 1 )
@@ -753,6 +839,21 @@ int libfsntfs_security_descriptor_index_get_entry_from_index_node_by_identifier(
 
 			goto on_error;
 		}
+		safe_security_descriptor_values->identifier = security_descriptor_index_value->identifier;
+
+		if( libfsntfs_security_descriptor_index_value_free(
+		     &security_descriptor_index_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free security descriptor index value.",
+			 function );
+
+			goto on_error;
+		}
 		*security_descriptor_values = safe_security_descriptor_values;
 
 		result = 1;
@@ -784,7 +885,7 @@ int libfsntfs_security_descriptor_index_get_entry_from_index_node_by_identifier(
 		result = libfsntfs_security_descriptor_index_get_entry_from_index_node_by_identifier(
 		          security_descriptor_index,
 		          file_io_handle,
-		          security_descriptor_index->sii_index->root_node,
+		          sub_node,
 		          security_descriptor_identifier,
 		          security_descriptor_values,
 		          recursion_depth + 1,
@@ -813,6 +914,12 @@ on_error:
 		 &safe_security_descriptor_values,
 		 NULL );
 	}
+	if( sds_index_value != NULL )
+	{
+		libfsntfs_sds_index_value_free(
+		 &sds_index_value,
+		 NULL );
+	}
 	if( security_descriptor_index_value != NULL )
 	{
 		libfsntfs_security_descriptor_index_value_free(
@@ -822,18 +929,128 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the security descriptor for a specific identifier
+/* Retrieves the cached security descriptor for a specific identifier
  * This function creates new security descriptor values
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libfsntfs_security_descriptor_index_get_cached_entry_by_identifier(
+     libfsntfs_security_descriptor_index_t *security_descriptor_index,
+     uint32_t security_descriptor_identifier,
+     libfsntfs_security_descriptor_values_t **security_descriptor_values,
+     libcerror_error_t **error )
+{
+	libfsntfs_security_descriptor_values_t lookup_security_descriptor_values;
+
+	libcdata_tree_node_t *upper_node                                            = NULL;
+	libfsntfs_security_descriptor_values_t *existing_security_descriptor_values = NULL;
+	static char *function                                                       = "libfsntfs_security_descriptor_index_get_cached_entry_by_identifier";
+	int result                                                                  = 0;
+
+	if( security_descriptor_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor index.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &lookup_security_descriptor_values,
+	     0,
+	     sizeof( libfsntfs_security_descriptor_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_security_descriptor_values.identifier = security_descriptor_identifier;
+
+	result = libcdata_btree_get_value_by_value(
+	          security_descriptor_index->security_descriptor_values_tree,
+	          (intptr_t *) &lookup_security_descriptor_values,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libfsntfs_security_descriptor_values_compare_by_identifier,
+	          &upper_node,
+	          (intptr_t **) &existing_security_descriptor_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security descriptor values from tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_security_descriptor_values_clone(
+	     security_descriptor_values,
+	     existing_security_descriptor_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the security descriptor for a specific identifier from the $SII index
+ * and the $SDS data stream
+ * This function creates new security descriptor values and does not use
+ * or modify the cached security descriptors
+ * The read/write lock of the security descriptor index is grabbed for writing
+ * since reading the $SII index modifies its index node cache
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsntfs_security_descriptor_index_get_entry_by_identifier(
+int libfsntfs_security_descriptor_index_read_entry_by_identifier(
      libfsntfs_security_descriptor_index_t *security_descriptor_index,
      libbfio_handle_t *file_io_handle,
      uint32_t security_descriptor_identifier,
      libfsntfs_security_descriptor_values_t **security_descriptor_values,
      libcerror_error_t **error )
 {
-	static char *function = "libfsntfs_security_descriptor_index_get_entry_by_identifier";
+	static char *function = "libfsntfs_security_descriptor_index_read_entry_by_identifier";
 	int result            = 0;
 
 	if( security_descriptor_index == NULL )
@@ -847,6 +1064,32 @@ int libfsntfs_security_descriptor_index_get_entry_by_identifier(
 
 		return( -1 );
 	}
+	if( security_descriptor_index->sii_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor index - missing $SII index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     security_descriptor_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	result = libfsntfs_security_descriptor_index_get_entry_from_index_node_by_identifier(
 	          security_descriptor_index,
 	          file_io_handle,
@@ -864,9 +1107,241 @@ int libfsntfs_security_descriptor_index_get_entry_by_identifier(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve security descriptor by identifier.",
 		 function );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     security_descriptor_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
+		if( *security_descriptor_values != NULL )
+		{
+			libfsntfs_security_descriptor_values_free(
+			 security_descriptor_values,
+			 NULL );
+		}
 		return( -1 );
 	}
+#endif
 	return( result );
 }
 
+/* Inserts read security descriptor values into the cached security descriptors
+ * This function takes over the read security descriptor values, when another
+ * thread cached values with the same identifier in the meantime these are used
+ * and the read security descriptor values are freed
+ * This function creates new security descriptor values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_security_descriptor_index_insert_entry(
+     libfsntfs_security_descriptor_index_t *security_descriptor_index,
+     libfsntfs_security_descriptor_values_t **read_security_descriptor_values,
+     libfsntfs_security_descriptor_values_t **security_descriptor_values,
+     libcerror_error_t **error )
+{
+	libcdata_tree_node_t *upper_node                                            = NULL;
+	libfsntfs_security_descriptor_values_t *existing_security_descriptor_values = NULL;
+	static char *function                                                       = "libfsntfs_security_descriptor_index_insert_entry";
+	int result                                                                  = 0;
+	int value_index                                                             = 0;
+
+	if( security_descriptor_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_security_descriptor_values == NULL )
+	 || ( *read_security_descriptor_values == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcdata_btree_insert_value(
+	          security_descriptor_index->security_descriptor_values_tree,
+	          &value_index,
+	          (intptr_t *) *read_security_descriptor_values,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libfsntfs_security_descriptor_values_compare_by_identifier,
+	          &upper_node,
+	          (intptr_t **) &existing_security_descriptor_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert security descriptor values into tree.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* Another thread could have cached the security descriptor in the meantime
+		 * or the identifier stored in $SDS differs from the one that was looked up
+		 * and the values of that identifier were already cached
+		 */
+		if( libfsntfs_security_descriptor_values_free(
+		     read_security_descriptor_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read security descriptor values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		existing_security_descriptor_values = *read_security_descriptor_values;
+
+		*read_security_descriptor_values = NULL;
+	}
+	if( libfsntfs_security_descriptor_values_clone(
+	     security_descriptor_values,
+	     existing_security_descriptor_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the security descriptor for a specific identifier
+ * This function creates new security descriptor values
+ * The security descriptor is read from the $SDS data stream only the first
+ * time it is retrieved, subsequent retrievals use the cached values
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_security_descriptor_index_get_entry_by_identifier(
+     libfsntfs_security_descriptor_index_t *security_descriptor_index,
+     libbfio_handle_t *file_io_handle,
+     uint32_t security_descriptor_identifier,
+     libfsntfs_security_descriptor_values_t **security_descriptor_values,
+     libcerror_error_t **error )
+{
+	libfsntfs_security_descriptor_values_t *read_security_descriptor_values = NULL;
+	static char *function                                                   = "libfsntfs_security_descriptor_index_get_entry_by_identifier";
+	int result                                                              = 0;
+
+	result = libfsntfs_security_descriptor_index_get_cached_entry_by_identifier(
+	          security_descriptor_index,
+	          security_descriptor_identifier,
+	          security_descriptor_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached security descriptor by identifier.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	result = libfsntfs_security_descriptor_index_read_entry_by_identifier(
+	          security_descriptor_index,
+	          file_io_handle,
+	          security_descriptor_identifier,
+	          &read_security_descriptor_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read security descriptor by identifier.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_security_descriptor_index_insert_entry(
+	     security_descriptor_index,
+	     &read_security_descriptor_values,
+	     security_descriptor_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert security descriptor values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( read_security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 &read_security_descriptor_values,
+		 NULL );
+	}
+	return( -1 );
+}
@@ -30,7 +30,9 @@
 #include "libfsntfs_index_node.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcthreads.h"
 #include "libfsntfs_mft_attribute.h"
 #include "libfsntfs_mft_entry.h"
 #include "libfsntfs_security_descriptor_values.h"
@@ -50,6 +52,17 @@ struct libfsntfs_security_descriptor_index
 	/* The $SDS data stream
 	 */
 	libfsntfs_data_stream_t *data_stream;
+
+	/* The security descriptor values B-tree, that caches the security
+	 * descriptors by identifier so that each is only read once
+	 */
+	libcdata_btree_t *security_descriptor_values_tree;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock, that serializes reads of the $SII index
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsntfs_security_descriptor_index_initialize(
@@ -79,6 +92,25 @@ int libfsntfs_security_descriptor_index_get_entry_from_index_node_by_identifier(
      int recursion_depth,
      libcerror_error_t **error );
 
+int libfsntfs_security_descriptor_index_get_cached_entry_by_identifier(
+     libfsntfs_security_descriptor_index_t *security_descriptor_index,
+     uint32_t security_descriptor_identifier,
+     libfsntfs_security_descriptor_values_t **security_descriptor_values,
+     libcerror_error_t **error );
+
+int libfsntfs_security_descriptor_index_read_entry_by_identifier(
+     libfsntfs_security_descriptor_index_t *security_descriptor_index,
+     libbfio_handle_t *file_io_handle,
+     uint32_t security_descriptor_identifier,
+     libfsntfs_security_descriptor_values_t **security_descriptor_values,
+     libcerror_error_t **error );
+
+int libfsntfs_security_descriptor_index_insert_entry(
+     libfsntfs_security_descriptor_index_t *security_descriptor_index,
+     libfsntfs_security_descriptor_values_t **read_security_descriptor_values,
+     libfsntfs_security_descriptor_values_t **security_descriptor_values,
+     libcerror_error_t **error );
+
 int libfsntfs_security_descriptor_index_get_entry_by_identifier(
      libfsntfs_security_descriptor_index_t *security_descriptor_index,
      libbfio_handle_t *file_io_handle,
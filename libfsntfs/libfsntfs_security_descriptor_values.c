@@ -27,6 +27,7 @@
 #include "libfsntfs_definitions.h"
 #include "libfsntfs_io_handle.h"
 #include "libfsntfs_libbfio.h"
+#include "libfsntfs_libcdata.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
 #include "libfsntfs_libfdata.h"
@@ -142,6 +143,157 @@ int libfsntfs_security_descriptor_values_free(
 	return( 1 );
 }
 
+/* Clones security descriptor values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_security_descriptor_values_clone(
+     libfsntfs_security_descriptor_values_t **destination_security_descriptor_values,
+     libfsntfs_security_descriptor_values_t *source_security_descriptor_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_security_descriptor_values_clone";
+
+	if( destination_security_descriptor_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_security_descriptor_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination security descriptor values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_security_descriptor_values == NULL )
+	{
+		*destination_security_descriptor_values = source_security_descriptor_values;
+
+		return( 1 );
+	}
+	if( source_security_descriptor_values->data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source security descriptor values - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_security_descriptor_values_initialize(
+	     destination_security_descriptor_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination security descriptor values.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_security_descriptor_values->data != NULL )
+	{
+		( *destination_security_descriptor_values )->data = (uint8_t *) memory_allocate(
+		                                                      sizeof( uint8_t ) * source_security_descriptor_values->data_size );
+
+		if( ( *destination_security_descriptor_values )->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_security_descriptor_values )->data,
+		     source_security_descriptor_values->data,
+		     source_security_descriptor_values->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source data to destination.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_security_descriptor_values )->data_size = source_security_descriptor_values->data_size;
+	}
+	( *destination_security_descriptor_values )->identifier = source_security_descriptor_values->identifier;
+
+	return( 1 );
+
+on_error:
+	if( *destination_security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 destination_security_descriptor_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares security descriptor values by their identifier
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsntfs_security_descriptor_values_compare_by_identifier(
+     libfsntfs_security_descriptor_values_t *first_security_descriptor_values,
+     libfsntfs_security_descriptor_values_t *second_security_descriptor_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_security_descriptor_values_compare_by_identifier";
+
+	if( first_security_descriptor_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_security_descriptor_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second security descriptor values.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_security_descriptor_values->identifier < second_security_descriptor_values->identifier )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_security_descriptor_values->identifier > second_security_descriptor_values->identifier )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
 /* Reads the security descriptor values
  * Returns 1 if successful or -1 on error
  */
@@ -46,6 +46,10 @@ struct libfsntfs_security_descriptor_values
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The identifier, as used by the $SII index, or 0 if not set
+	 */
+	uint32_t identifier;
 };
 
 int libfsntfs_security_descriptor_values_initialize(
@@ -56,6 +60,16 @@ int libfsntfs_security_descriptor_values_free(
      libfsntfs_security_descriptor_values_t **security_descriptor_values,
      libcerror_error_t **error );
 
+int libfsntfs_security_descriptor_values_clone(
+     libfsntfs_security_descriptor_values_t **destination_security_descriptor_values,
+     libfsntfs_security_descriptor_values_t *source_security_descriptor_values,
+     libcerror_error_t **error );
+
+int libfsntfs_security_descriptor_values_compare_by_identifier(
+     libfsntfs_security_descriptor_values_t *first_security_descriptor_values,
+     libfsntfs_security_descriptor_values_t *second_security_descriptor_values,
+     libcerror_error_t **error );
+
 int libfsntfs_security_descriptor_values_read_data(
      libfsntfs_security_descriptor_values_t *security_descriptor_values,
      const uint8_t *data,
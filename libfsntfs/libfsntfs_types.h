@@ -37,6 +37,7 @@
 typedef struct libfsntfs_attribute {}			libfsntfs_attribute_t;
 typedef struct libfsntfs_attribute_list_entry {}	libfsntfs_attribute_list_entry_t;
 typedef struct libfsntfs_data_stream {}			libfsntfs_data_stream_t;
+typedef struct libfsntfs_directory_iterator {}		libfsntfs_directory_iterator_t;
 typedef struct libfsntfs_file_entry {}			libfsntfs_file_entry_t;
 typedef struct libfsntfs_mft_metadata_file {}		libfsntfs_mft_metadata_file_t;
 typedef struct libfsntfs_usn_change_journal {}		libfsntfs_usn_change_journal_t;
@@ -46,6 +47,7 @@ typedef struct libfsntfs_volume {}			libfsntfs_volume_t;
 typedef intptr_t libfsntfs_attribute_t;
 typedef intptr_t libfsntfs_attribute_list_entry_t;
 typedef intptr_t libfsntfs_data_stream_t;
+typedef intptr_t libfsntfs_directory_iterator_t;
 typedef intptr_t libfsntfs_file_entry_t;
 typedef intptr_t libfsntfs_mft_metadata_file_t;
 typedef intptr_t libfsntfs_usn_change_journal_t;
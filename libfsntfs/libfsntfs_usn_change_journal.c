@@ -25,14 +25,19 @@
 #include <types.h>
 
 #include "libfsntfs_cluster_block_stream.h"
+#include "libfsntfs_debug.h"
 #include "libfsntfs_definitions.h"
 #include "libfsntfs_file_entry.h"
 #include "libfsntfs_libcerror.h"
 #include "libfsntfs_libcnotify.h"
 #include "libfsntfs_libcthreads.h"
+#include "libfsntfs_libfdatetime.h"
 #include "libfsntfs_mft_attribute.h"
 #include "libfsntfs_types.h"
 #include "libfsntfs_usn_change_journal.h"
+#include "libfsntfs_usn_record_values.h"
+
+#include "fsntfs_usn_change_journal.h"
 
 /* Creates an USN change journal
  * Make sure the value usn_change_journal is referencing, is set to NULL
@@ -207,8 +212,9 @@ int libfsntfs_usn_change_journal_initialize(
 
 		goto on_error;
 	}
-	internal_usn_change_journal->file_io_handle  = file_io_handle;
-	internal_usn_change_journal->directory_entry = directory_entry;
+	internal_usn_change_journal->file_io_handle    = file_io_handle;
+	internal_usn_change_journal->directory_entry   = directory_entry;
+	internal_usn_change_journal->number_of_threads = 1;
 
 	*usn_change_journal = (libfsntfs_usn_change_journal_t *) internal_usn_change_journal;
 
@@ -284,6 +290,16 @@ int libfsntfs_usn_change_journal_free(
 
 			result = -1;
 		}
+		if( internal_usn_change_journal->read_block_data != NULL )
+		{
+			memory_free(
+			 internal_usn_change_journal->read_block_data );
+		}
+		if( internal_usn_change_journal->record_offsets != NULL )
+		{
+			memory_free(
+			 internal_usn_change_journal->record_offsets );
+		}
 		memory_free(
 		 internal_usn_change_journal->journal_block_data );
 
@@ -333,6 +349,336 @@ int libfsntfs_usn_change_journal_get_offset(
 	return( 1 );
 }
 
+/* Retrieves the next update sequence number (USN)
+ * This is the update sequence number of the next USN record that will be added to the journal
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_change_journal_get_next_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     uint64_t *next_update_sequence_number,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_get_next_usn";
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( next_update_sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next update sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	/* USN records are appended to the end of the $J data stream
+	 */
+	*next_update_sequence_number = (uint64_t) internal_usn_change_journal->data_size;
+
+	return( 1 );
+}
+
+/* Reads the USN change journal maximum ($Max) data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_read_max_data(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_usn_change_journal_read_max_data";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit  = 0;
+#endif
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: maximum data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 data_size,
+		 0 );
+	}
+#endif
+	if( data_size < sizeof( fsntfs_usn_change_journal_maximum_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported maximum data size: %" PRIzd "\n",
+		 function,
+		 data_size );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsntfs_usn_change_journal_maximum_t *) data )->journal_identifier,
+	 internal_usn_change_journal->journal_identifier );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsntfs_usn_change_journal_maximum_t *) data )->maximum_size,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: maximum size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsntfs_usn_change_journal_maximum_t *) data )->allocation_delta,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: allocation delta\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		if( libfsntfs_debug_print_filetime_value(
+		     function,
+		     "journal identifier\t\t",
+		     ( (fsntfs_usn_change_journal_maximum_t *) data )->journal_identifier,
+		     8,
+		     LIBFDATETIME_ENDIAN_LITTLE,
+		     LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print FILETIME value.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsntfs_usn_change_journal_maximum_t *) data )->lowest_valid_update_sequence_number,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: lowest valid USN\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	internal_usn_change_journal->has_journal_identifier = 1;
+
+	return( 1 );
+}
+
+/* Reads the USN change journal maximum ($Max) data from an MFT attribute
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_read_max_attribute(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libfsntfs_mft_attribute_t *mft_attribute,
+     libcerror_error_t **error )
+{
+	uint8_t *data           = NULL;
+	static char *function   = "libfsntfs_internal_usn_change_journal_read_max_attribute";
+	size_t data_size        = 0;
+	uint32_t attribute_type = 0;
+	int result              = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_mft_attribute_get_type(
+	     mft_attribute,
+	     &attribute_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type from attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_type != LIBFSNTFS_ATTRIBUTE_TYPE_DATA )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported attribute type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_mft_attribute_data_is_resident(
+	          mft_attribute,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if attribute data is resident.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported non-resident attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_mft_attribute_get_resident_data(
+	     mft_attribute,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resident data from attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_internal_usn_change_journal_read_max_data(
+	     internal_usn_change_journal,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read maximum data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the journal identifier
+ * The journal identifier is stored in the $Max data stream and changes when the journal is
+ * deleted and created again, at which point previously retrieved update sequence numbers
+ * (USN) no longer refer to the same journal
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsntfs_usn_change_journal_get_journal_identifier(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     uint64_t *journal_identifier,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_get_journal_identifier";
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( journal_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_usn_change_journal->has_journal_identifier == 0 )
+	{
+		return( 0 );
+	}
+	*journal_identifier = internal_usn_change_journal->journal_identifier;
+
+	return( 1 );
+}
+
 /* Reads an USN record from the USN change journal
  * Returns the number of bytes read if successful or -1 on error
  */
@@ -631,3 +977,1862 @@ ssize_t libfsntfs_usn_change_journal_read_usn_record(
 	return( (ssize_t) usn_record_size );
 }
 
+/* Reads the block of the $J data stream that contains the offset
+ * The block starts at the journal block that contains the offset and ends at
+ * the end of the (non-sparse) data range that contains the offset
+ * Returns 1 if successful, 0 if the offset is in a sparse range or beyond the data or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_read_block(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_usn_change_journal_read_block";
+	size64_t range_size   = 0;
+	size64_t read_size    = 0;
+	ssize_t read_count    = 0;
+	off64_t block_offset  = 0;
+	off64_t range_end     = 0;
+	off64_t range_offset  = 0;
+	uint32_t range_flags  = 0;
+	int result            = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->journal_block_size == 0 )
+	 || ( ( LIBFSNTFS_USN_CHANGE_JOURNAL_READ_BLOCK_SIZE % internal_usn_change_journal->journal_block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_cluster_block_stream_get_range_at_offset(
+	          internal_usn_change_journal->data_stream,
+	          offset,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $J data stream range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( ( range_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( internal_usn_change_journal->read_block_data == NULL )
+	{
+		internal_usn_change_journal->read_block_data = (uint8_t *) memory_allocate(
+		                                                            sizeof( uint8_t ) * LIBFSNTFS_USN_CHANGE_JOURNAL_READ_BLOCK_SIZE );
+
+		if( internal_usn_change_journal->read_block_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read block data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	block_offset = offset - ( offset % internal_usn_change_journal->journal_block_size );
+
+	/* The data range is extended to the end of its last journal block since
+	 * records do not span journal blocks
+	 */
+	range_end  = range_offset + (off64_t) range_size;
+	range_end += internal_usn_change_journal->journal_block_size - 1;
+	range_end -= range_end % internal_usn_change_journal->journal_block_size;
+
+	if( (size64_t) range_end > internal_usn_change_journal->data_size )
+	{
+		range_end = (off64_t) internal_usn_change_journal->data_size;
+	}
+	read_size = (size64_t) ( range_end - block_offset );
+
+	if( read_size > (size64_t) LIBFSNTFS_USN_CHANGE_JOURNAL_READ_BLOCK_SIZE )
+	{
+		read_size = (size64_t) LIBFSNTFS_USN_CHANGE_JOURNAL_READ_BLOCK_SIZE;
+	}
+	internal_usn_change_journal->read_block_data_size   = 0;
+	internal_usn_change_journal->number_of_parse_ranges = 0;
+
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              internal_usn_change_journal->data_stream,
+	              (intptr_t *) internal_usn_change_journal->file_io_handle,
+	              internal_usn_change_journal->read_block_data,
+	              (size_t) read_size,
+	              block_offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block from $J data stream at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_offset,
+		 block_offset );
+
+		return( -1 );
+	}
+	internal_usn_change_journal->read_block_offset    = block_offset;
+	internal_usn_change_journal->read_block_data_size = (size_t) read_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of threads used to parse the USN change journal
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_change_journal_get_number_of_threads(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_get_number_of_threads";
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_usn_change_journal->number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to parse the USN change journal
+ * The number of threads must be between 1 and LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS.
+ * Without multi-threading support the USN change journal is always parsed by the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_change_journal_set_number_of_threads(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_set_number_of_threads";
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Parses the USN records in a range of the read block
+ * The offsets of the records are stored in the record offsets starting at the first record index.
+ * Since records do not span journal blocks the records can be found from the start of every
+ * journal block. Version 3 and 4 records are skipped, parsing stops at the first unsupported record
+ * Returns 1 if successful, 0 if an unsupported record was found or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_parse_range(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libfsntfs_usn_change_journal_parse_range_t *parse_range,
+     libcerror_error_t **error )
+{
+	libfsntfs_usn_record_values_t usn_record_values;
+
+	static char *function          = "libfsntfs_internal_usn_change_journal_parse_range";
+	size_t available_size          = 0;
+	size_t journal_block_remainder = 0;
+	size_t range_offset            = 0;
+	uint32_t usn_record_size       = 0;
+	int record_index               = 0;
+	int result                     = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->read_block_data == NULL )
+	 || ( internal_usn_change_journal->record_offsets == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid USN change journal - missing read block data or record offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse range.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parse_range->start_offset > parse_range->end_offset )
+	 || ( parse_range->end_offset > internal_usn_change_journal->read_block_data_size )
+	 || ( parse_range->first_record_index < 0 )
+	 || ( (size_t) parse_range->first_record_index != ( parse_range->start_offset / LIBFSNTFS_USN_CHANGE_JOURNAL_MINIMUM_RECORD_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parse range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	parse_range->number_of_records         = 0;
+	parse_range->unsupported_record_offset = 0;
+
+	range_offset = parse_range->start_offset;
+	record_index = parse_range->first_record_index;
+
+	while( range_offset < parse_range->end_offset )
+	{
+		/* The read block starts at a journal block boundary
+		 */
+		journal_block_remainder = internal_usn_change_journal->journal_block_size
+		                        - ( range_offset % internal_usn_change_journal->journal_block_size );
+
+		if( journal_block_remainder < 60 )
+		{
+			range_offset += journal_block_remainder;
+
+			continue;
+		}
+		available_size = internal_usn_change_journal->read_block_data_size - range_offset;
+
+		if( available_size > journal_block_remainder )
+		{
+			available_size = journal_block_remainder;
+		}
+		if( available_size < 4 )
+		{
+			usn_record_size = 0;
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( internal_usn_change_journal->read_block_data[ range_offset ] ),
+			 usn_record_size );
+		}
+		if( usn_record_size == 0 )
+		{
+			/* The remainder of the journal block is unused
+			 */
+			range_offset += journal_block_remainder;
+
+			continue;
+		}
+		result = libfsntfs_usn_record_values_read_data(
+		          &usn_record_values,
+		          &( internal_usn_change_journal->read_block_data[ range_offset ] ),
+		          available_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read USN record values at read block offset: %" PRIzd ".",
+			 function,
+			 range_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			result = libfsntfs_usn_record_values_read_unsupported_record_size(
+			          &( internal_usn_change_journal->read_block_data[ range_offset ] ),
+			          available_size,
+			          &usn_record_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read unsupported USN record size at read block offset: %" PRIzd ".",
+				 function,
+				 range_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				parse_range->unsupported_record_offset = range_offset;
+
+				return( 0 );
+			}
+			/* Version 3 and 4 records are skipped
+			 */
+			range_offset += usn_record_size;
+
+			continue;
+		}
+		internal_usn_change_journal->record_offsets[ record_index++ ] = (uint32_t) range_offset;
+
+		parse_range->number_of_records += 1;
+
+		range_offset += usn_record_size;
+	}
+	return( 1 );
+}
+
+/* Callback function to parse a range of the read block in a thread
+ * Returns 1 if successful, 0 if an unsupported record was found or -1 on error
+ */
+int libfsntfs_usn_change_journal_parse_range_thread_callback_function(
+     libfsntfs_usn_change_journal_parse_range_t *parse_range )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libfsntfs_usn_change_journal_parse_range_thread_callback_function";
+
+	if( parse_range == NULL )
+	{
+		return( -1 );
+	}
+	parse_range->result = libfsntfs_internal_usn_change_journal_parse_range(
+	                       parse_range->internal_usn_change_journal,
+	                       parse_range,
+	                       &error );
+
+	if( parse_range->result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse range.",
+		 function );
+
+		goto on_error;
+	}
+	return( parse_range->result );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Parses the read block from the read offset
+ * The remainder of the read block is split into parse ranges on journal block boundaries,
+ * which are parsed by multiple threads if multi-threading is supported and more than
+ * 1 thread is set. The parse ranges are stored in journal order, and hence in USN order
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_parse_read_block(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libcerror_error_t **error )
+{
+	libfsntfs_usn_change_journal_parse_range_t *parse_range = NULL;
+	static char *function                                   = "libfsntfs_internal_usn_change_journal_parse_read_block";
+	size_t block_start_offset                               = 0;
+	size_t parse_range_size                                 = 0;
+	size_t range_start_offset                               = 0;
+	size_t read_block_offset                                = 0;
+	int number_of_parse_ranges                              = 0;
+	int number_of_threads                                   = 1;
+	int parse_range_index                                   = 0;
+	int result                                              = 1;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->read_offset < internal_usn_change_journal->read_block_offset )
+	 || ( internal_usn_change_journal->read_offset >= (off64_t) ( internal_usn_change_journal->read_block_offset + internal_usn_change_journal->read_block_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - read offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_usn_change_journal->record_offsets == NULL )
+	{
+		internal_usn_change_journal->record_offsets = (uint32_t *) memory_allocate(
+		                                                            sizeof( uint32_t ) * ( LIBFSNTFS_USN_CHANGE_JOURNAL_READ_BLOCK_SIZE / LIBFSNTFS_USN_CHANGE_JOURNAL_MINIMUM_RECORD_SIZE ) );
+
+		if( internal_usn_change_journal->record_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record offsets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_usn_change_journal->number_of_parse_ranges = 0;
+
+	read_block_offset  = (size_t) ( internal_usn_change_journal->read_offset - internal_usn_change_journal->read_block_offset );
+	block_start_offset = read_block_offset - ( read_block_offset % internal_usn_change_journal->journal_block_size );
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	number_of_threads = internal_usn_change_journal->number_of_threads;
+
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		number_of_threads = 1;
+	}
+#endif
+	/* The size of the parse ranges is rounded up to a multiple of the journal block size
+	 * so that every parse range, except the first, starts at a journal block boundary
+	 */
+	parse_range_size  = internal_usn_change_journal->read_block_data_size - block_start_offset;
+	parse_range_size /= (size_t) number_of_threads;
+	parse_range_size += internal_usn_change_journal->journal_block_size - 1;
+	parse_range_size -= parse_range_size % internal_usn_change_journal->journal_block_size;
+
+	if( parse_range_size == 0 )
+	{
+		parse_range_size = internal_usn_change_journal->journal_block_size;
+	}
+
+	range_start_offset = read_block_offset;
+
+	while( ( range_start_offset < internal_usn_change_journal->read_block_data_size )
+	    && ( number_of_parse_ranges < number_of_threads ) )
+	{
+		parse_range = &( internal_usn_change_journal->parse_ranges[ number_of_parse_ranges ] );
+
+		parse_range->internal_usn_change_journal = internal_usn_change_journal;
+		parse_range->start_offset                = range_start_offset;
+		parse_range->end_offset                  = block_start_offset + ( ( number_of_parse_ranges + 1 ) * parse_range_size );
+		parse_range->first_record_index          = (int) ( range_start_offset / LIBFSNTFS_USN_CHANGE_JOURNAL_MINIMUM_RECORD_SIZE );
+		parse_range->number_of_records           = 0;
+		parse_range->unsupported_record_offset   = 0;
+		parse_range->result                      = -1;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+		parse_range->thread = NULL;
+#endif
+		if( ( parse_range->end_offset > internal_usn_change_journal->read_block_data_size )
+		 || ( ( number_of_parse_ranges + 1 ) == number_of_threads ) )
+		{
+			parse_range->end_offset = internal_usn_change_journal->read_block_data_size;
+		}
+		range_start_offset = parse_range->end_offset;
+
+		number_of_parse_ranges++;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( number_of_parse_ranges > 1 )
+	{
+		for( parse_range_index = 0;
+		     parse_range_index < number_of_parse_ranges;
+		     parse_range_index++ )
+		{
+			parse_range = &( internal_usn_change_journal->parse_ranges[ parse_range_index ] );
+
+			if( libcthreads_thread_create(
+			     &( parse_range->thread ),
+			     NULL,
+			     (int (*)(void *)) &libfsntfs_usn_change_journal_parse_range_thread_callback_function,
+			     (void *) parse_range,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 parse_range_index );
+
+				result = -1;
+
+				break;
+			}
+		}
+		/* A thread can fail to parse so the parse ranges are validated after all threads finished
+		 */
+		for( parse_range_index = 0;
+		     parse_range_index < number_of_parse_ranges;
+		     parse_range_index++ )
+		{
+			parse_range = &( internal_usn_change_journal->parse_ranges[ parse_range_index ] );
+
+			if( parse_range->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( parse_range->thread ),
+				     NULL ) != 1 )
+				{
+					parse_range->thread = NULL;
+				}
+			}
+		}
+		if( result == 1 )
+		{
+			for( parse_range_index = 0;
+			     parse_range_index < number_of_parse_ranges;
+			     parse_range_index++ )
+			{
+				if( internal_usn_change_journal->parse_ranges[ parse_range_index ].result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to parse range: %d.",
+					 function,
+					 parse_range_index );
+
+					result = -1;
+
+					break;
+				}
+			}
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT ) */
+	{
+		for( parse_range_index = 0;
+		     parse_range_index < number_of_parse_ranges;
+		     parse_range_index++ )
+		{
+			parse_range = &( internal_usn_change_journal->parse_ranges[ parse_range_index ] );
+
+			parse_range->result = libfsntfs_internal_usn_change_journal_parse_range(
+			                       internal_usn_change_journal,
+			                       parse_range,
+			                       error );
+
+			if( parse_range->result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to parse range: %d.",
+				 function,
+				 parse_range_index );
+
+				return( -1 );
+			}
+			/* The ranges after an unsupported record are not needed
+			 */
+			else if( parse_range->result == 0 )
+			{
+				parse_range_index++;
+
+				break;
+			}
+		}
+		number_of_parse_ranges = parse_range_index;
+	}
+	internal_usn_change_journal->number_of_parse_ranges = number_of_parse_ranges;
+	internal_usn_change_journal->parse_range_index      = 0;
+	internal_usn_change_journal->parse_record_index     = 0;
+	internal_usn_change_journal->parse_offset           = internal_usn_change_journal->read_offset;
+
+	return( 1 );
+}
+
+/* Reads USN records from the USN change journal
+ * The USN records are copied, as stored in the journal, back-to-back into the
+ * USN records data for as many complete records as fit. Every record starts
+ * with its 32-bit record size and the USN records are validated to be version 2
+ * records with the name stored within the record. Version 3 and 4 records are skipped.
+ * The sparse ranges of the journal are skipped without being read and the
+ * journal is read in blocks of LIBFSNTFS_USN_CHANGE_JOURNAL_READ_BLOCK_SIZE.
+ * Every read block is parsed, by multiple threads if set, before its records
+ * are copied in USN order. An unsupported record is reported by the call after the
+ * one that returned the records before it, after which reading continues at the
+ * next journal block.
+ * This function maintains its own read position, independent of
+ * libfsntfs_usn_change_journal_read_usn_record
+ * Returns the number of bytes of USN records data if successful, 0 if no more records are available or -1 on error
+ */
+ssize_t libfsntfs_usn_change_journal_read_usn_records(
+         libfsntfs_usn_change_journal_t *usn_change_journal,
+         uint8_t *usn_records_data,
+         size_t usn_records_data_size,
+         int *number_of_usn_records,
+         libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	libfsntfs_usn_change_journal_parse_range_t *parse_range              = NULL;
+	uint8_t *usn_record_data                                             = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_read_usn_records";
+	off64_t unsupported_record_offset                                    = 0;
+	size_t record_offset                                                 = 0;
+	size_t usn_records_data_offset                                       = 0;
+	uint32_t usn_record_size                                             = 0;
+	int result                                                           = 0;
+	int safe_number_of_usn_records                                       = 0;
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN records data.",
+		 function );
+
+		return( -1 );
+	}
+	if( usn_records_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN records data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_usn_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of USN records.",
+		 function );
+
+		return( -1 );
+	}
+	while( (size64_t) internal_usn_change_journal->read_offset < internal_usn_change_journal->data_size )
+	{
+		if( ( internal_usn_change_journal->read_offset < internal_usn_change_journal->read_block_offset )
+		 || ( internal_usn_change_journal->read_offset >= (off64_t) ( internal_usn_change_journal->read_block_offset + internal_usn_change_journal->read_block_data_size ) ) )
+		{
+			result = libfsntfs_internal_usn_change_journal_read_block(
+			          internal_usn_change_journal,
+			          internal_usn_change_journal->read_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_usn_change_journal->read_offset,
+				 internal_usn_change_journal->read_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				/* Skip the sparse range
+				 */
+				result = libfsntfs_cluster_block_stream_get_data_offset(
+				          internal_usn_change_journal->data_stream,
+				          internal_usn_change_journal->read_offset,
+				          &( internal_usn_change_journal->read_offset ),
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve $J data stream data offset.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					internal_usn_change_journal->read_offset = (off64_t) internal_usn_change_journal->data_size;
+				}
+				continue;
+			}
+		}
+		if( ( internal_usn_change_journal->number_of_parse_ranges == 0 )
+		 || ( internal_usn_change_journal->parse_offset != internal_usn_change_journal->read_offset ) )
+		{
+			if( libfsntfs_internal_usn_change_journal_parse_read_block(
+			     internal_usn_change_journal,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to parse block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_usn_change_journal->read_offset,
+				 internal_usn_change_journal->read_offset );
+
+				return( -1 );
+			}
+		}
+		parse_range = &( internal_usn_change_journal->parse_ranges[ internal_usn_change_journal->parse_range_index ] );
+
+		if( internal_usn_change_journal->parse_record_index < parse_range->number_of_records )
+		{
+			record_offset   = (size_t) internal_usn_change_journal->record_offsets[ parse_range->first_record_index + internal_usn_change_journal->parse_record_index ];
+			usn_record_data = &( internal_usn_change_journal->read_block_data[ record_offset ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 usn_record_data,
+			 usn_record_size );
+
+			if( (size_t) usn_record_size > ( usn_records_data_size - usn_records_data_offset ) )
+			{
+				if( usn_records_data_offset == 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: USN records data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+			}
+			if( memory_copy(
+			     &( usn_records_data[ usn_records_data_offset ] ),
+			     usn_record_data,
+			     (size_t) usn_record_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy USN record data.",
+				 function );
+
+				return( -1 );
+			}
+			usn_records_data_offset += usn_record_size;
+
+			internal_usn_change_journal->read_offset = internal_usn_change_journal->read_block_offset + (off64_t) ( record_offset + usn_record_size );
+
+			internal_usn_change_journal->parse_record_index += 1;
+
+			safe_number_of_usn_records++;
+		}
+		else if( parse_range->result == 0 )
+		{
+			/* The records copied so far are returned first, the unsupported record
+			 * is reported by the next call
+			 */
+			if( usn_records_data_offset > 0 )
+			{
+				break;
+			}
+			unsupported_record_offset = internal_usn_change_journal->read_block_offset + (off64_t) parse_range->unsupported_record_offset;
+
+			/* Records do not span journal blocks hence reading continues at the next journal block
+			 */
+			internal_usn_change_journal->read_offset            = unsupported_record_offset
+			                                                    - ( unsupported_record_offset % internal_usn_change_journal->journal_block_size )
+			                                                    + internal_usn_change_journal->journal_block_size;
+			internal_usn_change_journal->number_of_parse_ranges = 0;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported USN record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 unsupported_record_offset,
+			 unsupported_record_offset );
+
+			return( -1 );
+		}
+		else
+		{
+			/* Continue at the start of the next parse range, which skips the unused remainder of the last journal block
+			 */
+			internal_usn_change_journal->read_offset = internal_usn_change_journal->read_block_offset + (off64_t) parse_range->end_offset;
+
+			internal_usn_change_journal->parse_range_index += 1;
+			internal_usn_change_journal->parse_record_index = 0;
+
+			if( internal_usn_change_journal->parse_range_index >= internal_usn_change_journal->number_of_parse_ranges )
+			{
+				internal_usn_change_journal->number_of_parse_ranges = 0;
+			}
+		}
+		internal_usn_change_journal->parse_offset = internal_usn_change_journal->read_offset;
+	}
+	*number_of_usn_records = safe_number_of_usn_records;
+
+	return( (ssize_t) usn_records_data_offset );
+}
+
+/* Reads a journal block of the $J data stream
+ * The part of the journal block beyond the end of the data is set to 0
+ * Returns 1 if successful, 0 if the journal block is in a sparse range or beyond the data or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_read_journal_block(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t journal_block_offset,
+     uint8_t *journal_block_data,
+     size_t journal_block_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_internal_usn_change_journal_read_journal_block";
+	size64_t range_size   = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	off64_t range_offset  = 0;
+	uint32_t range_flags  = 0;
+	int result            = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( journal_block_offset < 0 )
+	 || ( ( journal_block_offset % internal_usn_change_journal->journal_block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid journal block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_block_data_size != internal_usn_change_journal->journal_block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid journal block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsntfs_cluster_block_stream_get_range_at_offset(
+	          internal_usn_change_journal->data_stream,
+	          journal_block_offset,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $J data stream range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 journal_block_offset,
+		 journal_block_offset );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( ( range_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     journal_block_data,
+	     0,
+	     journal_block_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear journal block data.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = journal_block_data_size;
+
+	if( (size64_t) read_size > ( internal_usn_change_journal->data_size - journal_block_offset ) )
+	{
+		read_size = (size_t) ( internal_usn_change_journal->data_size - journal_block_offset );
+	}
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              internal_usn_change_journal->data_stream,
+	              (intptr_t *) internal_usn_change_journal->file_io_handle,
+	              journal_block_data,
+	              read_size,
+	              journal_block_offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read journal block from $J data stream at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 journal_block_offset,
+		 journal_block_offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the first record in a journal block with an update sequence number (USN)
+ * equal to or greater than the update sequence number
+ * Returns 1 if successful, 0 if no such record was found or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     const uint8_t *journal_block_data,
+     size_t journal_block_data_size,
+     uint64_t update_sequence_number,
+     size_t *record_offset,
+     uint64_t *record_update_sequence_number,
+     libcerror_error_t **error )
+{
+	libfsntfs_usn_record_values_t usn_record_values;
+
+	static char *function       = "libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn";
+	size_t journal_block_offset = 0;
+	uint32_t usn_record_size    = 0;
+	int result                  = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_block_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid journal block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_update_sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record update sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	/* Parsing stops at the unused remainder of the journal block or at an unsupported record,
+	 * version 3 and 4 records are skipped
+	 */
+	while( ( journal_block_data_size - journal_block_offset ) >= 60 )
+	{
+		result = libfsntfs_usn_record_values_read_data(
+		          &usn_record_values,
+		          &( journal_block_data[ journal_block_offset ] ),
+		          journal_block_data_size - journal_block_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read USN record values at journal block offset: %" PRIzd ".",
+			 function,
+			 journal_block_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			result = libfsntfs_usn_record_values_read_unsupported_record_size(
+			          &( journal_block_data[ journal_block_offset ] ),
+			          journal_block_data_size - journal_block_offset,
+			          &usn_record_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read unsupported USN record size at journal block offset: %" PRIzd ".",
+				 function,
+				 journal_block_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			/* Version 3 and 4 records are skipped
+			 */
+			journal_block_offset += usn_record_size;
+
+			continue;
+		}
+		if( usn_record_values.update_sequence_number >= update_sequence_number )
+		{
+			*record_offset                 = journal_block_offset;
+			*record_update_sequence_number = usn_record_values.update_sequence_number;
+
+			return( 1 );
+		}
+		journal_block_offset += usn_record_values.record_size;
+	}
+	return( 0 );
+}
+
+/* Sets the read position of the USN change journal
+ * Both libfsntfs_usn_change_journal_read_usn_record and libfsntfs_usn_change_journal_read_usn_records
+ * continue at the offset, which is either the offset of a record or the end of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_set_record_offset(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsntfs_internal_usn_change_journal_set_record_offset";
+	size64_t extent_size         = 0;
+	size_t read_size             = 0;
+	ssize_t read_count           = 0;
+	off64_t extent_start_offset  = 0;
+	off64_t journal_block_offset = 0;
+	off64_t segment_offset       = 0;
+	uint32_t extent_flags        = 0;
+	int extent_index             = 0;
+	int segment_file_index       = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > internal_usn_change_journal->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal->read_offset            = offset;
+	internal_usn_change_journal->number_of_parse_ranges = 0;
+
+	/* Determine the extent that contains the offset for libfsntfs_usn_change_journal_read_usn_record
+	 */
+	for( extent_index = 0;
+	     extent_index < internal_usn_change_journal->number_of_extents;
+	     extent_index++ )
+	{
+		if( libfdata_stream_get_segment_by_index(
+		     internal_usn_change_journal->data_stream,
+		     extent_index,
+		     &segment_file_index,
+		     &segment_offset,
+		     &extent_size,
+		     &extent_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve $J data stream extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( (size64_t) ( offset - extent_start_offset ) < extent_size )
+		{
+			break;
+		}
+		extent_start_offset += (off64_t) extent_size;
+	}
+	internal_usn_change_journal->extent_index         = extent_index;
+	internal_usn_change_journal->extent_start_offset  = extent_start_offset;
+	internal_usn_change_journal->extent_size          = extent_size;
+	internal_usn_change_journal->extent_flags         = extent_flags;
+	internal_usn_change_journal->extent_offset        = 0;
+	internal_usn_change_journal->data_offset          = offset;
+	internal_usn_change_journal->journal_block_offset = 0;
+
+	if( ( offset == 0 )
+	 || ( extent_index >= internal_usn_change_journal->number_of_extents )
+	 || ( ( extent_flags & LIBFSNTFS_EXTENT_FLAG_IS_SPARSE ) != 0 ) )
+	{
+		return( 1 );
+	}
+	journal_block_offset = offset - ( offset % internal_usn_change_journal->journal_block_size );
+
+	if( journal_block_offset < extent_start_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - extent start offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal->extent_offset = journal_block_offset - extent_start_offset;
+
+	if( memory_set(
+	     internal_usn_change_journal->journal_block_data,
+	     0,
+	     internal_usn_change_journal->journal_block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear journal block.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = internal_usn_change_journal->journal_block_size;
+
+	if( read_size > ( extent_size - internal_usn_change_journal->extent_offset ) )
+	{
+		read_size = (size_t) ( extent_size - internal_usn_change_journal->extent_offset );
+	}
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              internal_usn_change_journal->data_stream,
+	              (intptr_t *) internal_usn_change_journal->file_io_handle,
+	              internal_usn_change_journal->journal_block_data,
+	              read_size,
+	              journal_block_offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read journal block from $J data stream at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 journal_block_offset,
+		 journal_block_offset );
+
+		return( -1 );
+	}
+	internal_usn_change_journal->journal_block_offset = (size_t) ( offset - journal_block_offset );
+
+	return( 1 );
+}
+
+/* Retrieves the offset of the first USN record with an update sequence number (USN) equal to or greater than the update sequence number
+ * Since the update sequence number is the offset of the record in the $J data stream the record
+ * is first looked up directly. If that record does not have the update sequence number, for example
+ * because the journal was truncated, the journal blocks are binary searched.
+ * The journal block data is used to read the journal blocks
+ * Returns 1 if successful, 0 if no such record was found or -1 on error
+ */
+int libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     uint64_t update_sequence_number,
+     uint8_t *journal_block_data,
+     size_t journal_block_data_size,
+     off64_t *record_journal_offset,
+     libcerror_error_t **error )
+{
+	static char *function                  = "libfsntfs_internal_usn_change_journal_get_record_offset_by_usn";
+	size_t record_offset                   = 0;
+	off64_t first_journal_block_offset     = 0;
+	off64_t journal_block_offset           = 0;
+	uint64_t first_journal_block_number    = 0;
+	uint64_t found_journal_block_number    = 0;
+	uint64_t journal_block_number          = 0;
+	uint64_t last_journal_block_number     = 0;
+	uint64_t record_update_sequence_number = 0;
+	uint8_t found_journal_block            = 0;
+	int result                             = 0;
+
+	if( internal_usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_journal_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record journal offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_usn_change_journal->data_size == 0 )
+	{
+		return( 0 );
+	}
+	/* The update sequence number is the offset of the record in the $J data stream
+	 */
+	if( ( update_sequence_number < internal_usn_change_journal->data_size )
+	 && ( ( update_sequence_number % 8 ) == 0 ) )
+	{
+		journal_block_offset = (off64_t) ( update_sequence_number - ( update_sequence_number % internal_usn_change_journal->journal_block_size ) );
+
+		result = libfsntfs_internal_usn_change_journal_read_journal_block(
+		          internal_usn_change_journal,
+		          journal_block_offset,
+		          journal_block_data,
+		          journal_block_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read journal block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 journal_block_offset,
+			 journal_block_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+			          internal_usn_change_journal,
+			          journal_block_data,
+			          journal_block_data_size,
+			          update_sequence_number,
+			          &record_offset,
+			          &record_update_sequence_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record from journal block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 journal_block_offset,
+				 journal_block_offset );
+
+				return( -1 );
+			}
+			else if( ( result != 0 )
+			      && ( record_update_sequence_number == update_sequence_number )
+			      && ( ( journal_block_offset + (off64_t) record_offset ) == (off64_t) update_sequence_number ) )
+			{
+				*record_journal_offset = (off64_t) update_sequence_number;
+
+				return( 1 );
+			}
+		}
+	}
+	/* Binary search the last journal block with a first record with an update sequence number
+	 * equal to or less than the update sequence number. The sparse ranges at the start of
+	 * a truncated journal are skipped.
+	 */
+	result = libfsntfs_cluster_block_stream_get_data_offset(
+	          internal_usn_change_journal->data_stream,
+	          0,
+	          &first_journal_block_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve $J data stream data offset.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	first_journal_block_number = (uint64_t) first_journal_block_offset / internal_usn_change_journal->journal_block_size;
+	last_journal_block_number  = ( internal_usn_change_journal->data_size - 1 ) / internal_usn_change_journal->journal_block_size;
+
+	while( first_journal_block_number <= last_journal_block_number )
+	{
+		journal_block_number = first_journal_block_number + ( ( last_journal_block_number - first_journal_block_number ) / 2 );
+		journal_block_offset = (off64_t) ( journal_block_number * internal_usn_change_journal->journal_block_size );
+
+		result = libfsntfs_internal_usn_change_journal_read_journal_block(
+		          internal_usn_change_journal,
+		          journal_block_offset,
+		          journal_block_data,
+		          journal_block_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read journal block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 journal_block_offset,
+			 journal_block_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+			          internal_usn_change_journal,
+			          journal_block_data,
+			          journal_block_data_size,
+			          0,
+			          &record_offset,
+			          &record_update_sequence_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve first record from journal block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 journal_block_offset,
+				 journal_block_offset );
+
+				return( -1 );
+			}
+		}
+		/* Sparse and empty journal blocks are considered to be after the update sequence number
+		 */
+		if( ( result != 0 )
+		 && ( record_update_sequence_number <= update_sequence_number ) )
+		{
+			found_journal_block_number = journal_block_number;
+			found_journal_block        = 1;
+
+			first_journal_block_number = journal_block_number + 1;
+		}
+		else if( journal_block_number == 0 )
+		{
+			break;
+		}
+		else
+		{
+			last_journal_block_number = journal_block_number - 1;
+		}
+	}
+	if( found_journal_block != 0 )
+	{
+		journal_block_offset = (off64_t) ( found_journal_block_number * internal_usn_change_journal->journal_block_size );
+	}
+	else
+	{
+		journal_block_offset = first_journal_block_offset - ( first_journal_block_offset % internal_usn_change_journal->journal_block_size );
+	}
+	/* Scan forward from the journal block for the first record with an update sequence number
+	 * equal to or greater than the update sequence number
+	 */
+	while( (size64_t) journal_block_offset < internal_usn_change_journal->data_size )
+	{
+		result = libfsntfs_internal_usn_change_journal_read_journal_block(
+		          internal_usn_change_journal,
+		          journal_block_offset,
+		          journal_block_data,
+		          journal_block_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read journal block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 journal_block_offset,
+			 journal_block_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* Skip the sparse range
+			 */
+			result = libfsntfs_cluster_block_stream_get_data_offset(
+			          internal_usn_change_journal->data_stream,
+			          journal_block_offset,
+			          &journal_block_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve $J data stream data offset.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			/* A journal block that is partially sparse does not contain valid records
+			 */
+			journal_block_offset += internal_usn_change_journal->journal_block_size - 1;
+			journal_block_offset -= journal_block_offset % internal_usn_change_journal->journal_block_size;
+
+			continue;
+		}
+		result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+		          internal_usn_change_journal,
+		          journal_block_data,
+		          journal_block_data_size,
+		          update_sequence_number,
+		          &record_offset,
+		          &record_update_sequence_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record from journal block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 journal_block_offset,
+			 journal_block_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*record_journal_offset = journal_block_offset + (off64_t) record_offset;
+
+			return( 1 );
+		}
+		journal_block_offset += internal_usn_change_journal->journal_block_size;
+	}
+	return( 0 );
+}
+
+/* Seeks the first USN record with an update sequence number (USN) equal to or greater than the update sequence number
+ * Both libfsntfs_usn_change_journal_read_usn_record and libfsntfs_usn_change_journal_read_usn_records
+ * continue reading at the record. If no such record was found both continue at the end of the journal
+ * Returns 1 if successful, 0 if no such record was found or -1 on error
+ */
+int libfsntfs_usn_change_journal_seek_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     uint64_t update_sequence_number,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	uint8_t *journal_block_data                                          = NULL;
+	static char *function                                                = "libfsntfs_usn_change_journal_seek_usn";
+	off64_t record_journal_offset                                        = 0;
+	int result                                                           = 0;
+
+	if( usn_change_journal == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( -1 );
+	}
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	if( ( internal_usn_change_journal->journal_block_size < 60 )
+	 || ( internal_usn_change_journal->journal_block_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid USN change journal - journal block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_sequence_number > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid update sequence number value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	journal_block_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * internal_usn_change_journal->journal_block_size );
+
+	if( journal_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create journal block data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          update_sequence_number,
+	          journal_block_data,
+	          internal_usn_change_journal->journal_block_size,
+	          &record_journal_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record offset of USN: %" PRIu64 ".",
+		 function,
+		 update_sequence_number );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		record_journal_offset = (off64_t) internal_usn_change_journal->data_size;
+	}
+	memory_free(
+	 journal_block_data );
+
+	journal_block_data = NULL;
+
+	if( libfsntfs_internal_usn_change_journal_set_record_offset(
+	     internal_usn_change_journal,
+	     record_journal_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set record offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 record_journal_offset,
+		 record_journal_offset );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( journal_block_data != NULL )
+	{
+		memory_free(
+		 journal_block_data );
+	}
+	return( -1 );
+}
+
@@ -38,8 +38,61 @@
 extern "C" {
 #endif
 
+/* The size of the blocks read by libfsntfs_usn_change_journal_read_usn_records,
+ * which must be a multiple of the journal block size
+ */
+#define LIBFSNTFS_USN_CHANGE_JOURNAL_READ_BLOCK_SIZE	( 4 * 1024 * 1024 )
+
+/* The minimum size of an USN record, which is the size of a version 2 record
+ * without name aligned to 8 bytes
+ */
+#define LIBFSNTFS_USN_CHANGE_JOURNAL_MINIMUM_RECORD_SIZE	64
+
+/* The maximum number of threads used to parse a read block
+ */
+#define LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS	8
+
 typedef struct libfsntfs_internal_usn_change_journal libfsntfs_internal_usn_change_journal_t;
 
+typedef struct libfsntfs_usn_change_journal_parse_range libfsntfs_usn_change_journal_parse_range_t;
+
+struct libfsntfs_usn_change_journal_parse_range
+{
+	/* The USN change journal
+	 */
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal;
+
+	/* The start offset of the range relative to the read block
+	 */
+	size_t start_offset;
+
+	/* The end offset of the range relative to the read block
+	 */
+	size_t end_offset;
+
+	/* The index of the first record offset of the range
+	 */
+	int first_record_index;
+
+	/* The number of records of the range
+	 */
+	int number_of_records;
+
+	/* The offset of the unsupported record relative to the read block
+	 */
+	size_t unsupported_record_offset;
+
+	/* The parse result, which is 1 if successful, 0 if an unsupported record was found or -1 on error
+	 */
+	int result;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
 struct libfsntfs_internal_usn_change_journal
 {
 	/* The file IO handle
@@ -62,6 +115,14 @@ struct libfsntfs_internal_usn_change_journal
 	 */
 	size64_t data_size;
 
+	/* The journal identifier
+	 */
+	uint64_t journal_identifier;
+
+	/* Value to indicate the journal identifier was read from the $Max data stream
+	 */
+	uint8_t has_journal_identifier;
+
 	/* The number of extents
 	 */
 	int number_of_extents;
@@ -97,6 +158,50 @@ struct libfsntfs_internal_usn_change_journal
 	/* The journal block size
 	 */
 	size_t journal_block_size;
+
+	/* The read block data
+	 */
+	uint8_t *read_block_data;
+
+	/* The read block offset
+	 */
+	off64_t read_block_offset;
+
+	/* The read block data size
+	 */
+	size_t read_block_data_size;
+
+	/* The read offset of libfsntfs_usn_change_journal_read_usn_records
+	 */
+	off64_t read_offset;
+
+	/* The number of threads used to parse a read block
+	 */
+	int number_of_threads;
+
+	/* The offsets of the parsed records relative to the read block
+	 */
+	uint32_t *record_offsets;
+
+	/* The parse ranges of the read block
+	 */
+	libfsntfs_usn_change_journal_parse_range_t parse_ranges[ LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* The number of parse ranges, which is 0 if the read block has not been parsed
+	 */
+	int number_of_parse_ranges;
+
+	/* The index of the current parse range
+	 */
+	int parse_range_index;
+
+	/* The index of the current record within the current parse range
+	 */
+	int parse_record_index;
+
+	/* The read offset that corresponds with the current parse range and record
+	 */
+	off64_t parse_offset;
 };
 
 int libfsntfs_usn_change_journal_initialize(
@@ -118,6 +223,29 @@ int libfsntfs_usn_change_journal_get_offset(
      off64_t *offset,
      libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+int libfsntfs_usn_change_journal_get_next_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     uint64_t *next_update_sequence_number,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_read_max_data(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_read_max_attribute(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libfsntfs_mft_attribute_t *mft_attribute,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_usn_change_journal_get_journal_identifier(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     uint64_t *journal_identifier,
+     libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 ssize_t libfsntfs_usn_change_journal_read_usn_record(
          libfsntfs_usn_change_journal_t *usn_change_journal,
@@ -125,6 +253,78 @@ ssize_t libfsntfs_usn_change_journal_read_usn_record(
          size_t usn_record_data_size,
          libcerror_error_t **error );
 
+int libfsntfs_internal_usn_change_journal_read_block(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t offset,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_usn_change_journal_get_number_of_threads(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_usn_change_journal_set_number_of_threads(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_parse_range(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libfsntfs_usn_change_journal_parse_range_t *parse_range,
+     libcerror_error_t **error );
+
+int libfsntfs_usn_change_journal_parse_range_thread_callback_function(
+     libfsntfs_usn_change_journal_parse_range_t *parse_range );
+
+int libfsntfs_internal_usn_change_journal_parse_read_block(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+ssize_t libfsntfs_usn_change_journal_read_usn_records(
+         libfsntfs_usn_change_journal_t *usn_change_journal,
+         uint8_t *usn_records_data,
+         size_t usn_records_data_size,
+         int *number_of_usn_records,
+         libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_read_journal_block(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t journal_block_offset,
+     uint8_t *journal_block_data,
+     size_t journal_block_data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     const uint8_t *journal_block_data,
+     size_t journal_block_data_size,
+     uint64_t update_sequence_number,
+     size_t *record_offset,
+     uint64_t *record_update_sequence_number,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_set_record_offset(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+     libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal,
+     uint64_t update_sequence_number,
+     uint8_t *journal_block_data,
+     size_t journal_block_data_size,
+     off64_t *record_journal_offset,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_usn_change_journal_seek_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal,
+     uint64_t update_sequence_number,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,370 @@
+/*
+ * USN change journal record values functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+#include "libfsntfs_libcnotify.h"
+#include "libfsntfs_usn_record_values.h"
+
+#include "fsntfs_usn_record.h"
+
+/* Creates USN record values
+ * Make sure the value usn_record_values is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_record_values_initialize(
+     libfsntfs_usn_record_values_t **usn_record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_usn_record_values_initialize";
+
+	if( usn_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *usn_record_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid USN record values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*usn_record_values = memory_allocate_structure(
+	                      libfsntfs_usn_record_values_t );
+
+	if( *usn_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create USN record values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *usn_record_values,
+	     0,
+	     sizeof( libfsntfs_usn_record_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear USN record values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *usn_record_values != NULL )
+	{
+		memory_free(
+		 *usn_record_values );
+
+		*usn_record_values = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees USN record values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_usn_record_values_free(
+     libfsntfs_usn_record_values_t **usn_record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsntfs_usn_record_values_free";
+
+	if( usn_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *usn_record_values != NULL )
+	{
+		memory_free(
+		 *usn_record_values );
+
+		*usn_record_values = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the USN record values
+ * The data can contain more data than the record, only the record size is read
+ * Only version 2 records are supported, the record size must be a multiple of 8
+ * and the name must be stored within the record
+ * Returns 1 if successful, 0 if the data does not contain a supported record or -1 on error
+ */
+int libfsntfs_usn_record_values_read_data(
+     libfsntfs_usn_record_values_t *usn_record_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfsntfs_usn_record_values_read_data";
+	uint32_t record_size   = 0;
+	uint16_t major_version = 0;
+	uint16_t name_offset   = 0;
+	uint16_t name_size     = 0;
+
+	if( usn_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid USN record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < sizeof( fsntfs_usn_record_v2_t ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->record_size,
+	 record_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->major_version,
+	 major_version );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->name_size,
+	 name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->name_offset,
+	 name_offset );
+
+	if( ( major_version != 2 )
+	 || ( record_size < sizeof( fsntfs_usn_record_v2_t ) )
+	 || ( (size_t) record_size > data_size )
+	 || ( ( record_size % 8 ) != 0 )
+	 || ( name_offset < sizeof( fsntfs_usn_record_v2_t ) )
+	 || ( name_offset > record_size )
+	 || ( name_size > ( record_size - name_offset ) ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: USN record data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 (size_t) record_size,
+		 0 );
+	}
+#endif
+	usn_record_values->record_size = record_size;
+	usn_record_values->name_offset = name_offset;
+	usn_record_values->name_size   = name_size;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->file_reference,
+	 usn_record_values->file_reference );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->parent_file_reference,
+	 usn_record_values->parent_file_reference );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->update_sequence_number,
+	 usn_record_values->update_sequence_number );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->update_time,
+	 usn_record_values->update_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->update_reason_flags,
+	 usn_record_values->update_reason_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->update_source_flags,
+	 usn_record_values->update_source_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->file_attribute_flags,
+	 usn_record_values->file_attribute_flags );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: record size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 usn_record_values->record_size );
+
+		libcnotify_printf(
+		 "%s: update sequence number\t\t: %" PRIu64 "\n",
+		 function,
+		 usn_record_values->update_sequence_number );
+
+		libcnotify_printf(
+		 "%s: file reference\t\t\t: %" PRIu64 "-%" PRIu64 "\n",
+		 function,
+		 usn_record_values->file_reference & 0xffffffffffffUL,
+		 usn_record_values->file_reference >> 48 );
+
+		libcnotify_printf(
+		 "%s: parent file reference\t\t: %" PRIu64 "-%" PRIu64 "\n",
+		 function,
+		 usn_record_values->parent_file_reference & 0xffffffffffffUL,
+		 usn_record_values->parent_file_reference >> 48 );
+
+		libcnotify_printf(
+		 "%s: update reason flags\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 usn_record_values->update_reason_flags );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Reads the record size of an USN record of an unsupported version
+ * Version 3 and 4 records share the record size and version with version 2 records,
+ * which allows them to be skipped. The record size must be a multiple of 8
+ * Returns 1 if successful, 0 if the data does not contain a version 3 or 4 record or -1 on error
+ */
+int libfsntfs_usn_record_values_read_unsupported_record_size(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *record_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfsntfs_usn_record_values_read_unsupported_record_size";
+	uint32_t safe_record_size = 0;
+	uint16_t major_version    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 8 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->record_size,
+	 safe_record_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsntfs_usn_record_v2_t *) data )->major_version,
+	 major_version );
+
+	if( ( ( major_version != 3 )
+	  &&  ( major_version != 4 ) )
+	 || ( safe_record_size < 8 )
+	 || ( (size_t) safe_record_size > data_size )
+	 || ( ( safe_record_size % 8 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	*record_size = safe_record_size;
+
+	return( 1 );
+}
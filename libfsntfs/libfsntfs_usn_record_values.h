@@ -0,0 +1,104 @@
+/*
+ * USN change journal record values functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSNTFS_USN_RECORD_VALUES_H )
+#define _LIBFSNTFS_USN_RECORD_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsntfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsntfs_usn_record_values libfsntfs_usn_record_values_t;
+
+struct libfsntfs_usn_record_values
+{
+	/* The record size
+	 */
+	uint32_t record_size;
+
+	/* The file reference
+	 */
+	uint64_t file_reference;
+
+	/* The parent file reference
+	 */
+	uint64_t parent_file_reference;
+
+	/* The update sequence number (USN)
+	 */
+	uint64_t update_sequence_number;
+
+	/* The update date and time
+	 */
+	uint64_t update_time;
+
+	/* The update reason flags
+	 */
+	uint32_t update_reason_flags;
+
+	/* The update source flags
+	 */
+	uint32_t update_source_flags;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The name offset relative to the start of the record
+	 */
+	uint16_t name_offset;
+
+	/* The name size
+	 */
+	uint16_t name_size;
+};
+
+int libfsntfs_usn_record_values_initialize(
+     libfsntfs_usn_record_values_t **usn_record_values,
+     libcerror_error_t **error );
+
+int libfsntfs_usn_record_values_free(
+     libfsntfs_usn_record_values_t **usn_record_values,
+     libcerror_error_t **error );
+
+int libfsntfs_usn_record_values_read_data(
+     libfsntfs_usn_record_values_t *usn_record_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsntfs_usn_record_values_read_unsupported_record_size(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *record_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSNTFS_USN_RECORD_VALUES_H ) */
+
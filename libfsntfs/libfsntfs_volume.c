@@ -41,6 +41,8 @@
 #include "libfsntfs_libfdata.h"
 #include "libfsntfs_libuna.h"
 #include "libfsntfs_mft_entry.h"
+#include "libfsntfs_path_cache.h"
+#include "libfsntfs_path_resolver.h"
 #include "libfsntfs_usn_change_journal.h"
 #include "libfsntfs_volume.h"
 #include "libfsntfs_volume_header.h"
@@ -2830,6 +2832,8 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
      libfsntfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
+	libfsntfs_path_cache_key_t path_cache_key;
+
 	libfsntfs_directory_entries_tree_t *directory_entries_tree = NULL;
 	libfsntfs_directory_entry_t *safe_directory_entry          = NULL;
 	const uint8_t *utf8_string_segment                         = NULL;
@@ -2838,6 +2842,10 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	size_t utf8_string_index                                   = 0;
 	size_t utf8_string_segment_length                          = 0;
 	uint64_t mft_entry_index                                   = 0;
+	uint64_t parent_file_reference                             = 0;
+	uint8_t read_mft_entry                                     = 0;
+	int cache_result                                           = 0;
+	int key_result                                             = 0;
 	int result                                                 = 0;
 
 	if( internal_volume == NULL )
@@ -2851,6 +2859,17 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 
 		return( -1 );
 	}
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
 	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
@@ -2904,10 +2923,12 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 			utf8_string_index++;
 		}
 	}
+	mft_entry_index = LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY;
+
 	if( libfsntfs_file_system_get_mft_entry_by_index(
 	     internal_volume->file_system,
 	     internal_volume->file_io_handle,
-	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
+	     mft_entry_index,
 	     mft_entry,
 	     error ) != 1 )
 	{
@@ -2920,6 +2941,8 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 
 		goto on_error;
 	}
+	parent_file_reference = ( *mft_entry )->file_reference;
+
 	if( ( utf8_string_length == 0 )
 	 || ( utf8_string_length == 1 ) )
 	{
@@ -2927,53 +2950,6 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 	}
 	else while( utf8_string_index < utf8_string_length )
 	{
-		if( directory_entries_tree != NULL )
-		{
-			if( libfsntfs_directory_entries_tree_free(
-			     &directory_entries_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entries tree.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		if( libfsntfs_directory_entries_tree_initialize(
-		     &directory_entries_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entries tree.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsntfs_directory_entries_tree_read_from_i30_index(
-		     directory_entries_tree,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     *mft_entry,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
-			 function,
-			 mft_entry_index );
-
-			goto on_error;
-		}
 		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
 		utf8_string_segment_length = utf8_string_index;
 
@@ -3008,25 +2984,149 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 		if( utf8_string_segment_length == 0 )
 		{
 			result = 0;
+
+			break;
 		}
-		else
+		if( safe_directory_entry != NULL )
+		{
+			if( libfsntfs_directory_entry_free(
+			     &safe_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Both names that exist and names that do not exist are cached
+		 * per parent directory
+		 */
+		key_result = libfsntfs_path_cache_key_set_utf8_name(
+		              &path_cache_key,
+		              parent_file_reference,
+		              utf8_string_segment,
+		              utf8_string_segment_length,
+		              error );
+
+		if( key_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path cache key.",
+			 function );
+
+			goto on_error;
+		}
+		cache_result = 0;
+
+		if( key_result != 0 )
+		{
+			cache_result = libfsntfs_path_cache_get_directory_entry(
+			                internal_volume->file_system->path_cache,
+			                &path_cache_key,
+			                &safe_directory_entry,
+			                error );
+
+			if( cache_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from path cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( cache_result != 0 )
 		{
 			if( safe_directory_entry != NULL )
 			{
-				if( libfsntfs_directory_entry_free(
-				     &safe_directory_entry,
+				result = 1;
+			}
+			else
+			{
+				result = 0;
+			}
+		}
+		else
+		{
+			if( read_mft_entry != 0 )
+			{
+				if( libfsntfs_file_system_get_mft_entry_by_index(
+				     internal_volume->file_system,
+				     internal_volume->file_io_handle,
+				     mft_entry_index,
+				     mft_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve MFT entry: %" PRIu64 ".",
+					 function,
+					 mft_entry_index );
+
+					goto on_error;
+				}
+				read_mft_entry = 0;
+			}
+			if( directory_entries_tree != NULL )
+			{
+				if( libfsntfs_directory_entries_tree_free(
+				     &directory_entries_tree,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory entry.",
+					 "%s: unable to free directory entries tree.",
 					 function );
 
 					goto on_error;
 				}
 			}
+			if( libfsntfs_directory_entries_tree_initialize(
+			     &directory_entries_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entries tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_directory_entries_tree_read_from_i30_index(
+			     directory_entries_tree,
+			     internal_volume->io_handle,
+			     internal_volume->file_io_handle,
+			     *mft_entry,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
+				 function,
+				 mft_entry_index );
+
+				goto on_error;
+			}
 			result = libfsntfs_directory_entries_tree_get_entry_by_utf8_name(
 			          directory_entries_tree,
 			          internal_volume->file_io_handle,
@@ -3034,19 +3134,42 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 			          utf8_string_segment_length,
 			          &safe_directory_entry,
 			          error );
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-8 name.",
-			 function );
 
-			goto on_error;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry by UTF-8 name.",
+				 function );
+
+				goto on_error;
+			}
+			/* The path cache key is case folded, hence only the names
+			 * of directories that use case folding are cached
+			 */
+			if( ( key_result != 0 )
+			 && ( directory_entries_tree->use_case_folding != 0 ) )
+			{
+				if( libfsntfs_path_cache_set_directory_entry(
+				     internal_volume->file_system->path_cache,
+				     &path_cache_key,
+				     safe_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set directory entry in path cache.",
+					 function );
+
+					goto on_error;
+				}
+			}
 		}
-		else if( result == 0 )
+		if( result == 0 )
 		{
 			break;
 		}
@@ -3064,6 +3187,16 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
 
 			goto on_error;
 		}
+		parent_file_reference = safe_directory_entry->file_reference;
+
+		/* The MFT entry is only read when its directory entries are needed
+		 * or when it is the last path segment
+		 */
+		read_mft_entry = 1;
+	}
+	if( ( result != 0 )
+	 && ( read_mft_entry != 0 ) )
+	{
 		if( libfsntfs_file_system_get_mft_entry_by_index(
 		     internal_volume->file_system,
 		     internal_volume->file_io_handle,
@@ -3289,6 +3422,8 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
      libfsntfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
+	libfsntfs_path_cache_key_t path_cache_key;
+
 	libfsntfs_directory_entries_tree_t *directory_entries_tree = NULL;
 	libfsntfs_directory_entry_t *safe_directory_entry          = NULL;
 	const uint16_t *utf16_string_segment                       = NULL;
@@ -3297,6 +3432,10 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 	size_t utf16_string_index                                  = 0;
 	size_t utf16_string_segment_length                         = 0;
 	uint64_t mft_entry_index                                   = 0;
+	uint64_t parent_file_reference                             = 0;
+	uint8_t read_mft_entry                                     = 0;
+	int cache_result                                           = 0;
+	int key_result                                             = 0;
 	int result                                                 = 0;
 
 	if( internal_volume == NULL )
@@ -3310,6 +3449,17 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 
 		return( -1 );
 	}
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
 	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
@@ -3363,10 +3513,12 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 			utf16_string_index++;
 		}
 	}
+	mft_entry_index = LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY;
+
 	if( libfsntfs_file_system_get_mft_entry_by_index(
 	     internal_volume->file_system,
 	     internal_volume->file_io_handle,
-	     LIBFSNTFS_MFT_ENTRY_INDEX_ROOT_DIRECTORY,
+	     mft_entry_index,
 	     mft_entry,
 	     error ) != 1 )
 	{
@@ -3379,6 +3531,8 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 
 		goto on_error;
 	}
+	parent_file_reference = ( *mft_entry )->file_reference;
+
 	if( ( utf16_string_length == 0 )
 	 || ( utf16_string_length == 1 ) )
 	{
@@ -3386,53 +3540,6 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 	}
 	else while( utf16_string_index < utf16_string_length )
 	{
-		if( directory_entries_tree != NULL )
-		{
-			if( libfsntfs_directory_entries_tree_free(
-			     &directory_entries_tree,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory entries tree.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		if( libfsntfs_directory_entries_tree_initialize(
-		     &directory_entries_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entries tree.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsntfs_directory_entries_tree_read_from_i30_index(
-		     directory_entries_tree,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     *mft_entry,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
-			 function,
-			 mft_entry_index );
-
-			goto on_error;
-		}
 		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
 		utf16_string_segment_length = utf16_string_index;
 
@@ -3467,54 +3574,201 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 		if( utf16_string_segment_length == 0 )
 		{
 			result = 0;
+
+			break;
 		}
-		else
+		if( safe_directory_entry != NULL )
 		{
-			if( safe_directory_entry != NULL )
+			if( libfsntfs_directory_entry_free(
+			     &safe_directory_entry,
+			     error ) != 1 )
 			{
-				if( libfsntfs_directory_entry_free(
-				     &safe_directory_entry,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory entry.",
-					 function );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entry.",
+				 function );
 
-					goto on_error;
-				}
+				goto on_error;
 			}
-			result = libfsntfs_directory_entries_tree_get_entry_by_utf16_name(
-			          directory_entries_tree,
-			          internal_volume->file_io_handle,
-			          utf16_string_segment,
-			          utf16_string_segment_length,
-			          &safe_directory_entry,
-			          error );
 		}
-		if( result == -1 )
+		/* Both names that exist and names that do not exist are cached
+		 * per parent directory
+		 */
+		key_result = libfsntfs_path_cache_key_set_utf16_name(
+		              &path_cache_key,
+		              parent_file_reference,
+		              utf16_string_segment,
+		              utf16_string_segment_length,
+		              error );
+
+		if( key_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by UTF-16 name.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path cache key.",
 			 function );
 
 			goto on_error;
 		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( libfsntfs_directory_entry_get_mft_entry_index(
-		     safe_directory_entry,
-		     &mft_entry_index,
-		     error ) != 1 )
+		cache_result = 0;
+
+		if( key_result != 0 )
 		{
-			libcerror_error_set(
+			cache_result = libfsntfs_path_cache_get_directory_entry(
+			                internal_volume->file_system->path_cache,
+			                &path_cache_key,
+			                &safe_directory_entry,
+			                error );
+
+			if( cache_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from path cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( cache_result != 0 )
+		{
+			if( safe_directory_entry != NULL )
+			{
+				result = 1;
+			}
+			else
+			{
+				result = 0;
+			}
+		}
+		else
+		{
+			if( read_mft_entry != 0 )
+			{
+				if( libfsntfs_file_system_get_mft_entry_by_index(
+				     internal_volume->file_system,
+				     internal_volume->file_io_handle,
+				     mft_entry_index,
+				     mft_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve MFT entry: %" PRIu64 ".",
+					 function,
+					 mft_entry_index );
+
+					goto on_error;
+				}
+				read_mft_entry = 0;
+			}
+			if( directory_entries_tree != NULL )
+			{
+				if( libfsntfs_directory_entries_tree_free(
+				     &directory_entries_tree,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory entries tree.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libfsntfs_directory_entries_tree_initialize(
+			     &directory_entries_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entries tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsntfs_directory_entries_tree_read_from_i30_index(
+			     directory_entries_tree,
+			     internal_volume->io_handle,
+			     internal_volume->file_io_handle,
+			     *mft_entry,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory entries tree from MFT entry: %" PRIu64 ".",
+				 function,
+				 mft_entry_index );
+
+				goto on_error;
+			}
+			result = libfsntfs_directory_entries_tree_get_entry_by_utf16_name(
+			          directory_entries_tree,
+			          internal_volume->file_io_handle,
+			          utf16_string_segment,
+			          utf16_string_segment_length,
+			          &safe_directory_entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry by UTF-16 name.",
+				 function );
+
+				goto on_error;
+			}
+			/* The path cache key is case folded, hence only the names
+			 * of directories that use case folding are cached
+			 */
+			if( ( key_result != 0 )
+			 && ( directory_entries_tree->use_case_folding != 0 ) )
+			{
+				if( libfsntfs_path_cache_set_directory_entry(
+				     internal_volume->file_system->path_cache,
+				     &path_cache_key,
+				     safe_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set directory entry in path cache.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( result == 0 )
+		{
+			break;
+		}
+		if( libfsntfs_directory_entry_get_mft_entry_index(
+		     safe_directory_entry,
+		     &mft_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
@@ -3523,6 +3777,16 @@ int libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
 
 			goto on_error;
 		}
+		parent_file_reference = safe_directory_entry->file_reference;
+
+		/* The MFT entry is only read when its directory entries are needed
+		 * or when it is the last path segment
+		 */
+		read_mft_entry = 1;
+	}
+	if( ( result != 0 )
+	 && ( read_mft_entry != 0 ) )
+	{
 		if( libfsntfs_file_system_get_mft_entry_by_index(
 		     internal_volume->file_system,
 		     internal_volume->file_io_handle,
@@ -3735,6 +3999,318 @@ int libfsntfs_volume_get_file_entry_by_utf16_path(
 	return( result );
 }
 
+/* Retrieves the file reference for an UTF-8 encoded path
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * Unlike libfsntfs_volume_get_file_entry_by_utf8_path no file entry is created
+ * and no error is set if the path does not exist
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsntfs_volume_get_file_reference_by_utf8_path(
+     libfsntfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	libfsntfs_mft_entry_t *mft_entry             = NULL;
+	static char *function                        = "libfsntfs_volume_get_file_reference_by_utf8_path";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf8_path(
+	          internal_volume,
+	          utf8_string,
+	          utf8_string_length,
+	          &mft_entry,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MFT and directory entry by path.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		*file_reference = mft_entry->file_reference;
+	}
+	if( directory_entry != NULL )
+	{
+		if( libfsntfs_directory_entry_free(
+		     &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file reference for an UTF-16 encoded path
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
+ * Unlike libfsntfs_volume_get_file_entry_by_utf16_path no file entry is created
+ * and no error is set if the path does not exist
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsntfs_volume_get_file_reference_by_utf16_path(
+     libfsntfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	libfsntfs_mft_entry_t *mft_entry             = NULL;
+	static char *function                        = "libfsntfs_volume_get_file_reference_by_utf16_path";
+	int result                                   = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsntfs_internal_volume_get_mft_and_directory_entry_by_utf16_path(
+	          internal_volume,
+	          utf16_string,
+	          utf16_string_length,
+	          &mft_entry,
+	          &directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MFT and directory entry by path.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		*file_reference = mft_entry->file_reference;
+	}
+	if( directory_entry != NULL )
+	{
+		if( libfsntfs_directory_entry_free(
+		     &directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file references for multiple UTF-8 encoded paths
+ * Paths that share parent directories are resolved by reading the $I30 index of each parent directory once
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * results[ path_index ] is set to 1 if the corresponding path was found or 0 if not,
+ * the file reference of a path that was not found is set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfsntfs_volume_get_file_references_by_utf8_paths(
+     libfsntfs_volume_t *volume,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     uint64_t *file_references,
+     int *results,
+     libcerror_error_t **error )
+{
+	libfsntfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsntfs_volume_get_file_references_by_utf8_paths";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsntfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsntfs_path_resolver_resolve_utf8_paths(
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     utf8_strings,
+	     utf8_string_lengths,
+	     number_of_paths,
+	     file_references,
+	     results,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve paths.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the USN change journal
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -3746,6 +4322,7 @@ int libfsntfs_volume_get_usn_change_journal(
 	libfsntfs_directory_entry_t *directory_entry = NULL;
 	libfsntfs_internal_volume_t *internal_volume = NULL;
 	libfsntfs_mft_attribute_t *data_attribute    = NULL;
+	libfsntfs_mft_attribute_t *max_attribute     = NULL;
 	libfsntfs_mft_entry_t *mft_entry             = NULL;
 	static char *function                        = "libfsntfs_volume_get_usn_change_journal";
 	int result                                   = 0;
@@ -3838,6 +4415,56 @@ int libfsntfs_volume_get_usn_change_journal(
 
 				result = -1;
 			}
+			else
+			{
+				directory_entry = NULL;
+
+				result = libfsntfs_mft_entry_get_alternate_data_attribute_by_utf8_name(
+				          mft_entry,
+				          (uint8_t *) "$Max",
+				          4,
+				          &max_attribute,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve $Max data attribute.",
+					 function );
+				}
+				else if( result != 0 )
+				{
+					if( libfsntfs_internal_usn_change_journal_read_max_attribute(
+					     (libfsntfs_internal_usn_change_journal_t *) *usn_change_journal,
+					     max_attribute,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read $Max data attribute.",
+						 function );
+
+						result = -1;
+					}
+				}
+				/* A journal without $Max data stream has no journal identifier
+				 */
+				if( result == -1 )
+				{
+					libfsntfs_usn_change_journal_free(
+					 usn_change_journal,
+					 NULL );
+				}
+				else
+				{
+					result = 1;
+				}
+			}
 		}
 		else
 		{
@@ -291,6 +291,32 @@ int libfsntfs_volume_get_file_entry_by_utf16_path(
      libfsntfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_file_reference_by_utf8_path(
+     libfsntfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_file_reference_by_utf16_path(
+     libfsntfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+LIBFSNTFS_EXTERN \
+int libfsntfs_volume_get_file_references_by_utf8_paths(
+     libfsntfs_volume_t *volume,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     uint64_t *file_references,
+     int *results,
+     libcerror_error_t **error );
+
 LIBFSNTFS_EXTERN \
 int libfsntfs_volume_get_usn_change_journal(
      libfsntfs_volume_t *volume,
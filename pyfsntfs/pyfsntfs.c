@@ -48,6 +48,7 @@
 #include "pyfsntfs_reparse_point_attribute.h"
 #include "pyfsntfs_security_descriptor_attribute.h"
 #include "pyfsntfs_standard_information_attribute.h"
+#include "pyfsntfs_table_column.h"
 #include "pyfsntfs_unused.h"
 #include "pyfsntfs_usn_change_journal.h"
 #include "pyfsntfs_volume.h"
@@ -616,6 +617,15 @@ PyMODINIT_FUNC initpyfsntfs(
 		return;
 #endif
 	}
+#if defined( Py_GIL_DISABLED ) && defined( LIBFSNTFS_HAVE_MULTI_THREAD_SUPPORT )
+	/* Declare the module safe to run without the GIL on free-threaded builds,
+	 * libfsntfs protects its objects with read/write locks and pyfsntfs uses
+	 * critical sections where it modifies Python object state
+	 */
+	PyUnstable_Module_SetGIL(
+	 module,
+	 Py_MOD_GIL_NOT_USED );
+#endif
 #if PY_VERSION_HEX < 0x03070000
 	PyEval_InitThreads();
 #endif
@@ -886,6 +896,23 @@ PyMODINIT_FUNC initpyfsntfs(
 	 "standard_information_attribute",
 	 (PyObject *) &pyfsntfs_attribute_type_object );
 
+	/* Setup the table column type object
+	 */
+	pyfsntfs_table_column_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfsntfs_table_column_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsntfs_table_column_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "table_column",
+	 (PyObject *) &pyfsntfs_table_column_type_object );
+
 	/* Setup the USN change journal type object
 	 */
 	pyfsntfs_usn_change_journal_type_object.tp_new = PyType_GenericNew;
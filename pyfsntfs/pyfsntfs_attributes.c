@@ -394,6 +394,7 @@ PyObject *pyfsntfs_attributes_iternext(
 {
 	PyObject *attribute_object = NULL;
 	static char *function      = "pyfsntfs_attributes_iternext";
+	int item_index             = 0;
 
 	if( sequence_object == NULL )
 	{
@@ -431,7 +432,21 @@ PyObject *pyfsntfs_attributes_iternext(
 
 		return( NULL );
 	}
-	if( sequence_object->current_index >= sequence_object->number_of_items )
+	/* Claim the current index in a critical section so that concurrent
+	 * iteration does not return the same item more than once
+	 */
+	Py_BEGIN_CRITICAL_SECTION(
+	 (PyObject *) sequence_object );
+
+	item_index = sequence_object->current_index;
+
+	if( item_index < sequence_object->number_of_items )
+	{
+		sequence_object->current_index++;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( item_index >= sequence_object->number_of_items )
 	{
 		PyErr_SetNone(
 		 PyExc_StopIteration );
@@ -440,12 +455,8 @@ PyObject *pyfsntfs_attributes_iternext(
 	}
 	attribute_object = sequence_object->get_item_by_index(
 	                    sequence_object->parent_object,
-	                    sequence_object->current_index );
+	                    item_index );
 
-	if( attribute_object != NULL )
-	{
-		sequence_object->current_index++;
-	}
 	return( attribute_object );
 }
 
@@ -395,6 +395,7 @@ PyObject *pyfsntfs_file_entries_iternext(
 {
 	PyObject *file_entry_object = NULL;
 	static char *function       = "pyfsntfs_file_entries_iternext";
+	int item_index              = 0;
 
 	if( sequence_object == NULL )
 	{
@@ -432,7 +433,21 @@ PyObject *pyfsntfs_file_entries_iternext(
 
 		return( NULL );
 	}
-	if( sequence_object->current_index >= sequence_object->number_of_items )
+	/* Claim the current index in a critical section so that concurrent
+	 * iteration does not return the same item more than once
+	 */
+	Py_BEGIN_CRITICAL_SECTION(
+	 (PyObject *) sequence_object );
+
+	item_index = sequence_object->current_index;
+
+	if( item_index < sequence_object->number_of_items )
+	{
+		sequence_object->current_index++;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( item_index >= sequence_object->number_of_items )
 	{
 		PyErr_SetNone(
 		 PyExc_StopIteration );
@@ -441,12 +456,8 @@ PyObject *pyfsntfs_file_entries_iternext(
 	}
 	file_entry_object = sequence_object->get_item_by_index(
 	                     sequence_object->parent_object,
-	                     sequence_object->current_index );
+	                     item_index );
 
-	if( file_entry_object != NULL )
-	{
-		sequence_object->current_index++;
-	}
 	return( file_entry_object );
 }
 
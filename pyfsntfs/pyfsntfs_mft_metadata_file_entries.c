@@ -399,6 +399,7 @@ PyObject *pyfsntfs_mft_metadata_file_entries_iternext(
 {
 	PyObject *file_entry_object = NULL;
 	static char *function       = "pyfsntfs_mft_metadata_file_entries_iternext";
+	uint64_t item_index         = 0;
 
 	if( pyfsntfs_mft_metadata_file_entries == NULL )
 	{
@@ -436,7 +437,21 @@ PyObject *pyfsntfs_mft_metadata_file_entries_iternext(
 
 		return( NULL );
 	}
-	if( pyfsntfs_mft_metadata_file_entries->file_entry_index >= pyfsntfs_mft_metadata_file_entries->number_of_file_entries )
+	/* Claim the current index in a critical section so that concurrent
+	 * iteration does not return the same item more than once
+	 */
+	Py_BEGIN_CRITICAL_SECTION(
+	 (PyObject *) pyfsntfs_mft_metadata_file_entries );
+
+	item_index = pyfsntfs_mft_metadata_file_entries->file_entry_index;
+
+	if( item_index < pyfsntfs_mft_metadata_file_entries->number_of_file_entries )
+	{
+		pyfsntfs_mft_metadata_file_entries->file_entry_index++;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( item_index >= pyfsntfs_mft_metadata_file_entries->number_of_file_entries )
 	{
 		PyErr_SetNone(
 		 PyExc_StopIteration );
@@ -445,12 +460,8 @@ PyObject *pyfsntfs_mft_metadata_file_entries_iternext(
 	}
 	file_entry_object = pyfsntfs_mft_metadata_file_entries->get_file_entry_by_index(
 	                     pyfsntfs_mft_metadata_file_entries->mft_metadata_file_object,
-	                     pyfsntfs_mft_metadata_file_entries->file_entry_index );
+	                     item_index );
 
-	if( file_entry_object != NULL )
-	{
-		pyfsntfs_mft_metadata_file_entries->file_entry_index++;
-	}
 	return( file_entry_object );
 }
 
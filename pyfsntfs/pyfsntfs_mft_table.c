@@ -0,0 +1,2419 @@
+/*
+ * Columnar MFT table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsntfs_libcerror.h"
+#include "pyfsntfs_libfsntfs.h"
+#include "pyfsntfs_mft_table.h"
+#include "pyfsntfs_python.h"
+#include "pyfsntfs_table_column.h"
+
+typedef struct pyfsntfs_mft_table_field_definition pyfsntfs_mft_table_field_definition_t;
+
+struct pyfsntfs_mft_table_field_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The field
+	 */
+	uint32_t field;
+};
+
+pyfsntfs_mft_table_field_definition_t pyfsntfs_mft_table_field_definitions[] = {
+	{ "file_reference", PYFSNTFS_MFT_TABLE_FIELD_FILE_REFERENCE },
+	{ "parent_file_reference", PYFSNTFS_MFT_TABLE_FIELD_PARENT_FILE_REFERENCE },
+	{ "size", PYFSNTFS_MFT_TABLE_FIELD_SIZE },
+	{ "creation_time", PYFSNTFS_MFT_TABLE_FIELD_CREATION_TIME },
+	{ "modification_time", PYFSNTFS_MFT_TABLE_FIELD_MODIFICATION_TIME },
+	{ "access_time", PYFSNTFS_MFT_TABLE_FIELD_ACCESS_TIME },
+	{ "entry_modification_time", PYFSNTFS_MFT_TABLE_FIELD_ENTRY_MODIFICATION_TIME },
+	{ "file_attribute_flags", PYFSNTFS_MFT_TABLE_FIELD_FILE_ATTRIBUTE_FLAGS },
+	{ "is_allocated", PYFSNTFS_MFT_TABLE_FIELD_IS_ALLOCATED },
+	{ "name", PYFSNTFS_MFT_TABLE_FIELD_NAME },
+	{ NULL, 0 } };
+
+typedef struct pyfsntfs_mft_table_column_definition pyfsntfs_mft_table_column_definition_t;
+
+struct pyfsntfs_mft_table_column_definition
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The field
+	 */
+	uint32_t field;
+
+	/* The item size
+	 */
+	Py_ssize_t item_size;
+};
+
+pyfsntfs_mft_table_column_definition_t pyfsntfs_mft_table_column_definitions[ PYFSNTFS_MFT_TABLE_NUMBER_OF_COLUMNS ] = {
+	{ "file_reference", PYFSNTFS_MFT_TABLE_FIELD_FILE_REFERENCE, sizeof( uint64_t ) },
+	{ "parent_file_reference", PYFSNTFS_MFT_TABLE_FIELD_PARENT_FILE_REFERENCE, sizeof( uint64_t ) },
+	{ "size", PYFSNTFS_MFT_TABLE_FIELD_SIZE, sizeof( uint64_t ) },
+	{ "creation_time", PYFSNTFS_MFT_TABLE_FIELD_CREATION_TIME, sizeof( uint64_t ) },
+	{ "modification_time", PYFSNTFS_MFT_TABLE_FIELD_MODIFICATION_TIME, sizeof( uint64_t ) },
+	{ "access_time", PYFSNTFS_MFT_TABLE_FIELD_ACCESS_TIME, sizeof( uint64_t ) },
+	{ "entry_modification_time", PYFSNTFS_MFT_TABLE_FIELD_ENTRY_MODIFICATION_TIME, sizeof( uint64_t ) },
+	{ "file_attribute_flags", PYFSNTFS_MFT_TABLE_FIELD_FILE_ATTRIBUTE_FLAGS, sizeof( uint32_t ) },
+	{ "is_allocated", PYFSNTFS_MFT_TABLE_FIELD_IS_ALLOCATED, sizeof( uint8_t ) },
+	{ "name_offsets", PYFSNTFS_MFT_TABLE_FIELD_NAME, sizeof( uint64_t ) },
+	{ "name_data", PYFSNTFS_MFT_TABLE_FIELD_NAME, sizeof( uint8_t ) },
+	{ "is_valid", PYFSNTFS_MFT_TABLE_FIELD_IS_VALID, sizeof( uint8_t ) } };
+
+/* Retrieves a field by name
+ * Returns 1 if successful, 0 if no such field or -1 on error
+ */
+int pyfsntfs_mft_table_get_field_by_name(
+     const char *name,
+     size_t name_length,
+     uint32_t *field,
+     libcerror_error_t **error )
+{
+	pyfsntfs_mft_table_field_definition_t *field_definition = NULL;
+	static char *function                                    = "pyfsntfs_mft_table_get_field_by_name";
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( field == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field.",
+		 function );
+
+		return( -1 );
+	}
+	for( field_definition = pyfsntfs_mft_table_field_definitions;
+	     field_definition->name != NULL;
+	     field_definition++ )
+	{
+		if( ( narrow_string_length(
+		       field_definition->name ) == name_length )
+		 && ( narrow_string_compare(
+		       field_definition->name,
+		       name,
+		       name_length ) == 0 ) )
+		{
+			*field = field_definition->field;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Creates a MFT table
+ * Make sure the value mft_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_initialize(
+     pyfsntfs_mft_table_t **mft_table,
+     uint32_t fields,
+     uint64_t number_of_rows,
+     libcerror_error_t **error )
+{
+	static char *function = "pyfsntfs_mft_table_initialize";
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mft_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid MFT table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fields & ~( PYFSNTFS_MFT_TABLE_FIELD_ALL ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_rows >= (uint64_t) ( ( SSIZE_MAX / sizeof( uint64_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of rows value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*mft_table = memory_allocate_structure(
+	              pyfsntfs_mft_table_t );
+
+	if( *mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create MFT table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mft_table,
+	     0,
+	     sizeof( pyfsntfs_mft_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear MFT table.",
+		 function );
+
+		memory_free(
+		 *mft_table );
+
+		*mft_table = NULL;
+
+		return( -1 );
+	}
+	( *mft_table )->fields         = fields;
+	( *mft_table )->number_of_rows = number_of_rows;
+
+	/* Allocate at least 1 value so that empty columns are backed by a valid buffer
+	 */
+	if( number_of_rows == 0 )
+	{
+		number_of_rows = 1;
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_FILE_REFERENCE ) != 0 )
+	{
+		( *mft_table )->file_references = (uint64_t *) memory_allocate(
+		                                                sizeof( uint64_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->file_references == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file references.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_PARENT_FILE_REFERENCE ) != 0 )
+	{
+		( *mft_table )->parent_file_references = (uint64_t *) memory_allocate(
+		                                                       sizeof( uint64_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->parent_file_references == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create parent file references.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_SIZE ) != 0 )
+	{
+		( *mft_table )->sizes = (uint64_t *) memory_allocate(
+		                                      sizeof( uint64_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sizes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_CREATION_TIME ) != 0 )
+	{
+		( *mft_table )->creation_times = (uint64_t *) memory_allocate(
+		                                               sizeof( uint64_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->creation_times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create creation times.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_MODIFICATION_TIME ) != 0 )
+	{
+		( *mft_table )->modification_times = (uint64_t *) memory_allocate(
+		                                                   sizeof( uint64_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->modification_times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create modification times.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_ACCESS_TIME ) != 0 )
+	{
+		( *mft_table )->access_times = (uint64_t *) memory_allocate(
+		                                             sizeof( uint64_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->access_times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create access times.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_ENTRY_MODIFICATION_TIME ) != 0 )
+	{
+		( *mft_table )->entry_modification_times = (uint64_t *) memory_allocate(
+		                                                         sizeof( uint64_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->entry_modification_times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry modification times.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_FILE_ATTRIBUTE_FLAGS ) != 0 )
+	{
+		( *mft_table )->file_attribute_flags = (uint32_t *) memory_allocate(
+		                                                     sizeof( uint32_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->file_attribute_flags == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file attribute flags.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_IS_ALLOCATED ) != 0 )
+	{
+		( *mft_table )->is_allocated = (uint8_t *) memory_allocate(
+		                                            sizeof( uint8_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->is_allocated == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create is allocated values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_NAME ) != 0 )
+	{
+		( *mft_table )->name_offsets = (uint64_t *) memory_allocate(
+		                                             sizeof( uint64_t ) * (size_t) ( ( *mft_table )->number_of_rows + 1 ) );
+
+		if( ( *mft_table )->name_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name offsets.",
+			 function );
+
+			goto on_error;
+		}
+		( *mft_table )->name_offsets[ 0 ] = 0;
+
+		/* Assume an average name of 16 bytes, the name data is resized on demand
+		 */
+		( *mft_table )->name_data_allocated_size = 16 * (size_t) number_of_rows;
+
+		( *mft_table )->name_data = (uint8_t *) memory_allocate(
+		                                         sizeof( uint8_t ) * ( *mft_table )->name_data_allocated_size );
+
+		if( ( *mft_table )->name_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( fields & PYFSNTFS_MFT_TABLE_FIELD_IS_VALID ) != 0 )
+	{
+		( *mft_table )->is_valid = (uint8_t *) memory_allocate(
+		                                        sizeof( uint8_t ) * (size_t) number_of_rows );
+
+		if( ( *mft_table )->is_valid == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create is valid values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *mft_table != NULL )
+	{
+		pyfsntfs_mft_table_free(
+		 mft_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a MFT table
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_free(
+     pyfsntfs_mft_table_t **mft_table,
+     libcerror_error_t **error )
+{
+	static char *function = "pyfsntfs_mft_table_free";
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mft_table != NULL )
+	{
+		if( ( *mft_table )->file_references != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->file_references );
+		}
+		if( ( *mft_table )->parent_file_references != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->parent_file_references );
+		}
+		if( ( *mft_table )->sizes != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->sizes );
+		}
+		if( ( *mft_table )->creation_times != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->creation_times );
+		}
+		if( ( *mft_table )->modification_times != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->modification_times );
+		}
+		if( ( *mft_table )->access_times != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->access_times );
+		}
+		if( ( *mft_table )->entry_modification_times != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->entry_modification_times );
+		}
+		if( ( *mft_table )->file_attribute_flags != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->file_attribute_flags );
+		}
+		if( ( *mft_table )->is_allocated != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->is_allocated );
+		}
+		if( ( *mft_table )->name_offsets != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->name_offsets );
+		}
+		if( ( *mft_table )->name_data != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->name_data );
+		}
+		if( ( *mft_table )->is_valid != NULL )
+		{
+			memory_free(
+			 ( *mft_table )->is_valid );
+		}
+		memory_free(
+		 *mft_table );
+
+		*mft_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the name data to hold at least an additional name size bytes
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_resize_name_data(
+     pyfsntfs_mft_table_t *mft_table,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation    = NULL;
+	static char *function    = "pyfsntfs_mft_table_resize_name_data";
+	size_t reallocation_size = 0;
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > ( (size_t) SSIZE_MAX - mft_table->name_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > ( mft_table->name_data_allocated_size - mft_table->name_data_size ) )
+	{
+		reallocation_size = mft_table->name_data_allocated_size * 2;
+
+		if( reallocation_size < ( mft_table->name_data_size + name_size ) )
+		{
+			reallocation_size = mft_table->name_data_size + name_size;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            mft_table->name_data,
+		                            sizeof( uint8_t ) * reallocation_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize name data.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->name_data                = reallocation;
+		mft_table->name_data_allocated_size = reallocation_size;
+	}
+	return( 1 );
+}
+
+/* Appends the name and parent file reference of the preferred $FILE_NAME attribute of a file entry
+ * The preferred $FILE_NAME attribute is the first one that is not in the DOS name space
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_append_name(
+     pyfsntfs_mft_table_t *mft_table,
+     uint64_t row_index,
+     libfsntfs_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	libfsntfs_attribute_t *attribute = NULL;
+	static char *function            = "pyfsntfs_mft_table_append_name";
+	size_t name_size                 = 0;
+	uint64_t parent_file_reference   = 0;
+	uint32_t attribute_type          = 0;
+	uint8_t name_space               = 0;
+	int attribute_index              = 0;
+	int name_attribute_index         = -1;
+	int number_of_attributes         = 0;
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( row_index >= mft_table->number_of_rows )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsntfs_file_entry_get_number_of_attributes(
+	     file_entry,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		goto on_error;
+	}
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
+	{
+		if( libfsntfs_file_entry_get_attribute_by_index(
+		     file_entry,
+		     attribute_index,
+		     &attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( libfsntfs_attribute_get_type(
+		     attribute,
+		     &attribute_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d type.",
+			 function,
+			 attribute_index );
+
+			goto on_error;
+		}
+		if( attribute_type == LIBFSNTFS_ATTRIBUTE_TYPE_FILE_NAME )
+		{
+			if( libfsntfs_file_name_attribute_get_name_space(
+			     attribute,
+			     &name_space,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d name space.",
+				 function,
+				 attribute_index );
+
+				goto on_error;
+			}
+			if( name_attribute_index == -1 )
+			{
+				name_attribute_index = attribute_index;
+			}
+			if( name_space != LIBFSNTFS_FILE_NAME_SPACE_DOS )
+			{
+				name_attribute_index = attribute_index;
+
+				attribute_index = number_of_attributes;
+			}
+		}
+		if( libfsntfs_attribute_free(
+		     &attribute,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free attribute.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( name_attribute_index != -1 )
+	{
+		if( libfsntfs_file_entry_get_parent_file_reference_by_attribute_index(
+		     file_entry,
+		     name_attribute_index,
+		     &parent_file_reference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent file reference from attribute: %d.",
+			 function,
+			 name_attribute_index );
+
+			goto on_error;
+		}
+		if( ( mft_table->fields & PYFSNTFS_MFT_TABLE_FIELD_NAME ) != 0 )
+		{
+			if( libfsntfs_file_entry_get_utf8_name_size_by_attribute_index(
+			     file_entry,
+			     name_attribute_index,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 name size from attribute: %d.",
+				 function,
+				 name_attribute_index );
+
+				goto on_error;
+			}
+			/* The name size includes space for the end-of-string character
+			 * which is overwritten by the next name
+			 */
+			if( pyfsntfs_mft_table_resize_name_data(
+			     mft_table,
+			     name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize name data.",
+				 function );
+
+				goto on_error;
+			}
+			if( name_size > 1 )
+			{
+				if( libfsntfs_file_entry_get_utf8_name_by_attribute_index(
+				     file_entry,
+				     name_attribute_index,
+				     &( mft_table->name_data[ mft_table->name_data_size ] ),
+				     name_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve UTF-8 name from attribute: %d.",
+					 function,
+					 name_attribute_index );
+
+					goto on_error;
+				}
+				mft_table->name_data_size += name_size - 1;
+			}
+		}
+	}
+	if( mft_table->parent_file_references != NULL )
+	{
+		mft_table->parent_file_references[ row_index ] = parent_file_reference;
+	}
+	if( mft_table->name_offsets != NULL )
+	{
+		mft_table->name_offsets[ row_index + 1 ] = (uint64_t) mft_table->name_data_size;
+	}
+	return( 1 );
+
+on_error:
+	if( attribute != NULL )
+	{
+		libfsntfs_attribute_free(
+		 &attribute,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Marks a specific row as invalid, the values of the row are set to 0 and the name is empty
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_set_invalid_row(
+     pyfsntfs_mft_table_t *mft_table,
+     uint64_t row_index,
+     libcerror_error_t **error )
+{
+	static char *function = "pyfsntfs_mft_table_set_invalid_row";
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( row_index >= mft_table->number_of_rows )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_table->file_references != NULL )
+	{
+		mft_table->file_references[ row_index ] = 0;
+	}
+	if( mft_table->parent_file_references != NULL )
+	{
+		mft_table->parent_file_references[ row_index ] = 0;
+	}
+	if( mft_table->sizes != NULL )
+	{
+		mft_table->sizes[ row_index ] = 0;
+	}
+	if( mft_table->creation_times != NULL )
+	{
+		mft_table->creation_times[ row_index ] = 0;
+	}
+	if( mft_table->modification_times != NULL )
+	{
+		mft_table->modification_times[ row_index ] = 0;
+	}
+	if( mft_table->access_times != NULL )
+	{
+		mft_table->access_times[ row_index ] = 0;
+	}
+	if( mft_table->entry_modification_times != NULL )
+	{
+		mft_table->entry_modification_times[ row_index ] = 0;
+	}
+	if( mft_table->file_attribute_flags != NULL )
+	{
+		mft_table->file_attribute_flags[ row_index ] = 0;
+	}
+	if( mft_table->is_allocated != NULL )
+	{
+		mft_table->is_allocated[ row_index ] = 0;
+	}
+	if( mft_table->name_offsets != NULL )
+	{
+		mft_table->name_offsets[ row_index + 1 ] = (uint64_t) mft_table->name_data_size;
+	}
+	if( mft_table->is_valid != NULL )
+	{
+		mft_table->is_valid[ row_index ] = 0;
+	}
+	return( 1 );
+}
+
+/* Reads the values of a file entry into a specific row
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_read_file_entry(
+     pyfsntfs_mft_table_t *mft_table,
+     uint64_t row_index,
+     libfsntfs_file_entry_t *file_entry,
+     libcerror_error_t **error )
+{
+	static char *function         = "pyfsntfs_mft_table_read_file_entry";
+	size64_t size                 = 0;
+	uint64_t value_64bit          = 0;
+	uint32_t file_attribute_flags = 0;
+	int result                    = 0;
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( row_index >= mft_table->number_of_rows )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_table->file_references != NULL )
+	{
+		if( libfsntfs_file_entry_get_file_reference(
+		     file_entry,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file reference.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->file_references[ row_index ] = value_64bit;
+	}
+	if( mft_table->sizes != NULL )
+	{
+		if( libfsntfs_file_entry_get_size(
+		     file_entry,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->sizes[ row_index ] = (uint64_t) size;
+	}
+	if( mft_table->creation_times != NULL )
+	{
+		value_64bit = 0;
+
+		if( libfsntfs_file_entry_get_creation_time(
+		     file_entry,
+		     &value_64bit,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve creation time.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->creation_times[ row_index ] = value_64bit;
+	}
+	if( mft_table->modification_times != NULL )
+	{
+		value_64bit = 0;
+
+		if( libfsntfs_file_entry_get_modification_time(
+		     file_entry,
+		     &value_64bit,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve modification time.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->modification_times[ row_index ] = value_64bit;
+	}
+	if( mft_table->access_times != NULL )
+	{
+		value_64bit = 0;
+
+		if( libfsntfs_file_entry_get_access_time(
+		     file_entry,
+		     &value_64bit,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access time.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->access_times[ row_index ] = value_64bit;
+	}
+	if( mft_table->entry_modification_times != NULL )
+	{
+		value_64bit = 0;
+
+		if( libfsntfs_file_entry_get_entry_modification_time(
+		     file_entry,
+		     &value_64bit,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry modification time.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->entry_modification_times[ row_index ] = value_64bit;
+	}
+	if( mft_table->file_attribute_flags != NULL )
+	{
+		file_attribute_flags = 0;
+
+		if( libfsntfs_file_entry_get_file_attribute_flags(
+		     file_entry,
+		     &file_attribute_flags,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file attribute flags.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->file_attribute_flags[ row_index ] = file_attribute_flags;
+	}
+	if( mft_table->is_allocated != NULL )
+	{
+		result = libfsntfs_file_entry_is_allocated(
+		          file_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file entry is allocated.",
+			 function );
+
+			return( -1 );
+		}
+		mft_table->is_allocated[ row_index ] = (uint8_t) result;
+	}
+	if( ( mft_table->fields & ( PYFSNTFS_MFT_TABLE_FIELD_PARENT_FILE_REFERENCE | PYFSNTFS_MFT_TABLE_FIELD_NAME ) ) != 0 )
+	{
+		if( pyfsntfs_mft_table_append_name(
+		     mft_table,
+		     row_index,
+		     file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to append name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( mft_table->is_valid != NULL )
+	{
+		mft_table->is_valid[ row_index ] = 1;
+	}
+	return( 1 );
+}
+
+/* Reads the MFT table from the file entries of a volume
+ * Rows of file entries that cannot be read, such as corrupt MFT entries, are marked as invalid
+ * This function does not use the Python C API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_read_volume(
+     pyfsntfs_mft_table_t *mft_table,
+     libfsntfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error      = NULL;
+	libfsntfs_file_entry_t *file_entry = NULL;
+	static char *function              = "pyfsntfs_mft_table_read_volume";
+	uint64_t row_index                 = 0;
+	int result                         = 0;
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	for( row_index = 0;
+	     row_index < mft_table->number_of_rows;
+	     row_index++ )
+	{
+		result = libfsntfs_volume_get_file_entry_by_index(
+		          volume,
+		          row_index,
+		          &file_entry,
+		          &read_error );
+
+		if( result == 1 )
+		{
+			result = pyfsntfs_mft_table_read_file_entry(
+			          mft_table,
+			          row_index,
+			          file_entry,
+			          &read_error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_free(
+			 &read_error );
+
+			if( pyfsntfs_mft_table_set_invalid_row(
+			     mft_table,
+			     row_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set row: %" PRIu64 " as invalid.",
+				 function,
+				 row_index );
+
+				goto on_error;
+			}
+		}
+		if( file_entry != NULL )
+		{
+			if( libfsntfs_file_entry_free(
+			     &file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry: %" PRIu64 ".",
+				 function,
+				 row_index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies the values of a row of another MFT table into a specific row
+ * The source MFT table must contain at least the fields of the MFT table, except for
+ * the is valid field, rows of a source MFT table without is valid values are valid
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_copy_row(
+     pyfsntfs_mft_table_t *mft_table,
+     uint64_t row_index,
+     pyfsntfs_mft_table_t *source_mft_table,
+     uint64_t source_row_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "pyfsntfs_mft_table_copy_row";
+	uint64_t name_data_end  = 0;
+	uint64_t name_data_start = 0;
+	size_t name_size        = 0;
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( row_index >= mft_table->number_of_rows )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mft_table->fields & ~( source_mft_table->fields | PYFSNTFS_MFT_TABLE_FIELD_IS_VALID ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid source MFT table - missing fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_row_index >= source_mft_table->number_of_rows )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_table->file_references != NULL )
+	{
+		mft_table->file_references[ row_index ] = source_mft_table->file_references[ source_row_index ];
+	}
+	if( mft_table->parent_file_references != NULL )
+	{
+		mft_table->parent_file_references[ row_index ] = source_mft_table->parent_file_references[ source_row_index ];
+	}
+	if( mft_table->sizes != NULL )
+	{
+		mft_table->sizes[ row_index ] = source_mft_table->sizes[ source_row_index ];
+	}
+	if( mft_table->creation_times != NULL )
+	{
+		mft_table->creation_times[ row_index ] = source_mft_table->creation_times[ source_row_index ];
+	}
+	if( mft_table->modification_times != NULL )
+	{
+		mft_table->modification_times[ row_index ] = source_mft_table->modification_times[ source_row_index ];
+	}
+	if( mft_table->access_times != NULL )
+	{
+		mft_table->access_times[ row_index ] = source_mft_table->access_times[ source_row_index ];
+	}
+	if( mft_table->entry_modification_times != NULL )
+	{
+		mft_table->entry_modification_times[ row_index ] = source_mft_table->entry_modification_times[ source_row_index ];
+	}
+	if( mft_table->file_attribute_flags != NULL )
+	{
+		mft_table->file_attribute_flags[ row_index ] = source_mft_table->file_attribute_flags[ source_row_index ];
+	}
+	if( mft_table->is_allocated != NULL )
+	{
+		mft_table->is_allocated[ row_index ] = source_mft_table->is_allocated[ source_row_index ];
+	}
+	if( mft_table->name_offsets != NULL )
+	{
+		name_data_start = source_mft_table->name_offsets[ source_row_index ];
+		name_data_end   = source_mft_table->name_offsets[ source_row_index + 1 ];
+
+		if( ( name_data_start > name_data_end )
+		 || ( name_data_end > (uint64_t) source_mft_table->name_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source MFT table - name offsets of row: %" PRIu64 " value out of bounds.",
+			 function,
+			 source_row_index );
+
+			return( -1 );
+		}
+		name_size = (size_t) ( name_data_end - name_data_start );
+
+		if( name_size > 0 )
+		{
+			if( pyfsntfs_mft_table_resize_name_data(
+			     mft_table,
+			     name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize name data.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( mft_table->name_data[ mft_table->name_data_size ] ),
+			     &( source_mft_table->name_data[ name_data_start ] ),
+			     name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy name data.",
+				 function );
+
+				return( -1 );
+			}
+			mft_table->name_data_size += name_size;
+		}
+		mft_table->name_offsets[ row_index + 1 ] = (uint64_t) mft_table->name_data_size;
+	}
+	if( mft_table->is_valid != NULL )
+	{
+		if( source_mft_table->is_valid != NULL )
+		{
+			mft_table->is_valid[ row_index ] = source_mft_table->is_valid[ source_row_index ];
+		}
+		else
+		{
+			mft_table->is_valid[ row_index ] = 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Marks the rows of the file entries that were changed since the next update sequence number (USN)
+ * The changed rows are determined from the file references of the USN records in the USN change journal
+ * The journal identifier and next update sequence number of the USN change journal are returned
+ * so that they can be passed to a next refresh
+ * Returns 1 if successful, 0 if the changes cannot be determined from the USN change journal,
+ * such as when it does not contain all the changes or its USN records cannot be read, or -1 on error
+ */
+int pyfsntfs_mft_table_read_changed_rows(
+     libfsntfs_volume_t *volume,
+     uint64_t journal_identifier,
+     uint64_t next_update_sequence_number,
+     uint8_t *changed_rows,
+     uint64_t number_of_rows,
+     uint64_t *current_journal_identifier,
+     uint64_t *journal_next_update_sequence_number,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error                      = NULL;
+	libfsntfs_usn_change_journal_t *usn_change_journal = NULL;
+	uint8_t *usn_records_data                          = NULL;
+	static char *function                              = "pyfsntfs_mft_table_read_changed_rows";
+	size_t usn_records_data_offset                     = 0;
+	ssize_t read_count                                 = 0;
+	uint64_t file_reference                            = 0;
+	uint64_t mft_entry_index                           = 0;
+	uint64_t update_sequence_number                    = 0;
+	uint32_t usn_record_size                           = 0;
+	int number_of_usn_records                          = 0;
+	int result                                         = 0;
+
+	if( changed_rows == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid changed rows.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_journal_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current journal identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_next_update_sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal next update sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	*current_journal_identifier          = 0;
+	*journal_next_update_sequence_number = 0;
+
+	result = libfsntfs_volume_get_usn_change_journal(
+	          volume,
+	          &usn_change_journal,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve USN change journal.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsntfs_usn_change_journal_get_next_usn(
+	     usn_change_journal,
+	     journal_next_update_sequence_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next USN of USN change journal.",
+		 function );
+
+		goto on_error;
+	}
+	/* A journal without $Max data stream has no journal identifier, which is represented by 0
+	 */
+	if( libfsntfs_usn_change_journal_get_journal_identifier(
+	     usn_change_journal,
+	     current_journal_identifier,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve journal identifier of USN change journal.",
+		 function );
+
+		goto on_error;
+	}
+	usn_records_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * PYFSNTFS_MFT_TABLE_USN_RECORDS_DATA_SIZE );
+
+	if( usn_records_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create USN records data.",
+		 function );
+
+		goto on_error;
+	}
+	/* A different journal identifier indicates the journal was deleted and created again
+	 * and the next update sequence number no longer refers to a position in this journal
+	 */
+	result = 1;
+
+	if( journal_identifier != *current_journal_identifier )
+	{
+		result = 0;
+	}
+	/* A next update sequence number beyond the end of the journal cannot have been
+	 * returned by this journal
+	 */
+	else if( next_update_sequence_number > *journal_next_update_sequence_number )
+	{
+		result = 0;
+	}
+	/* Determine if the USN records since the next update sequence number were removed when the journal was truncated
+	 */
+	if( result != 0 )
+	{
+		result = libfsntfs_usn_change_journal_seek_usn(
+		          usn_change_journal,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to seek first USN record.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			read_count = libfsntfs_usn_change_journal_read_usn_records(
+			              usn_change_journal,
+			              usn_records_data,
+			              PYFSNTFS_MFT_TABLE_USN_RECORDS_DATA_SIZE,
+			              &number_of_usn_records,
+			              &read_error );
+
+			/* USN records that cannot be read, such as USN records of an unsupported
+			 * version, require all the file entries to be read
+			 */
+			if( read_count < 0 )
+			{
+				libcerror_error_free(
+				 &read_error );
+
+				result = 0;
+			}
+			else if( read_count >= 60 )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( usn_records_data[ 24 ] ),
+				 update_sequence_number );
+
+				if( next_update_sequence_number < update_sequence_number )
+				{
+					result = 0;
+				}
+			}
+		}
+		else if( next_update_sequence_number < *journal_next_update_sequence_number )
+		{
+			/* The journal contains no USN records
+			 */
+			result = 0;
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+	if( result != 0 )
+	{
+		result = libfsntfs_usn_change_journal_seek_usn(
+		          usn_change_journal,
+		          next_update_sequence_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to seek USN: %" PRIu64 ".",
+			 function,
+			 next_update_sequence_number );
+
+			goto on_error;
+		}
+		/* Read the USN records until the end of the journal, if no record was found
+		 * reading continues at the end of the journal
+		 */
+		result = 1;
+
+		while( result != 0 )
+		{
+			read_count = libfsntfs_usn_change_journal_read_usn_records(
+			              usn_change_journal,
+			              usn_records_data,
+			              PYFSNTFS_MFT_TABLE_USN_RECORDS_DATA_SIZE,
+			              &number_of_usn_records,
+			              &read_error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_free(
+				 &read_error );
+
+				result = 0;
+
+				break;
+			}
+			else if( read_count == 0 )
+			{
+				break;
+			}
+			usn_records_data_offset = 0;
+
+			while( ( (size_t) read_count - usn_records_data_offset ) >= 60 )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( usn_records_data[ usn_records_data_offset ] ),
+				 usn_record_size );
+
+				byte_stream_copy_to_uint64_little_endian(
+				 &( usn_records_data[ usn_records_data_offset + 8 ] ),
+				 file_reference );
+
+				if( ( usn_record_size < 60 )
+				 || ( (size_t) usn_record_size > ( (size_t) read_count - usn_records_data_offset ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid USN record size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				mft_entry_index = file_reference & 0x0000ffffffffffffUL;
+
+				if( mft_entry_index < number_of_rows )
+				{
+					changed_rows[ mft_entry_index ] = 1;
+				}
+				usn_records_data_offset += usn_record_size;
+			}
+		}
+	}
+	memory_free(
+	 usn_records_data );
+
+	usn_records_data = NULL;
+
+	if( libfsntfs_usn_change_journal_free(
+	     &usn_change_journal,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free USN change journal.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( usn_records_data != NULL )
+	{
+		memory_free(
+		 usn_records_data );
+	}
+	if( usn_change_journal != NULL )
+	{
+		libfsntfs_usn_change_journal_free(
+		 &usn_change_journal,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Refreshes a MFT table from a previously read MFT table and the file entries of a volume
+ * Only the file entries that were changed since the next update sequence number (USN) and the
+ * file entries that were added to the volume are read, the other rows are copied from the
+ * previous MFT table. If the journal identifier differs or the USN change journal does not
+ * contain all the changes since the next update sequence number all the file entries are read.
+ * Rows of file entries that cannot be read are marked as invalid
+ * This function does not use the Python C API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_refresh_volume(
+     pyfsntfs_mft_table_t *mft_table,
+     pyfsntfs_mft_table_t *previous_mft_table,
+     libfsntfs_volume_t *volume,
+     uint64_t journal_identifier,
+     uint64_t next_update_sequence_number,
+     uint64_t *current_journal_identifier,
+     uint64_t *journal_next_update_sequence_number,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error      = NULL;
+	libfsntfs_file_entry_t *file_entry = NULL;
+	uint8_t *changed_rows              = NULL;
+	static char *function              = "pyfsntfs_mft_table_refresh_volume";
+	uint64_t row_index                 = 0;
+	int read_result                    = 0;
+	int result                         = 0;
+
+	if( mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_mft_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( mft_table->number_of_rows > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid MFT table - number of rows value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Allocate at least 1 value so that an empty MFT table is supported
+	 */
+	changed_rows = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * (size_t) ( mft_table->number_of_rows + 1 ) );
+
+	if( changed_rows == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create changed rows.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     changed_rows,
+	     0,
+	     sizeof( uint8_t ) * (size_t) ( mft_table->number_of_rows + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear changed rows.",
+		 function );
+
+		goto on_error;
+	}
+	result = pyfsntfs_mft_table_read_changed_rows(
+	          volume,
+	          journal_identifier,
+	          next_update_sequence_number,
+	          changed_rows,
+	          mft_table->number_of_rows,
+	          current_journal_identifier,
+	          journal_next_update_sequence_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read changed rows.",
+		 function );
+
+		goto on_error;
+	}
+	for( row_index = 0;
+	     row_index < mft_table->number_of_rows;
+	     row_index++ )
+	{
+		if( ( result != 0 )
+		 && ( changed_rows[ row_index ] == 0 )
+		 && ( row_index < previous_mft_table->number_of_rows ) )
+		{
+			if( pyfsntfs_mft_table_copy_row(
+			     mft_table,
+			     row_index,
+			     previous_mft_table,
+			     row_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy row: %" PRIu64 ".",
+				 function,
+				 row_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+		read_result = libfsntfs_volume_get_file_entry_by_index(
+		               volume,
+		               row_index,
+		               &file_entry,
+		               &read_error );
+
+		if( read_result == 1 )
+		{
+			read_result = pyfsntfs_mft_table_read_file_entry(
+			               mft_table,
+			               row_index,
+			               file_entry,
+			               &read_error );
+		}
+		if( read_result != 1 )
+		{
+			libcerror_error_free(
+			 &read_error );
+
+			if( pyfsntfs_mft_table_set_invalid_row(
+			     mft_table,
+			     row_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set row: %" PRIu64 " as invalid.",
+				 function,
+				 row_index );
+
+				goto on_error;
+			}
+		}
+		if( file_entry != NULL )
+		{
+			if( libfsntfs_file_entry_free(
+			     &file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file entry: %" PRIu64 ".",
+				 function,
+				 row_index );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 changed_rows );
+
+	return( 1 );
+
+on_error:
+	if( file_entry != NULL )
+	{
+		libfsntfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( changed_rows != NULL )
+	{
+		memory_free(
+		 changed_rows );
+	}
+	return( -1 );
+}
+
+/* Sets a column in a dictionary object
+ * The column takes over ownership of data
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_set_column(
+     PyObject *dictionary_object,
+     const char *name,
+     uint8_t **data,
+     Py_ssize_t number_of_items,
+     Py_ssize_t item_size,
+     char *format )
+{
+	PyObject *column_object = NULL;
+	static char *function   = "pyfsntfs_mft_table_set_column";
+
+	if( ( data == NULL )
+	 || ( *data == NULL ) )
+	{
+		return( 1 );
+	}
+	column_object = pyfsntfs_table_column_new(
+	                 *data,
+	                 number_of_items,
+	                 item_size,
+	                 format );
+
+	if( column_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create %s column object.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	*data = NULL;
+
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     name,
+	     column_object ) != 0 )
+	{
+		Py_DecRef(
+		 column_object );
+
+		return( -1 );
+	}
+	Py_DecRef(
+	 column_object );
+
+	return( 1 );
+}
+
+/* Retrieves a buffer of a column in a dictionary object
+ * Returns 1 if successful, 0 if no such column or -1 on error
+ */
+int pyfsntfs_mft_table_get_column_buffer(
+     PyObject *dictionary_object,
+     const char *name,
+     Py_ssize_t item_size,
+     Py_buffer *buffer )
+{
+	PyObject *column_object = NULL;
+	static char *function   = "pyfsntfs_mft_table_get_column_buffer";
+	int result              = 0;
+
+	result = PyMapping_HasKeyString(
+	          dictionary_object,
+	          (char *) name );
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	column_object = PyMapping_GetItemString(
+	                 dictionary_object,
+	                 (char *) name );
+
+	if( column_object == NULL )
+	{
+		return( -1 );
+	}
+	if( PyObject_GetBuffer(
+	     column_object,
+	     buffer,
+	     PyBUF_C_CONTIGUOUS ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported %s column object type.",
+		 function,
+		 name );
+
+		goto on_error;
+	}
+	if( ( buffer->ndim != 1 )
+	 || ( buffer->itemsize != item_size ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported %s column item size.",
+		 function,
+		 name );
+
+		PyBuffer_Release(
+		 buffer );
+
+		goto on_error;
+	}
+	Py_DecRef(
+	 column_object );
+
+	return( 1 );
+
+on_error:
+	if( column_object != NULL )
+	{
+		Py_DecRef(
+		 column_object );
+	}
+	return( -1 );
+}
+
+/* Sets a MFT table from the columns in a dictionary object
+ * The MFT table does not take over ownership of the column values, these remain valid
+ * until the buffers, that must contain PYFSNTFS_MFT_TABLE_NUMBER_OF_COLUMNS values,
+ * are released by pyfsntfs_mft_table_release_column_buffers
+ * Returns 1 if successful or -1 on error
+ */
+int pyfsntfs_mft_table_set_from_columns(
+     pyfsntfs_mft_table_t *mft_table,
+     PyObject *dictionary_object,
+     Py_buffer *buffers )
+{
+	static char *function     = "pyfsntfs_mft_table_set_from_columns";
+	Py_ssize_t item_size      = 0;
+	Py_ssize_t number_of_rows = -1;
+	int column_index          = 0;
+	int result                = 0;
+
+	if( mft_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffers == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( PyMapping_Check(
+	     dictionary_object ) == 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported MFT table object type.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     mft_table,
+	     0,
+	     sizeof( pyfsntfs_mft_table_t ) ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear MFT table.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < PYFSNTFS_MFT_TABLE_NUMBER_OF_COLUMNS;
+	     column_index++ )
+	{
+		item_size = pyfsntfs_mft_table_column_definitions[ column_index ].item_size;
+
+		result = pyfsntfs_mft_table_get_column_buffer(
+		          dictionary_object,
+		          pyfsntfs_mft_table_column_definitions[ column_index ].name,
+		          item_size,
+		          &( buffers[ column_index ] ) );
+
+		if( result == -1 )
+		{
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		mft_table->fields |= pyfsntfs_mft_table_column_definitions[ column_index ].field;
+
+		/* The name data column has no relation with the number of rows
+		 * and the name offsets column contains number of rows + 1 values
+		 */
+		if( column_index == PYFSNTFS_MFT_TABLE_COLUMN_NAME_DATA )
+		{
+			mft_table->name_data      = (uint8_t *) buffers[ column_index ].buf;
+			mft_table->name_data_size = (size_t) buffers[ column_index ].len;
+
+			continue;
+		}
+		if( column_index == PYFSNTFS_MFT_TABLE_COLUMN_NAME_OFFSETS )
+		{
+			if( buffers[ column_index ].len < item_size )
+			{
+				PyErr_Format(
+				 PyExc_ValueError,
+				 "%s: invalid name offsets column - missing values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( number_of_rows == -1 )
+		{
+			number_of_rows = buffers[ column_index ].len / item_size;
+
+			if( column_index == PYFSNTFS_MFT_TABLE_COLUMN_NAME_OFFSETS )
+			{
+				number_of_rows -= 1;
+			}
+		}
+		else if( ( ( column_index == PYFSNTFS_MFT_TABLE_COLUMN_NAME_OFFSETS )
+		       && ( ( buffers[ column_index ].len / item_size ) != ( number_of_rows + 1 ) ) )
+		      || ( ( column_index != PYFSNTFS_MFT_TABLE_COLUMN_NAME_OFFSETS )
+		       && ( ( buffers[ column_index ].len / item_size ) != number_of_rows ) ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid %s column - number of values does not match number of rows.",
+			 function,
+			 pyfsntfs_mft_table_column_definitions[ column_index ].name );
+
+			return( -1 );
+		}
+	}
+	if( ( mft_table->fields & ~( PYFSNTFS_MFT_TABLE_FIELD_IS_VALID ) ) == 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid MFT table - missing columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffers[ PYFSNTFS_MFT_TABLE_COLUMN_NAME_OFFSETS ].obj == NULL )
+	 != ( buffers[ PYFSNTFS_MFT_TABLE_COLUMN_NAME_DATA ].obj == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid MFT table - name offsets and name data columns are required.",
+		 function );
+
+		return( -1 );
+	}
+	mft_table->number_of_rows           = (uint64_t) number_of_rows;
+	mft_table->file_references          = (uint64_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_FILE_REFERENCE ].buf;
+	mft_table->parent_file_references   = (uint64_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_PARENT_FILE_REFERENCE ].buf;
+	mft_table->sizes                    = (uint64_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_SIZE ].buf;
+	mft_table->creation_times           = (uint64_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_CREATION_TIME ].buf;
+	mft_table->modification_times       = (uint64_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_MODIFICATION_TIME ].buf;
+	mft_table->access_times             = (uint64_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_ACCESS_TIME ].buf;
+	mft_table->entry_modification_times = (uint64_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_ENTRY_MODIFICATION_TIME ].buf;
+	mft_table->file_attribute_flags     = (uint32_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_FILE_ATTRIBUTE_FLAGS ].buf;
+	mft_table->is_allocated             = (uint8_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_IS_ALLOCATED ].buf;
+	mft_table->name_offsets             = (uint64_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_NAME_OFFSETS ].buf;
+	mft_table->is_valid                 = (uint8_t *) buffers[ PYFSNTFS_MFT_TABLE_COLUMN_IS_VALID ].buf;
+
+	return( 1 );
+}
+
+/* Releases the column buffers
+ * The buffers must contain PYFSNTFS_MFT_TABLE_NUMBER_OF_COLUMNS values
+ */
+void pyfsntfs_mft_table_release_column_buffers(
+      Py_buffer *buffers )
+{
+	int column_index = 0;
+
+	if( buffers == NULL )
+	{
+		return;
+	}
+	for( column_index = 0;
+	     column_index < PYFSNTFS_MFT_TABLE_NUMBER_OF_COLUMNS;
+	     column_index++ )
+	{
+		if( buffers[ column_index ].obj != NULL )
+		{
+			PyBuffer_Release(
+			 &( buffers[ column_index ] ) );
+		}
+	}
+}
+
+/* Retrieves the columns of the MFT table as a dictionary of table column objects
+ * The table columns take over ownership of the MFT table values
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_mft_table_get_columns(
+           pyfsntfs_mft_table_t *mft_table )
+{
+	PyObject *dictionary_object = NULL;
+	static char *function       = "pyfsntfs_mft_table_get_columns";
+	Py_ssize_t number_of_rows   = 0;
+
+	if( mft_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid MFT table.",
+		 function );
+
+		return( NULL );
+	}
+	number_of_rows = (Py_ssize_t) mft_table->number_of_rows;
+
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "file_reference",
+	     (uint8_t **) &( mft_table->file_references ),
+	     number_of_rows,
+	     sizeof( uint64_t ),
+	     "Q" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "parent_file_reference",
+	     (uint8_t **) &( mft_table->parent_file_references ),
+	     number_of_rows,
+	     sizeof( uint64_t ),
+	     "Q" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "size",
+	     (uint8_t **) &( mft_table->sizes ),
+	     number_of_rows,
+	     sizeof( uint64_t ),
+	     "Q" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "creation_time",
+	     (uint8_t **) &( mft_table->creation_times ),
+	     number_of_rows,
+	     sizeof( uint64_t ),
+	     "Q" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "modification_time",
+	     (uint8_t **) &( mft_table->modification_times ),
+	     number_of_rows,
+	     sizeof( uint64_t ),
+	     "Q" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "access_time",
+	     (uint8_t **) &( mft_table->access_times ),
+	     number_of_rows,
+	     sizeof( uint64_t ),
+	     "Q" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "entry_modification_time",
+	     (uint8_t **) &( mft_table->entry_modification_times ),
+	     number_of_rows,
+	     sizeof( uint64_t ),
+	     "Q" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "file_attribute_flags",
+	     (uint8_t **) &( mft_table->file_attribute_flags ),
+	     number_of_rows,
+	     sizeof( uint32_t ),
+	     "I" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "is_allocated",
+	     (uint8_t **) &( mft_table->is_allocated ),
+	     number_of_rows,
+	     sizeof( uint8_t ),
+	     "B" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "name_offsets",
+	     (uint8_t **) &( mft_table->name_offsets ),
+	     number_of_rows + 1,
+	     sizeof( uint64_t ),
+	     "Q" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "name_data",
+	     &( mft_table->name_data ),
+	     (Py_ssize_t) mft_table->name_data_size,
+	     sizeof( uint8_t ),
+	     "B" ) != 1 )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_set_column(
+	     dictionary_object,
+	     "is_valid",
+	     &( mft_table->is_valid ),
+	     number_of_rows,
+	     sizeof( uint8_t ),
+	     "B" ) != 1 )
+	{
+		goto on_error;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	return( NULL );
+}
+
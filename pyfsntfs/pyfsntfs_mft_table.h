@@ -0,0 +1,246 @@
+/*
+ * Columnar MFT table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSNTFS_MFT_TABLE_H )
+#define _PYFSNTFS_MFT_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsntfs_libcerror.h"
+#include "pyfsntfs_libfsntfs.h"
+#include "pyfsntfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum PYFSNTFS_MFT_TABLE_FIELDS
+{
+	PYFSNTFS_MFT_TABLE_FIELD_FILE_REFERENCE			= 0x00000001UL,
+	PYFSNTFS_MFT_TABLE_FIELD_PARENT_FILE_REFERENCE		= 0x00000002UL,
+	PYFSNTFS_MFT_TABLE_FIELD_SIZE				= 0x00000004UL,
+	PYFSNTFS_MFT_TABLE_FIELD_CREATION_TIME			= 0x00000008UL,
+	PYFSNTFS_MFT_TABLE_FIELD_MODIFICATION_TIME		= 0x00000010UL,
+	PYFSNTFS_MFT_TABLE_FIELD_ACCESS_TIME			= 0x00000020UL,
+	PYFSNTFS_MFT_TABLE_FIELD_ENTRY_MODIFICATION_TIME	= 0x00000040UL,
+	PYFSNTFS_MFT_TABLE_FIELD_FILE_ATTRIBUTE_FLAGS		= 0x00000080UL,
+	PYFSNTFS_MFT_TABLE_FIELD_IS_ALLOCATED			= 0x00000100UL,
+	PYFSNTFS_MFT_TABLE_FIELD_NAME				= 0x00000200UL,
+	PYFSNTFS_MFT_TABLE_FIELD_IS_VALID			= 0x00000400UL,
+
+	PYFSNTFS_MFT_TABLE_FIELD_ALL				= 0x000007ffUL
+};
+
+enum PYFSNTFS_MFT_TABLE_COLUMNS
+{
+	PYFSNTFS_MFT_TABLE_COLUMN_FILE_REFERENCE		= 0,
+	PYFSNTFS_MFT_TABLE_COLUMN_PARENT_FILE_REFERENCE		= 1,
+	PYFSNTFS_MFT_TABLE_COLUMN_SIZE				= 2,
+	PYFSNTFS_MFT_TABLE_COLUMN_CREATION_TIME			= 3,
+	PYFSNTFS_MFT_TABLE_COLUMN_MODIFICATION_TIME		= 4,
+	PYFSNTFS_MFT_TABLE_COLUMN_ACCESS_TIME			= 5,
+	PYFSNTFS_MFT_TABLE_COLUMN_ENTRY_MODIFICATION_TIME	= 6,
+	PYFSNTFS_MFT_TABLE_COLUMN_FILE_ATTRIBUTE_FLAGS		= 7,
+	PYFSNTFS_MFT_TABLE_COLUMN_IS_ALLOCATED			= 8,
+	PYFSNTFS_MFT_TABLE_COLUMN_NAME_OFFSETS			= 9,
+	PYFSNTFS_MFT_TABLE_COLUMN_NAME_DATA			= 10,
+	PYFSNTFS_MFT_TABLE_COLUMN_IS_VALID			= 11
+};
+
+/* The number of columns
+ */
+#define PYFSNTFS_MFT_TABLE_NUMBER_OF_COLUMNS			12
+
+/* The size of the buffer used to read the USN records
+ */
+#define PYFSNTFS_MFT_TABLE_USN_RECORDS_DATA_SIZE		( 1024 * 1024 )
+
+typedef struct pyfsntfs_mft_table pyfsntfs_mft_table_t;
+
+struct pyfsntfs_mft_table
+{
+	/* The fields
+	 */
+	uint32_t fields;
+
+	/* The number of rows
+	 */
+	uint64_t number_of_rows;
+
+	/* The file references
+	 */
+	uint64_t *file_references;
+
+	/* The parent file references
+	 */
+	uint64_t *parent_file_references;
+
+	/* The sizes
+	 */
+	uint64_t *sizes;
+
+	/* The creation times
+	 */
+	uint64_t *creation_times;
+
+	/* The modification times
+	 */
+	uint64_t *modification_times;
+
+	/* The access times
+	 */
+	uint64_t *access_times;
+
+	/* The entry modification times
+	 */
+	uint64_t *entry_modification_times;
+
+	/* The file attribute flags
+	 */
+	uint32_t *file_attribute_flags;
+
+	/* The is allocated values
+	 */
+	uint8_t *is_allocated;
+
+	/* The name offsets, contains number of rows + 1 values
+	 */
+	uint64_t *name_offsets;
+
+	/* The UTF-8 encoded name data, without end-of-string characters
+	 */
+	uint8_t *name_data;
+
+	/* The name data size
+	 */
+	size_t name_data_size;
+
+	/* The name data allocated size
+	 */
+	size_t name_data_allocated_size;
+
+	/* The is valid values, where 0 indicates the file entry could not be read
+	 */
+	uint8_t *is_valid;
+};
+
+int pyfsntfs_mft_table_get_field_by_name(
+     const char *name,
+     size_t name_length,
+     uint32_t *field,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_initialize(
+     pyfsntfs_mft_table_t **mft_table,
+     uint32_t fields,
+     uint64_t number_of_rows,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_free(
+     pyfsntfs_mft_table_t **mft_table,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_resize_name_data(
+     pyfsntfs_mft_table_t *mft_table,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_append_name(
+     pyfsntfs_mft_table_t *mft_table,
+     uint64_t row_index,
+     libfsntfs_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_set_invalid_row(
+     pyfsntfs_mft_table_t *mft_table,
+     uint64_t row_index,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_read_file_entry(
+     pyfsntfs_mft_table_t *mft_table,
+     uint64_t row_index,
+     libfsntfs_file_entry_t *file_entry,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_read_volume(
+     pyfsntfs_mft_table_t *mft_table,
+     libfsntfs_volume_t *volume,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_copy_row(
+     pyfsntfs_mft_table_t *mft_table,
+     uint64_t row_index,
+     pyfsntfs_mft_table_t *source_mft_table,
+     uint64_t source_row_index,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_read_changed_rows(
+     libfsntfs_volume_t *volume,
+     uint64_t journal_identifier,
+     uint64_t next_update_sequence_number,
+     uint8_t *changed_rows,
+     uint64_t number_of_rows,
+     uint64_t *current_journal_identifier,
+     uint64_t *journal_next_update_sequence_number,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_refresh_volume(
+     pyfsntfs_mft_table_t *mft_table,
+     pyfsntfs_mft_table_t *previous_mft_table,
+     libfsntfs_volume_t *volume,
+     uint64_t journal_identifier,
+     uint64_t next_update_sequence_number,
+     uint64_t *current_journal_identifier,
+     uint64_t *journal_next_update_sequence_number,
+     libcerror_error_t **error );
+
+int pyfsntfs_mft_table_set_column(
+     PyObject *dictionary_object,
+     const char *name,
+     uint8_t **data,
+     Py_ssize_t number_of_items,
+     Py_ssize_t item_size,
+     char *format );
+
+int pyfsntfs_mft_table_get_column_buffer(
+     PyObject *dictionary_object,
+     const char *name,
+     Py_ssize_t item_size,
+     Py_buffer *buffer );
+
+int pyfsntfs_mft_table_set_from_columns(
+     pyfsntfs_mft_table_t *mft_table,
+     PyObject *dictionary_object,
+     Py_buffer *buffers );
+
+void pyfsntfs_mft_table_release_column_buffers(
+      Py_buffer *buffers );
+
+PyObject *pyfsntfs_mft_table_get_columns(
+           pyfsntfs_mft_table_t *mft_table );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSNTFS_MFT_TABLE_H ) */
+
@@ -79,5 +79,17 @@
 
 #endif /* !defined( Py_TYPE ) */
 
+/* Critical sections were introduced in Python 3.13 and only have an effect
+ * on free-threaded builds
+ */
+#if !defined( Py_BEGIN_CRITICAL_SECTION )
+#define Py_BEGIN_CRITICAL_SECTION( object ) \
+	{
+
+#define Py_END_CRITICAL_SECTION() \
+	}
+
+#endif /* !defined( Py_BEGIN_CRITICAL_SECTION ) */
+
 #endif /* !defined( _PYFSNTFS_PYTHON_H ) */
 
@@ -0,0 +1,426 @@
+/*
+ * Python object definition of the table column buffer
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsntfs_python.h"
+#include "pyfsntfs_table_column.h"
+
+PySequenceMethods pyfsntfs_table_column_sequence_methods = {
+	/* sq_length */
+	(lenfunc) pyfsntfs_table_column_len,
+	/* sq_concat */
+	0,
+	/* sq_repeat */
+	0,
+	/* sq_item */
+	0,
+	/* sq_slice */
+	0,
+	/* sq_ass_item */
+	0,
+	/* sq_ass_slice */
+	0,
+	/* sq_contains */
+	0,
+	/* sq_inplace_concat */
+	0,
+	/* sq_inplace_repeat */
+	0
+};
+
+#if PY_MAJOR_VERSION >= 3
+
+PyBufferProcs pyfsntfs_table_column_buffer_procs = {
+	/* bf_getbuffer */
+	(getbufferproc) pyfsntfs_table_column_get_buffer,
+	/* bf_releasebuffer */
+	0
+};
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
+PyTypeObject pyfsntfs_table_column_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsntfs._table_column",
+	/* tp_basicsize */
+	sizeof( pyfsntfs_table_column_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsntfs_table_column_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	&pyfsntfs_table_column_sequence_methods,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+#if PY_MAJOR_VERSION >= 3
+	&pyfsntfs_table_column_buffer_procs,
+#else
+	0,
+#endif
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"internal pyfsntfs table column object that exposes its values using the buffer protocol",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsntfs_table_column_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new table column object
+ * The table column takes over ownership of data, which must have been allocated
+ * using memory_allocate and is freed with memory_free
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_table_column_new(
+           uint8_t *data,
+           Py_ssize_t number_of_items,
+           Py_ssize_t item_size,
+           char *format )
+{
+	pyfsntfs_table_column_t *pyfsntfs_table_column = NULL;
+	static char *function                          = "pyfsntfs_table_column_new";
+
+	if( ( data == NULL )
+	 && ( number_of_items != 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data.",
+		 function );
+
+		return( NULL );
+	}
+	if( number_of_items < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of items value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( item_size <= 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid item size value zero or less.",
+		 function );
+
+		return( NULL );
+	}
+	if( format == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid format.",
+		 function );
+
+		return( NULL );
+	}
+	pyfsntfs_table_column = PyObject_New(
+	                         struct pyfsntfs_table_column,
+	                         &pyfsntfs_table_column_type_object );
+
+	if( pyfsntfs_table_column == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize table column.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyfsntfs_table_column_init(
+	     pyfsntfs_table_column ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize table column.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsntfs_table_column->data            = data;
+	pyfsntfs_table_column->number_of_items = number_of_items;
+	pyfsntfs_table_column->item_size       = item_size;
+	pyfsntfs_table_column->format          = format;
+	pyfsntfs_table_column->shape[ 0 ]      = number_of_items;
+	pyfsntfs_table_column->strides[ 0 ]    = item_size;
+
+	return( (PyObject *) pyfsntfs_table_column );
+
+on_error:
+	if( pyfsntfs_table_column != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsntfs_table_column );
+	}
+	return( NULL );
+}
+
+/* Initializes a table column object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsntfs_table_column_init(
+     pyfsntfs_table_column_t *pyfsntfs_table_column )
+{
+	static char *function = "pyfsntfs_table_column_init";
+
+	if( pyfsntfs_table_column == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid table column.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the table column values are initialized
+	 */
+	pyfsntfs_table_column->data            = NULL;
+	pyfsntfs_table_column->number_of_items = 0;
+	pyfsntfs_table_column->item_size       = 1;
+	pyfsntfs_table_column->format          = NULL;
+	pyfsntfs_table_column->shape[ 0 ]      = 0;
+	pyfsntfs_table_column->strides[ 0 ]    = 1;
+
+	return( 0 );
+}
+
+/* Frees a table column object
+ */
+void pyfsntfs_table_column_free(
+      pyfsntfs_table_column_t *pyfsntfs_table_column )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyfsntfs_table_column_free";
+
+	if( pyfsntfs_table_column == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid table column.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsntfs_table_column );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsntfs_table_column->data != NULL )
+	{
+		memory_free(
+		 pyfsntfs_table_column->data );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsntfs_table_column );
+}
+
+/* The table column len() function
+ */
+Py_ssize_t pyfsntfs_table_column_len(
+            pyfsntfs_table_column_t *pyfsntfs_table_column )
+{
+	static char *function = "pyfsntfs_table_column_len";
+
+	if( pyfsntfs_table_column == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid table column.",
+		 function );
+
+		return( -1 );
+	}
+	return( pyfsntfs_table_column->number_of_items );
+}
+
+#if PY_MAJOR_VERSION >= 3
+
+/* The table column get buffer function
+ * The buffer is read-only and one-dimensional
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsntfs_table_column_get_buffer(
+     pyfsntfs_table_column_t *pyfsntfs_table_column,
+     Py_buffer *buffer,
+     int flags )
+{
+	static char *function = "pyfsntfs_table_column_get_buffer";
+
+	if( pyfsntfs_table_column == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid table column.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & PyBUF_WRITABLE ) == PyBUF_WRITABLE )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: table column is read-only.",
+		 function );
+
+		buffer->obj = NULL;
+
+		return( -1 );
+	}
+	buffer->buf        = (void *) pyfsntfs_table_column->data;
+	buffer->obj        = (PyObject *) pyfsntfs_table_column;
+	buffer->len        = pyfsntfs_table_column->number_of_items * pyfsntfs_table_column->item_size;
+	buffer->readonly   = 1;
+	buffer->itemsize   = pyfsntfs_table_column->item_size;
+	buffer->format     = NULL;
+	buffer->ndim       = 1;
+	buffer->shape      = NULL;
+	buffer->strides    = NULL;
+	buffer->suboffsets = NULL;
+	buffer->internal   = NULL;
+
+	if( ( flags & PyBUF_FORMAT ) == PyBUF_FORMAT )
+	{
+		buffer->format = pyfsntfs_table_column->format;
+	}
+	if( ( flags & PyBUF_ND ) == PyBUF_ND )
+	{
+		buffer->shape = pyfsntfs_table_column->shape;
+	}
+	if( ( flags & PyBUF_STRIDES ) == PyBUF_STRIDES )
+	{
+		buffer->strides = pyfsntfs_table_column->strides;
+	}
+	Py_IncRef(
+	 (PyObject *) pyfsntfs_table_column );
+
+	return( 0 );
+}
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
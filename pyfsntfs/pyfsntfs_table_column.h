@@ -0,0 +1,98 @@
+/*
+ * Python object definition of the table column buffer
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSNTFS_TABLE_COLUMN_H )
+#define _PYFSNTFS_TABLE_COLUMN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsntfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsntfs_table_column pyfsntfs_table_column_t;
+
+struct pyfsntfs_table_column
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The number of items
+	 */
+	Py_ssize_t number_of_items;
+
+	/* The item size
+	 */
+	Py_ssize_t item_size;
+
+	/* The struct module style item format
+	 */
+	char *format;
+
+	/* The shape, used by the buffer protocol
+	 */
+	Py_ssize_t shape[ 1 ];
+
+	/* The strides, used by the buffer protocol
+	 */
+	Py_ssize_t strides[ 1 ];
+};
+
+extern PyTypeObject pyfsntfs_table_column_type_object;
+
+PyObject *pyfsntfs_table_column_new(
+           uint8_t *data,
+           Py_ssize_t number_of_items,
+           Py_ssize_t item_size,
+           char *format );
+
+int pyfsntfs_table_column_init(
+     pyfsntfs_table_column_t *pyfsntfs_table_column );
+
+void pyfsntfs_table_column_free(
+      pyfsntfs_table_column_t *pyfsntfs_table_column );
+
+Py_ssize_t pyfsntfs_table_column_len(
+            pyfsntfs_table_column_t *pyfsntfs_table_column );
+
+#if PY_MAJOR_VERSION >= 3
+
+int pyfsntfs_table_column_get_buffer(
+     pyfsntfs_table_column_t *pyfsntfs_table_column,
+     Py_buffer *buffer,
+     int flags );
+
+#endif /* PY_MAJOR_VERSION >= 3 */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSNTFS_TABLE_COLUMN_H ) */
+
@@ -45,6 +45,20 @@ PyMethodDef pyfsntfs_usn_change_journal_object_methods[] = {
 	  "\n"
 	  "Returns the current offset within the USN change journal data." },
 
+	{ "get_next_usn",
+	  (PyCFunction) pyfsntfs_usn_change_journal_get_next_usn,
+	  METH_NOARGS,
+	  "get_next_usn() -> Integer\n"
+	  "\n"
+	  "Returns the update sequence number (USN) of the next USN record that will be added to the journal." },
+
+	{ "get_journal_identifier",
+	  (PyCFunction) pyfsntfs_usn_change_journal_get_journal_identifier,
+	  METH_NOARGS,
+	  "get_journal_identifier() -> Integer or None\n"
+	  "\n"
+	  "Returns the journal identifier, which changes when the journal is deleted and created again." },
+
 	{ "read_usn_record",
 	  (PyCFunction) pyfsntfs_usn_change_journal_read_usn_record,
 	  METH_NOARGS,
@@ -362,6 +376,117 @@ PyObject *pyfsntfs_usn_change_journal_get_offset(
 	return( integer_object );
 }
 
+/* Retrieves the next update sequence number (USN)
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_usn_change_journal_get_next_usn(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error             = NULL;
+	PyObject *integer_object             = NULL;
+	static char *function                = "pyfsntfs_usn_change_journal_get_next_usn";
+	uint64_t next_update_sequence_number = 0;
+	int result                           = 0;
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_usn_change_journal == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_usn_change_journal_get_next_usn(
+	          pyfsntfs_usn_change_journal->usn_change_journal,
+	          &next_update_sequence_number,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve next USN.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyfsntfs_integer_unsigned_new_from_64bit(
+	                  next_update_sequence_number );
+
+	return( integer_object );
+}
+
+/* Retrieves the journal identifier
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_usn_change_journal_get_journal_identifier(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyfsntfs_usn_change_journal_get_journal_identifier";
+	uint64_t journal_identifier = 0;
+	int result                  = 0;
+
+	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsntfs_usn_change_journal == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid USN change journal.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_usn_change_journal_get_journal_identifier(
+	          pyfsntfs_usn_change_journal->usn_change_journal,
+	          &journal_identifier,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve journal identifier.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	integer_object = pyfsntfs_integer_unsigned_new_from_64bit(
+	                  journal_identifier );
+
+	return( integer_object );
+}
+
 /* Reads an USN record
  * Returns a Python object holding the data if successful or NULL on error
  */
@@ -66,6 +66,14 @@ PyObject *pyfsntfs_usn_change_journal_get_offset(
            pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
            PyObject *arguments );
 
+PyObject *pyfsntfs_usn_change_journal_get_next_usn(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments );
+
+PyObject *pyfsntfs_usn_change_journal_get_journal_identifier(
+           pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
+           PyObject *arguments );
+
 PyObject *pyfsntfs_usn_change_journal_read_usn_record(
            pyfsntfs_usn_change_journal_t *pyfsntfs_usn_change_journal,
            PyObject *arguments );
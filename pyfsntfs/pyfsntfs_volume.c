@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 
@@ -34,6 +35,7 @@
 #include "pyfsntfs_libbfio.h"
 #include "pyfsntfs_libcerror.h"
 #include "pyfsntfs_libfsntfs.h"
+#include "pyfsntfs_mft_table.h"
 #include "pyfsntfs_python.h"
 #include "pyfsntfs_string.h"
 #include "pyfsntfs_unused.h"
@@ -165,6 +167,46 @@ PyMethodDef pyfsntfs_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the USN change journal." },
 
+	/* Functions to export the file entries */
+
+	{ "export_mft_table",
+	  (PyCFunction) pyfsntfs_volume_export_mft_table,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "export_mft_table(fields=None) -> Dictionary\n"
+	  "\n"
+	  "Exports the metadata of all file entries as columns.\n"
+	  "\n"
+	  "The fields argument contains a sequence of field names, where None\n"
+	  "represents all fields. Supported fields are: file_reference,\n"
+	  "parent_file_reference, size, creation_time, modification_time,\n"
+	  "access_time, entry_modification_time, file_attribute_flags,\n"
+	  "is_allocated and name.\n"
+	  "\n"
+	  "Every column supports the buffer protocol and contains one value per\n"
+	  "file entry. The name field is exported as name_offsets, containing\n"
+	  "number of file entries + 1 offsets, and name_data, containing the\n"
+	  "concatenated UTF-8 encoded names. The is_valid column is always\n"
+	  "exported and contains 0 for file entries that could not be read,\n"
+	  "such as corrupt MFT entries, of which the other values are 0." },
+
+	{ "refresh_mft_table",
+	  (PyCFunction) pyfsntfs_volume_refresh_mft_table,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "refresh_mft_table(mft_table, journal_identifier, next_usn) -> Tuple( Dictionary, Integer or None, Integer )\n"
+	  "\n"
+	  "Refreshes a MFT table previously exported by export_mft_table.\n"
+	  "\n"
+	  "Only the file entries referenced by the USN change journal records\n"
+	  "since next_usn, and file entries added to the volume, are read again,\n"
+	  "the values of the other file entries are copied from mft_table. When\n"
+	  "journal_identifier differs from the identifier of the USN change\n"
+	  "journal, which happens when the journal was deleted and created again,\n"
+	  "or the USN change journal no longer contains all the records since\n"
+	  "next_usn, all file entries are read. Returns the refreshed MFT table,\n"
+	  "with the same fields as mft_table and the is_valid column, and the\n"
+	  "journal identifier and next USN of the USN change journal, to be\n"
+	  "passed to the next refresh." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -708,12 +750,13 @@ PyObject *pyfsntfs_volume_open_file_object(
            PyObject *arguments,
            PyObject *keywords )
 {
-	PyObject *file_object       = NULL;
-	libcerror_error_t *error    = NULL;
-	static char *function       = "pyfsntfs_volume_open_file_object";
-	static char *keyword_list[] = { "file_object", "mode", NULL };
-	char *mode                  = NULL;
-	int result                  = 0;
+	PyObject *file_object            = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "pyfsntfs_volume_open_file_object";
+	static char *keyword_list[]      = { "file_object", "mode", NULL };
+	char *mode                       = NULL;
+	int result                       = 0;
 
 	if( pyfsntfs_volume == NULL )
 	{
@@ -775,18 +818,8 @@ PyObject *pyfsntfs_volume_open_file_object(
 
 		return( NULL );
 	}
-	if( pyfsntfs_volume->file_io_handle != NULL )
-	{
-		pyfsntfs_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: invalid volume - file IO handle already set.",
-		 function );
-
-		goto on_error;
-	}
 	if( pyfsntfs_file_object_initialize(
-	     &( pyfsntfs_volume->file_io_handle ),
+	     &file_io_handle,
 	     file_object,
 	     &error ) != 1 )
 	{
@@ -801,6 +834,28 @@ PyObject *pyfsntfs_volume_open_file_object(
 
 		goto on_error;
 	}
+	/* Set the file IO handle in a critical section so that concurrent
+	 * opens of the same volume object cannot both set it
+	 */
+	Py_BEGIN_CRITICAL_SECTION(
+	 (PyObject *) pyfsntfs_volume );
+
+	if( pyfsntfs_volume->file_io_handle == NULL )
+	{
+		pyfsntfs_volume->file_io_handle = file_io_handle;
+		file_io_handle                  = NULL;
+	}
+	Py_END_CRITICAL_SECTION()
+
+	if( file_io_handle != NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid volume - file IO handle already set.",
+		 function );
+
+		goto on_error;
+	}
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libfsntfs_volume_open_file_io_handle(
@@ -822,6 +877,14 @@ PyObject *pyfsntfs_volume_open_file_object(
 		libcerror_error_free(
 		 &error );
 
+		Py_BEGIN_CRITICAL_SECTION(
+		 (PyObject *) pyfsntfs_volume );
+
+		file_io_handle                  = pyfsntfs_volume->file_io_handle;
+		pyfsntfs_volume->file_io_handle = NULL;
+
+		Py_END_CRITICAL_SECTION()
+
 		goto on_error;
 	}
 	Py_IncRef(
@@ -830,10 +893,10 @@ PyObject *pyfsntfs_volume_open_file_object(
 	return( Py_None );
 
 on_error:
-	if( pyfsntfs_volume->file_io_handle != NULL )
+	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
-		 &( pyfsntfs_volume->file_io_handle ),
+		 &file_io_handle,
 		 NULL );
 	}
 	return( NULL );
@@ -846,9 +909,10 @@ PyObject *pyfsntfs_volume_close(
            pyfsntfs_volume_t *pyfsntfs_volume,
            PyObject *arguments PYFSNTFS_ATTRIBUTE_UNUSED )
 {
-	libcerror_error_t *error = NULL;
-	static char *function    = "pyfsntfs_volume_close";
-	int result               = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "pyfsntfs_volume_close";
+	int result                       = 0;
 
 	PYFSNTFS_UNREFERENCED_PARAMETER( arguments )
 
@@ -882,12 +946,23 @@ PyObject *pyfsntfs_volume_close(
 
 		return( NULL );
 	}
-	if( pyfsntfs_volume->file_io_handle != NULL )
+	/* Take over the file IO handle in a critical section so that
+	 * concurrent closes of the same volume object free it only once
+	 */
+	Py_BEGIN_CRITICAL_SECTION(
+	 (PyObject *) pyfsntfs_volume );
+
+	file_io_handle                  = pyfsntfs_volume->file_io_handle;
+	pyfsntfs_volume->file_io_handle = NULL;
+
+	Py_END_CRITICAL_SECTION()
+
+	if( file_io_handle != NULL )
 	{
 		Py_BEGIN_ALLOW_THREADS
 
 		result = libbfio_handle_free(
-		          &( pyfsntfs_volume->file_io_handle ),
+		          &file_io_handle,
 		          &error );
 
 		Py_END_ALLOW_THREADS
@@ -1888,3 +1963,502 @@ on_error:
 	return( NULL );
 }
 
+/* Exports the metadata of the file entries as columns
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_volume_export_mft_table(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *fields_object         = NULL;
+	PyObject *iterator_object       = NULL;
+	PyObject *string_object         = NULL;
+	PyObject *table_object          = NULL;
+	libcerror_error_t *error        = NULL;
+	pyfsntfs_mft_table_t *mft_table = NULL;
+	const char *field_name          = NULL;
+	static char *function           = "pyfsntfs_volume_export_mft_table";
+	static char *keyword_list[]     = { "fields", NULL };
+	Py_ssize_t field_name_length    = 0;
+	uint64_t number_of_file_entries = 0;
+	uint32_t field                  = 0;
+	uint32_t fields                 = 0;
+	int result                      = 0;
+
+	if( pyfsntfs_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &fields_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( fields_object == NULL )
+	 || ( fields_object == Py_None ) )
+	{
+		fields = PYFSNTFS_MFT_TABLE_FIELD_ALL;
+	}
+	else
+	{
+		iterator_object = PyObject_GetIter(
+		                   fields_object );
+
+		if( iterator_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_TypeError,
+			 "%s: unsupported fields object type.",
+			 function );
+
+			goto on_error;
+		}
+		while( ( string_object = PyIter_Next(
+		                          iterator_object ) ) != NULL )
+		{
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
+			if( PyUnicode_Check(
+			     string_object ) == 0 )
+			{
+				PyErr_Format(
+				 PyExc_TypeError,
+				 "%s: unsupported field name object type.",
+				 function );
+
+				goto on_error;
+			}
+			field_name = PyUnicode_AsUTF8AndSize(
+			              string_object,
+			              &field_name_length );
+#else
+			if( PyString_Check(
+			     string_object ) == 0 )
+			{
+				PyErr_Format(
+				 PyExc_TypeError,
+				 "%s: unsupported field name object type.",
+				 function );
+
+				goto on_error;
+			}
+			field_name        = PyString_AsString(
+			                     string_object );
+			field_name_length = PyString_Size(
+			                     string_object );
+#endif
+			if( field_name == NULL )
+			{
+				goto on_error;
+			}
+			result = pyfsntfs_mft_table_get_field_by_name(
+			          field_name,
+			          (size_t) field_name_length,
+			          &field,
+			          &error );
+
+			if( result == -1 )
+			{
+				pyfsntfs_error_raise(
+				 error,
+				 PyExc_RuntimeError,
+				 "%s: unable to retrieve field.",
+				 function );
+
+				libcerror_error_free(
+				 &error );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				PyErr_Format(
+				 PyExc_ValueError,
+				 "%s: unsupported field: %s.",
+				 function,
+				 field_name );
+
+				goto on_error;
+			}
+			fields |= field;
+
+			Py_DecRef(
+			 string_object );
+
+			string_object = NULL;
+		}
+		Py_DecRef(
+		 iterator_object );
+
+		iterator_object = NULL;
+
+		if( PyErr_Occurred() )
+		{
+			goto on_error;
+		}
+		if( fields == 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: missing fields.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The is valid column is always exported so that rows of file entries
+	 * that could not be read can be distinguished from rows with values of 0
+	 */
+	fields |= PYFSNTFS_MFT_TABLE_FIELD_IS_VALID;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          pyfsntfs_volume->volume,
+	          &number_of_file_entries,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = pyfsntfs_mft_table_initialize(
+		          &mft_table,
+		          fields,
+		          number_of_file_entries,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = pyfsntfs_mft_table_read_volume(
+		          mft_table,
+		          pyfsntfs_volume->volume,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to export MFT table.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	table_object = pyfsntfs_mft_table_get_columns(
+	                mft_table );
+
+	if( table_object == NULL )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_free(
+	     &mft_table,
+	     &error ) != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free MFT table.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	return( table_object );
+
+on_error:
+	if( table_object != NULL )
+	{
+		Py_DecRef(
+		 table_object );
+	}
+	if( mft_table != NULL )
+	{
+		pyfsntfs_mft_table_free(
+		 &mft_table,
+		 NULL );
+	}
+	if( string_object != NULL )
+	{
+		Py_DecRef(
+		 string_object );
+	}
+	if( iterator_object != NULL )
+	{
+		Py_DecRef(
+		 iterator_object );
+	}
+	return( NULL );
+}
+
+/* Refreshes a previously exported MFT table
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsntfs_volume_refresh_mft_table(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffers[ PYFSNTFS_MFT_TABLE_NUMBER_OF_COLUMNS ];
+
+	pyfsntfs_mft_table_t previous_mft_table;
+
+	PyObject *identifier_object                  = NULL;
+	PyObject *integer_object                     = NULL;
+	PyObject *journal_identifier_object          = NULL;
+	PyObject *next_usn_object                    = NULL;
+	PyObject *previous_table_object              = NULL;
+	PyObject *table_object                       = NULL;
+	PyObject *tuple_object                       = NULL;
+	libcerror_error_t *error                     = NULL;
+	pyfsntfs_mft_table_t *mft_table              = NULL;
+	static char *function                        = "pyfsntfs_volume_refresh_mft_table";
+	static char *keyword_list[]                  = { "mft_table", "journal_identifier", "next_usn", NULL };
+	uint64_t current_journal_identifier          = 0;
+	uint64_t journal_identifier                  = 0;
+	uint64_t journal_next_update_sequence_number = 0;
+	uint64_t next_update_sequence_number         = 0;
+	uint64_t number_of_file_entries              = 0;
+	int result                                   = 0;
+
+	if( pyfsntfs_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OOO",
+	     keyword_list,
+	     &previous_table_object,
+	     &journal_identifier_object,
+	     &next_usn_object ) == 0 )
+	{
+		return( NULL );
+	}
+	/* None represents a journal without journal identifier
+	 */
+	if( journal_identifier_object != Py_None )
+	{
+		if( pyfsntfs_integer_unsigned_copy_to_64bit(
+		     journal_identifier_object,
+		     &journal_identifier,
+		     &error ) != 1 )
+		{
+			pyfsntfs_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert journal identifier into 64-bit unsigned integer.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			return( NULL );
+		}
+	}
+	if( pyfsntfs_integer_unsigned_copy_to_64bit(
+	     next_usn_object,
+	     &next_update_sequence_number,
+	     &error ) != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_ValueError,
+		 "%s: unable to convert next USN into 64-bit unsigned integer.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( memory_set(
+	     buffers,
+	     0,
+	     sizeof( Py_buffer ) * PYFSNTFS_MFT_TABLE_NUMBER_OF_COLUMNS ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear buffers.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfsntfs_mft_table_set_from_columns(
+	     &previous_mft_table,
+	     previous_table_object,
+	     buffers ) != 1 )
+	{
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsntfs_volume_get_number_of_file_entries(
+	          pyfsntfs_volume->volume,
+	          &number_of_file_entries,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = pyfsntfs_mft_table_initialize(
+		          &mft_table,
+		          previous_mft_table.fields | PYFSNTFS_MFT_TABLE_FIELD_IS_VALID,
+		          number_of_file_entries,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = pyfsntfs_mft_table_refresh_volume(
+		          mft_table,
+		          &previous_mft_table,
+		          pyfsntfs_volume->volume,
+		          journal_identifier,
+		          next_update_sequence_number,
+		          &current_journal_identifier,
+		          &journal_next_update_sequence_number,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	pyfsntfs_mft_table_release_column_buffers(
+	 buffers );
+
+	if( result != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to refresh MFT table.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	table_object = pyfsntfs_mft_table_get_columns(
+	                mft_table );
+
+	if( table_object == NULL )
+	{
+		goto on_error;
+	}
+	if( pyfsntfs_mft_table_free(
+	     &mft_table,
+	     &error ) != 1 )
+	{
+		pyfsntfs_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free MFT table.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( current_journal_identifier == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		identifier_object = Py_None;
+	}
+	else
+	{
+		identifier_object = pyfsntfs_integer_unsigned_new_from_64bit(
+		                     current_journal_identifier );
+
+		if( identifier_object == NULL )
+		{
+			goto on_error;
+		}
+	}
+	integer_object = pyfsntfs_integer_unsigned_new_from_64bit(
+	                  journal_next_update_sequence_number );
+
+	if( integer_object == NULL )
+	{
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                3 );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	/* PyTuple_SetItem steals the references
+	 */
+	PyTuple_SetItem(
+	 tuple_object,
+	 0,
+	 table_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 1,
+	 identifier_object );
+
+	PyTuple_SetItem(
+	 tuple_object,
+	 2,
+	 integer_object );
+
+	return( tuple_object );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 integer_object );
+	}
+	if( identifier_object != NULL )
+	{
+		Py_DecRef(
+		 identifier_object );
+	}
+	if( table_object != NULL )
+	{
+		Py_DecRef(
+		 table_object );
+	}
+	if( mft_table != NULL )
+	{
+		pyfsntfs_mft_table_free(
+		 &mft_table,
+		 NULL );
+	}
+	pyfsntfs_mft_table_release_column_buffers(
+	 buffers );
+
+	return( NULL );
+}
+
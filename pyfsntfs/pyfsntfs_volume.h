@@ -131,6 +131,16 @@ PyObject *pyfsntfs_volume_get_usn_change_journal(
            pyfsntfs_volume_t *pyfsntfs_volume,
            PyObject *arguments );
 
+PyObject *pyfsntfs_volume_export_mft_table(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfsntfs_volume_refresh_mft_table(
+           pyfsntfs_volume_t *pyfsntfs_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -1220,6 +1220,7 @@ int fsntfs_test_compressed_block_data_handle_read_segment_data(
 	libfsntfs_compressed_block_data_handle_t *compressed_block_data_handle = NULL;
 	libfsntfs_io_handle_t *io_handle                                       = NULL;
 	libfsntfs_mft_attribute_t *mft_attribute                               = NULL;
+	uint8_t *data                                                          = NULL;
 	ssize_t read_count                                                     = 0;
 	off64_t offset                                                         = 0;
 	int result                                                             = 0;
@@ -1421,6 +1422,77 @@ int fsntfs_test_compressed_block_data_handle_read_segment_data(
 	 "error",
 	 error );
 
+	/* Read a whole compression unit directly into the buffer
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 65536 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	offset = libfsntfs_compressed_block_data_handle_seek_segment_offset(
+	          compressed_block_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_compressed_block_data_handle_read_segment_data(
+	              compressed_block_data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              data,
+	              65536,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 65536 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_segment_data1,
+	          12 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( data[ 65536 - 4 ] ),
+	          expected_segment_data2,
+	          4 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
 	/* Clean up
 	 */
 	result = libfsntfs_compressed_block_data_handle_free(
@@ -1699,6 +1771,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
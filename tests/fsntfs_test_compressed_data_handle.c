@@ -274,7 +274,7 @@ int fsntfs_test_compressed_data_handle_initialize(
 
 #if defined( HAVE_FSNTFS_TEST_MEMORY )
 	int number_of_malloc_fail_tests                            = 3;
-	int number_of_memset_fail_tests                            = 1;
+	int number_of_memset_fail_tests                            = 2;
 	int test_number                                            = 0;
 #endif
 
@@ -775,16 +775,19 @@ on_error:
 int fsntfs_test_compressed_data_handle_read_segment_data(
      void )
 {
+	uint8_t data[ 7638 ];
 	uint8_t segment_data[ 16 ];
 
 	uint8_t expected_segment_data1[ 12 ] = {
 		0x09, 0x09, 0x20, 0x20, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x45, 0x53 };
 
-	libcerror_error_t *error                                   = NULL;
-	libfdata_stream_t *compressed_data_stream                  = NULL;
-	libfsntfs_compressed_data_handle_t *compressed_data_handle = NULL;
-	ssize_t read_count                                         = 0;
-	int result                                                 = 0;
+	libcerror_error_t *error                                    = NULL;
+	libfdata_stream_t *compressed_data_stream                   = NULL;
+	libfsntfs_compressed_data_handle_cache_value_t *cache_value = NULL;
+	libfsntfs_compressed_data_handle_t *compressed_data_handle  = NULL;
+	ssize_t read_count                                          = 0;
+	off64_t offset                                              = 0;
+	int result                                                  = 0;
 
 	/* Initialize test
 	 */
@@ -861,6 +864,145 @@ int fsntfs_test_compressed_data_handle_read_segment_data(
 	 result,
 	 0 );
 
+	/* Test reading the same data again from the cache
+	 */
+	result = libfsntfs_compressed_data_handle_get_cache_value(
+	          compressed_data_handle,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "cache_value->data_size",
+	 cache_value->data_size,
+	 (size_t) 7638 );
+
+	offset = libfsntfs_compressed_data_handle_seek_segment_offset(
+	          compressed_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_compressed_data_handle_read_segment_data(
+	              compressed_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              12,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 12 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          expected_segment_data1,
+	          12 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test reading whole compressed blocks directly into the segment data
+	 */
+	cache_value->compressed_block_index = (uint64_t) -1;
+
+	offset = libfsntfs_compressed_data_handle_seek_segment_offset(
+	          compressed_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_compressed_data_handle_read_segment_data(
+	              compressed_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              data,
+	              7638,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 7638 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_segment_data1,
+	          12 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsntfs_compressed_data_handle_get_cache_value(
+	          compressed_data_handle,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	read_count = libfsntfs_compressed_data_handle_read_segment_data(
@@ -1290,6 +1290,195 @@ uint8_t fsntfs_test_compression_uncompressed_data1[ 7638 ] = {
 
 #if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
 
+/* Tests the libfsntfs_compression_copy_match function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_compression_copy_match(
+     void )
+{
+	uint8_t uncompressed_data[ 48 ] = {
+		'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p',
+		'q', 'r', 's', 't', 0 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_compression_copy_match(
+	          uncompressed_data,
+	          48,
+	          20,
+	          20,
+	          20,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "abcdefghijklmnopqrstabcdefghijklmnopqrst",
+	          40 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsntfs_compression_copy_match(
+	          uncompressed_data,
+	          48,
+	          4,
+	          2,
+	          8,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "abcdcdcdcdcdmnop",
+	          16 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsntfs_compression_copy_match(
+	          uncompressed_data,
+	          48,
+	          1,
+	          1,
+	          3,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          "aaaacdcdcdcdmnop",
+	          16 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_compression_copy_match(
+	          NULL,
+	          48,
+	          20,
+	          20,
+	          8,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_compression_copy_match(
+	          uncompressed_data,
+	          48,
+	          20,
+	          0,
+	          8,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_compression_copy_match(
+	          uncompressed_data,
+	          48,
+	          20,
+	          21,
+	          8,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_compression_copy_match(
+	          uncompressed_data,
+	          48,
+	          20,
+	          20,
+	          29,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_decompress_data function
  * Returns 1 if successful or 0 if not
  */
@@ -1558,6 +1747,10 @@ int main(
 	 "libfsntfs_decompress_data",
 	 fsntfs_test_decompress_data );
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_compression_copy_match",
+	 fsntfs_test_compression_copy_match );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -430,6 +430,288 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_compression_unit_data_handle_get_descriptor_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_compression_unit_data_handle_get_descriptor_at_offset(
+     void )
+{
+	libcerror_error_t *error                                               = NULL;
+	libfsntfs_compression_unit_data_handle_t *compression_unit_data_handle = NULL;
+	libfsntfs_compression_unit_descriptor_t *descriptor                    = NULL;
+	libfsntfs_io_handle_t *io_handle                                       = NULL;
+	libfsntfs_mft_attribute_t *mft_attribute                               = NULL;
+	int result                                                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->cluster_block_size = 4096;
+
+	result = libfsntfs_mft_attribute_initialize(
+	          &mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mft_attribute",
+	 mft_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_read_data(
+	          mft_attribute,
+	          io_handle,
+	          fsntfs_test_compression_unit_data_handle_data1,
+	          80,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_compression_unit_data_handle_initialize(
+	          &compression_unit_data_handle,
+	          io_handle,
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "compression_unit_data_handle",
+	 compression_unit_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+	          compression_unit_data_handle,
+	          0,
+	          &descriptor,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "descriptor",
+	 descriptor );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "descriptor->data_offset",
+	 (int64_t) descriptor->data_offset,
+	 (int64_t) 0 );
+
+	result = libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+	          compression_unit_data_handle,
+	          (off64_t) descriptor->compression_unit_size - 1,
+	          &descriptor,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "descriptor->data_offset",
+	 (int64_t) descriptor->data_offset,
+	 (int64_t) 0 );
+
+	result = libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+	          compression_unit_data_handle,
+	          -1,
+	          &descriptor,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+	          compression_unit_data_handle,
+	          (off64_t) INT64_MAX,
+	          &descriptor,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+	          NULL,
+	          0,
+	          &descriptor,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_compression_unit_data_handle_get_descriptor_at_offset(
+	          compression_unit_data_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_compression_unit_data_handle_free(
+	          &compression_unit_data_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "compression_unit_data_handle",
+	 compression_unit_data_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_free(
+	          &mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "mft_attribute",
+	 mft_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( compression_unit_data_handle != NULL )
+	{
+		libfsntfs_compression_unit_data_handle_free(
+		 &compression_unit_data_handle,
+		 NULL );
+	}
+	if( mft_attribute != NULL )
+	{
+		libfsntfs_mft_attribute_free(
+		 &mft_attribute,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -461,6 +743,10 @@ int main(
 
 	/* TODO add tests for libfsntfs_compression_unit_data_handle_get_descriptor_by_index */
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_compression_unit_data_handle_get_descriptor_at_offset",
+	 fsntfs_test_compression_unit_data_handle_get_descriptor_at_offset );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
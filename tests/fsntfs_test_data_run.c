@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -40,6 +41,16 @@
 uint8_t fsntfs_test_data_run_data1[ 6 ] = {
 	0x11, 0x03, 0x37, 0x01, 0x0d, 0x00 };
 
+/* Data runs with value sizes of 1 to 8 bytes, negative cluster block number deltas
+ * and cluster block number deltas that follow sparse data runs
+ */
+uint8_t fsntfs_test_data_run_data2[ 77 ] = {
+	0x31, 0x10, 0x56, 0x34, 0x12, 0x42, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x08, 0x33, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0xf0, 0x52, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x01, 0x61, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x00, 0x10, 0x71, 0x04, 0xaa, 0xcb, 0xfd, 0xff, 0xff, 0xff,
+	0xff, 0x81, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0x24, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
 
 /* Tests the libfsntfs_data_run_initialize function
@@ -599,6 +610,479 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_data_run_read_list_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_data_run_read_list_data(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_data_run_t *data_run     = NULL;
+	libfsntfs_data_run_t *data_runs    = NULL;
+	libfsntfs_io_handle_t *io_handle   = NULL;
+	size_t data_offset                 = 0;
+	ssize_t read_count                 = 0;
+	uint64_t last_cluster_block_number = 0;
+	int data_run_index                 = 0;
+	int number_of_data_runs            = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->cluster_block_size = 4096;
+
+	result = libfsntfs_data_run_initialize(
+	          &data_run,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_run",
+	 data_run );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              &number_of_data_runs,
+	              io_handle,
+	              fsntfs_test_data_run_data1,
+	              6,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 6 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_runs",
+	 data_runs );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_data_runs",
+	 number_of_data_runs,
+	 2 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 0 ].cluster_block_number",
+	 data_runs[ 0 ].cluster_block_number,
+	 (uint64_t) 55 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 0 ].start_offset",
+	 (uint64_t) data_runs[ 0 ].start_offset,
+	 (uint64_t) 55 * 4096 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 0 ].size",
+	 (uint64_t) data_runs[ 0 ].size,
+	 (uint64_t) 12288 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "data_runs[ 0 ].range_flags",
+	 (uint32_t) data_runs[ 0 ].range_flags,
+	 (uint32_t) 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 1 ].cluster_block_number",
+	 data_runs[ 1 ].cluster_block_number,
+	 (uint64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 1 ].start_offset",
+	 (uint64_t) data_runs[ 1 ].start_offset,
+	 (uint64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 1 ].size",
+	 (uint64_t) data_runs[ 1 ].size,
+	 (uint64_t) 53248 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "data_runs[ 1 ].range_flags",
+	 (uint32_t) data_runs[ 1 ].range_flags,
+	 (uint32_t) LIBFDATA_RANGE_FLAG_IS_SPARSE );
+
+	memory_free(
+	 data_runs );
+
+	data_runs = NULL;
+
+	/* Test data runs data that is larger than the padded data size and compare
+	 * the data runs with the ones read by libfsntfs_data_run_read_data
+	 */
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              &number_of_data_runs,
+	              io_handle,
+	              fsntfs_test_data_run_data2,
+	              77,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 77 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_runs",
+	 data_runs );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_data_runs",
+	 number_of_data_runs,
+	 11 );
+
+	for( data_run_index = 0;
+	     data_run_index < number_of_data_runs;
+	     data_run_index++ )
+	{
+		read_count = libfsntfs_data_run_read_data(
+		              data_run,
+		              io_handle,
+		              &( fsntfs_test_data_run_data2[ data_offset ] ),
+		              77 - data_offset,
+		              last_cluster_block_number,
+		              &error );
+
+		FSNTFS_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "data_runs[ data_run_index ].cluster_block_number",
+		 data_runs[ data_run_index ].cluster_block_number,
+		 data_run->cluster_block_number );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "data_runs[ data_run_index ].start_offset",
+		 (uint64_t) data_runs[ data_run_index ].start_offset,
+		 (uint64_t) data_run->start_offset );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "data_runs[ data_run_index ].size",
+		 (uint64_t) data_runs[ data_run_index ].size,
+		 (uint64_t) data_run->size );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+		 "data_runs[ data_run_index ].range_flags",
+		 (uint32_t) data_runs[ data_run_index ].range_flags,
+		 (uint32_t) data_run->range_flags );
+
+		data_offset += (size_t) read_count;
+
+		if( ( data_run->range_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) == 0 )
+		{
+			last_cluster_block_number = data_run->cluster_block_number;
+		}
+	}
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 76 );
+
+	/* The negative cluster block number delta after the sparse data run is relative
+	 * to the last data run that is not sparse
+	 */
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 3 ].cluster_block_number",
+	 data_runs[ 3 ].cluster_block_number,
+	 (uint64_t) 0x01023456UL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 7 ].cluster_block_number",
+	 data_runs[ 7 ].cluster_block_number,
+	 (uint64_t) 0x01000000UL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_runs[ 9 ].size",
+	 (uint64_t) data_runs[ 9 ].size,
+	 (uint64_t) 4096 );
+
+	memory_free(
+	 data_runs );
+
+	data_runs = NULL;
+
+	/* Test data runs data that only contains the terminator
+	 */
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              &number_of_data_runs,
+	              io_handle,
+	              &( fsntfs_test_data_run_data1[ 5 ] ),
+	              6 - 5,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "data_runs",
+	 data_runs );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_data_runs",
+	 number_of_data_runs,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libfsntfs_data_run_read_list_data(
+	              NULL,
+	              &number_of_data_runs,
+	              io_handle,
+	              fsntfs_test_data_run_data1,
+	              6,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              NULL,
+	              io_handle,
+	              fsntfs_test_data_run_data1,
+	              6,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              &number_of_data_runs,
+	              NULL,
+	              fsntfs_test_data_run_data1,
+	              6,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              &number_of_data_runs,
+	              io_handle,
+	              NULL,
+	              6,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              &number_of_data_runs,
+	              io_handle,
+	              fsntfs_test_data_run_data1,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              &number_of_data_runs,
+	              io_handle,
+	              fsntfs_test_data_run_data1,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data runs data that is too small
+	 */
+	read_count = libfsntfs_data_run_read_list_data(
+	              &data_runs,
+	              &number_of_data_runs,
+	              io_handle,
+	              fsntfs_test_data_run_data1,
+	              2,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "data_runs",
+	 data_runs );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_data_run_free(
+	          &data_run,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "data_run",
+	 data_run );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_runs != NULL )
+	{
+		memory_free(
+		 data_runs );
+	}
+	if( data_run != NULL )
+	{
+		libfsntfs_data_run_free(
+		 &data_run,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -630,6 +1114,10 @@ int main(
 	 "libfsntfs_data_run_read_data",
 	 fsntfs_test_data_run_read_data );
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_data_run_read_list_data",
+	 fsntfs_test_data_run_read_list_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -3394,6 +3394,993 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_data_stream_get_number_of_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_data_stream_get_number_of_ranges(
+     libfsntfs_data_stream_t *data_stream )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_ranges     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_data_stream_get_number_of_ranges(
+	          data_stream,
+	          &number_of_ranges,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_data_stream_get_number_of_ranges(
+	          NULL,
+	          &number_of_ranges,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_get_number_of_ranges(
+	          data_stream,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK )
+
+	/* Test libfsntfs_data_stream_get_number_of_ranges with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_get_number_of_ranges(
+	          data_stream,
+	          &number_of_ranges,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfsntfs_data_stream_get_number_of_ranges with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_get_number_of_ranges(
+	          data_stream,
+	          &number_of_ranges,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_data_stream_get_range_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_data_stream_get_range_by_index(
+     libfsntfs_data_stream_t *data_stream )
+{
+	libcerror_error_t *error = NULL;
+	size64_t expected_size   = 0;
+	size64_t range_size      = 0;
+	off64_t expected_offset  = 0;
+	off64_t range_offset     = 0;
+	uint32_t expected_flags  = 0;
+	uint32_t range_flags     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          0,
+	          &expected_offset,
+	          &expected_size,
+	          &expected_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_data_stream_get_range_by_index(
+	          data_stream,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) expected_offset );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) expected_size );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 expected_flags );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_data_stream_get_range_by_index(
+	          NULL,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_get_range_by_index(
+	          data_stream,
+	          -1,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_get_range_by_index(
+	          data_stream,
+	          1,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_get_range_by_index(
+	          data_stream,
+	          0,
+	          NULL,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK )
+
+	/* Test libfsntfs_data_stream_get_range_by_index with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_get_range_by_index(
+	          data_stream,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfsntfs_data_stream_get_range_by_index with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_get_range_by_index(
+	          data_stream,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_data_stream_get_range_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_data_stream_get_range_at_offset(
+     libfsntfs_data_stream_t *data_stream )
+{
+	libcerror_error_t *error = NULL;
+	size64_t range_size      = 0;
+	size64_t size            = 0;
+	off64_t range_offset     = 0;
+	uint32_t range_flags     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_data_stream_get_size(
+	          data_stream,
+	          &size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "range_size",
+	 (int64_t) range_size,
+	 (int64_t) 0 );
+
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          (off64_t) size,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          NULL,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          -1,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          0,
+	          NULL,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          0,
+	          &range_offset,
+	          NULL,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK )
+
+	/* Test libfsntfs_data_stream_get_range_at_offset with pthread_rwlock_rdlock failing in libcthreads_read_write_lock_grab_for_read
+	 */
+	fsntfs_test_pthread_rwlock_rdlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_rdlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_rdlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfsntfs_data_stream_get_range_at_offset with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_read
+	 */
+	fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_get_range_at_offset(
+	          data_stream,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_data_stream_seek_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_data_stream_seek_data(
+     libfsntfs_data_stream_t *data_stream )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t data_offset      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_data_stream_get_size(
+	          data_stream,
+	          &size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_data_stream_seek_data(
+	          data_stream,
+	          0,
+	          &data_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) 0 );
+
+	result = libfsntfs_data_stream_seek_data(
+	          data_stream,
+	          (off64_t) size,
+	          &data_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_data_stream_seek_data(
+	          NULL,
+	          0,
+	          &data_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_seek_data(
+	          data_stream,
+	          -1,
+	          &data_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_seek_data(
+	          data_stream,
+	          0,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK )
+
+	/* Test libfsntfs_data_stream_seek_data with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_seek_data(
+	          data_stream,
+	          0,
+	          &data_offset,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfsntfs_data_stream_seek_data with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_seek_data(
+	          data_stream,
+	          0,
+	          &data_offset,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_data_stream_seek_hole function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_data_stream_seek_hole(
+     libfsntfs_data_stream_t *data_stream )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	off64_t hole_offset      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_data_stream_get_size(
+	          data_stream,
+	          &size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_data_stream_seek_hole(
+	          data_stream,
+	          0,
+	          &hole_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hole_offset",
+	 (int64_t) hole_offset,
+	 (int64_t) 0 );
+
+	result = libfsntfs_data_stream_seek_hole(
+	          data_stream,
+	          (off64_t) size,
+	          &hole_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_data_stream_seek_hole(
+	          NULL,
+	          0,
+	          &hole_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_seek_hole(
+	          data_stream,
+	          -1,
+	          &hole_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_data_stream_seek_hole(
+	          data_stream,
+	          0,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK )
+
+	/* Test libfsntfs_data_stream_seek_hole with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_seek_hole(
+	          data_stream,
+	          0,
+	          &hole_offset,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfsntfs_data_stream_seek_hole with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libfsntfs_data_stream_seek_hole(
+	          data_stream,
+	          0,
+	          &hole_offset,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -3592,6 +4579,31 @@ int main(
 	 fsntfs_test_data_stream_get_extent_by_index,
 	 data_stream );
 
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_data_stream_get_number_of_ranges",
+	 fsntfs_test_data_stream_get_number_of_ranges,
+	 data_stream );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_data_stream_get_range_by_index",
+	 fsntfs_test_data_stream_get_range_by_index,
+	 data_stream );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_data_stream_get_range_at_offset",
+	 fsntfs_test_data_stream_get_range_at_offset,
+	 data_stream );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_data_stream_seek_data",
+	 fsntfs_test_data_stream_seek_data,
+	 data_stream );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_data_stream_seek_hole",
+	 fsntfs_test_data_stream_seek_hole,
+	 data_stream );
+
 	/* Clean up
 	 */
 	result = libfsntfs_data_stream_free(
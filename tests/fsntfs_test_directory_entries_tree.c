@@ -770,6 +770,187 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_directory_entries_tree_read_from_i30_index_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_entries_tree_read_from_i30_index_on_demand(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_directory_entries_tree_read_from_i30_index_on_demand(
+	          directory_entries_tree,
+	          NULL,
+	          NULL,
+	          NULL,
+	          LIBFSNTFS_FILE_ENTRY_FLAGS_MFT_ONLY,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A directory entries tree without $I30 index is marked as read
+	 */
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_tree->i30_index",
+	 directory_entries_tree->i30_index );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT8(
+	 "directory_entries_tree->is_read",
+	 directory_entries_tree->is_read,
+	 (uint8_t) 1 );
+
+	/* The $I30 index is only read once
+	 */
+	result = libfsntfs_directory_entries_tree_read_from_i30_index_on_demand(
+	          directory_entries_tree,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_tree->i30_index",
+	 directory_entries_tree->i30_index );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_entries_tree_read_from_i30_index_on_demand(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          LIBFSNTFS_FILE_ENTRY_FLAGS_MFT_ONLY,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_entries_tree_build_name_hash_table_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_entries_tree_build_name_hash_table_on_demand(
+     libfsntfs_directory_entries_tree_t *directory_entries_tree )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_directory_entries_tree_build_name_hash_table_on_demand(
+	          directory_entries_tree,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A directory entries tree with too few entries does not get a name hash table
+	 */
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_tree->name_hash_table",
+	 directory_entries_tree->name_hash_table );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT8(
+	 "directory_entries_tree->name_hash_table_is_checked",
+	 directory_entries_tree->name_hash_table_is_checked,
+	 (uint8_t) 1 );
+
+	/* The name hash table is only checked once
+	 */
+	result = libfsntfs_directory_entries_tree_build_name_hash_table_on_demand(
+	          directory_entries_tree,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "directory_entries_tree->name_hash_table",
+	 directory_entries_tree->name_hash_table );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_entries_tree_build_name_hash_table_on_demand(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_directory_entries_tree_get_entry_by_index function
  * Returns 1 if successful or 0 if not
  */
@@ -1595,6 +1776,16 @@ int main(
 	 fsntfs_test_directory_entries_tree_get_number_of_entries,
 	 directory_entries_tree );
 
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_directory_entries_tree_read_from_i30_index_on_demand",
+	 fsntfs_test_directory_entries_tree_read_from_i30_index_on_demand,
+	 directory_entries_tree );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_directory_entries_tree_build_name_hash_table_on_demand",
+	 fsntfs_test_directory_entries_tree_build_name_hash_table_on_demand,
+	 directory_entries_tree );
+
 	FSNTFS_TEST_RUN_WITH_ARGS(
 	 "libfsntfs_directory_entries_tree_get_entry_by_index",
 	 fsntfs_test_directory_entries_tree_get_entry_by_index,
@@ -0,0 +1,1162 @@
+/*
+ * Library directory_iterator type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_directory_iterator.h"
+#include "../libfsntfs/libfsntfs_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Tests the libfsntfs_directory_iterator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_directory_iterator_t *directory_iterator = NULL;
+	libfsntfs_io_handle_t *io_handle                   = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_initialize(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_iterator = (libfsntfs_directory_iterator_t *) 0x12345678UL;
+
+	result = libfsntfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	directory_iterator = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "directory_iterator",
+	 directory_iterator );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_directory_iterator_initialize(
+	          &directory_iterator,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "directory_iterator",
+	 directory_iterator );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* Tests the libfsntfs_directory_iterator_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_reset(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_next_sub_file_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_next_sub_file_entry(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsntfs_file_entry_t *sub_file_entry   = NULL;
+	int result                               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_next_sub_file_entry(
+	          NULL,
+	          &sub_file_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "sub_file_entry",
+	 sub_file_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_seek_after_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_seek_after_utf8_name(
+     void )
+{
+	uint8_t utf8_name[ 5 ]   = { 't', 'e', 's', 't', 0 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_seek_after_utf8_name(
+	          NULL,
+	          utf8_name,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_seek_after_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_seek_after_utf16_name(
+     void )
+{
+	uint16_t utf16_name[ 5 ] = { 't', 'e', 's', 't', 0 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_seek_after_utf16_name(
+	          NULL,
+	          utf16_name,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_cursor function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_cursor(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t cursor          = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_cursor(
+	          NULL,
+	          &cursor,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_set_cursor function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_set_cursor(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_set_cursor(
+	          NULL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_read_next_index_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_read_next_index_entry(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_read_next_index_entry(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_file_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_file_reference(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t file_reference  = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_file_reference(
+	          NULL,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_parent_file_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_parent_file_reference(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint64_t parent_file_reference = 0;
+	int result                     = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_parent_file_reference(
+	          NULL,
+	          &parent_file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_creation_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_creation_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_creation_time(
+	          NULL,
+	          &filetime,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_modification_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_modification_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_modification_time(
+	          NULL,
+	          &filetime,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_access_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_access_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_access_time(
+	          NULL,
+	          &filetime,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_entry_modification_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_entry_modification_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_entry_modification_time(
+	          NULL,
+	          &filetime,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_allocated_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_allocated_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t allocated_size  = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_allocated_size(
+	          NULL,
+	          &allocated_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t size            = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_file_attribute_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_file_attribute_flags(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	uint32_t file_attribute_flags = 0;
+	int result                    = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_file_attribute_flags(
+	          NULL,
+	          &file_attribute_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_utf8_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_utf8_name_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_utf8_name_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_utf16_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_utf16_name_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_utf16_name_size(
+	          NULL,
+	          &utf16_string_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_utf8_name(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_utf8_name(
+	          NULL,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_directory_iterator_get_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_directory_iterator_get_utf16_name(
+     void )
+{
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_directory_iterator_get_utf16_name(
+	          NULL,
+	          utf16_string,
+	          32,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_initialize",
+	 fsntfs_test_directory_iterator_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_free",
+	 fsntfs_test_directory_iterator_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_reset",
+	 fsntfs_test_directory_iterator_reset );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_next_sub_file_entry",
+	 fsntfs_test_directory_iterator_get_next_sub_file_entry );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_seek_after_utf8_name",
+	 fsntfs_test_directory_iterator_seek_after_utf8_name );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_seek_after_utf16_name",
+	 fsntfs_test_directory_iterator_seek_after_utf16_name );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_cursor",
+	 fsntfs_test_directory_iterator_get_cursor );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_set_cursor",
+	 fsntfs_test_directory_iterator_set_cursor );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_read_next_index_entry",
+	 fsntfs_test_directory_iterator_read_next_index_entry );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_file_reference",
+	 fsntfs_test_directory_iterator_get_file_reference );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_parent_file_reference",
+	 fsntfs_test_directory_iterator_get_parent_file_reference );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_creation_time",
+	 fsntfs_test_directory_iterator_get_creation_time );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_modification_time",
+	 fsntfs_test_directory_iterator_get_modification_time );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_access_time",
+	 fsntfs_test_directory_iterator_get_access_time );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_entry_modification_time",
+	 fsntfs_test_directory_iterator_get_entry_modification_time );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_allocated_size",
+	 fsntfs_test_directory_iterator_get_allocated_size );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_size",
+	 fsntfs_test_directory_iterator_get_size );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_file_attribute_flags",
+	 fsntfs_test_directory_iterator_get_file_attribute_flags );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_utf8_name_size",
+	 fsntfs_test_directory_iterator_get_utf8_name_size );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_utf16_name_size",
+	 fsntfs_test_directory_iterator_get_utf16_name_size );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_utf8_name",
+	 fsntfs_test_directory_iterator_get_utf8_name );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_directory_iterator_get_utf16_name",
+	 fsntfs_test_directory_iterator_get_utf16_name );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1381 @@
+/*
+ * Library extent_map type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_functions.h"
+#include "fsntfs_test_libbfio.h"
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_extent_map.h"
+
+uint8_t fsntfs_test_extent_map_data1[ 48 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f };
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Creates an extent map with test extents
+ * The extents map data offset 0 to physical offset 32, data offset 8 is sparse
+ * and data offset 16 maps to physical offset 0, which is appended as 2 extents
+ * Returns 1 if successful or -1 on error
+ */
+int fsntfs_test_extent_map_create(
+     libfsntfs_extent_map_t **extent_map,
+     libcerror_error_t **error )
+{
+	if( libfsntfs_extent_map_initialize(
+	     extent_map,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfsntfs_extent_map_append_extent(
+	     *extent_map,
+	     32,
+	     8,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsntfs_extent_map_append_extent(
+	     *extent_map,
+	     0,
+	     8,
+	     LIBFSNTFS_EXTENT_FLAG_IS_SPARSE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsntfs_extent_map_append_extent(
+	     *extent_map,
+	     0,
+	     8,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfsntfs_extent_map_append_extent(
+	     *extent_map,
+	     8,
+	     8,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfsntfs_extent_map_free(
+	 extent_map,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfsntfs_extent_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_map_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_extent_map_t *extent_map = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_extent_map_initialize(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_map_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_map = (libfsntfs_extent_map_t *) 0x12345678UL;
+
+	result = libfsntfs_extent_map_initialize(
+	          &extent_map,
+	          &error );
+
+	extent_map = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_extent_map_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_extent_map_initialize(
+		          &extent_map,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( extent_map != NULL )
+			{
+				libfsntfs_extent_map_free(
+				 &extent_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "extent_map",
+			 extent_map );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_extent_map_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_extent_map_initialize(
+		          &extent_map,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( extent_map != NULL )
+			{
+				libfsntfs_extent_map_free(
+				 &extent_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "extent_map",
+			 extent_map );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsntfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_map_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_map_append_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_map_append_extent(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_extent_map_t *extent_map = NULL;
+	int extent_index                   = 0;
+	int number_of_extents              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_extent_map_initialize(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( extent_index = 0;
+	     extent_index < 1024;
+	     extent_index++ )
+	{
+		/* Every other extent is physically adjacent to the previous extent
+		 */
+		result = libfsntfs_extent_map_append_extent(
+		          extent_map,
+		          (off64_t) ( ( extent_index * 4096 ) + ( ( extent_index / 2 ) * 4096 ) ),
+		          4096,
+		          0,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsntfs_extent_map_append_extent(
+	          extent_map,
+	          0,
+	          4096,
+	          LIBFSNTFS_EXTENT_FLAG_IS_SPARSE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_map_append_extent(
+	          extent_map,
+	          0,
+	          4096,
+	          LIBFSNTFS_EXTENT_FLAG_IS_SPARSE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_map_get_number_of_extents(
+	          extent_map,
+	          &number_of_extents,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 513 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_map_append_extent(
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_map_append_extent(
+	          extent_map,
+	          -1,
+	          4096,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsntfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_map_get_number_of_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_map_get_number_of_extents(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_extent_map_t *extent_map = NULL;
+	int number_of_extents              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_extent_map_create(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_extent_map_get_number_of_extents(
+	          extent_map,
+	          &number_of_extents,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 3 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_map_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_map_get_number_of_extents(
+	          extent_map,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsntfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_map_get_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_map_get_extent_by_index(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_extent_map_t *extent_map = NULL;
+	size64_t size                      = 0;
+	off64_t data_offset                = 0;
+	off64_t physical_offset            = 0;
+	uint8_t extent_flags               = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_extent_map_create(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_extent_map_get_extent_by_index(
+	          extent_map,
+	          1,
+	          &data_offset,
+	          &physical_offset,
+	          &size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) 8 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 8 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT8(
+	 "extent_flags",
+	 extent_flags,
+	 LIBFSNTFS_EXTENT_FLAG_IS_SPARSE );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_extent_map_get_extent_by_index(
+	          extent_map,
+	          2,
+	          &data_offset,
+	          &physical_offset,
+	          &size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "data_offset",
+	 (int64_t) data_offset,
+	 (int64_t) 16 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 (int64_t) physical_offset,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 16 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT8(
+	 "extent_flags",
+	 extent_flags,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_map_get_extent_by_index(
+	          NULL,
+	          0,
+	          &data_offset,
+	          &physical_offset,
+	          &size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_map_get_extent_by_index(
+	          extent_map,
+	          3,
+	          &data_offset,
+	          &physical_offset,
+	          &size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_map_get_extent_by_index(
+	          extent_map,
+	          0,
+	          NULL,
+	          &physical_offset,
+	          &size,
+	          &extent_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsntfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_map_get_extent_index_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_map_get_extent_index_at_offset(
+     void )
+{
+	off64_t data_offsets[ 6 ]          = { 0, 7, 8, 15, 16, 31 };
+	int expected_extent_indexes[ 6 ]   = { 0, 0, 1, 1, 2, 2 };
+
+	libcerror_error_t *error           = NULL;
+	libfsntfs_extent_map_t *extent_map = NULL;
+	int extent_index                   = 0;
+	int result                         = 0;
+	int test_number                    = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_extent_map_create(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( test_number = 0;
+	     test_number < 6;
+	     test_number++ )
+	{
+		result = libfsntfs_extent_map_get_extent_index_at_offset(
+		          extent_map,
+		          data_offsets[ test_number ],
+		          &extent_index,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "extent_index",
+		 extent_index,
+		 expected_extent_indexes[ test_number ] );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsntfs_extent_map_get_extent_index_at_offset(
+	          extent_map,
+	          32,
+	          &extent_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_extent_map_get_extent_index_at_offset(
+	          NULL,
+	          0,
+	          &extent_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_extent_map_get_extent_index_at_offset(
+	          extent_map,
+	          0,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsntfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_extent_map_read_segment_data and libfsntfs_extent_map_seek_segment_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_extent_map_read_segment_data(
+     void )
+{
+	uint8_t segment_data[ 32 ];
+
+	uint8_t expected_segment_data1[ 32 ] = {
+		0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libfsntfs_extent_map_t *extent_map = NULL;
+	ssize_t read_count                 = 0;
+	off64_t offset                     = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = fsntfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsntfs_test_extent_map_data1,
+	          48,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsntfs_test_extent_map_create(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libfsntfs_extent_map_seek_segment_offset(
+	          extent_map,
+	          file_io_handle,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_extent_map_read_segment_data(
+	              extent_map,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              32,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 (int64_t) read_count,
+	 (int64_t) 32 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          expected_segment_data1,
+	          32 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read buffer spanning the end of the extents
+	 */
+	offset = libfsntfs_extent_map_seek_segment_offset(
+	          extent_map,
+	          file_io_handle,
+	          0,
+	          0,
+	          28,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 28 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_extent_map_read_segment_data(
+	              extent_map,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              8,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 (int64_t) read_count,
+	 (int64_t) 4 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( expected_segment_data1[ 28 ] ),
+	          4 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read buffer beyond the end of the extents
+	 */
+	read_count = libfsntfs_extent_map_read_segment_data(
+	              extent_map,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              8,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 (int64_t) read_count,
+	 (int64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsntfs_extent_map_read_segment_data(
+	              NULL,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              8,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 (int64_t) read_count,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_extent_map_read_segment_data(
+	              extent_map,
+	              file_io_handle,
+	              0,
+	              0,
+	              NULL,
+	              8,
+	              0,
+	              0,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 (int64_t) read_count,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libfsntfs_extent_map_seek_segment_offset(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libfsntfs_extent_map_seek_segment_offset(
+	          extent_map,
+	          file_io_handle,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_extent_map_free(
+	          &extent_map,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "extent_map",
+	 extent_map );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsntfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_map != NULL )
+	{
+		libfsntfs_extent_map_free(
+		 &extent_map,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_map_initialize",
+	 fsntfs_test_extent_map_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_map_free",
+	 fsntfs_test_extent_map_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_map_append_extent",
+	 fsntfs_test_extent_map_append_extent );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_map_get_number_of_extents",
+	 fsntfs_test_extent_map_get_number_of_extents );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_map_get_extent_by_index",
+	 fsntfs_test_extent_map_get_extent_by_index );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_map_get_extent_index_at_offset",
+	 fsntfs_test_extent_map_get_extent_index_at_offset );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_extent_map_read_segment_data",
+	 fsntfs_test_extent_map_read_segment_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+}
+
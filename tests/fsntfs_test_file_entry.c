@@ -8364,6 +8364,345 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_file_entry_get_number_of_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_file_entry_get_number_of_ranges(
+     libfsntfs_file_entry_t *file_entry )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_ranges     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_file_entry_get_number_of_ranges(
+	          file_entry,
+	          &number_of_ranges,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_file_entry_get_number_of_ranges(
+	          NULL,
+	          &number_of_ranges,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_file_entry_get_number_of_ranges(
+	          file_entry,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK )
+
+	/* Test libfsntfs_file_entry_get_number_of_ranges with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libfsntfs_file_entry_get_number_of_ranges(
+	          file_entry,
+	          &number_of_ranges,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfsntfs_file_entry_get_number_of_ranges with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libfsntfs_file_entry_get_number_of_ranges(
+	          file_entry,
+	          &number_of_ranges,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_file_entry_get_range_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_file_entry_get_range_by_index(
+     libfsntfs_file_entry_t *file_entry )
+{
+	libcerror_error_t *error = NULL;
+	size64_t expected_size   = 0;
+	size64_t range_size      = 0;
+	off64_t expected_offset  = 0;
+	off64_t range_offset     = 0;
+	uint32_t expected_flags  = 0;
+	uint32_t range_flags     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_file_entry_get_range_at_offset(
+	          file_entry,
+	          0,
+	          &expected_offset,
+	          &expected_size,
+	          &expected_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_file_entry_get_range_by_index(
+	          file_entry,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) expected_offset );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) expected_size );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 expected_flags );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_file_entry_get_range_by_index(
+	          NULL,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_file_entry_get_range_by_index(
+	          file_entry,
+	          -1,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_file_entry_get_range_by_index(
+	          file_entry,
+	          0,
+	          NULL,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK )
+
+	/* Test libfsntfs_file_entry_get_range_by_index with pthread_rwlock_wrlock failing in libcthreads_read_write_lock_grab_for_write
+	 */
+	fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = 0;
+
+	result = libfsntfs_file_entry_get_range_by_index(
+	          file_entry,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfsntfs_file_entry_get_range_by_index with pthread_rwlock_unlock failing in libcthreads_read_write_lock_release_for_write
+	 */
+	fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = 0;
+
+	result = libfsntfs_file_entry_get_range_by_index(
+	          file_entry,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &range_flags,
+	          &error );
+
+	if( fsntfs_test_pthread_rwlock_unlock_attempts_before_fail != -1 )
+	{
+		fsntfs_test_pthread_rwlock_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_RWLOCK_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -8786,6 +9125,16 @@ int main(
 	 fsntfs_test_file_entry_get_extent_by_index,
 	 file_entry );
 
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_file_entry_get_number_of_ranges",
+	 fsntfs_test_file_entry_get_number_of_ranges,
+	 file_entry );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_file_entry_get_range_by_index",
+	 fsntfs_test_file_entry_get_range_by_index,
+	 file_entry );
+
 	/* Clean up
 	 */
 	result = libfsntfs_file_entry_free(
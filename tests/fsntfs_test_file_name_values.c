@@ -1639,6 +1639,84 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_file_name_values_get_allocated_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_file_name_values_get_allocated_size(
+     libfsntfs_file_name_values_t *file_name_values )
+{
+	libcerror_error_t *error      = NULL;
+	uint64_t allocated_size        = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_file_name_values_get_allocated_size(
+	          file_name_values,
+	          &allocated_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "allocated_size",
+	 allocated_size,
+	 (uint64_t) 16384 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_file_name_values_get_allocated_size(
+	          NULL,
+	          &allocated_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_file_name_values_get_allocated_size(
+	          file_name_values,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_file_name_values_get_file_attribute_flags function
  * Returns 1 if successful or 0 if not
  */
@@ -2194,6 +2272,11 @@ int main(
 	 fsntfs_test_file_name_values_get_entry_modification_time,
 	 file_name_values );
 
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_file_name_values_get_allocated_size",
+	 fsntfs_test_file_name_values_get_allocated_size,
+	 file_name_values );
+
 	FSNTFS_TEST_RUN_WITH_ARGS(
 	 "libfsntfs_file_name_values_get_file_attribute_flags",
 	 fsntfs_test_file_name_values_get_file_attribute_flags,
@@ -696,6 +696,302 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_index_node_get_value_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_index_node_get_value_by_index(
+     libfsntfs_index_node_t *index_node )
+{
+	libcerror_error_t *error             = NULL;
+	libfsntfs_index_value_t *index_value = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_index_node_get_value_by_index(
+	          index_node,
+	          0,
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_value",
+	 index_value );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "index_value->size",
+	 index_value->size,
+	 24 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "index_value->flags",
+	 index_value->flags,
+	 0x00000003UL );
+
+	/* Test error cases
+	 */
+	index_value = NULL;
+
+	result = libfsntfs_index_node_get_value_by_index(
+	          NULL,
+	          0,
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_index_node_get_value_by_index(
+	          index_node,
+	          -1,
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_index_node_get_value_by_index(
+	          index_node,
+	          1,
+	          &index_value,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_index_node_get_value_by_index(
+	          index_node,
+	          0,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_index_node_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_index_node_add_reference(
+     libfsntfs_index_node_t *index_node )
+{
+	libcerror_error_t *error                  = NULL;
+	libfsntfs_index_node_t *shared_index_node = NULL;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_index_node_add_reference(
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node->number_of_references",
+	 index_node->number_of_references,
+	 2 );
+
+	/* Releasing the additional reference should not free the index node
+	 */
+	shared_index_node = index_node;
+
+	result = libfsntfs_index_node_free(
+	          &shared_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "shared_index_node",
+	 shared_index_node );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node->number_of_references",
+	 index_node->number_of_references,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node->number_of_values",
+	 index_node->number_of_values,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_index_node_add_reference(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_index_node_remove_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_index_node_remove_reference(
+     libfsntfs_index_node_t *index_node )
+{
+	libcerror_error_t *error                  = NULL;
+	libfsntfs_index_node_t *shared_index_node = NULL;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_index_node_add_reference(
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	shared_index_node = index_node;
+
+	result = libfsntfs_index_node_remove_reference(
+	          &shared_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "shared_index_node",
+	 shared_index_node );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node->number_of_references",
+	 index_node->number_of_references,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_index_node_remove_reference(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -800,7 +1096,20 @@ int main(
 	 fsntfs_test_index_node_get_number_of_values,
 	 index_node );
 
-	/* TODO add tests for libfsntfs_index_node_get_value_by_index */
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_index_node_get_value_by_index",
+	 fsntfs_test_index_node_get_value_by_index,
+	 index_node );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_index_node_add_reference",
+	 fsntfs_test_index_node_add_reference,
+	 index_node );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_index_node_remove_reference",
+	 fsntfs_test_index_node_remove_reference,
+	 index_node );
 
 	/* Clean up
 	 */
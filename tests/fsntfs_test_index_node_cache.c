@@ -0,0 +1,1038 @@
+/*
+ * Library index_node_cache type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_index_node.h"
+#include "../libfsntfs/libfsntfs_index_node_cache.h"
+
+uint8_t fsntfs_test_index_node_cache_data1[ 40 ] = {
+	0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Tests the libfsntfs_index_node_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_index_node_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsntfs_index_node_cache_t *index_node_cache   = NULL;
+	int result                                       = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                  = 1;
+	int number_of_memset_fail_tests                  = 1;
+	int test_number                                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_index_node_cache_initialize(
+	          &index_node_cache,
+	          1024 * 1024,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_node_cache",
+	 index_node_cache );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_cache_free(
+	          &index_node_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "index_node_cache",
+	 index_node_cache );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_index_node_cache_initialize(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_node_cache = (libfsntfs_index_node_cache_t *) 0x12345678UL;
+
+	result = libfsntfs_index_node_cache_initialize(
+	          &index_node_cache,
+	          1024 * 1024,
+	          &error );
+
+	index_node_cache = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_index_node_cache_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_index_node_cache_initialize(
+		          &index_node_cache,
+		          1024 * 1024,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( index_node_cache != NULL )
+			{
+				libfsntfs_index_node_cache_free(
+				 &index_node_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "index_node_cache",
+			 index_node_cache );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_index_node_cache_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_index_node_cache_initialize(
+		          &index_node_cache,
+		          1024 * 1024,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( index_node_cache != NULL )
+			{
+				libfsntfs_index_node_cache_free(
+				 &index_node_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "index_node_cache",
+			 index_node_cache );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_node_cache != NULL )
+	{
+		libfsntfs_index_node_cache_free(
+		 &index_node_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_index_node_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_index_node_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_index_node_cache_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_index_node_cache_get_index_node and libfsntfs_index_node_cache_set_index_node functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_index_node_cache_get_and_set_index_node(
+     libfsntfs_index_node_t *index_node )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsntfs_index_node_cache_t *index_node_cache = NULL;
+	libfsntfs_index_node_t *cached_index_node      = NULL;
+	int number_of_values                           = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_index_node_cache_initialize(
+	          &index_node_cache,
+	          1024 * 1024,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_node_cache",
+	 index_node_cache );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_index_node_cache_get_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "cached_index_node",
+	 cached_index_node );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_cache_set_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node_cache->number_of_values",
+	 index_node_cache->number_of_values,
+	 1 );
+
+	/* The cache shares the index node instead of storing a copy
+	 */
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node->number_of_references",
+	 index_node->number_of_references,
+	 2 );
+
+	/* Setting the same index node again should not add another value
+	 */
+	result = libfsntfs_index_node_cache_set_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node_cache->number_of_values",
+	 index_node_cache->number_of_values,
+	 1 );
+
+	result = libfsntfs_index_node_cache_get_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "cached_index_node",
+	 (int) ( cached_index_node == index_node ),
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node->number_of_references",
+	 index_node->number_of_references,
+	 3 );
+
+	result = libfsntfs_index_node_get_number_of_values(
+	          cached_index_node,
+	          &number_of_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_free(
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The index entry index is part of the key
+	 */
+	result = libfsntfs_index_node_cache_get_index_node(
+	          index_node_cache,
+	          4096,
+	          2,
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "cached_index_node",
+	 cached_index_node );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_cache_empty(
+	          index_node_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node_cache->number_of_values",
+	 index_node_cache->number_of_values,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "index_node_cache->size",
+	 index_node_cache->size,
+	 (size_t) 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node->number_of_references",
+	 index_node->number_of_references,
+	 1 );
+
+	result = libfsntfs_index_node_cache_get_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_index_node_cache_get_index_node(
+	          NULL,
+	          4096,
+	          1,
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_index_node_cache_get_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_index_node_cache_set_index_node(
+	          NULL,
+	          4096,
+	          1,
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_index_node_cache_set_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_index_node_cache_free(
+	          &index_node_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "index_node_cache",
+	 index_node_cache );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cached_index_node != NULL )
+	{
+		libfsntfs_index_node_free(
+		 &cached_index_node,
+		 NULL );
+	}
+	if( index_node_cache != NULL )
+	{
+		libfsntfs_index_node_cache_free(
+		 &index_node_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the removal of the least recently used index nodes
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_index_node_cache_remove_last_value(
+     libfsntfs_index_node_t *index_node )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsntfs_index_node_cache_t *index_node_cache = NULL;
+	libfsntfs_index_node_t *cached_index_node      = NULL;
+	size_t index_node_size                         = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_index_node_get_size(
+	          index_node,
+	          &index_node_size,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a cache that has room for 2 index nodes
+	 */
+	result = libfsntfs_index_node_cache_initialize(
+	          &index_node_cache,
+	          2 * ( index_node_size + sizeof( libfsntfs_index_node_cache_value_t ) ),
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_cache_set_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_cache_set_index_node(
+	          index_node_cache,
+	          8192,
+	          2,
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Mark the first index node as most recently used
+	 */
+	result = libfsntfs_index_node_cache_get_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_free(
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Setting a third index node should remove the least recently used
+	 */
+	result = libfsntfs_index_node_cache_set_index_node(
+	          index_node_cache,
+	          12288,
+	          3,
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node_cache->number_of_values",
+	 index_node_cache->number_of_values,
+	 2 );
+
+	result = libfsntfs_index_node_cache_get_index_node(
+	          index_node_cache,
+	          8192,
+	          2,
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_cache_get_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_free(
+	          &cached_index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_cache_free(
+	          &index_node_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a cache that is too small for an index node
+	 */
+	result = libfsntfs_index_node_cache_initialize(
+	          &index_node_cache,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_cache_set_index_node(
+	          index_node_cache,
+	          4096,
+	          1,
+	          index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "index_node_cache->number_of_values",
+	 index_node_cache->number_of_values,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfsntfs_index_node_cache_free(
+	          &index_node_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cached_index_node != NULL )
+	{
+		libfsntfs_index_node_free(
+		 &cached_index_node,
+		 NULL );
+	}
+	if( index_node_cache != NULL )
+	{
+		libfsntfs_index_node_cache_free(
+		 &index_node_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+	libcerror_error_t *error           = NULL;
+	libfsntfs_index_node_t *index_node = NULL;
+	int result                         = 0;
+#endif
+
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_index_node_cache_initialize",
+	 fsntfs_test_index_node_cache_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_index_node_cache_free",
+	 fsntfs_test_index_node_cache_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize test
+	 */
+	result = libfsntfs_index_node_initialize(
+	          &index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "index_node",
+	 index_node );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_read_header(
+	          index_node,
+	          fsntfs_test_index_node_cache_data1,
+	          40,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_index_node_read_values(
+	          index_node,
+	          0,
+	          fsntfs_test_index_node_cache_data1,
+	          40,
+	          16,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Run tests
+	 */
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_index_node_cache_get_index_node",
+	 fsntfs_test_index_node_cache_get_and_set_index_node,
+	 index_node );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_index_node_cache_remove_last_value",
+	 fsntfs_test_index_node_cache_remove_last_value,
+	 index_node );
+
+	/* Clean up
+	 */
+	result = libfsntfs_index_node_free(
+	          &index_node,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "index_node",
+	 index_node );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_node != NULL )
+	{
+		libfsntfs_index_node_free(
+		 &index_node,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+}
+
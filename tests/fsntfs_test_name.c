@@ -1089,6 +1089,217 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_name_get_hash, libfsntfs_name_get_hash_from_utf8_string
+ * and libfsntfs_name_get_hash_from_utf16_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_name_get_hash(
+     void )
+{
+        uint8_t utf16_stream_equal[ 12 ]            = { 'e', 0, 'q', 0, 'u', 0, 'a', 0, 'l', 0, 0 };
+        uint8_t utf16_stream_more[ 10 ]             = { 'm', 0, 'o', 0, 'r', 0, 'e', 0, 0, 0 };
+        uint8_t utf8_string_equal_upper[ 6 ]        = { 'E', 'Q', 'U', 'A', 'L', 0 };
+        uint16_t utf16_string_equal_upper[ 5 ]      = { 'E', 'Q', 'U', 'A', 'L' };
+	libcerror_error_t *error                    = NULL;
+	uint32_t case_sensitive_hash                = 0;
+	uint32_t hash                               = 0;
+	uint32_t utf8_string_hash                   = 0;
+	uint32_t utf16_string_hash                  = 0;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_name_get_hash(
+	          utf16_stream_equal,
+	          12,
+	          1,
+	          &hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_name_get_hash_from_utf8_string(
+	          utf8_string_equal_upper,
+	          6,
+	          1,
+	          &utf8_string_hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "utf8_string_hash",
+	 utf8_string_hash,
+	 hash );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_name_get_hash_from_utf16_string(
+	          utf16_string_equal_upper,
+	          5,
+	          1,
+	          &utf16_string_hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_string_hash",
+	 utf16_string_hash,
+	 hash );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that case folding is only applied when requested
+	 */
+	result = libfsntfs_name_get_hash(
+	          utf16_stream_equal,
+	          12,
+	          0,
+	          &case_sensitive_hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "case_sensitive_hash",
+	 (int32_t) case_sensitive_hash,
+	 (int32_t) hash );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_name_get_hash(
+	          utf16_stream_more,
+	          10,
+	          1,
+	          &utf16_string_hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "utf16_string_hash",
+	 (int32_t) utf16_string_hash,
+	 (int32_t) hash );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_name_get_hash(
+	          NULL,
+	          12,
+	          1,
+	          &hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_get_hash(
+	          utf16_stream_equal,
+	          12,
+	          1,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_get_hash_from_utf8_string(
+	          NULL,
+	          6,
+	          1,
+	          &hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_name_get_hash_from_utf16_string(
+	          NULL,
+	          5,
+	          1,
+	          &hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -1124,6 +1335,10 @@ int main(
 	 "libfsntfs_name_compare_with_utf16_string",
 	 fsntfs_test_name_compare_with_utf16_string );
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_name_get_hash",
+	 fsntfs_test_name_get_hash );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1041 @@
+/*
+ * Library path_cache type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_directory_entry.h"
+#include "../libfsntfs/libfsntfs_path_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Tests the libfsntfs_path_cache_key_set_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_path_cache_key_set_utf8_name(
+     void )
+{
+	uint8_t utf8_name1[ 5 ]  = { '$', 'M', 'F', 'T', 0 };
+	uint8_t utf8_name2[ 5 ]  = { '$', 'm', 'f', 't', 0 };
+	uint16_t utf16_name[ 5 ] = { '$', 'm', 'F', 't', 0 };
+	libfsntfs_path_cache_key_t path_cache_key1;
+	libfsntfs_path_cache_key_t path_cache_key2;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_path_cache_key_set_utf8_name(
+	          &path_cache_key1,
+	          5,
+	          utf8_name1,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "path_cache_key1.parent_file_reference",
+	 path_cache_key1.parent_file_reference,
+	 (uint64_t) 5 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "path_cache_key1.name_length",
+	 path_cache_key1.name_length,
+	 (size_t) 4 );
+
+	/* The name is case folded
+	 */
+	result = libfsntfs_path_cache_key_set_utf8_name(
+	          &path_cache_key2,
+	          5,
+	          utf8_name2,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "path_cache_key2.name_hash",
+	 path_cache_key2.name_hash,
+	 path_cache_key1.name_hash );
+
+	result = libfsntfs_path_cache_key_set_utf16_name(
+	          &path_cache_key2,
+	          5,
+	          utf16_name,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "path_cache_key2.name_hash",
+	 path_cache_key2.name_hash,
+	 path_cache_key1.name_hash );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_path_cache_key_set_utf8_name(
+	          NULL,
+	          5,
+	          utf8_name1,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_cache_key_set_utf8_name(
+	          &path_cache_key1,
+	          5,
+	          NULL,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_cache_key_set_utf16_name(
+	          NULL,
+	          5,
+	          utf16_name,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_path_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_path_cache_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsntfs_path_cache_t *path_cache = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_path_cache_initialize(
+	          &path_cache,
+	          LIBFSNTFS_PATH_CACHE_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_path_cache_initialize(
+	          NULL,
+	          LIBFSNTFS_PATH_CACHE_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_cache = (libfsntfs_path_cache_t *) 0x12345678UL;
+
+	result = libfsntfs_path_cache_initialize(
+	          &path_cache,
+	          LIBFSNTFS_PATH_CACHE_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	path_cache = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_path_cache_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_path_cache_initialize(
+		          &path_cache,
+		          LIBFSNTFS_PATH_CACHE_MAXIMUM_NUMBER_OF_VALUES,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( path_cache != NULL )
+			{
+				libfsntfs_path_cache_free(
+				 &path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "path_cache",
+			 path_cache );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_path_cache_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_path_cache_initialize(
+		          &path_cache,
+		          LIBFSNTFS_PATH_CACHE_MAXIMUM_NUMBER_OF_VALUES,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( path_cache != NULL )
+			{
+				libfsntfs_path_cache_free(
+				 &path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "path_cache",
+			 path_cache );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		libfsntfs_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_path_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_path_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_path_cache_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_path_cache_get_directory_entry and libfsntfs_path_cache_set_directory_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_path_cache_get_and_set_directory_entry(
+     void )
+{
+	uint8_t utf8_name1[ 5 ]                      = { '$', 'M', 'F', 'T', 0 };
+	uint8_t utf8_name2[ 5 ]                      = { '$', 'B', 'a', 'd', 0 };
+	libcerror_error_t *error                     = NULL;
+	libfsntfs_directory_entry_t *cached_entry    = NULL;
+	libfsntfs_directory_entry_t *directory_entry = NULL;
+	libfsntfs_path_cache_t *path_cache           = NULL;
+	libfsntfs_path_cache_key_t path_cache_key;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	directory_entry->file_reference = 0x0001000000000000UL;
+
+	result = libfsntfs_path_cache_initialize(
+	          &path_cache,
+	          LIBFSNTFS_PATH_CACHE_MAXIMUM_NUMBER_OF_VALUES,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_cache_key_set_utf8_name(
+	          &path_cache_key,
+	          5,
+	          utf8_name1,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_path_cache_get_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_cache_set_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->number_of_values",
+	 path_cache->number_of_values,
+	 1 );
+
+	result = libfsntfs_path_cache_get_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cached_entry->file_reference",
+	 cached_entry->file_reference,
+	 (uint64_t) 0x0001000000000000UL );
+
+	result = libfsntfs_directory_entry_free(
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The parent file reference is part of the key
+	 */
+	path_cache_key.parent_file_reference = 6;
+
+	result = libfsntfs_path_cache_get_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that does not exist
+	 */
+	result = libfsntfs_path_cache_key_set_utf8_name(
+	          &path_cache_key,
+	          5,
+	          utf8_name2,
+	          4,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_cache_set_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_cache_get_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "cached_entry",
+	 cached_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_cache_empty(
+	          path_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->number_of_values",
+	 path_cache->number_of_values,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_path_cache_get_directory_entry(
+	          NULL,
+	          &path_cache_key,
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_cache_get_directory_entry(
+	          path_cache,
+	          NULL,
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_cache_get_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_cache_set_directory_entry(
+	          NULL,
+	          &path_cache_key,
+	          directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_cache_set_directory_entry(
+	          path_cache,
+	          NULL,
+	          directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_directory_entry_free(
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cached_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &cached_entry,
+		 NULL );
+	}
+	if( path_cache != NULL )
+	{
+		libfsntfs_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the removal of the least recently used values
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_path_cache_remove_last_value(
+     void )
+{
+	uint8_t utf8_name[ 2 ]                    = { 'a', 0 };
+	libcerror_error_t *error                  = NULL;
+	libfsntfs_directory_entry_t *cached_entry = NULL;
+	libfsntfs_path_cache_t *path_cache        = NULL;
+	libfsntfs_path_cache_key_t path_cache_key;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_path_cache_initialize(
+	          &path_cache,
+	          2,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( utf8_name[ 0 ] = 'a';
+	     utf8_name[ 0 ] <= 'c';
+	     utf8_name[ 0 ] += 1 )
+	{
+		result = libfsntfs_path_cache_key_set_utf8_name(
+		          &path_cache_key,
+		          5,
+		          utf8_name,
+		          1,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsntfs_path_cache_set_directory_entry(
+		          path_cache,
+		          &path_cache_key,
+		          NULL,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->number_of_values",
+	 path_cache->number_of_values,
+	 2 );
+
+	/* The least recently used value should have been removed
+	 */
+	utf8_name[ 0 ] = 'a';
+
+	result = libfsntfs_path_cache_key_set_utf8_name(
+	          &path_cache_key,
+	          5,
+	          utf8_name,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_cache_get_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_name[ 0 ] = 'c';
+
+	result = libfsntfs_path_cache_key_set_utf8_name(
+	          &path_cache_key,
+	          5,
+	          utf8_name,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_cache_get_directory_entry(
+	          path_cache,
+	          &path_cache_key,
+	          &cached_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cached_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &cached_entry,
+		 NULL );
+	}
+	if( path_cache != NULL )
+	{
+		libfsntfs_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_path_cache_key_set_utf8_name",
+	 fsntfs_test_path_cache_key_set_utf8_name );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_path_cache_initialize",
+	 fsntfs_test_path_cache_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_path_cache_free",
+	 fsntfs_test_path_cache_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_path_cache_get_directory_entry",
+	 fsntfs_test_path_cache_get_and_set_directory_entry );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_path_cache_remove_last_value",
+	 fsntfs_test_path_cache_remove_last_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,383 @@
+/*
+ * Library path_resolver functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_path_resolver.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Tests the libfsntfs_path_resolver_path_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_path_resolver_path_compare(
+     void )
+{
+	libfsntfs_path_resolver_path_t first_path;
+	libfsntfs_path_resolver_path_t second_path;
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	first_path.utf8_string         = (uint8_t *) "\\Windows\\System32";
+	first_path.utf8_string_length  = 17;
+	first_path.path_index          = 0;
+
+	second_path.utf8_string        = (uint8_t *) "\\Windows\\System32\\config";
+	second_path.utf8_string_length = 24;
+	second_path.path_index         = 1;
+
+	result = libfsntfs_path_resolver_path_compare(
+	          &first_path,
+	          &second_path );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfsntfs_path_resolver_path_compare(
+	          &second_path,
+	          &first_path );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	second_path.utf8_string        = (uint8_t *) "\\Users";
+	second_path.utf8_string_length = 6;
+
+	result = libfsntfs_path_resolver_path_compare(
+	          &first_path,
+	          &second_path );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Equal strings are ordered by their index in the input
+	 */
+	second_path.utf8_string        = (uint8_t *) "\\Windows\\System32";
+	second_path.utf8_string_length = 17;
+
+	result = libfsntfs_path_resolver_path_compare(
+	          &first_path,
+	          &second_path );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfsntfs_path_resolver_path_compare(
+	          &first_path,
+	          &first_path );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfsntfs_path_resolver_get_utf8_path_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_path_resolver_get_utf8_path_segment(
+     void )
+{
+	uint8_t utf8_path[ 18 ]  = {
+		'\\', 'W', 'i', 'n', 'd', 'o', 'w', 's', '\\', 'S', 'y', 's', 't', 'e', 'm', '3', '2', 0 };
+
+	libcerror_error_t *error = NULL;
+	size_t segment_length    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_path_resolver_get_utf8_path_segment(
+	          utf8_path,
+	          17,
+	          1,
+	          &segment_length,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 7 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_resolver_get_utf8_path_segment(
+	          utf8_path,
+	          17,
+	          9,
+	          &segment_length,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 8 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_path_resolver_get_utf8_path_segment(
+	          utf8_path,
+	          17,
+	          0,
+	          &segment_length,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_path_resolver_get_utf8_path_segment(
+	          NULL,
+	          17,
+	          1,
+	          &segment_length,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_resolver_get_utf8_path_segment(
+	          utf8_path,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &segment_length,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_resolver_get_utf8_path_segment(
+	          utf8_path,
+	          17,
+	          18,
+	          &segment_length,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_path_resolver_get_utf8_path_segment(
+	          utf8_path,
+	          17,
+	          1,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_path_resolver_resolve_utf8_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_path_resolver_resolve_utf8_paths(
+     void )
+{
+	uint8_t utf8_path[ 6 ]         = { '\\', '$', 'M', 'F', 'T', 0 };
+	const uint8_t *utf8_strings[ 1 ];
+	size_t utf8_string_lengths[ 1 ];
+	uint64_t file_references[ 1 ];
+	int results[ 1 ];
+
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	utf8_strings[ 0 ]        = utf8_path;
+	utf8_string_lengths[ 0 ] = 5;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_path_resolver_resolve_utf8_paths(
+	          NULL,
+	          NULL,
+	          NULL,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          1,
+	          file_references,
+	          results,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_path_resolver_path_compare",
+	 fsntfs_test_path_resolver_path_compare );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_path_resolver_get_utf8_path_segment",
+	 fsntfs_test_path_resolver_get_utf8_path_segment );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_path_resolver_resolve_utf8_paths",
+	 fsntfs_test_path_resolver_resolve_utf8_paths );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+}
+
@@ -37,6 +37,7 @@
 #include "../libfsntfs/libfsntfs_io_handle.h"
 #include "../libfsntfs/libfsntfs_mft_attribute.h"
 #include "../libfsntfs/libfsntfs_security_descriptor_index.h"
+#include "../libfsntfs/libfsntfs_security_descriptor_values.h"
 
 uint8_t fsntfs_test_security_descriptor_index_data1[ 80 ] = {
 	0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x04, 0x40, 0x00, 0x00, 0x00, 0x08, 0x00,
@@ -419,6 +420,403 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_security_descriptor_index_insert_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_security_descriptor_index_insert_entry(
+     void )
+{
+	libbfio_handle_t *file_io_handle                                        = NULL;
+	libcerror_error_t *error                                                = NULL;
+	libfsntfs_io_handle_t *io_handle                                        = NULL;
+	libfsntfs_mft_attribute_t *data_attribute                               = NULL;
+	libfsntfs_security_descriptor_index_t *security_descriptor_index        = NULL;
+	libfsntfs_security_descriptor_values_t *read_security_descriptor_values = NULL;
+	libfsntfs_security_descriptor_values_t *security_descriptor_values      = NULL;
+	int result                                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->cluster_block_size = 4096;
+
+	result = libfsntfs_mft_attribute_initialize(
+	          &data_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_attribute",
+	 data_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_read_data(
+	          data_attribute,
+	          io_handle,
+	          fsntfs_test_security_descriptor_index_data1,
+	          80,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_index_initialize(
+	          &security_descriptor_index,
+	          io_handle,
+	          file_io_handle,
+	          data_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_index",
+	 security_descriptor_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_security_descriptor_index_get_cached_entry_by_identifier(
+	          security_descriptor_index,
+	          256,
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_values",
+	 security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_values_initialize(
+	          &read_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_security_descriptor_values",
+	 read_security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_security_descriptor_values->identifier = 256;
+
+	result = libfsntfs_security_descriptor_index_insert_entry(
+	          security_descriptor_index,
+	          &read_security_descriptor_values,
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "read_security_descriptor_values",
+	 read_security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_values",
+	 security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_values->identifier",
+	 security_descriptor_values->identifier,
+	 (uint32_t) 256 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_values_free(
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_index_get_cached_entry_by_identifier(
+	          security_descriptor_index,
+	          256,
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_values",
+	 security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_values_free(
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting values of an identifier that was cached in the meantime
+	 */
+	result = libfsntfs_security_descriptor_values_initialize(
+	          &read_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_security_descriptor_values->identifier = 256;
+
+	result = libfsntfs_security_descriptor_index_insert_entry(
+	          security_descriptor_index,
+	          &read_security_descriptor_values,
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "read_security_descriptor_values",
+	 read_security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_values",
+	 security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_values_free(
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_security_descriptor_index_insert_entry(
+	          NULL,
+	          &read_security_descriptor_values,
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_security_descriptor_index_insert_entry(
+	          security_descriptor_index,
+	          &read_security_descriptor_values,
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_security_descriptor_index_get_cached_entry_by_identifier(
+	          NULL,
+	          256,
+	          &security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_security_descriptor_index_free(
+	          &security_descriptor_index,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_index",
+	 security_descriptor_index );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_free(
+	          &data_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 &security_descriptor_values,
+		 NULL );
+	}
+	if( read_security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 &read_security_descriptor_values,
+		 NULL );
+	}
+	if( security_descriptor_index != NULL )
+	{
+		libfsntfs_security_descriptor_index_free(
+		 &security_descriptor_index,
+		 NULL );
+	}
+	if( data_attribute != NULL )
+	{
+		libfsntfs_mft_attribute_free(
+		 &data_attribute,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -450,6 +848,10 @@ int main(
 
 	/* TODO: add tests for libfsntfs_security_descriptor_index_get_security_descriptor_by_identifier */
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_security_descriptor_index_insert_entry",
+	 fsntfs_test_security_descriptor_index_insert_entry );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
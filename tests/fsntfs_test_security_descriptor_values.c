@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -29,6 +30,7 @@
 
 #include "fsntfs_test_functions.h"
 #include "fsntfs_test_libbfio.h"
+#include "fsntfs_test_libcdata.h"
 #include "fsntfs_test_libcerror.h"
 #include "fsntfs_test_libfdata.h"
 #include "fsntfs_test_libfsntfs.h"
@@ -1507,6 +1509,331 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_security_descriptor_values_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_security_descriptor_values_clone(
+     libfsntfs_security_descriptor_values_t *security_descriptor_values )
+{
+	libcerror_error_t *error                                                       = NULL;
+	libfsntfs_security_descriptor_values_t *destination_security_descriptor_values = NULL;
+	int result                                                                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_security_descriptor_values_clone(
+	          &destination_security_descriptor_values,
+	          security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_security_descriptor_values",
+	 destination_security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_security_descriptor_values->data_size",
+	 destination_security_descriptor_values->data_size,
+	 security_descriptor_values->data_size );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_security_descriptor_values->identifier",
+	 destination_security_descriptor_values->identifier,
+	 security_descriptor_values->identifier );
+
+	result = memory_compare(
+	          destination_security_descriptor_values->data,
+	          security_descriptor_values->data,
+	          security_descriptor_values->data_size );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsntfs_security_descriptor_values_free(
+	          &destination_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "destination_security_descriptor_values",
+	 destination_security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_values_clone(
+	          &destination_security_descriptor_values,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "destination_security_descriptor_values",
+	 destination_security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_security_descriptor_values_clone(
+	          NULL,
+	          security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_security_descriptor_values = security_descriptor_values;
+
+	result = libfsntfs_security_descriptor_values_clone(
+	          &destination_security_descriptor_values,
+	          security_descriptor_values,
+	          &error );
+
+	destination_security_descriptor_values = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 &destination_security_descriptor_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_security_descriptor_values_compare_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_security_descriptor_values_compare_by_identifier(
+     void )
+{
+	libcerror_error_t *error                                                  = NULL;
+	libfsntfs_security_descriptor_values_t *first_security_descriptor_values  = NULL;
+	libfsntfs_security_descriptor_values_t *second_security_descriptor_values = NULL;
+	int result                                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_security_descriptor_values_initialize(
+	          &first_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "first_security_descriptor_values",
+	 first_security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_values_initialize(
+	          &second_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "second_security_descriptor_values",
+	 second_security_descriptor_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	first_security_descriptor_values->identifier  = 256;
+	second_security_descriptor_values->identifier = 257;
+
+	result = libfsntfs_security_descriptor_values_compare_by_identifier(
+	          first_security_descriptor_values,
+	          second_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_values_compare_by_identifier(
+	          second_security_descriptor_values,
+	          first_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	second_security_descriptor_values->identifier = 256;
+
+	result = libfsntfs_security_descriptor_values_compare_by_identifier(
+	          first_security_descriptor_values,
+	          second_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_security_descriptor_values_compare_by_identifier(
+	          NULL,
+	          second_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_security_descriptor_values_compare_by_identifier(
+	          first_security_descriptor_values,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_security_descriptor_values_free(
+	          &second_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_security_descriptor_values_free(
+	          &first_security_descriptor_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 &second_security_descriptor_values,
+		 NULL );
+	}
+	if( first_security_descriptor_values != NULL )
+	{
+		libfsntfs_security_descriptor_values_free(
+		 &first_security_descriptor_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
 
 /* The main program
@@ -1556,6 +1883,10 @@ int main(
 	 "libfsntfs_security_descriptor_values_read_from_mft_attribute",
 	 fsntfs_test_security_descriptor_values_read_from_mft_attribute );
 
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_security_descriptor_values_compare_by_identifier",
+	 fsntfs_test_security_descriptor_values_compare_by_identifier );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize security_descriptor_values for tests
@@ -1602,6 +1933,11 @@ int main(
 	 fsntfs_test_security_descriptor_values_get_data,
 	 security_descriptor_values );
 
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_security_descriptor_values_clone",
+	 fsntfs_test_security_descriptor_values_clone,
+	 security_descriptor_values );
+
 	/* Clean up
 	 */
 	result = libfsntfs_security_descriptor_values_free(
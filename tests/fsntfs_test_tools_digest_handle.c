@@ -0,0 +1,1189 @@
+/*
+ * Tools digest_handle type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../fsntfstools/digest_handle.h"
+
+/* Tests the digest_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_handle_initialize(
+     void )
+{
+	digest_handle_t *digest_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_handle_initialize(
+	          &digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_ALL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_handle",
+	 digest_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_free(
+	          &digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "digest_handle",
+	 digest_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_handle_initialize(
+	          NULL,
+	          DIGEST_HANDLE_DIGEST_TYPE_MD5,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	digest_handle = (digest_handle_t *) 0x12345678UL;
+
+	result = digest_handle_initialize(
+	          &digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_MD5,
+	          &error );
+
+	digest_handle = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_handle_initialize(
+	          &digest_handle,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_handle != NULL )
+	{
+		digest_handle_free(
+		 &digest_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_handle_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_handle_update and digest_handle_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_handle_update(
+     void )
+{
+	uint8_t block[ 4096 ];
+	char string[ DIGEST_HANDLE_STRING_SIZE_SHA256 ];
+
+	digest_handle_t *digest_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t block_index             = 0;
+	int result                     = 0;
+
+	for( block_index = 0;
+	     block_index < 4096;
+	     block_index++ )
+	{
+		block[ block_index ] = (uint8_t) ( block_index % 251 );
+	}
+	/* Initialize test
+	 */
+	result = digest_handle_initialize(
+	          &digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_ALL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_handle",
+	 digest_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with data that spans multiple buffers
+	 */
+	result = digest_handle_start(
+	          digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( block_index = 0;
+	     block_index < 700;
+	     block_index++ )
+	{
+		result = digest_handle_update(
+		          digest_handle,
+		          block,
+		          4096,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = digest_handle_finalize(
+	          digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_get_string(
+	          digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_MD5,
+	          string,
+	          DIGEST_HANDLE_STRING_SIZE_SHA256,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "c7b9407ebb4e40a39744703ce47ab6ef",
+	          33 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = digest_handle_get_string(
+	          digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_SHA1,
+	          string,
+	          DIGEST_HANDLE_STRING_SIZE_SHA256,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "20ee86a37a1eca5e2c8c64c546737acee447a08d",
+	          41 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = digest_handle_get_string(
+	          digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_SHA256,
+	          string,
+	          DIGEST_HANDLE_STRING_SIZE_SHA256,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "da5e597d5e2a5b0c675d2433bb57a469c4c622c28f3be6476a133ab0e198f6eb",
+	          65 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the digest handle can be reused
+	 */
+	result = digest_handle_start(
+	          digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_update(
+	          digest_handle,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_finalize(
+	          digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_get_string(
+	          digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_SHA256,
+	          string,
+	          DIGEST_HANDLE_STRING_SIZE_SHA256,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+	          65 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_handle_finalize(
+	          digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_handle_update(
+	          NULL,
+	          block,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_handle_free(
+	          &digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "digest_handle",
+	 digest_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_handle != NULL )
+	{
+		digest_handle_free(
+		 &digest_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_handle_update_sparse function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_handle_update_sparse(
+     void )
+{
+	uint8_t block[ 4096 ];
+	uint8_t expected_hashes[ DIGEST_HANDLE_HASHES_SIZE ];
+	uint8_t hashes[ DIGEST_HANDLE_HASHES_SIZE ];
+
+	digest_handle_t *digest_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t block_index             = 0;
+	int pass_index                 = 0;
+	int result                     = 0;
+
+	for( block_index = 0;
+	     block_index < 4096;
+	     block_index++ )
+	{
+		block[ block_index ] = (uint8_t) ( block_index % 251 );
+	}
+	/* Initialize test
+	 */
+	result = digest_handle_initialize(
+	          &digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_ALL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_handle",
+	 digest_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the first pass hashes the 0-byte values as data
+	 * and the second pass as sparse data, which must result in the same hashes
+	 */
+	for( pass_index = 0;
+	     pass_index < 2;
+	     pass_index++ )
+	{
+		result = digest_handle_start(
+		          digest_handle,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = digest_handle_update(
+		          digest_handle,
+		          block,
+		          4096,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( pass_index == 0 )
+		{
+			if( memory_set(
+			     block,
+			     0,
+			     4096 ) == NULL )
+			{
+				goto on_error;
+			}
+			for( block_index = 0;
+			     block_index < 600;
+			     block_index++ )
+			{
+				result = digest_handle_update(
+				          digest_handle,
+				          block,
+				          4096,
+				          &error );
+
+				FSNTFS_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				FSNTFS_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+			result = digest_handle_update(
+			          digest_handle,
+			          block,
+			          7,
+			          &error );
+
+			for( block_index = 0;
+			     block_index < 4096;
+			     block_index++ )
+			{
+				block[ block_index ] = (uint8_t) ( block_index % 251 );
+			}
+		}
+		else
+		{
+			result = digest_handle_update_sparse(
+			          digest_handle,
+			          ( 600 * 4096 ) + 7,
+			          &error );
+		}
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = digest_handle_update(
+		          digest_handle,
+		          block,
+		          4096,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = digest_handle_finalize(
+		          digest_handle,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = digest_handle_get_hashes(
+		          digest_handle,
+		          ( pass_index == 0 ) ? expected_hashes : hashes,
+		          DIGEST_HANDLE_HASHES_SIZE,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          DIGEST_HANDLE_HASHES_SIZE );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_handle_update_sparse(
+	          NULL,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_handle_free(
+	          &digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "digest_handle",
+	 digest_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_handle != NULL )
+	{
+		digest_handle_free(
+		 &digest_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_handle_get_hashes and digest_handle_set_hashes functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_handle_get_hashes(
+     void )
+{
+	uint8_t hashes[ DIGEST_HANDLE_HASHES_SIZE ];
+	char string[ DIGEST_HANDLE_STRING_SIZE_SHA256 ];
+
+	uint8_t expected_md5_hash[ 16 ] = {
+		0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0, 0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72 };
+
+	digest_handle_t *digest_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	size_t hash_index              = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = digest_handle_initialize(
+	          &digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_MD5,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_handle",
+	 digest_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_start(
+	          digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the digests were not finalized
+	 */
+	result = digest_handle_get_hashes(
+	          digest_handle,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = digest_handle_update(
+	          digest_handle,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_finalize(
+	          digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_get_hashes(
+	          digest_handle,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_md5_hash,
+	          16 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The hashes of digest types that are not calculated are 0
+	 */
+	for( hash_index = 16;
+	     hash_index < DIGEST_HANDLE_HASHES_SIZE;
+	     hash_index++ )
+	{
+		FSNTFS_TEST_ASSERT_EQUAL_UINT8(
+		 "hashes[ hash_index ]",
+		 hashes[ hash_index ],
+		 0 );
+	}
+	/* Test that set hashes are available as if they were calculated
+	 */
+	result = digest_handle_start(
+	          digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_set_hashes(
+	          digest_handle,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_get_string(
+	          digest_handle,
+	          DIGEST_HANDLE_DIGEST_TYPE_MD5,
+	          string,
+	          DIGEST_HANDLE_STRING_SIZE_SHA256,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          string,
+	          "900150983cd24fb0d6963f7d28e17f72",
+	          33 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = digest_handle_get_hashes(
+	          NULL,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_handle_get_hashes(
+	          digest_handle,
+	          hashes,
+	          16,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_handle_set_hashes(
+	          NULL,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_handle_set_hashes(
+	          digest_handle,
+	          NULL,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_handle_free(
+	          &digest_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "digest_handle",
+	 digest_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_handle != NULL )
+	{
+		digest_handle_free(
+		 &digest_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_handle_get_digest_types_from_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_handle_get_digest_types_from_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t digest_types     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_handle_get_digest_types_from_string(
+	          _SYSTEM_STRING( "md5,SHA256" ),
+	          &digest_types,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT8(
+	 "digest_types",
+	 digest_types,
+	 (uint8_t) ( DIGEST_HANDLE_DIGEST_TYPE_MD5 | DIGEST_HANDLE_DIGEST_TYPE_SHA256 ) );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	digest_types = DIGEST_HANDLE_DIGEST_TYPE_MD5;
+
+	result = digest_handle_get_digest_types_from_string(
+	          _SYSTEM_STRING( "sha1" ),
+	          &digest_types,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT8(
+	 "digest_types",
+	 digest_types,
+	 (uint8_t) ( DIGEST_HANDLE_DIGEST_TYPE_MD5 | DIGEST_HANDLE_DIGEST_TYPE_SHA1 ) );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_handle_get_digest_types_from_string(
+	          _SYSTEM_STRING( "sha1,crc32" ),
+	          &digest_types,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_handle_get_digest_types_from_string(
+	          NULL,
+	          &digest_types,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSNTFS_TEST_RUN(
+	 "digest_handle_initialize",
+	 fsntfs_test_tools_digest_handle_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "digest_handle_free",
+	 fsntfs_test_tools_digest_handle_free );
+
+	FSNTFS_TEST_RUN(
+	 "digest_handle_update",
+	 fsntfs_test_tools_digest_handle_update );
+
+	FSNTFS_TEST_RUN(
+	 "digest_handle_update_sparse",
+	 fsntfs_test_tools_digest_handle_update_sparse );
+
+	FSNTFS_TEST_RUN(
+	 "digest_handle_get_hashes",
+	 fsntfs_test_tools_digest_handle_get_hashes );
+
+	FSNTFS_TEST_RUN(
+	 "digest_handle_get_digest_types_from_string",
+	 fsntfs_test_tools_digest_handle_get_digest_types_from_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,882 @@
+/*
+ * Tools digest_memo type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../fsntfstools/digest_memo.h"
+
+/* Tests the digest_memo_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_memo_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	digest_memo_t *digest_memo = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_memo_initialize(
+	          &digest_memo,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_memo",
+	 digest_memo );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_memo_free(
+	          &digest_memo,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "digest_memo",
+	 digest_memo );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_memo_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	digest_memo = (digest_memo_t *) 0x12345678UL;
+
+	result = digest_memo_initialize(
+	          &digest_memo,
+	          &error );
+
+	digest_memo = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_memo != NULL )
+	{
+		digest_memo_free(
+		 &digest_memo,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_memo_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_memo_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = digest_memo_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_memo_get_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_memo_get_name_hash(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t name_hash       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = digest_memo_get_name_hash(
+	          NULL,
+	          0,
+	          &name_hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_memo_get_name_hash(
+	          _SYSTEM_STRING( "a" ),
+	          1,
+	          &name_hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_memo_get_name_hash(
+	          NULL,
+	          1,
+	          &name_hash,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_memo_get_name_hash(
+	          _SYSTEM_STRING( "a" ),
+	          1,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the digest_memo_get_hashes and digest_memo_set_hashes functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_digest_memo_get_hashes(
+     void )
+{
+	uint8_t hashes[ DIGEST_HANDLE_HASHES_SIZE ];
+	uint8_t expected_hashes[ DIGEST_HANDLE_HASHES_SIZE ];
+
+	digest_memo_t *digest_memo = NULL;
+	libcerror_error_t *error   = NULL;
+	uint64_t file_reference    = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = digest_memo_initialize(
+	          &digest_memo,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "digest_memo",
+	 digest_memo );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the hashes of a file entry that is not shared are retained
+	 * until the hashes of another file entry are set
+	 */
+	memory_set(
+	 expected_hashes,
+	 0xa5,
+	 DIGEST_HANDLE_HASHES_SIZE );
+
+	result = digest_memo_set_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          expected_hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "digest_memo->number_of_entries",
+	 digest_memo->number_of_entries,
+	 (uint32_t) 0 );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          DIGEST_HANDLE_HASHES_SIZE );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the hashes of shared file entries are retained
+	 */
+	for( file_reference = 16;
+	     file_reference < 4096;
+	     file_reference++ )
+	{
+		memory_set(
+		 expected_hashes,
+		 (int) ( file_reference & 0xff ),
+		 DIGEST_HANDLE_HASHES_SIZE );
+
+		result = digest_memo_set_hashes(
+		          digest_memo,
+		          ( (uint64_t) 3 << 48 ) | file_reference,
+		          NULL,
+		          0,
+		          expected_hashes,
+		          DIGEST_HANDLE_HASHES_SIZE,
+		          1,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "digest_memo->number_of_entries",
+	 digest_memo->number_of_entries,
+	 (uint32_t) ( 4096 - 16 ) );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_reference = 16;
+	     file_reference < 4096;
+	     file_reference++ )
+	{
+		memory_set(
+		 expected_hashes,
+		 (int) ( file_reference & 0xff ),
+		 DIGEST_HANDLE_HASHES_SIZE );
+
+		result = digest_memo_get_hashes(
+		          digest_memo,
+		          ( (uint64_t) 3 << 48 ) | file_reference,
+		          NULL,
+		          0,
+		          hashes,
+		          DIGEST_HANDLE_HASHES_SIZE,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          hashes,
+		          expected_hashes,
+		          DIGEST_HANDLE_HASHES_SIZE );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* A file reference with a different sequence number is a different file entry
+	 */
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 4 << 48 ) | 16,
+	          NULL,
+	          0,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the hashes of an alternate data stream are distinct from
+	 * those of the default data stream of the same file entry
+	 */
+	memory_set(
+	 expected_hashes,
+	 0x5a,
+	 DIGEST_HANDLE_HASHES_SIZE );
+
+	result = digest_memo_set_hashes(
+	          digest_memo,
+	          ( (uint64_t) 3 << 48 ) | 16,
+	          _SYSTEM_STRING( "ads" ),
+	          3,
+	          expected_hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 3 << 48 ) | 16,
+	          _SYSTEM_STRING( "ads" ),
+	          3,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          DIGEST_HANDLE_HASHES_SIZE );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_set(
+	 expected_hashes,
+	 16,
+	 DIGEST_HANDLE_HASHES_SIZE );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 3 << 48 ) | 16,
+	          NULL,
+	          0,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hashes,
+	          expected_hashes,
+	          DIGEST_HANDLE_HASHES_SIZE );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 3 << 48 ) | 16,
+	          _SYSTEM_STRING( "adt" ),
+	          3,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the most recently set entry only matches the same data stream
+	 */
+	result = digest_memo_set_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 7,
+	          NULL,
+	          0,
+	          expected_hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 7,
+	          _SYSTEM_STRING( "ads" ),
+	          3,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = digest_memo_get_hashes(
+	          NULL,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          NULL,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          hashes,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_memo_get_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          3,
+	          hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_memo_set_hashes(
+	          NULL,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          expected_hashes,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_memo_set_hashes(
+	          digest_memo,
+	          ( (uint64_t) 1 << 48 ) | 5,
+	          NULL,
+	          0,
+	          NULL,
+	          DIGEST_HANDLE_HASHES_SIZE,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_memo_resize(
+	          digest_memo,
+	          1000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = digest_memo_resize(
+	          digest_memo,
+	          1024,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = digest_memo_free(
+	          &digest_memo,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "digest_memo",
+	 digest_memo );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( digest_memo != NULL )
+	{
+		digest_memo_free(
+		 &digest_memo,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSNTFS_TEST_RUN(
+	 "digest_memo_initialize",
+	 fsntfs_test_tools_digest_memo_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "digest_memo_free",
+	 fsntfs_test_tools_digest_memo_free );
+
+	FSNTFS_TEST_RUN(
+	 "digest_memo_get_name_hash",
+	 fsntfs_test_tools_digest_memo_get_name_hash );
+
+	FSNTFS_TEST_RUN(
+	 "digest_memo_get_hashes",
+	 fsntfs_test_tools_digest_memo_get_hashes );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
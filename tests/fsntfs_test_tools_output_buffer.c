@@ -0,0 +1,388 @@
+/*
+ * Tools output_buffer type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../fsntfstools/output_buffer.h"
+
+/* Tests the output_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_output_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_buffer_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer = (output_buffer_t *) 0x12345678UL;
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	output_buffer = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_output_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = output_buffer_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_printf and output_buffer_empty functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_tools_output_buffer_printf(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	size_t expected_data_size      = 0;
+	int line_index                 = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_printf(
+	          output_buffer,
+	          "0|%s|%" PRIu64 "-%d\n",
+	          "/file.txt",
+	          (uint64_t) 64,
+	          1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 17 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 17 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "0|/file.txt|64-1\n",
+	          17 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test appending data that exceeds the initial allocated size
+	 */
+	expected_data_size = 17;
+
+	for( line_index = 0;
+	     line_index < 8192;
+	     line_index++ )
+	{
+		result = output_buffer_printf(
+		          output_buffer,
+		          "%08d|%-16s\n",
+		          line_index,
+		          "name" );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 26 );
+
+		expected_data_size += 26;
+	}
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 expected_data_size );
+
+	result = memory_compare(
+	          &( output_buffer->data[ expected_data_size - 26 ] ),
+	          "00008191|name            \n",
+	          26 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = output_buffer_empty(
+	          output_buffer,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_buffer_printf(
+	          NULL,
+	          "%s",
+	          "test" );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = output_buffer_empty(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSNTFS_TEST_RUN(
+	 "output_buffer_initialize",
+	 fsntfs_test_tools_output_buffer_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "output_buffer_free",
+	 fsntfs_test_tools_output_buffer_free );
+
+	FSNTFS_TEST_RUN(
+	 "output_buffer_printf",
+	 fsntfs_test_tools_output_buffer_printf );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
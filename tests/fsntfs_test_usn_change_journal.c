@@ -20,13 +20,16 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fsntfs_test_functions.h"
 #include "fsntfs_test_libbfio.h"
 #include "fsntfs_test_libcerror.h"
 #include "fsntfs_test_libfsntfs.h"
@@ -36,8 +39,49 @@
 
 #include "../libfsntfs/libfsntfs_directory_entry.h"
 #include "../libfsntfs/libfsntfs_io_handle.h"
+#include "../libfsntfs/libfsntfs_mft_attribute.h"
 #include "../libfsntfs/libfsntfs_usn_change_journal.h"
 
+#define FSNTFS_TEST_USN_CHANGE_JOURNAL_DATA_SIZE	16384
+
+/* The $J data attribute with a sparse first cluster followed by 3 clusters at LCN 1
+ */
+uint8_t fsntfs_test_usn_change_journal_data_attribute_data[ 80 ] = {
+	0x80, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x02, 0x40, 0x00, 0x00, 0x80, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x03, 0x01, 0x00, 0x00, 0x00 };
+
+/* A version 2 USN record with the name "ab"
+ */
+uint8_t fsntfs_test_usn_change_journal_usn_record_v2_data[ 64 ] = {
+	0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xd0, 0x5b, 0x7f, 0x0e, 0x2f, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x61, 0x00, 0x62, 0x00 };
+
+/* A version 3 USN record with the name "ab"
+ */
+uint8_t fsntfs_test_usn_change_journal_usn_record_v3_data[ 80 ] = {
+	0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xd0, 0x5b, 0x7f, 0x0e, 0x2f, 0xd9, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x61, 0x00, 0x62, 0x00 };
+
+/* The resident $Max data attribute
+ */
+uint8_t fsntfs_test_usn_change_journal_max_attribute_data[ 64 ] = {
+	0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x4d, 0x00, 0x61, 0x00, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xd0, 0x5b, 0x7f, 0x0e, 0x2f, 0xd9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The $J data stream, which is also used as the volume data since the clusters
+ * of the $J data stream are stored at the corresponding volume offsets
+ */
+uint8_t fsntfs_test_usn_change_journal_data[ FSNTFS_TEST_USN_CHANGE_JOURNAL_DATA_SIZE ];
 
 /* TODO implement */
 #ifdef TODO
@@ -369,44 +413,3379 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+/* Writes an USN record into the $J data stream at the journal offset
+ * The update sequence number of the record is set to the journal offset
+ */
+void fsntfs_test_usn_change_journal_write_usn_record(
+      const uint8_t *usn_record_data,
+      size_t usn_record_data_size,
+      size_t update_sequence_number_offset,
+      size_t journal_offset )
+{
+	memory_copy(
+	 &( fsntfs_test_usn_change_journal_data[ journal_offset ] ),
+	 usn_record_data,
+	 usn_record_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fsntfs_test_usn_change_journal_data[ journal_offset + update_sequence_number_offset ] ),
+	 (uint64_t) journal_offset );
+}
 
-/* The main program
+/* Writes the USN records into the $J data stream
+ * The first journal block is sparse, the second contains 3 version 2 records and
+ * a version 3 record, the third contains 2 version 2 records followed by an
+ * unsupported record and the fourth contains 2 version 2 records
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
-#endif
+void fsntfs_test_usn_change_journal_write_usn_records(
+      void )
 {
-	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
-	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x00001000 );
+
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x00001040 );
+
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v3_data,
+	 80,
+	 40,
+	 0x00001080 );
+
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x000010d0 );
+
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x00002000 );
+
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x00002040 );
+
+	/* The unsupported record has major version 9
+	 */
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x00002080 );
+
+	fsntfs_test_usn_change_journal_data[ 0x00002080 + 4 ] = 9;
+
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x000020c0 );
+
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x00003000 );
+
+	fsntfs_test_usn_change_journal_write_usn_record(
+	 fsntfs_test_usn_change_journal_usn_record_v2_data,
+	 64,
+	 24,
+	 0x00003040 );
+}
 
-#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+/* Tests the libfsntfs_usn_change_journal_get_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_get_offset(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	off64_t offset                                                       = 0;
+	int result                                                           = 0;
 
-	/* TODO: add tests for libfsntfs_usn_change_journal_initialize */
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          internal_usn_change_journal,
+	          0x00001040,
+	          &error );
 
-	FSNTFS_TEST_RUN(
-	 "libfsntfs_usn_change_journal_free",
-	 fsntfs_test_usn_change_journal_free );
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_change_journal_get_offset(
+	          usn_change_journal,
+	          &offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libfsntfs_usn_change_journal_get_offset */
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libfsntfs_usn_change_journal_read_usn_record */
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0x00001040 );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_change_journal_get_offset(
+	          NULL,
+	          &offset,
+	          &error );
 
-	return( EXIT_SUCCESS );
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_get_offset(
+	          usn_change_journal,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
 
 on_error:
-	return( EXIT_FAILURE );
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_get_next_usn function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_get_next_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error             = NULL;
+	uint64_t next_update_sequence_number = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_change_journal_get_next_usn(
+	          usn_change_journal,
+	          &next_update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "next_update_sequence_number",
+	 next_update_sequence_number,
+	 (uint64_t) FSNTFS_TEST_USN_CHANGE_JOURNAL_DATA_SIZE );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_change_journal_get_next_usn(
+	          NULL,
+	          &next_update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_get_next_usn(
+	          usn_change_journal,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_get_journal_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_get_journal_identifier(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error    = NULL;
+	uint64_t journal_identifier = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_change_journal_get_journal_identifier(
+	          usn_change_journal,
+	          &journal_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_change_journal_get_journal_identifier(
+	          NULL,
+	          &journal_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_get_journal_identifier(
+	          usn_change_journal,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
 }
 
+/* Tests the libfsntfs_usn_change_journal_read_usn_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_read_usn_record(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	uint8_t usn_record_data[ 128 ];
+
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	uint64_t update_sequence_number                                      = 0;
+	ssize_t read_count                                                   = 0;
+	int result                                                           = 0;
+
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          internal_usn_change_journal,
+	          0x00001000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_record(
+	              usn_change_journal,
+	              usn_record_data,
+	              128,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( usn_record_data[ 24 ] ),
+	 update_sequence_number );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x00001000 );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_record(
+	              usn_change_journal,
+	              usn_record_data,
+	              128,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( usn_record_data[ 24 ] ),
+	 update_sequence_number );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x00001040 );
+
+	/* Test error cases
+	 */
+	read_count = libfsntfs_usn_change_journal_read_usn_record(
+	              NULL,
+	              usn_record_data,
+	              128,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_record(
+	              usn_change_journal,
+	              NULL,
+	              128,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          internal_usn_change_journal,
+	          0x00001000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_record(
+	              usn_change_journal,
+	              usn_record_data,
+	              32,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_internal_usn_change_journal_read_max_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_read_max_data(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error    = NULL;
+	uint64_t journal_identifier = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_max_data(
+	          (libfsntfs_internal_usn_change_journal_t *) usn_change_journal,
+	          &( fsntfs_test_usn_change_journal_max_attribute_data[ 32 ] ),
+	          32,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_change_journal_get_journal_identifier(
+	          usn_change_journal,
+	          &journal_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "journal_identifier",
+	 journal_identifier,
+	 (uint64_t) 0x01d92f0e7f5bd000UL );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_max_data(
+	          NULL,
+	          &( fsntfs_test_usn_change_journal_max_attribute_data[ 32 ] ),
+	          32,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_max_data(
+	          (libfsntfs_internal_usn_change_journal_t *) usn_change_journal,
+	          NULL,
+	          32,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_max_data(
+	          (libfsntfs_internal_usn_change_journal_t *) usn_change_journal,
+	          &( fsntfs_test_usn_change_journal_max_attribute_data[ 32 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_max_data(
+	          (libfsntfs_internal_usn_change_journal_t *) usn_change_journal,
+	          &( fsntfs_test_usn_change_journal_max_attribute_data[ 32 ] ),
+	          16,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_internal_usn_change_journal_read_max_attribute function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_read_max_attribute(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error                 = NULL;
+	libfsntfs_io_handle_t *io_handle         = NULL;
+	libfsntfs_mft_attribute_t *mft_attribute = NULL;
+	uint64_t journal_identifier              = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->cluster_block_size = 4096;
+
+	result = libfsntfs_mft_attribute_initialize(
+	          &mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mft_attribute",
+	 mft_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_read_data(
+	          mft_attribute,
+	          io_handle,
+	          fsntfs_test_usn_change_journal_max_attribute_data,
+	          64,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_max_attribute(
+	          (libfsntfs_internal_usn_change_journal_t *) usn_change_journal,
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_change_journal_get_journal_identifier(
+	          usn_change_journal,
+	          &journal_identifier,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "journal_identifier",
+	 journal_identifier,
+	 (uint64_t) 0x01d92f0e7f5bd000UL );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_max_attribute(
+	          NULL,
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_max_attribute(
+	          (libfsntfs_internal_usn_change_journal_t *) usn_change_journal,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_mft_attribute_free(
+	          &mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "mft_attribute",
+	 mft_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a non-resident data attribute
+	 */
+	result = libfsntfs_mft_attribute_initialize(
+	          &mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mft_attribute",
+	 mft_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_read_data(
+	          mft_attribute,
+	          io_handle,
+	          fsntfs_test_usn_change_journal_data_attribute_data,
+	          80,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_internal_usn_change_journal_read_max_attribute(
+	          (libfsntfs_internal_usn_change_journal_t *) usn_change_journal,
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_mft_attribute_free(
+	          &mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "mft_attribute",
+	 mft_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mft_attribute != NULL )
+	{
+		libfsntfs_mft_attribute_free(
+		 &mft_attribute,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_get_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_get_number_of_threads(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_change_journal_get_number_of_threads(
+	          usn_change_journal,
+	          &number_of_threads,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_change_journal_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_get_number_of_threads(
+	          usn_change_journal,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_set_number_of_threads(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_change_journal_set_number_of_threads(
+	          usn_change_journal,
+	          LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_change_journal_get_number_of_threads(
+	          usn_change_journal,
+	          &number_of_threads,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS );
+
+	result = libfsntfs_usn_change_journal_set_number_of_threads(
+	          usn_change_journal,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_change_journal_set_number_of_threads(
+	          NULL,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_set_number_of_threads(
+	          usn_change_journal,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_set_number_of_threads(
+	          usn_change_journal,
+	          LIBFSNTFS_USN_CHANGE_JOURNAL_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_get_number_of_threads(
+	          usn_change_journal,
+	          &number_of_threads,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_internal_usn_change_journal_parse_read_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_parse_read_block(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	int result                                                           = 0;
+
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_block(
+	          internal_usn_change_journal,
+	          0x00001000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_block_offset",
+	 (int64_t) internal_usn_change_journal->read_block_offset,
+	 (int64_t) 0x00001000 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "read_block_data_size",
+	 internal_usn_change_journal->read_block_data_size,
+	 (size_t) 0x00003000 );
+
+	internal_usn_change_journal->read_offset       = 0x00001000;
+	internal_usn_change_journal->number_of_threads = 1;
+
+	result = libfsntfs_internal_usn_change_journal_parse_read_block(
+	          internal_usn_change_journal,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The single parse range stops at the unsupported record in the second journal block
+	 * and contains the 3 version 2 records of the first and 2 of the second journal block
+	 */
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_parse_ranges",
+	 internal_usn_change_journal->number_of_parse_ranges,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_result",
+	 internal_usn_change_journal->parse_ranges[ 0 ].result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_number_of_records",
+	 internal_usn_change_journal->parse_ranges[ 0 ].number_of_records,
+	 5 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_range_unsupported_record_offset",
+	 internal_usn_change_journal->parse_ranges[ 0 ].unsupported_record_offset,
+	 (size_t) 0x00001080 );
+
+	internal_usn_change_journal->number_of_threads = 3;
+
+	result = libfsntfs_internal_usn_change_journal_parse_read_block(
+	          internal_usn_change_journal,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_LIBFSNTFS_MULTI_THREAD_SUPPORT )
+	/* Every journal block is parsed in a separate parse range
+	 */
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_parse_ranges",
+	 internal_usn_change_journal->number_of_parse_ranges,
+	 3 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_result",
+	 internal_usn_change_journal->parse_ranges[ 0 ].result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_number_of_records",
+	 internal_usn_change_journal->parse_ranges[ 0 ].number_of_records,
+	 3 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_result",
+	 internal_usn_change_journal->parse_ranges[ 1 ].result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_number_of_records",
+	 internal_usn_change_journal->parse_ranges[ 1 ].number_of_records,
+	 2 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_range_unsupported_record_offset",
+	 internal_usn_change_journal->parse_ranges[ 1 ].unsupported_record_offset,
+	 (size_t) 0x00001080 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_result",
+	 internal_usn_change_journal->parse_ranges[ 2 ].result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_number_of_records",
+	 internal_usn_change_journal->parse_ranges[ 2 ].number_of_records,
+	 2 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range_first_record_index",
+	 internal_usn_change_journal->parse_ranges[ 2 ].first_record_index,
+	 0x00002000 / LIBFSNTFS_USN_CHANGE_JOURNAL_MINIMUM_RECORD_SIZE );
+
+#else
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_parse_ranges",
+	 internal_usn_change_journal->number_of_parse_ranges,
+	 1 );
+
+#endif
+	internal_usn_change_journal->number_of_threads = 1;
+
+	/* Test that the range before the data is sparse
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_block(
+	          internal_usn_change_journal,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_parse_read_block(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_usn_change_journal->read_offset = 0x00004000;
+
+	result = libfsntfs_internal_usn_change_journal_parse_read_block(
+	          internal_usn_change_journal,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_usn_change_journal->read_offset            = 0;
+	internal_usn_change_journal->number_of_parse_ranges = 0;
+
+	result = libfsntfs_internal_usn_change_journal_read_block(
+	          NULL,
+	          0x00001000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_block(
+	          internal_usn_change_journal,
+	          -1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_internal_usn_change_journal_parse_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_parse_range(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libfsntfs_usn_change_journal_parse_range_t parse_range;
+
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	int result                                                           = 0;
+
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_block(
+	          internal_usn_change_journal,
+	          0x00001000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_usn_change_journal->read_offset = 0x00001000;
+
+	result = libfsntfs_internal_usn_change_journal_parse_read_block(
+	          internal_usn_change_journal,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* The version 3 record at journal offset 0x00001080 is skipped
+	 */
+	parse_range.internal_usn_change_journal = internal_usn_change_journal;
+	parse_range.start_offset                = 0;
+	parse_range.end_offset                  = 0x00001000;
+	parse_range.first_record_index          = 0;
+
+	result = libfsntfs_internal_usn_change_journal_parse_range(
+	          internal_usn_change_journal,
+	          &parse_range,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range.number_of_records",
+	 parse_range.number_of_records,
+	 3 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_offset",
+	 internal_usn_change_journal->record_offsets[ 0 ],
+	 (uint32_t) 0x00000000 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_offset",
+	 internal_usn_change_journal->record_offsets[ 1 ],
+	 (uint32_t) 0x00000040 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_offset",
+	 internal_usn_change_journal->record_offsets[ 2 ],
+	 (uint32_t) 0x000000d0 );
+
+	/* The range of the last journal block starts at its first record index
+	 */
+	parse_range.start_offset       = 0x00002000;
+	parse_range.end_offset         = 0x00003000;
+	parse_range.first_record_index = 0x00002000 / LIBFSNTFS_USN_CHANGE_JOURNAL_MINIMUM_RECORD_SIZE;
+
+	result = libfsntfs_internal_usn_change_journal_parse_range(
+	          internal_usn_change_journal,
+	          &parse_range,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range.number_of_records",
+	 parse_range.number_of_records,
+	 2 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "record_offset",
+	 internal_usn_change_journal->record_offsets[ parse_range.first_record_index + 1 ],
+	 (uint32_t) 0x00002040 );
+
+	/* Parsing stops at the unsupported record at journal offset 0x00002080
+	 */
+	parse_range.start_offset       = 0x00001000;
+	parse_range.end_offset         = 0x00002000;
+	parse_range.first_record_index = 0x00001000 / LIBFSNTFS_USN_CHANGE_JOURNAL_MINIMUM_RECORD_SIZE;
+
+	result = libfsntfs_internal_usn_change_journal_parse_range(
+	          internal_usn_change_journal,
+	          &parse_range,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "parse_range.number_of_records",
+	 parse_range.number_of_records,
+	 2 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "parse_range.unsupported_record_offset",
+	 parse_range.unsupported_record_offset,
+	 (size_t) 0x00001080 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_parse_range(
+	          NULL,
+	          &parse_range,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_parse_range(
+	          internal_usn_change_journal,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parse_range.first_record_index = 0;
+
+	result = libfsntfs_internal_usn_change_journal_parse_range(
+	          internal_usn_change_journal,
+	          &parse_range,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parse_range.start_offset       = 0x00002000;
+	parse_range.end_offset         = 0x00004000;
+	parse_range.first_record_index = 0x00002000 / LIBFSNTFS_USN_CHANGE_JOURNAL_MINIMUM_RECORD_SIZE;
+
+	result = libfsntfs_internal_usn_change_journal_parse_range(
+	          internal_usn_change_journal,
+	          &parse_range,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_read_usn_records function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_read_usn_records(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	uint8_t usn_records_data[ 512 ];
+
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	uint64_t update_sequence_number                                      = 0;
+	ssize_t read_count                                                   = 0;
+	int number_of_threads                                                = 0;
+	int number_of_usn_records                                            = 0;
+	int result                                                           = 0;
+
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads += 2 )
+	{
+		result = libfsntfs_usn_change_journal_set_number_of_threads(
+		          usn_change_journal,
+		          number_of_threads,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsntfs_internal_usn_change_journal_set_record_offset(
+		          internal_usn_change_journal,
+		          0,
+		          &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The sparse journal block is skipped and the records of the first 2 journal blocks
+		 * are returned before the unsupported record at journal offset 0x00002080
+		 */
+		read_count = libfsntfs_usn_change_journal_read_usn_records(
+		              usn_change_journal,
+		              usn_records_data,
+		              512,
+		              &number_of_usn_records,
+		              &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 320 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_usn_records",
+		 number_of_usn_records,
+		 5 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( usn_records_data[ 24 ] ),
+		 update_sequence_number );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "update_sequence_number",
+		 update_sequence_number,
+		 (uint64_t) 0x00001000 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( usn_records_data[ 128 + 24 ] ),
+		 update_sequence_number );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "update_sequence_number",
+		 update_sequence_number,
+		 (uint64_t) 0x000010d0 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( usn_records_data[ 256 + 24 ] ),
+		 update_sequence_number );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "update_sequence_number",
+		 update_sequence_number,
+		 (uint64_t) 0x00002040 );
+
+		/* The unsupported record is reported by the next call
+		 */
+		read_count = libfsntfs_usn_change_journal_read_usn_records(
+		              usn_change_journal,
+		              usn_records_data,
+		              512,
+		              &number_of_usn_records,
+		              &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Reading continues at the journal block after the unsupported record
+		 */
+		read_count = libfsntfs_usn_change_journal_read_usn_records(
+		              usn_change_journal,
+		              usn_records_data,
+		              512,
+		              &number_of_usn_records,
+		              &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 128 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_usn_records",
+		 number_of_usn_records,
+		 2 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( usn_records_data[ 24 ] ),
+		 update_sequence_number );
+
+		FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+		 "update_sequence_number",
+		 update_sequence_number,
+		 (uint64_t) 0x00003000 );
+
+		read_count = libfsntfs_usn_change_journal_read_usn_records(
+		              usn_change_journal,
+		              usn_records_data,
+		              512,
+		              &number_of_usn_records,
+		              &error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		FSNTFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSNTFS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_usn_records",
+		 number_of_usn_records,
+		 0 );
+	}
+	result = libfsntfs_usn_change_journal_set_number_of_threads(
+	          usn_change_journal,
+	          1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that only the records that fit are returned
+	 */
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          internal_usn_change_journal,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              usn_records_data,
+	              100,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_usn_records",
+	 number_of_usn_records,
+	 1 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( usn_records_data[ 24 ] ),
+	 update_sequence_number );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x00001000 );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              usn_records_data,
+	              100,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( usn_records_data[ 24 ] ),
+	 update_sequence_number );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x00001040 );
+
+	/* The version 3 record at journal offset 0x00001080 is skipped
+	 */
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              usn_records_data,
+	              100,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 64 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( usn_records_data[ 24 ] ),
+	 update_sequence_number );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x000010d0 );
+
+	/* Test error cases
+	 */
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              NULL,
+	              usn_records_data,
+	              512,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              NULL,
+	              512,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              usn_records_data,
+	              (size_t) SSIZE_MAX + 1,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              usn_records_data,
+	              512,
+	              NULL,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with USN records data too small for a single record
+	 */
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              usn_records_data,
+	              32,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_internal_usn_change_journal_read_journal_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_read_journal_block(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	uint8_t journal_block_data[ 4096 ];
+
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	int result                                                           = 0;
+
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          0x00001000,
+	          journal_block_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          journal_block_data,
+	          &( fsntfs_test_usn_change_journal_data[ 0x00001000 ] ),
+	          4096 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a sparse journal block
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          0,
+	          journal_block_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a journal block beyond the data
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          0x00004000,
+	          journal_block_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          NULL,
+	          0x00001000,
+	          journal_block_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          -1,
+	          journal_block_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          0x00001040,
+	          journal_block_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          0x00001000,
+	          NULL,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          0x00001000,
+	          journal_block_data,
+	          2048,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_get_journal_block_record_by_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	uint8_t journal_block_data[ 4096 ];
+
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	size_t record_offset                                                 = 0;
+	uint64_t update_sequence_number                                      = 0;
+	int result                                                           = 0;
+
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          0x00001000,
+	          journal_block_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          internal_usn_change_journal,
+	          journal_block_data,
+	          4096,
+	          0,
+	          &record_offset,
+	          &update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "record_offset",
+	 record_offset,
+	 (size_t) 0x00000000 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x00001000 );
+
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          internal_usn_change_journal,
+	          journal_block_data,
+	          4096,
+	          0x00001040,
+	          &record_offset,
+	          &update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "record_offset",
+	 record_offset,
+	 (size_t) 0x00000040 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x00001040 );
+
+	/* The version 3 record at journal offset 0x00001080 is skipped
+	 */
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          internal_usn_change_journal,
+	          journal_block_data,
+	          4096,
+	          0x00001041,
+	          &record_offset,
+	          &update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "record_offset",
+	 record_offset,
+	 (size_t) 0x000000d0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x000010d0 );
+
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          internal_usn_change_journal,
+	          journal_block_data,
+	          4096,
+	          0x000010d1,
+	          &record_offset,
+	          &update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the search stops at the unsupported record
+	 */
+	result = libfsntfs_internal_usn_change_journal_read_journal_block(
+	          internal_usn_change_journal,
+	          0x00002000,
+	          journal_block_data,
+	          4096,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          internal_usn_change_journal,
+	          journal_block_data,
+	          4096,
+	          0x00002041,
+	          &record_offset,
+	          &update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          NULL,
+	          journal_block_data,
+	          4096,
+	          0,
+	          &record_offset,
+	          &update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          internal_usn_change_journal,
+	          NULL,
+	          4096,
+	          0,
+	          &record_offset,
+	          &update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          internal_usn_change_journal,
+	          journal_block_data,
+	          4096,
+	          0,
+	          NULL,
+	          &update_sequence_number,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn(
+	          internal_usn_change_journal,
+	          journal_block_data,
+	          4096,
+	          0,
+	          &record_offset,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_internal_usn_change_journal_set_record_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_set_record_offset(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	int result                                                           = 0;
+
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          internal_usn_change_journal,
+	          0x00001040,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_offset",
+	 (int64_t) internal_usn_change_journal->read_offset,
+	 (int64_t) 0x00001040 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 internal_usn_change_journal->extent_index,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SIZE(
+	 "journal_block_offset",
+	 internal_usn_change_journal->journal_block_offset,
+	 (size_t) 0x00000040 );
+
+	/* Test the end of the data
+	 */
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          internal_usn_change_journal,
+	          0x00004000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 internal_usn_change_journal->extent_index,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          NULL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          internal_usn_change_journal,
+	          -1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_set_record_offset(
+	          internal_usn_change_journal,
+	          0x00004001,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_internal_usn_change_journal_get_record_offset_by_usn function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_get_record_offset_by_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	uint8_t journal_block_data[ 4096 ];
+
+	libcerror_error_t *error                                             = NULL;
+	libfsntfs_internal_usn_change_journal_t *internal_usn_change_journal = NULL;
+	off64_t record_journal_offset                                        = 0;
+	int result                                                           = 0;
+
+	internal_usn_change_journal = (libfsntfs_internal_usn_change_journal_t *) usn_change_journal;
+
+	/* Test regular cases
+	 */
+	/* Test an update sequence number before the journal
+	 */
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          0,
+	          journal_block_data,
+	          4096,
+	          &record_journal_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "record_journal_offset",
+	 record_journal_offset,
+	 (int64_t) 0x00001000 );
+
+	/* Test an update sequence number of a record
+	 */
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          0x00001040,
+	          journal_block_data,
+	          4096,
+	          &record_journal_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "record_journal_offset",
+	 record_journal_offset,
+	 (int64_t) 0x00001040 );
+
+	/* Test an update sequence number inside the journal that is not of a record
+	 */
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          0x00001048,
+	          journal_block_data,
+	          4096,
+	          &record_journal_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "record_journal_offset",
+	 record_journal_offset,
+	 (int64_t) 0x000010d0 );
+
+	/* Test an update sequence number of a record after the unsupported record, which is
+	 * not found since a journal block is not parsed beyond an unsupported record
+	 */
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          0x000020c0,
+	          journal_block_data,
+	          4096,
+	          &record_journal_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "record_journal_offset",
+	 record_journal_offset,
+	 (int64_t) 0x00003000 );
+
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          0x00003040,
+	          journal_block_data,
+	          4096,
+	          &record_journal_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "record_journal_offset",
+	 record_journal_offset,
+	 (int64_t) 0x00003040 );
+
+	/* Test an update sequence number after the journal
+	 */
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          0x00003048,
+	          journal_block_data,
+	          4096,
+	          &record_journal_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          0x00010000,
+	          journal_block_data,
+	          4096,
+	          &record_journal_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          NULL,
+	          0,
+	          journal_block_data,
+	          4096,
+	          &record_journal_offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_internal_usn_change_journal_get_record_offset_by_usn(
+	          internal_usn_change_journal,
+	          0,
+	          journal_block_data,
+	          4096,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_change_journal_seek_usn function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_change_journal_seek_usn(
+     libfsntfs_usn_change_journal_t *usn_change_journal )
+{
+	uint8_t usn_records_data[ 512 ];
+
+	libcerror_error_t *error        = NULL;
+	off64_t offset                  = 0;
+	uint64_t update_sequence_number = 0;
+	ssize_t read_count              = 0;
+	int number_of_usn_records       = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	/* Test seeking an update sequence number before the journal
+	 */
+	result = libfsntfs_usn_change_journal_seek_usn(
+	          usn_change_journal,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_change_journal_get_offset(
+	          usn_change_journal,
+	          &offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0x00001000 );
+
+	/* Test seeking an update sequence number inside the journal that is not of a record
+	 */
+	result = libfsntfs_usn_change_journal_seek_usn(
+	          usn_change_journal,
+	          0x00001048,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_change_journal_get_offset(
+	          usn_change_journal,
+	          &offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0x000010d0 );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              usn_records_data,
+	              512,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 192 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_usn_records",
+	 number_of_usn_records,
+	 3 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( usn_records_data[ 24 ] ),
+	 update_sequence_number );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "update_sequence_number",
+	 update_sequence_number,
+	 (uint64_t) 0x000010d0 );
+
+	/* Test seeking an update sequence number after the journal
+	 */
+	result = libfsntfs_usn_change_journal_seek_usn(
+	          usn_change_journal,
+	          0x00010000,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_change_journal_get_offset(
+	          usn_change_journal,
+	          &offset,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0x00004000 );
+
+	read_count = libfsntfs_usn_change_journal_read_usn_records(
+	              usn_change_journal,
+	              usn_records_data,
+	              512,
+	              &number_of_usn_records,
+	              &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_change_journal_seek_usn(
+	          NULL,
+	          0,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_change_journal_seek_usn(
+	          usn_change_journal,
+	          (uint64_t) INT64_MAX + 1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle                   = NULL;
+	libcerror_error_t *error                           = NULL;
+	libfsntfs_directory_entry_t *directory_entry       = NULL;
+	libfsntfs_io_handle_t *io_handle                   = NULL;
+	libfsntfs_mft_attribute_t *mft_attribute           = NULL;
+	libfsntfs_usn_change_journal_t *usn_change_journal = NULL;
+	int result                                         = 0;
+#endif
+
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	/* TODO: add tests for libfsntfs_usn_change_journal_initialize */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_change_journal_free",
+	 fsntfs_test_usn_change_journal_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize USN change journal for tests
+	 */
+	fsntfs_test_usn_change_journal_write_usn_records();
+
+	result = libfsntfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->cluster_block_size = 4096;
+
+	result = libfsntfs_mft_attribute_initialize(
+	          &mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mft_attribute",
+	 mft_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_read_data(
+	          mft_attribute,
+	          io_handle,
+	          fsntfs_test_usn_change_journal_data_attribute_data,
+	          80,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsntfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsntfs_test_usn_change_journal_data,
+	          FSNTFS_TEST_USN_CHANGE_JOURNAL_DATA_SIZE,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_directory_entry_initialize(
+	          &directory_entry,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_entry",
+	 directory_entry );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_change_journal_initialize(
+	          &usn_change_journal,
+	          io_handle,
+	          file_io_handle,
+	          directory_entry,
+	          mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_change_journal",
+	 usn_change_journal );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The USN change journal takes over management of the directory entry
+	 */
+	directory_entry = NULL;
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_usn_change_journal_get_offset",
+	 fsntfs_test_usn_change_journal_get_offset,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_usn_change_journal_get_next_usn",
+	 fsntfs_test_usn_change_journal_get_next_usn,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_usn_change_journal_get_journal_identifier",
+	 fsntfs_test_usn_change_journal_get_journal_identifier,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_internal_usn_change_journal_read_max_data",
+	 fsntfs_test_usn_change_journal_read_max_data,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_internal_usn_change_journal_read_max_attribute",
+	 fsntfs_test_usn_change_journal_read_max_attribute,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_usn_change_journal_read_usn_record",
+	 fsntfs_test_usn_change_journal_read_usn_record,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_usn_change_journal_get_number_of_threads",
+	 fsntfs_test_usn_change_journal_get_number_of_threads,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_usn_change_journal_set_number_of_threads",
+	 fsntfs_test_usn_change_journal_set_number_of_threads,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_internal_usn_change_journal_parse_range",
+	 fsntfs_test_usn_change_journal_parse_range,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_internal_usn_change_journal_parse_read_block",
+	 fsntfs_test_usn_change_journal_parse_read_block,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_usn_change_journal_read_usn_records",
+	 fsntfs_test_usn_change_journal_read_usn_records,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_internal_usn_change_journal_read_journal_block",
+	 fsntfs_test_usn_change_journal_read_journal_block,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_internal_usn_change_journal_get_journal_block_record_by_usn",
+	 fsntfs_test_usn_change_journal_get_journal_block_record_by_usn,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_internal_usn_change_journal_set_record_offset",
+	 fsntfs_test_usn_change_journal_set_record_offset,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_internal_usn_change_journal_get_record_offset_by_usn",
+	 fsntfs_test_usn_change_journal_get_record_offset_by_usn,
+	 usn_change_journal );
+
+	FSNTFS_TEST_RUN_WITH_ARGS(
+	 "libfsntfs_usn_change_journal_seek_usn",
+	 fsntfs_test_usn_change_journal_seek_usn,
+	 usn_change_journal );
+
+	/* Clean up
+	 */
+	result = libfsntfs_usn_change_journal_free(
+	          &usn_change_journal,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "usn_change_journal",
+	 usn_change_journal );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsntfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_mft_attribute_free(
+	          &mft_attribute,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "mft_attribute",
+	 mft_attribute );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_change_journal != NULL )
+	{
+		libfsntfs_usn_change_journal_free(
+		 &usn_change_journal,
+		 NULL );
+	}
+	if( directory_entry != NULL )
+	{
+		libfsntfs_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( mft_attribute != NULL )
+	{
+		libfsntfs_mft_attribute_free(
+		 &mft_attribute,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsntfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,530 @@
+/*
+ * Library usn_record_values type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsntfs_test_libcerror.h"
+#include "fsntfs_test_libfsntfs.h"
+#include "fsntfs_test_macros.h"
+#include "fsntfs_test_memory.h"
+#include "fsntfs_test_unused.h"
+
+#include "../libfsntfs/libfsntfs_usn_record_values.h"
+
+uint8_t fsntfs_test_usn_record_values_data1[ 88 ] = {
+	0x58, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x3e, 0x5d, 0x6d, 0x2b, 0x9c, 0xd7, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18, 0x00, 0x3c, 0x00, 0x74, 0x00, 0x65, 0x00,
+	0x73, 0x00, 0x74, 0x00, 0x66, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x74, 0x00,
+	0x78, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+/* Tests the libfsntfs_usn_record_values_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_record_values_initialize(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsntfs_usn_record_values_t *usn_record_values = NULL;
+	int result                                       = 0;
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                  = 1;
+	int number_of_memset_fail_tests                  = 1;
+	int test_number                                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_record_values_initialize(
+	          &usn_record_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_record_values",
+	 usn_record_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_usn_record_values_free(
+	          &usn_record_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "usn_record_values",
+	 usn_record_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_record_values_initialize(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	usn_record_values = (libfsntfs_usn_record_values_t *) 0x12345678UL;
+
+	result = libfsntfs_usn_record_values_initialize(
+	          &usn_record_values,
+	          &error );
+
+	usn_record_values = NULL;
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSNTFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_usn_record_values_initialize with malloc failing
+		 */
+		fsntfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsntfs_usn_record_values_initialize(
+		          &usn_record_values,
+		          &error );
+
+		if( fsntfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsntfs_test_malloc_attempts_before_fail = -1;
+
+			if( usn_record_values != NULL )
+			{
+				libfsntfs_usn_record_values_free(
+				 &usn_record_values,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "usn_record_values",
+			 usn_record_values );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsntfs_usn_record_values_initialize with memset failing
+		 */
+		fsntfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsntfs_usn_record_values_initialize(
+		          &usn_record_values,
+		          &error );
+
+		if( fsntfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsntfs_test_memset_attempts_before_fail = -1;
+
+			if( usn_record_values != NULL )
+			{
+				libfsntfs_usn_record_values_free(
+				 &usn_record_values,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSNTFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSNTFS_TEST_ASSERT_IS_NULL(
+			 "usn_record_values",
+			 usn_record_values );
+
+			FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSNTFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_record_values != NULL )
+	{
+		libfsntfs_usn_record_values_free(
+		 &usn_record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_record_values_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_record_values_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_record_values_free(
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_usn_record_values_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_usn_record_values_read_data(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsntfs_usn_record_values_t *usn_record_values = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsntfs_usn_record_values_initialize(
+	          &usn_record_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "usn_record_values",
+	 usn_record_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_usn_record_values_read_data(
+	          usn_record_values,
+	          fsntfs_test_usn_record_values_data1,
+	          88,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "usn_record_values->record_size",
+	 usn_record_values->record_size,
+	 88 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "usn_record_values->file_reference",
+	 usn_record_values->file_reference,
+	 (uint64_t) 0x000300000000002aUL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "usn_record_values->parent_file_reference",
+	 usn_record_values->parent_file_reference,
+	 (uint64_t) 0x0005000000000005UL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "usn_record_values->update_sequence_number",
+	 usn_record_values->update_sequence_number,
+	 (uint64_t) 4096 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT32(
+	 "usn_record_values->update_reason_flags",
+	 usn_record_values->update_reason_flags,
+	 0x00000100UL );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT16(
+	 "usn_record_values->name_offset",
+	 usn_record_values->name_offset,
+	 60 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT16(
+	 "usn_record_values->name_size",
+	 usn_record_values->name_size,
+	 24 );
+
+	/* Test data too small for the record header
+	 */
+	result = libfsntfs_usn_record_values_read_data(
+	          usn_record_values,
+	          fsntfs_test_usn_record_values_data1,
+	          59,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data too small for the record
+	 */
+	result = libfsntfs_usn_record_values_read_data(
+	          usn_record_values,
+	          fsntfs_test_usn_record_values_data1,
+	          80,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_usn_record_values_read_data(
+	          NULL,
+	          fsntfs_test_usn_record_values_data1,
+	          88,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_record_values_read_data(
+	          usn_record_values,
+	          NULL,
+	          88,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_usn_record_values_read_data(
+	          usn_record_values,
+	          fsntfs_test_usn_record_values_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsntfs_usn_record_values_free(
+	          &usn_record_values,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "usn_record_values",
+	 usn_record_values );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( usn_record_values != NULL )
+	{
+		libfsntfs_usn_record_values_free(
+		 &usn_record_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSNTFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSNTFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSNTFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_record_values_initialize",
+	 fsntfs_test_usn_record_values_initialize );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_record_values_free",
+	 fsntfs_test_usn_record_values_free );
+
+	FSNTFS_TEST_RUN(
+	 "libfsntfs_usn_record_values_read_data",
+	 fsntfs_test_usn_record_values_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSNTFS_DLL_IMPORT ) */
+}
+
@@ -2942,6 +2942,489 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsntfs_volume_get_file_reference_by_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_file_reference_by_utf8_path(
+     libfsntfs_volume_t *volume )
+{
+	uint8_t utf8_path1[ 6 ]  = { '\\', '$', 'M', 'F', 'T', 0 };
+	uint8_t utf8_path2[ 6 ]  = { '\\', '$', 'B', 'o', 'g', 0 };
+	libcerror_error_t *error = NULL;
+	uint64_t file_reference  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_file_reference_by_utf8_path(
+	          volume,
+	          utf8_path1,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference & 0xffffffffffffUL",
+	 (uint64_t) ( file_reference & 0xffffffffffffUL ),
+	 (uint64_t) 0 );
+
+	/* Test a path that does not exist, twice to test the cached negative lookup
+	 */
+	result = libfsntfs_volume_get_file_reference_by_utf8_path(
+	          volume,
+	          utf8_path2,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_volume_get_file_reference_by_utf8_path(
+	          volume,
+	          utf8_path2,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_file_reference_by_utf8_path(
+	          NULL,
+	          utf8_path1,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_reference_by_utf8_path(
+	          volume,
+	          NULL,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_reference_by_utf8_path(
+	          volume,
+	          utf8_path1,
+	          5,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_file_reference_by_utf16_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_file_reference_by_utf16_path(
+     libfsntfs_volume_t *volume )
+{
+	uint16_t utf16_path1[ 6 ] = { '\\', '$', 'M', 'F', 'T', 0 };
+	uint16_t utf16_path2[ 6 ] = { '\\', '$', 'B', 'o', 'g', 0 };
+	libcerror_error_t *error  = NULL;
+	uint64_t file_reference   = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_file_reference_by_utf16_path(
+	          volume,
+	          utf16_path1,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference & 0xffffffffffffUL",
+	 (uint64_t) ( file_reference & 0xffffffffffffUL ),
+	 (uint64_t) 0 );
+
+	/* Test a path that does not exist, twice to test the cached negative lookup
+	 */
+	result = libfsntfs_volume_get_file_reference_by_utf16_path(
+	          volume,
+	          utf16_path2,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsntfs_volume_get_file_reference_by_utf16_path(
+	          volume,
+	          utf16_path2,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_file_reference_by_utf16_path(
+	          NULL,
+	          utf16_path1,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_reference_by_utf16_path(
+	          volume,
+	          NULL,
+	          5,
+	          &file_reference,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_reference_by_utf16_path(
+	          volume,
+	          utf16_path1,
+	          5,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsntfs_volume_get_file_references_by_utf8_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int fsntfs_test_volume_get_file_references_by_utf8_paths(
+     libfsntfs_volume_t *volume )
+{
+	uint8_t utf8_path1[ 6 ]  = { '\\', '$', 'M', 'F', 'T', 0 };
+	uint8_t utf8_path2[ 6 ]  = { '\\', '$', 'B', 'a', 'd', 0 };
+	uint8_t utf8_path3[ 2 ]  = { '\\', 0 };
+	const uint8_t *utf8_strings[ 3 ];
+	size_t utf8_string_lengths[ 3 ];
+	uint64_t file_references[ 3 ];
+	int results[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	utf8_strings[ 0 ]        = utf8_path1;
+	utf8_string_lengths[ 0 ] = 5;
+	utf8_strings[ 1 ]        = utf8_path2;
+	utf8_string_lengths[ 1 ] = 5;
+	utf8_strings[ 2 ]        = utf8_path3;
+	utf8_string_lengths[ 2 ] = 1;
+
+	/* Test regular cases
+	 */
+	result = libfsntfs_volume_get_file_references_by_utf8_paths(
+	          volume,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          3,
+	          file_references,
+	          results,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "results[ 0 ]",
+	 results[ 0 ],
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_references[ 0 ] & 0xffffffffffffUL",
+	 (uint64_t) ( file_references[ 0 ] & 0xffffffffffffUL ),
+	 (uint64_t) 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "results[ 1 ]",
+	 results[ 1 ],
+	 0 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "results[ 2 ]",
+	 results[ 2 ],
+	 1 );
+
+	FSNTFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_references[ 2 ] & 0xffffffffffffUL",
+	 (uint64_t) ( file_references[ 2 ] & 0xffffffffffffUL ),
+	 (uint64_t) 5 );
+
+	result = libfsntfs_volume_get_file_references_by_utf8_paths(
+	          volume,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          0,
+	          file_references,
+	          results,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSNTFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsntfs_volume_get_file_references_by_utf8_paths(
+	          NULL,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          3,
+	          file_references,
+	          results,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_references_by_utf8_paths(
+	          volume,
+	          NULL,
+	          utf8_string_lengths,
+	          3,
+	          file_references,
+	          results,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_references_by_utf8_paths(
+	          volume,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          -1,
+	          file_references,
+	          results,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_references_by_utf8_paths(
+	          volume,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          3,
+	          NULL,
+	          results,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsntfs_volume_get_file_references_by_utf8_paths(
+	          volume,
+	          utf8_strings,
+	          utf8_string_lengths,
+	          3,
+	          file_references,
+	          NULL,
+	          &error );
+
+	FSNTFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSNTFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsntfs_volume_get_root_directory function
  * Returns 1 if successful or 0 if not
  */
@@ -3471,6 +3954,21 @@ int main(
 		 fsntfs_test_volume_get_file_entry_by_utf16_path,
 		 volume );
 
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_get_file_reference_by_utf8_path",
+		 fsntfs_test_volume_get_file_reference_by_utf8_path,
+		 volume );
+
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_get_file_reference_by_utf16_path",
+		 fsntfs_test_volume_get_file_reference_by_utf16_path,
+		 volume );
+
+		FSNTFS_TEST_RUN_WITH_ARGS(
+		 "libfsntfs_volume_get_file_references_by_utf8_paths",
+		 fsntfs_test_volume_get_file_references_by_utf8_paths,
+		 volume );
+
 		FSNTFS_TEST_RUN_WITH_ARGS(
 		 "libfsntfs_volume_get_root_directory",
 		 fsntfs_test_volume_get_root_directory,
@@ -22,6 +22,7 @@
 import argparse
 import os
 import sys
+import threading
 import unittest
 
 import pyfsntfs
@@ -520,7 +521,160 @@ class VolumeTypeTests(unittest.TestCase):
       fsntfs_volume.open_file_object(file_object)
 
       try:
-        _ = fsntfs_volume.get_usn_change_journal()
+        usn_change_journal = fsntfs_volume.get_usn_change_journal()
+        if usn_change_journal:
+          journal_identifier = usn_change_journal.get_journal_identifier()
+          if journal_identifier is not None:
+            self.assertNotEqual(journal_identifier, 0)
+
+      finally:
+        fsntfs_volume.close()
+
+  def test_export_mft_table(self):
+    """Tests the export_mft_table function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      try:
+        number_of_file_entries = fsntfs_volume.get_number_of_file_entries()
+
+        mft_table = fsntfs_volume.export_mft_table()
+        self.assertIsNotNone(mft_table)
+
+        file_references = memoryview(mft_table["file_reference"])
+        self.assertEqual(file_references.format, "Q")
+        self.assertEqual(len(file_references), number_of_file_entries)
+
+        name_offsets = memoryview(mft_table["name_offsets"])
+        self.assertEqual(len(name_offsets), number_of_file_entries + 1)
+
+        name_data = memoryview(mft_table["name_data"])
+        self.assertEqual(len(name_data), name_offsets[-1])
+
+        is_valid = memoryview(mft_table["is_valid"])
+        self.assertEqual(is_valid.format, "B")
+        self.assertEqual(len(is_valid), number_of_file_entries)
+
+        mft_table = fsntfs_volume.export_mft_table(fields=["size"])
+        self.assertEqual(sorted(mft_table.keys()), ["is_valid", "size"])
+
+        with self.assertRaises(ValueError):
+          fsntfs_volume.export_mft_table(fields=["bogus"])
+
+        with self.assertRaises(ValueError):
+          fsntfs_volume.export_mft_table(fields=[])
+
+      finally:
+        fsntfs_volume.close()
+
+  def test_refresh_mft_table(self):
+    """Tests the refresh_mft_table function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      try:
+        journal_identifier = None
+        next_usn = 0
+        usn_change_journal = fsntfs_volume.get_usn_change_journal()
+        if usn_change_journal:
+          journal_identifier = usn_change_journal.get_journal_identifier()
+          next_usn = usn_change_journal.get_next_usn()
+
+        mft_table = fsntfs_volume.export_mft_table()
+
+        refreshed_mft_table, refreshed_journal_identifier, refreshed_usn = (
+            fsntfs_volume.refresh_mft_table(
+                mft_table, journal_identifier, next_usn))
+        self.assertEqual(refreshed_journal_identifier, journal_identifier)
+        self.assertEqual(refreshed_usn, next_usn)
+        self.assertEqual(
+            sorted(refreshed_mft_table.keys()), sorted(mft_table.keys()))
+
+        for name, column in mft_table.items():
+          self.assertEqual(
+              memoryview(refreshed_mft_table[name]).tobytes(),
+              memoryview(column).tobytes())
+
+        # Refreshing from the start of the journal reads all file entries.
+        refreshed_mft_table, _, _ = fsntfs_volume.refresh_mft_table(
+            mft_table, journal_identifier, 0)
+        self.assertEqual(
+            memoryview(refreshed_mft_table["name_data"]).tobytes(),
+            memoryview(mft_table["name_data"]).tobytes())
+
+        # Refreshing with the identifier of another journal reads all file
+        # entries.
+        refreshed_mft_table, refreshed_journal_identifier, _ = (
+            fsntfs_volume.refresh_mft_table(
+                mft_table, (journal_identifier or 0) + 1, next_usn))
+        self.assertEqual(refreshed_journal_identifier, journal_identifier)
+        self.assertEqual(
+            memoryview(refreshed_mft_table["name_data"]).tobytes(),
+            memoryview(mft_table["name_data"]).tobytes())
+
+        mft_table = fsntfs_volume.export_mft_table(fields=["size"])
+        refreshed_mft_table, _, _ = fsntfs_volume.refresh_mft_table(
+            mft_table, journal_identifier, next_usn)
+        self.assertEqual(
+            sorted(refreshed_mft_table.keys()), ["is_valid", "size"])
+
+        with self.assertRaises(ValueError):
+          fsntfs_volume.refresh_mft_table({}, journal_identifier, next_usn)
+
+      finally:
+        fsntfs_volume.close()
+
+  def test_file_entries_concurrent_iteration(self):
+    """Tests iterating the file entries from multiple threads."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fsntfs_volume = pyfsntfs.volume()
+      fsntfs_volume.open_file_object(file_object)
+
+      try:
+        number_of_file_entries = fsntfs_volume.get_number_of_file_entries()
+
+        file_entries = iter(fsntfs_volume.file_entries)
+        file_references = []
+
+        def _ReadFileEntries():
+          for file_entry in file_entries:
+            file_references.append(file_entry.file_reference)
+
+        threads = [threading.Thread(target=_ReadFileEntries) for _ in range(4)]
+        for thread in threads:
+          thread.start()
+        for thread in threads:
+          thread.join()
+
+        self.assertEqual(len(file_references), number_of_file_entries)
+        self.assertEqual(
+            len(set(file_references)), number_of_file_entries)
 
       finally:
         fsntfs_volume.close()
@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "bodyfile digest_hash info_handle mount_path_string output path_string signal"
+$ToolsTests = "bodyfile digest_handle digest_memo digest_hash info_handle mount_path_string output output_buffer path_string signal"
 $OptionSets = "offset" -split " "
 
 . .\test_functions.ps1